@@ -4,11 +4,19 @@
 #include "ProgramOptions.h"
 
 #include "../Lib/PoGoCmp.h"
+#include "../Lib/Appraisal.h"
+#include "../Lib/Database.h"
+#include "../Lib/IvSpace.h"
+#include "../Lib/PowerUp.h"
+#include "../Lib/PvpRank.h"
+#include "../Lib/RaidCp.h"
+#include "../Lib/Query.h"
 #include "../Lib/PoGoDb.h"
 #include "../Lib/MathUtils.h"
 
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <algorithm>
 #include <sstream>
@@ -17,9 +25,9 @@
 #include <cmath>
 #include <climits>
 #include <cassert>
+#include <numeric>
 
 #include <range/v3/algorithm/sort.hpp>
-#include <range/v3/algorithm/transform.hpp>
 
 const Utf8::String fullInfoFormat{
     "%na (%nu)\\n"
@@ -63,19 +71,30 @@ void Log(const std::wstring& msg)
     Utf8::PrintLine(Utf8::FromWString(msg), Utf8::OutputStream::Out);
 }
 
+using PropertyFunc = PoGoCmp::SpecieProperty;
+
+//! Resolves the criteria once so that the property can be read without string compares.
+//! returns null if unknown criteria given
+PropertyFunc PropertyByName(const std::string& prop)
+{
+    using PoGoCmp::PokemonSpecie;
+    if (prop.empty() || prop == "number") { return [](const PokemonSpecie& pkm) -> float { return pkm.number; }; }
+    else if (prop ==  "atk" || prop == "attack") { return [](const PokemonSpecie& pkm) -> float { return pkm.baseAtk; }; }
+    else if (prop ==  "def" || prop == "defense") { return [](const PokemonSpecie& pkm) -> float { return pkm.baseDef; }; }
+    else if (prop ==  "sta" || prop ==  "hp" || prop == "stamina") { return [](const PokemonSpecie& pkm) -> float { return pkm.baseSta; }; }
+    else if (prop == "bulk") { return [](const PokemonSpecie& pkm) { return float(pkm.bulk); }; }
+    else if (prop == "total") { return [](const PokemonSpecie& pkm) -> float { return pkm.total; }; }
+    else if (prop == "cp") { return [](const PokemonSpecie& pkm) -> float { return pkm.maxCp; }; }
+    else if (prop == "gender") { return [](const PokemonSpecie& pkm) { return MathUtils::IsZero(pkm.malePercent) && MathUtils::IsZero(pkm.femalePercent) ? INFINITY : pkm.malePercent; }; }
+    else if (prop == "buddy") { return [](const PokemonSpecie& pkm) -> float { return pkm.buddyDistance; }; }
+    else { return nullptr; }
+}
+
 //! returns NAN if unknown criteria given
 float PropertyValueByName(const PoGoCmp::PokemonSpecie& pkm, const std::string& prop)
 {
-    if (prop.empty() || prop == "number") { return pkm.number; }
-    else if (prop ==  "atk" || prop == "attack") { return pkm.baseAtk; }
-    else if (prop ==  "def" || prop == "defense") { return pkm.baseDef; }
-    else if (prop ==  "sta" || prop ==  "hp" || prop == "stamina") { return pkm.baseSta; }
-    else if (prop == "bulk") { return float(pkm.baseSta * pkm.baseDef); }
-    else if (prop == "total") { return float(pkm.baseAtk + pkm.baseDef + pkm.baseSta); }
-    else if (prop == "cp") { return float(MaxCp(pkm)); }
-    else if (prop == "gender") { return MathUtils::IsZero(pkm.malePercent) && MathUtils::IsZero(pkm.femalePercent) ? INFINITY : pkm.malePercent; }
-    else if (prop == "buddy") { return pkm.buddyDistance; }
-    else { return NAN; }
+    const auto property = PropertyByName(prop);
+    return property ? property(pkm) : NAN;
 }
 
 // std::to_string(float) uses fixed precision instead of the %g type of specifier so using this to get nicer output
@@ -161,91 +180,183 @@ std::vector<TypePair> AllSingleTypes()
     return types;
 };
 
-//! @param useBaseName For Pokémon with multiple forms with same stats, show only the base name (e.g. "Unown" instead of "Unown A").
-Utf8::String PokemonToString(
-    const PoGoCmp::PokemonSpecie& base,
-    const PoGoCmp::Pokemon& pkm,
-    Utf8::String fmt,
-    const std::string& sortCriteria,
-    bool useBaseName)
+//! A format specifier of the -f/--format string.
+enum class FormatField : uint8_t
 {
-    using namespace StringUtils;
-    using namespace PoGoCmp;
+    Literal, Number, Name, BaseAtk, Atk, BaseDef, Def, BaseSta, Sta, Types, Type, Type2, SortValue, Cp, Level,
+    FastMoves, ChargeMoves, BuddyDistance, Gender, NotVeryEffective, Neutral, SuperEffective
+};
+
+//! Longer specifiers before their prefixes, e.g. %NVE before %N.
+const std::pair<std::string_view, FormatField> formatSpecifiers[]{
+    { "%NVE", FormatField::NotVeryEffective },
+    { "%nu", FormatField::Number }, { "%na", FormatField::Name },
+    { "%ba", FormatField::BaseAtk }, { "%bd", FormatField::BaseDef }, { "%bs", FormatField::BaseSta },
+    { "%Tt", FormatField::Types }, { "%cp", FormatField::Cp }, { "%fm", FormatField::FastMoves },
+    { "%cm", FormatField::ChargeMoves }, { "%SE", FormatField::SuperEffective },
+    { "%a", FormatField::Atk }, { "%d", FormatField::Def }, { "%s", FormatField::Sta },
+    { "%T", FormatField::Type }, { "%t", FormatField::Type2 }, { "%o", FormatField::SortValue },
+    { "%l", FormatField::Level }, { "%b", FormatField::BuddyDistance }, { "%g", FormatField::Gender },
+    { "%N", FormatField::Neutral }
+};
+
+struct FormatToken
+{
+    FormatField field;
+    //! Text of a FormatField::Literal.
+    std::string literal;
+};
+
+//! -f/--format string parsed once, see CompileFormat() and FormatPokemon().
+using CompiledFormat = std::vector<FormatToken>;
+
+CompiledFormat CompileFormat(const Utf8::String& fmt)
+{
+    CompiledFormat tokens;
+    auto appendLiteral = [&tokens](std::string_view str)
+    {
+        if (tokens.empty() || tokens.back().field != FormatField::Literal)
+            tokens.push_back({ FormatField::Literal, {} });
+        tokens.back().literal += str;
+    };
 
-    const auto type = SnakeCaseToTitleCaseCopy(PoGoCmp::PokemonTypeToString(base.type));
-    const auto type2 = base.type2 == PoGoCmp::PokemonType::NONE
-        ? "" : SnakeCaseToTitleCaseCopy(PoGoCmp::PokemonTypeToString(base.type2));
-    const auto types = Concat(type, (!type2.empty() ? "/" : ""), type2);
-    fmt = std::regex_replace(fmt, std::regex{"%nu"}, std::to_string(base.number));
-    auto id = useBaseName ? PoGoCmp::FormIdToBaseId(base.id) : base.id;
-    fmt = std::regex_replace(fmt, std::regex{"%na"}, PoGoCmp::PokemonIdToName(id));
-    //! @todo Raid bosses might have slightly different stat computation.
-    //! When comparing my stats e.g. to Pokebattler's stats, my attack and defence are off by one.
-    fmt = std::regex_replace(fmt, std::regex{"%ba"}, std::to_string(base.baseAtk));
-    fmt = std::regex_replace(fmt, std::regex{"%a"}, std::to_string(ComputeStat(base.baseAtk, pkm.atk, pkm.level)));
-    fmt = std::regex_replace(fmt, std::regex{"%bd"}, std::to_string(base.baseDef));
-    fmt = std::regex_replace(fmt, std::regex{"%d"}, std::to_string(ComputeStat(base.baseDef, pkm.def, pkm.level)));
-    fmt = std::regex_replace(fmt, std::regex{"%bs"}, std::to_string(base.baseSta));
-    const bool isRaidBoss = pkm.sta > 15;
-    const auto sta = isRaidBoss ? pkm.sta : ComputeStat(base.baseSta, pkm.sta, pkm.level);
-    fmt = std::regex_replace(fmt, std::regex{"%s"}, std::to_string(sta));
-    fmt = std::regex_replace(fmt, std::regex{"%Tt"}, types);
-    fmt = std::regex_replace(fmt, std::regex{"%T"}, type);
-    fmt = std::regex_replace(fmt, std::regex{"%t"}, type2);
-    fmt = std::regex_replace(fmt, std::regex{"%o"}, FloatToString(PropertyValueByName(base, sortCriteria)));
-    const auto cp = isRaidBoss ? ComputeRaidBossCp(base, pkm) : ComputeCp(base, pkm);
-    fmt = std::regex_replace(fmt, std::regex{"%cp"}, std::to_string(cp));
-    fmt = std::regex_replace(fmt, std::regex{"%l"}, FloatToString(pkm.level));
-
-    const std::regex fm{"%fm"}, cm{"%cm"};
-    std::smatch m;
-    if (std::regex_search(fmt, m, fm) || std::regex_search(fmt, m, cm))
-    {
-        auto snakeCaseToTitleCase = [](auto s) { SnakeCaseToTitleCase(s); return s; };
-        auto moves = base.fastMoves;
-        ranges::transform(moves, moves.begin(), snakeCaseToTitleCase);
-        fmt = std::regex_replace(fmt, fm, FormatList(moves));
-
-        moves = base.chargeMoves;
-        ranges::transform(moves, moves.begin(), snakeCaseToTitleCase);
-        fmt = std::regex_replace(fmt, cm, FormatList(moves));
+    const std::string_view str{ fmt };
+    for (size_t i = 0; i < str.size();)
+    {
+        const auto rest = str.substr(i);
+        if (rest.size() >= 2 && rest[0] == '\\' && (rest[1] == 'n' || rest[1] == 't'))
+        {
+            appendLiteral(rest[1] == 'n' ? "\n" : "\t");
+            i += 2;
+            continue;
+        }
+        const auto specifier = std::find_if(
+            std::begin(formatSpecifiers), std::end(formatSpecifiers),
+            [&rest](const auto& kvp) { return rest.substr(0, kvp.first.size()) == kvp.first; }
+        );
+        if (specifier != std::end(formatSpecifiers))
+        {
+            tokens.push_back({ specifier->second, {} });
+            i += specifier->first.size();
+        }
+        else
+        {
+            appendLiteral(rest.substr(0, 1));
+            ++i;
+        }
     }
+    return tokens;
+}
+
+std::string TypeName(PoGoCmp::PokemonType type)
+{
+    return type == PoGoCmp::PokemonType::NONE
+        ? "" : StringUtils::SnakeCaseToTitleCaseCopy(PoGoCmp::PokemonTypeToString(type));
+}
 
-    fmt = std::regex_replace(fmt, std::regex{"%b"}, std::to_string(base.buddyDistance));
-    fmt = std::regex_replace(fmt, std::regex{"%g"}, FormatGender(base.malePercent, base.femalePercent));
+//! @return Whether the database is the compiled-in one, i.e. its indices are valid for the tables precomputed
+//! from the compiled-in data, such as IvSpaceFor() and RaidBossCp().
+bool IsCompiled(const PoGoCmp::Database& db)
+{
+    return &db == PoGoCmp::Database::Compiled().get();
+}
+
+//! Appends the Pokémon formatted according to the format to the output. Only the fields used by the format are computed.
+//! @param idx Index to db.Species().
+//! @param raidTier [1, NumRaidTiers()] if pkm is a raid boss of the tier, i.e. RaidLevels[raidTier - 1], 0 otherwise.
+//! @param sortValue Shown for FormatField::SortValue.
+//! @param id ID used for the name, e.g. the base ID for Pokémon whose forms have the same stats ("Unown" instead of "Unown A").
+void FormatPokemon(
+    Utf8::String& out,
+    const CompiledFormat& format,
+    const PoGoCmp::Database& db,
+    PoGoCmp::SpecieIndex idx,
+    const PoGoCmp::Pokemon& pkm,
+    size_t raidTier,
+    float sortValue,
+    std::string_view id)
+{
+    using namespace StringUtils;
+    using namespace PoGoCmp;
 
-    const std::regex nved{"%NVE"}, nd{"%N"}, sed{"%SE"};
-    if (std::regex_search(fmt, m, nved) || std::regex_search(fmt, m, nd) || std::regex_search(fmt, m, sed))
+    const auto& base = db.Species()[idx];
+    const bool isRaidBoss = raidTier > 0;
+    auto moveNames = [&db](const MoveSpan& moves)
+    {
+        std::vector<std::string> names;
+        for (auto move : db.MovesOf(moves))
+            names.push_back(SnakeCaseToTitleCaseCopy(std::string(db.String(db.Moves()[(size_t)move].id))));
+        return names;
+    };
+    // Not very effective, neutral and super effective attack types, computed on first use.
+    std::vector<std::string> effectiveness[3];
+    bool effectivenessComputed = false;
+    auto typesByEffectiveness = [&](size_t i) -> const std::vector<std::string>&
     {
-        auto tes = ComputeEffectiveness(AllSingleTypes(), {{base.type, base.type2}});
-        std::vector<std::string> a, b, c;
-        for (const auto& te : tes)
+        if (!effectivenessComputed)
         {
-            if (te.scalar <= nveDamageMultiplier)
-            {
-                a.push_back(te.At1());
-                // if ... FloatToString(te.scalar) << "\n";
-            }
-            else if (MathUtils::Equals(te.scalar, 1.f))
-            {
-                b.push_back(te.At1());
-            }
-            else if (te.scalar >= seDamageMultiplier)
+            const auto numTypes = (size_t)PokemonType::NUM_TYPES;
+            const auto typeEffectiveness = db.TypeEffectiveness();
+            for (size_t at = 0; at < numTypes; ++at)
             {
-                c.push_back(te.At1());
-                //if ... FloatToString(te.scalar)
+                auto scalar = typeEffectiveness[at * numTypes + (size_t)base.type];
+                if (base.type2 != PokemonType::NONE)
+                    scalar *= typeEffectiveness[at * numTypes + (size_t)base.type2];
+                const auto typeName = TypeName((PokemonType)at);
+                if (scalar <= nveDamageMultiplier)
+                    effectiveness[0].push_back(typeName);
+                else if (MathUtils::Equals(scalar, 1.f))
+                    effectiveness[1].push_back(typeName);
+                else if (scalar >= seDamageMultiplier)
+                    effectiveness[2].push_back(typeName);
             }
+            effectivenessComputed = true;
         }
-        fmt = std::regex_replace(fmt, nved, FormatList(a));
-        fmt = std::regex_replace(fmt, nd, FormatList(b));
-        fmt = std::regex_replace(fmt, sed, FormatList(c));
-    }
-
-    //fmt = std::regex_replace(fmt, std::regex("%%"), "%");
-    fmt = std::regex_replace(fmt, std::regex{"\\\\n"}, "\n");
-    fmt = std::regex_replace(fmt, std::regex{"\\\\t"}, "\t");
+        return effectiveness[i];
+    };
+    auto cp = [&]
+    {
+        if (!isRaidBoss) return db.ComputeCp(idx, pkm.level, pkm.atk, pkm.def, pkm.sta);
+        return IsCompiled(db) ? RaidBossCp(idx, raidTier) : ComputeRaidBossCp(base.baseAtk, base.baseDef, pkm);
+    };
 
-    return fmt;
+    for (const auto& token : format)
+    {
+        switch (token.field)
+        {
+        case FormatField::Literal: out += token.literal; break;
+        case FormatField::Number: out += std::to_string(base.number); break;
+        case FormatField::Name:
+            out += PokemonIdToName(std::string(id));
+            break;
+        //! @todo Raid bosses might have slightly different stat computation.
+        //! When comparing my stats e.g. to Pokebattler's stats, my attack and defence are off by one.
+        case FormatField::BaseAtk: out += std::to_string(base.baseAtk); break;
+        case FormatField::Atk: out += std::to_string(db.ComputeStat(base.baseAtk, pkm.atk, pkm.level)); break;
+        case FormatField::BaseDef: out += std::to_string(base.baseDef); break;
+        case FormatField::Def: out += std::to_string(db.ComputeStat(base.baseDef, pkm.def, pkm.level)); break;
+        case FormatField::BaseSta: out += std::to_string(base.baseSta); break;
+        case FormatField::Sta:
+            out += std::to_string(isRaidBoss ? pkm.sta : db.ComputeStat(base.baseSta, pkm.sta, pkm.level));
+            break;
+        case FormatField::Types:
+            out += TypeName(base.type);
+            if (base.type2 != PokemonType::NONE) out += "/" + TypeName(base.type2);
+            break;
+        case FormatField::Type: out += TypeName(base.type); break;
+        case FormatField::Type2: out += TypeName(base.type2); break;
+        case FormatField::SortValue: out += FloatToString(sortValue); break;
+        case FormatField::Cp: out += std::to_string(cp()); break;
+        case FormatField::Level: out += FloatToString(pkm.level); break;
+        case FormatField::FastMoves: out += FormatList(moveNames(base.fastMoves)); break;
+        case FormatField::ChargeMoves: out += FormatList(moveNames(base.chargeMoves)); break;
+        case FormatField::BuddyDistance: out += std::to_string(base.buddyDistance); break;
+        case FormatField::Gender: out += FormatGender(base.malePercent, base.femalePercent); break;
+        case FormatField::NotVeryEffective: out += FormatList(typesByEffectiveness(0)); break;
+        case FormatField::Neutral: out += FormatList(typesByEffectiveness(1)); break;
+        case FormatField::SuperEffective: out += FormatList(typesByEffectiveness(2)); break;
+        }
+    }
 }
 
 const std::vector<ProgramOption> programsOptions{
@@ -268,9 +379,17 @@ const std::vector<ProgramOption> programsOptions{
         L"fire, water, grass, electric, psychic, ice, dragon, dark, or fairy. Multiple options supported."
     },
     {
-        "-it", "--includeMove",
-        L"Specify Pokémon to be included by specific moves(s). Use 'info moves' command to see the available moves. "
-        L"Multiple options supported."
+        "-im", "--includeMove",
+        L"Specify Pokémon to be included by specific move(s), e.g. 'vine_whip'. Use 'moves' command to see the available "
+        L"moves. Multiple options supported."
+    },
+    {
+        "", "--filter",
+        L"Show only Pokémon matching the filter expression, e.g. \"atk>=200 && (type=fire || type2=fire) && "
+        L"rarity!=legendary && cp<2500\". The sorting criteria, 'mincp', 'type', 'type2', 'rarity', and 'move' "
+        L"(the Pokémon learns the move) can be compared using <, <=, =, !=, >, or >=; the types, the rarity, and "
+        L"the moves only using = and !=. The comparisons can be combined using && (and), || (or), ! (not), and "
+        L"parentheses. Multiple options supported, all of the filters must match."
     },
     {
         "-r", "--results",
@@ -311,12 +430,32 @@ const std::vector<ProgramOption> programsOptions{
         L"Show duplicate Pokémon forms, i.e. forms that differ only by name and type. "
         L"By default, duplicates (same base stats) are not shown."
     },
+    {
+        "", "--minIv",
+        L"Minimum IV of each stat for perfect-ivs, [0,15], 15 by default."
+    },
+    {
+        "", "--encounter",
+        L"Encounter type for perfect-ivs: 'wild' (default, including weather-boosted levels), 'boosted' "
+        L"(weather-boosted wild), 'raid' (both normal and weather-boosted), or 'egg'. The guaranteed minimum IVs of "
+        L"the encounter type are taken into account."
+    },
+    {
+        "", "--rankFile",
+        L"Use PvP ranks from a file written by the pvprank-export command instead of computing them."
+    },
+    {
+        "", "--database",
+        L"Game data for the cp command: a snapshot file written by PoGoDbGen, or GAME_MASTER JSON if the extension "
+        L"is .json. The other commands use the compiled-in data."
+    },
     // Commands
     {
         "sort", "",
         L"Sort the Pokémon by certain criteria: 'number' (default), base 'attack'/'atk', base 'defense'/'def', "
-        L"base 'stamina'/'sta'/'hp', bulk (def*sta), 'total' (atk+def+sta), 'gender', or 'buddy' (buddy distance). "
-        L"Comparison operator (<, <=, =, >, or >=) and value can be appended to the criteria, e.g.' \"(atk>=200\"'"
+        L"base 'stamina'/'sta'/'hp', bulk (def*sta), 'total' (atk+def+sta), 'cp' (max. CP), 'gender', or 'buddy' "
+        L"(buddy distance). Multiple comma-separated criteria can be given, the latter ones breaking ties, e.g. "
+        L"'atk,def'. Comparison operator (<, <=, =, !=, >, or >=) and value can be appended to each criteria, e.g.' \"(atk>=200\"'"
         L"(make sure to use double quotes) will only include Pokémon with base attack larger than or equal to 200 "
         L"to the results. A name of Pokémon can also be used as the value: "
         L"in this case the property of the specified Pokémon is used as the reference point."
@@ -328,8 +467,31 @@ const std::vector<ProgramOption> programsOptions{
     },
     {
         "perfect-ivs", "",
-        L"Generate a search string that can be used to filter perfect wild Pokémon catches. "
-        L"Only single name/ID/number as an argument supported. Forms not supported."
+        L"Generate a search string that can be used to filter perfect (see --minIv) Pokémon catches (see --encounter). "
+        L"A name/ID/number, a form name, or 'all' for all Pokémon and forms as an argument. "
+        L"Consecutive CP values are combined into ranges."
+    },
+    {
+        "appraise", "",
+        L"List the possible levels and IVs of a Pokémon based on the values shown in the game: "
+        L"'appraise <name|number>,<cp>[,<hp>[,<stardust>]]', where stardust is the cost of the next power-up, "
+        L"e.g. 'appraise Dragonite,2500,140,4000'. Forms are supported by using the form name."
+    },
+    {
+        "cp", "",
+        L"Print the CP of Pokémon using the game data of --database, or the compiled-in data: "
+        L"'cp <name|number>[,<name|number>...]', e.g. 'cp dragonite,149'. See also --ivs and --level."
+    },
+    {
+        "pvprank", "",
+        L"Rank the IVs of a Pokémon by stat product for a PvP league: 'pvprank <name|number>[,<league>]', where league is "
+        L"little, great (default), ultra, or master. Prints the top IVs (see -r/--results, 10 by default), or the rank "
+        L"of specific IVs if --ivs is given. See also --rankFile."
+    },
+    {
+        "pvprank-export", "",
+        L"Compute the PvP ranks of all Pokémon for all leagues and write them to a binary file, e.g. "
+        L"'pvprank-export ranks.bin'."
     },
     {
         "info", "",
@@ -374,24 +536,60 @@ void PrintLongHelp()
     Utf8::PrintLine(ss.str());
 }
 
-using FloatComparator = std::function<bool(float, float)>;
-
-FloatComparator MakeComparator(const std::string& comp)
+PoGoCmp::CompareOp ParseCompareOp(const std::string& comp)
 {
-    if (comp.empty()) return FloatComparator{[](float /*a*/, float /*b*/) { return true; }};
-    if (comp == "<") return FloatComparator{[](float a, float b) { return a < b; }};
-    if (comp == "<=") return FloatComparator{[](float a, float b) { return a <= b; }};
-    if (comp == ">") return FloatComparator{[](float a, float b) { return a > b; }};
-    if (comp == ">=") return FloatComparator{[](float a, float b) { return a >= b; }};
-    if (comp == "=") return FloatComparator{[](float a, float b) { return MathUtils::Equals(a, b); }};
+    using PoGoCmp::CompareOp;
+    if (comp.empty()) return CompareOp::Any;
+    if (comp == "<") return CompareOp::Less;
+    if (comp == "<=") return CompareOp::LessEqual;
+    if (comp == ">") return CompareOp::Greater;
+    if (comp == ">=") return CompareOp::GreaterEqual;
+    if (comp == "=") return CompareOp::Equal;
+    if (comp == "!=") return CompareOp::NotEqual;
     throw std::runtime_error{"Unknown/unsupported comparator '" + comp + "'"};
 }
 
+//! A sort criteria with an optional filter, e.g. "atk" or "atk>=200".
+using SortCriteria = PoGoCmp::PropertyFilter;
+
+SortCriteria ParseSortCriteria(std::string criteria)
+{
+    using namespace StringUtils;
+
+    std::string compOpType, compValStr;
+    float compVal{};
+    if (auto opBegin = criteria.find_first_of("<>=!"), opEnd = criteria.find_last_of("<>=!");
+        opBegin != std::string::npos && opEnd != std::string::npos)
+    {
+        compOpType = criteria.substr(opBegin, opEnd - opBegin + 1);
+        compValStr = criteria.substr(opEnd + 1, criteria.length() - opEnd);
+        criteria = criteria.substr(0, opBegin);
+    }
+
+    const auto property = PropertyByName(criteria);
+    if (!property)
+        LogErrorAndExit("Invalid sorting criteria: '" + criteria + "'.");
+    if (!compOpType.empty())
+    {
+        try
+        {
+            compVal = IsNumber(compValStr)
+                ? std::stof(compValStr)
+                : property(PoGoCmp::PokemonByIdName(compValStr));
+        }
+        catch (const std::exception& e)
+        {
+            LogErrorAndExit(Concat("Not a valid number or name '", compValStr, "': ", e.what()));
+        }
+    }
+    return { property, ParseCompareOp(compOpType), compVal };
+}
+
 bool IsFormName(const std::string& id)
 {
     return std::find_if(
         PoGoCmp::FormNames.begin(), PoGoCmp::FormNames.end(),
-        [&id](const auto& kvp) { return Utf8::CompareI(kvp.second.c_str(), id.c_str()) == 0; }
+        [&id](const auto& kvp) { return Utf8::CompareI(kvp.second.data(), id.c_str()) == 0; }
     ) != PoGoCmp::FormNames.end();
 }
 
@@ -404,6 +602,48 @@ T ParseValue(const std::string& str, T minVal, T maxVal)
     return val;
 }
 
+//! @param str Pokédex number, or name/ID of a specie/form.
+//! @return Indices to db.Species() in the database order: all forms of the number or the base ID (e.g. "Unown"),
+//! or only the specie/form named. Empty if not found.
+//! @throws std::exception if the number is out of range.
+std::vector<PoGoCmp::SpecieIndex> FindForms(const PoGoCmp::Database& db, const std::string& str)
+{
+    using namespace PoGoCmp;
+    const auto species = db.Species();
+    auto formsOf = [&species](PokedexNumber number)
+    {
+        std::vector<SpecieIndex> forms;
+        for (size_t i = 0; i < species.size(); ++i)
+            if (species[i].number == number) forms.push_back((SpecieIndex)i);
+        return forms;
+    };
+    if (StringUtils::IsNumber(str))
+        return formsOf(ParseValue<PokedexNumber>(str, 0, UINT16_MAX));
+
+    auto id = PokemonNameToId(StringUtils::TrimCopy(str));
+    auto idx = db.SpecieIndexByName(id);
+    if (idx >= species.size())
+    {
+        id = str;
+        idx = db.SpecieIndexByName(id);
+    }
+    if (idx >= species.size()) return {};
+    if (!NameEquals(db.String(species[idx].id), id))
+        return formsOf(species[idx].number);
+    return { idx };
+}
+
+//! @param str Pokédex number or base ID, in which case the first form is used, or name/ID of a specie/form.
+//! @return Index to db.Species().
+//! @throws std::exception if the specie/form is not found.
+PoGoCmp::SpecieIndex ParseSpecie(const PoGoCmp::Database& db, const std::string& str)
+{
+    const auto forms = FindForms(db, str);
+    if (forms.empty())
+        throw std::runtime_error("'" + str + "' not found.");
+    return forms.front();
+}
+
 struct RangeWithForm
 {
     RangeWithForm() = default;
@@ -495,6 +735,97 @@ RangeWithForm ParsePokedexRange(
     return range;
 }
 
+//! The IV floor of hatched eggs is not available in the game master.
+const int eggMinIv = 10;
+
+struct Encounter
+{
+    std::vector<float> levels;
+    int minIv;
+};
+
+//! @return Empty levels for an unknown encounter type.
+Encounter EncounterByName(const PoGoCmp::Database& db, const std::string& name, int minIv)
+{
+    using namespace PoGoCmp;
+    Encounter encounter{{}, minIv};
+    auto addLevels = [&encounter](float first, float last)
+    {
+        for (float level = first; level <= last; ++level)
+            encounter.levels.push_back(level);
+    };
+    const float maxWildLevel = db.Settings().maxEncounterPlayerLevel;
+    const float boostedBonus = WeatherBonus.cpBaseLevelBonus;
+    if (name.empty() || name == "wild")
+    {
+        addLevels(1, maxWildLevel + boostedBonus);
+    }
+    else if (name == "boosted")
+    {
+        addLevels(1 + boostedBonus, maxWildLevel + boostedBonus);
+        encounter.minIv = std::max(minIv, (int)WeatherBonus.guaranteedIndividualValues);
+    }
+    else if (name == "raid")
+    {
+        addLevels(RaidEncounterLevel, RaidEncounterLevel);
+        addLevels(RaidEncounterLevel + WeatherBonus.raidEncounterCpBaseLevelBonus,
+            RaidEncounterLevel + WeatherBonus.raidEncounterCpBaseLevelBonus);
+        encounter.minIv = std::max(minIv, (int)WeatherBonus.raidEncounterGuaranteedIndividualValues);
+    }
+    else if (name == "egg")
+    {
+        addLevels(db.Settings().maxEggPlayerLevel, db.Settings().maxEggPlayerLevel);
+        encounter.minIv = std::max(minIv, eggMinIv);
+    }
+    return encounter;
+}
+
+//! @param idx Index to db.Species().
+//! @param encounter The levels must be valid for the database.
+//! @return "<number>&cp<A>,cp<B>-<C>,...", consecutive CP values combined into ranges.
+std::string PerfectIvSearchString(const PoGoCmp::Database& db, PoGoCmp::SpecieIndex idx, const Encounter& encounter)
+{
+    using namespace PoGoCmp;
+    // The game shows CP below 10 as 10.
+    const int minShownCp = 10;
+    // The CPs of the compiled-in data are read from the precomputed tables, a loaded database has none.
+    const IvSpace* ivSpace = IsCompiled(db) ? &IvSpaceFor(idx) : nullptr;
+    // The CPs are marked in a bitmap instead of sorting them, which also deduplicates them.
+    std::vector<bool> present(UINT16_MAX + 1);
+    int minCp = INT_MAX, maxCp = 0;
+    for (auto level : encounter.levels)
+    {
+        const auto* cpTable = ivSpace ? ivSpace->CpTable(LevelToIndex(level)) : nullptr;
+        for (int atk = encounter.minIv; atk <= 15; ++atk)
+            for (int def = encounter.minIv; def <= 15; ++def)
+                for (int sta = encounter.minIv; sta <= 15; ++sta)
+                {
+                    const auto cp = std::max<int>(
+                        cpTable ? cpTable[ToIvIndex(atk, def, sta)] : db.ComputeCp(idx, level, atk, def, sta),
+                        minShownCp);
+                    present[cp] = true;
+                    minCp = std::min(minCp, cp);
+                    maxCp = std::max(maxCp, cp);
+                }
+    }
+
+    std::stringstream ss;
+    ss << db.Species()[idx].number << "&";
+    for (int cp = minCp; cp <= maxCp;)
+    {
+        int last = cp;
+        while (last + 1 <= maxCp && present[last + 1])
+            ++last;
+        ss << (cp > minCp ? "," : "") << "cp" << cp;
+        if (last > cp)
+            ss << "-" << last;
+        cp = last + 1;
+        while (cp <= maxCp && !present[cp])
+            ++cp;
+    }
+    return ss.str();
+}
+
 int main(int argc, char **argv)
 {
     ProgamOptionMap opts{Utf8::ParseArguments(argc, argv)};
@@ -536,6 +867,8 @@ int main(int argc, char **argv)
     pokemon.atk = 15;
     pokemon.def = 15;
     pokemon.sta = 15;
+    // --raidLevel, 0 if the Pokémon is not a raid boss.
+    size_t raidTier = 0;
 
     if (auto level = opts.OptionValue("--level"); !level.empty())
     {
@@ -579,8 +912,8 @@ int main(int argc, char **argv)
 
         try
         {
-            auto raidLevel = ParseValue(level, 1, (int)RaidLevels.size());
-            pokemon = RaidLevels[raidLevel - 1];
+            raidTier = ParseValue(level, (size_t)1, NumRaidTiers());
+            pokemon = RaidLevels[raidTier - 1];
         }
         catch (const std::exception& e)
         {
@@ -588,32 +921,32 @@ int main(int argc, char **argv)
         }
     }
 
+    if (auto dbPath = opts.OptionValue("--database"); !dbPath.empty())
+    {
+        auto db = Database::Load(dbPath);
+        if (!db)
+            LogErrorAndExit("Failed to load '" + dbPath + "'.");
+        PublishDatabase(std::move(db));
+    }
+
     if (opts.HasOption("info"))
     {
         try
         {
-            auto range = ParsePokedexRange(opts.OptionValue("info"));
-
-            if (!range.formId.empty())
-                assert(range.first == range.second);
-
-            for (auto it = range.formId.empty()
-                ? PokemonByNumber.lower_bound(range.first)
-                : std::find_if(
-                    PokemonByNumber.begin(), PokemonByNumber.end(),
-                    [&range](const auto& kvp) { return kvp.first == range.first && kvp.second.id == range.formId; }
-                ),
-                end = PokemonByNumber.upper_bound(range.second);
-                ;
-                ++it)
+            const auto db = CurrentDatabase();
+            const auto forms = FindForms(*db, opts.OptionValue("info"));
+            if (forms.empty())
+                throw std::runtime_error("'" + opts.OptionValue("info") + "' not found.");
+
+            const auto infoFormat = CompileFormat(fullInfoFormat);
+            Utf8::String output;
+            for (auto idx : forms)
             {
-                const auto& base = it->second;
-
-                Utf8::Print(PokemonToString(base, pokemon, fullInfoFormat, "", false));
-
-                if (!range.formId.empty() || it == end)
-                    break;
+                const auto& base = db->Species()[idx];
+                // The default sort property is the number.
+                FormatPokemon(output, infoFormat, *db, idx, pokemon, raidTier, base.number, db->String(base.id));
             }
+            Utf8::Print(output);
 
             ret = EXIT_SUCCESS;
         }
@@ -635,28 +968,13 @@ int main(int argc, char **argv)
     else if (opts.HasOption("moves"))
     {
         Log(std::to_string(PoGoCmp::Moves.size()) + " moves available:");
-        auto isMoveInUse = [](const std::string& id)
+        for (size_t i = 0; i < PoGoCmp::Moves.size(); ++i)
         {
-            return std::any_of(
-                PoGoCmp::PokemonByNumber.begin(), PoGoCmp::PokemonByNumber.end(),
-                [&id](const auto& kvp)
-            {
-                return
-                    std::any_of(kvp.second.fastMoves.begin(), kvp.second.fastMoves.end(),
-                        [&id](const auto& fmId) { return fmId == id; }) ||
-                    std::any_of(kvp.second.chargeMoves.begin(), kvp.second.chargeMoves.end(),
-                        [&id](const auto& cmId) { return cmId == id; });
-            }
-            );
-        };
-
-        for (const auto& m : PoGoCmp::Moves)
-        {
-            Utf8::Print(m.id);
-            if (!isMoveInUse(m.id)) Utf8::Print("*");
+            Utf8::Print(std::string(PoGoCmp::Moves[i].id));
+            if (PoGoCmp::LearnersOf((PoGoCmp::MoveId)i).empty()) Utf8::Print("*");
             Utf8::PrintLine("");
         }
-        Log(L"*) Move currently available in any Pokémon's moveset.");
+        Log(L"*) Move not currently available in any Pokémon's moveset.");
 
         ret = EXIT_SUCCESS;
     }
@@ -736,8 +1054,9 @@ int main(int argc, char **argv)
         // E.g. "16,32", or "bulbasaur,ivysaur", or "250". The names can contain following
         // Unicode characters: ♀ (\u2640), ♂ (\u2642), é (\u00e9), É (\u00c9).
         //! @todo Test for this
+        // The hyphen is last in the brackets as "\w-." is an invalid range in some implementations, e.g. libstdc++.
         const std::wregex rangePattern{
-            LR"(([\w-.' \u2640\u2642\u00e9\u00c9]+)(,)?([\w-.' \u2640\u2642\u00e9\u00c9]+)?)"
+            LR"(([\w.' \u2640\u2642\u00e9\u00c9-]+)(,)?([\w.' \u2640\u2642\u00e9\u00c9-]+)?)"
         };
         std::wsmatch rangeMatches;
 
@@ -807,171 +1126,121 @@ int main(int argc, char **argv)
         }
 
         const bool ascending = !opts.HasOption("-d", "--descending");
-        const auto sortCmp = MakeComparator(ascending ? "<" : ">");
-        std::string sortCriteria = opts.OptionValue("sort");
-        std::string compOpType, compValStr;
-        float compVal;
-        if (auto opBegin = sortCriteria.find_first_of("<>="), opEnd = sortCriteria.find_last_of("<>=");
-            opBegin != std::string::npos && opEnd != std::string::npos)
-        {
-            compOpType = sortCriteria.substr(opBegin, opEnd - opBegin + 1);
-            compValStr = sortCriteria.substr(opEnd + 1, sortCriteria.length() - opEnd);
-            sortCriteria = sortCriteria.substr(0, opBegin);
-            try
-            {
-                compVal = IsNumber(compValStr)
-                    ? std::stof(compValStr)
-                    : PropertyValueByName(PoGoCmp::PokemonByIdName(PoGoCmp::PokemonNameToId(compValStr)), sortCriteria);
-            }
-            catch (const std::exception& e)
-            {
-                LogErrorAndExit(Concat("Not a valid number or name '", compValStr, "': ", e.what()));
-            }
-        }
-
-        if (std::isnan(PropertyValueByName({}, sortCriteria)))
-            LogErrorAndExit("Invalid sorting criteria: '" + sortCriteria + "'.");
-
-        std::vector<PoGoCmp::PokemonSpecie> results;
+        const auto sortOp = ascending ? PoGoCmp::CompareOp::Less : PoGoCmp::CompareOp::Greater;
+        std::vector<SortCriteria> sortCriteria;
+        for (const auto& criteriaStr : Split(opts.OptionValue("sort"), ",", StringUtils::RemoveEmptyEntries))
+            sortCriteria.push_back(ParseSortCriteria(criteriaStr));
+        if (sortCriteria.empty())
+            sortCriteria.push_back(ParseSortCriteria(""));
+
+        // All of the criteria are compiled into a single query that is evaluated in one pass over PokemonColumns.
+        PoGoCmp::SpeciesQuery query;
+        query.filters = sortCriteria;
         for (const auto& range : ranges)
         {
-            auto begin = range.formId.empty()
-                ? PokemonByNumber.lower_bound(range.first)
-                : std::find_if(
-                    PokemonByNumber.begin(), PokemonByNumber.end(),
-                    [&range](const auto& kvp) { return kvp.first == range.first && kvp.second.id == range.formId; }
-                );
-
-            auto end = PokemonByNumber.upper_bound(range.second);
-
-            std::vector<PoGoCmp::PokemonSpecie> rangeResult;
-            rangeResult.reserve(std::distance(begin, end) + 1);
-
+            auto rangeSpecies = PoGoCmp::SpeciesByNumber(range.first, range.second);
             if (!range.formId.empty())
             {
                 assert(range.first == range.second);
-                rangeResult.push_back(begin->second);
-                begin = PokemonByNumber.upper_bound(range.second);
+                const auto forms = rangeSpecies;
+                rangeSpecies = {};
+                for (auto idx = forms.first; idx < forms.last; ++idx)
+                    if (SpecieByIndex(idx).id == range.formId)
+                        rangeSpecies = { idx, PoGoCmp::SpecieIndex(idx + 1) };
             }
-
-            for (; begin != end; ++begin)
-            {
-                rangeResult.push_back(begin->second);
-            }
-
-            const auto filterCmp = MakeComparator(compOpType);
-            std::copy_if(
-                rangeResult.begin(), rangeResult.end(), std::back_inserter(results),
-                [&](const auto &pkm) { return filterCmp(PropertyValueByName(pkm, sortCriteria), compVal); }
-            );
+            // An empty range must not be left out, as no ranges would mean all species.
+            query.ranges.push_back(rangeSpecies);
         }
 
-        // remove duplicate and overlapping results
-        ranges::sort(
-            results,
-            [](const auto& a, const auto& b)
-            {
-                if (a.number < b.number) return true;
-                if (a.number > b.number) return false;
-
-                if (Utf8::CompareI(a.id.c_str(), b.id.c_str()) < 0) return true;
-
-                return false;
-            }
-        );
-
-        results.erase(
-            std::unique(
-                results.begin(), results.end(),
-                [](const auto& a, const auto& b) { return a.number == b.number && a.id == b.id; }
-            ),
-            results.end()
-        );
-
-        // --showDuplicateForms
-
-        const auto formsHaveSameStats = [](const auto& a, const auto& b)
-        {
-            return a.number == b.number &&
-                a.baseAtk == b.baseAtk && a.baseDef == b.baseDef && a.baseSta == b.baseSta;
-        };
-
-        const auto showDuplicateForms = opts.HasOption("", "--showDuplicateForms");
-        if (!showDuplicateForms)
+        // --rarity
+        const auto rarityStrings = opts.OptionValues("--rarity");
+        for (const auto& rarityStr : rarityStrings)
         {
-            results.erase(
-                std::unique(results.begin(), results.end(), formsHaveSameStats),
-                results.end()
-            );
+            auto rarity = PoGoCmp::StringToPokemonRarity(rarityStr.c_str());
+            if (rarity == PoGoCmp::PokemonRarity::NONE)
+                LogErrorAndExit("Unknown rarity '" + rarityStr + "'");
+            query.AddRarity(rarity);
         }
-
-        // --rarity
-
-        std::vector<PoGoCmp::PokemonRarity> rarities{
-            PoGoCmp::PokemonRarity::NORMAL,
-            PoGoCmp::PokemonRarity::LEGENDARY,
-            PoGoCmp::PokemonRarity::MYTHIC
-        };
-        if (auto rarityStrings = opts.OptionValues("--rarity"); !rarityStrings.empty())
+        if (rarityStrings.empty())
         {
-            rarities.clear();
-            for (const auto& rarityStr : rarityStrings)
-            {
-                auto rarity = PoGoCmp::StringToPokemonRarity(rarityStr.c_str());
-                if (rarity == PoGoCmp::PokemonRarity::NONE)
-                    LogErrorAndExit("Unknown rarity '" + rarityStr + "'");
-                rarities.push_back(rarity);
-            }
+            for (auto rarity : { PoGoCmp::PokemonRarity::NORMAL, PoGoCmp::PokemonRarity::LEGENDARY, PoGoCmp::PokemonRarity::MYTHIC })
+                query.AddRarity(rarity);
         }
 
-        results.erase(
-            std::remove_if(results.begin(), results.end(), [&rarities](const auto& pkm)
-            {
-                return std::find(rarities.begin(), rarities.end(), pkm.rarity) == rarities.end();
-            }),
-            results.end()
-        );
-
         // --includeType
-        std::vector<PoGoCmp::PokemonType> types;
         for (const auto& typeStr : opts.OptionValues("-it", "--includeType"))
         {
             auto type = PoGoCmp::StringToPokemonType(typeStr.c_str());
             if (type == PoGoCmp::PokemonType::NONE)
                 LogErrorAndExit("Unknown type '" + typeStr + "'");
-            types.push_back(type);
+            query.AddType(type);
         }
 
-        if (!types.empty())
+        // --includeMove
+        for (const auto& moveStr : opts.OptionValues("-im", "--includeMove"))
         {
-            results.erase(
-                std::remove_if(
-                    results.begin(),
-                    results.end(), [&types](const auto& pkm)
-                    {
-                        return std::find_if(types.begin(), types.end(),
-                            [&pkm](auto type) { return pkm.type == type || pkm.type2 == type; }
-                        ) == types.end();
-                    }
-                ),
-                results.end()
-            );
+            const auto move = PoGoCmp::MoveIdByName(moveStr);
+            if (move == PoGoCmp::MoveId::NONE)
+                LogErrorAndExit("Unknown move '" + moveStr + "'");
+            query.moves.push_back(move);
         }
 
-        // Finally sort according the sorting criteria...
-        ranges::sort(
-            results,
-            [&sortCmp, &sortCriteria](const auto& lhs, const auto& rhs)
+        // --filter
+        if (auto filterStrings = opts.OptionValues("", "--filter"); !filterStrings.empty())
+        {
+            // Multiple filters are combined into a single expression so that it's compiled and evaluated once.
+            std::string expression, error;
+            for (const auto& filterStr : filterStrings)
             {
-                return sortCmp(PropertyValueByName(lhs, sortCriteria), PropertyValueByName(rhs, sortCriteria));
+                if (!query.expression.Compile(filterStr, &error))
+                    LogErrorAndExit(Concat("Invalid filter '", filterStr, "': ", error));
+                expression += (expression.empty() ? "(" : " && (") + filterStr + ")";
             }
-        );
+            if (!query.expression.Compile(expression, &error))
+                LogErrorAndExit(Concat("Invalid filter '", expression, "': ", error));
+        }
 
-        // ...and show the results.
+        // --showDuplicateForms
+        // Only the first matching form of each group of forms with the same stats is kept.
+        const auto showDuplicateForms = opts.HasOption("", "--showDuplicateForms");
+        query.uniqueStats = !showDuplicateForms;
+
+        auto results = PoGoCmp::RunQuery(query);
+
+        // Finally sort according the sorting criteria: the keys are extracted once per result and only the
+        // shown results are ordered. Ties are kept in the number order so that the output is deterministic...
         const auto numMatches = (int)results.size();
-        Utf8::Print(std::to_string(numMatches) + " matches (showing ");
         // negative number means 'show all'
         numResults = numResults < 0 ? numMatches : std::min(numResults, numMatches);
+        const auto numKeys = sortCriteria.size();
+        std::vector<float> sortKeys(results.size() * numKeys);
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const auto& pkm = SpecieByIndex(results[i]);
+            for (size_t k = 0; k < numKeys; ++k)
+                sortKeys[i * numKeys + k] = sortCriteria[k].property(pkm);
+        }
+        std::vector<uint32_t> order(results.size());
+        std::iota(order.begin(), order.end(), 0u);
+        const auto orderCmp = [&](uint32_t lhs, uint32_t rhs)
+        {
+            for (size_t k = 0; k < numKeys; ++k)
+            {
+                const auto a = sortKeys[lhs * numKeys + k], b = sortKeys[rhs * numKeys + k];
+                if (PoGoCmp::Compare(a, sortOp, b)) return true;
+                if (PoGoCmp::Compare(b, sortOp, a)) return false;
+            }
+            return lhs < rhs;
+        };
+        std::partial_sort(order.begin(), order.begin() + numResults, order.end(), orderCmp);
+        std::vector<PoGoCmp::SpecieIndex> sortedResults;
+        sortedResults.reserve(results.size());
+        for (auto i : order)
+            sortedResults.push_back(results[i]);
+        results = std::move(sortedResults);
+
+        // ...and show the results.
+        Utf8::Print(std::to_string(numMatches) + " matches (showing ");
         Utf8::PrintLine(std::to_string(numResults) + (ascending ? " last" : " first") + " results):");
 
         auto formNameSpecified = [&includes](const auto& id) -> bool
@@ -982,19 +1251,23 @@ int main(int argc, char **argv)
             ) != includes.end();
         };
 
+        const auto compiledFormat = CompileFormat(format);
+        Utf8::String output;
         for (int i = 0; i < numMatches && i < numResults; ++i)
         {
-            const auto& base = results[i];
+            const auto& base = SpecieByIndex(results[i]);
             /* if (verbose) Log("Pokédex range " + std::to_string(result.first.first) + "-" +
                 std::to_string(result.first.second) + ":"); */
             // if (verbose) Utf8::Print(std::to_string(i+1) + ": ");
 
-            const auto numSameStatsForms = std::unique(results.begin(), results.end(), formsHaveSameStats) - results.begin();
-            const bool useBaseName = !formNameSpecified(base.id) &&
-                !(numSameStatsForms > 1) && !showDuplicateForms;
+            // For Pokémon whose forms all have the same stats only the base name is shown, e.g. "Unown" instead of "Unown A".
+            const auto baseId = PoGoCmp::PokemonColumns.baseId[results[i]];
+            const bool useBaseName = baseId != PoGoCmp::NoBaseId && !showDuplicateForms && !formNameSpecified(base.id);
 
-            Utf8::Print(PokemonToString(base, pokemon, format, sortCriteria, useBaseName));
+            FormatPokemon(output, compiledFormat, *Database::Compiled(), results[i], pokemon, raidTier,
+                sortCriteria.front().property(base), useBaseName ? PoGoCmp::PokemonBaseIds[baseId] : base.id);
         }
+        Utf8::Print(output);
 
         ret = EXIT_SUCCESS;
     }
@@ -1009,26 +1282,17 @@ int main(int argc, char **argv)
             const auto max = (float)PoGoCmp::PokemonUpgrades.candyCost.size();
             auto end = ParseValue(powerupRange[1], 1.f, max);
             auto begin = ParseValue(powerupRange[0], 1.f, end);
-            const auto step = 1.f / PoGoCmp::PokemonUpgrades.upgradesPerLevel;
-            float dummy;
-            const auto beginFract = std::modf(begin, &dummy);
-            if (!MathUtils::Equals(beginFract, 0.f) && !MathUtils::Equals(beginFract, step))
+            const auto beginIdx = LevelToIndex(begin);
+            if (beginIdx == LevelIndex::Invalid)
                 LogErrorAndExit("Invalid factorial for range's begin.");
-            const auto endFract = std::modf(end, &dummy);
-            if (!MathUtils::Equals(endFract, 0.f) && !MathUtils::Equals(endFract, step))
+            const auto endIdx = LevelToIndex(end);
+            if (endIdx == LevelIndex::Invalid)
                 LogErrorAndExit("Invalid factorial for range's end.");
 
-            int candyTotal{}, dustTotal{};
-            for (float i = begin - 1; i < end - 1; i += step)
-            {
-                auto idx = (size_t)std::floor(i);
-                candyTotal += PoGoCmp::PokemonUpgrades.candyCost[idx];
-                dustTotal += PoGoCmp::PokemonUpgrades.stardustCost[idx];
-            }
-
+            const auto cost = PowerUpCostBetween(beginIdx, endIdx);
             Log("Power-up costs from level " + powerupRange[0] + " to " + powerupRange[1] + ":");
-            Log(" candy: " + std::to_string(candyTotal));
-            Log(" stardust: " + std::to_string(dustTotal));
+            Log(" candy: " + std::to_string(cost.candy));
+            Log(" stardust: " + std::to_string(cost.stardust));
         }
         catch(const std::exception& e)
         {
@@ -1038,29 +1302,192 @@ int main(int argc, char **argv)
     }
     else if (auto val = opts.OptionValue("perfect-ivs"); !val.empty())
     {
+        int minIv = 15;
+        try
+        {
+            if (auto minIvVal = opts.OptionValue("--minIv"); !minIvVal.empty())
+                minIv = ParseValue(minIvVal, 0, 15);
+        }
+        catch(const std::exception& e)
+        {
+            LogErrorAndExit(Concat("Invalid --minIv value: ", e.what()));
+        }
+        // Held until the end so that all of the results are computed from the same data.
+        const auto db = CurrentDatabase();
+        const auto encounterName = opts.OptionValue("--encounter");
+        const auto encounter = EncounterByName(*db, encounterName, minIv);
+        if (encounter.levels.empty())
+            LogErrorAndExit("'" + encounterName + "' is not a valid encounter type.");
+        for (auto level : encounter.levels)
+            if (std::isnan(db->CpMultiplier(level)))
+                LogErrorAndExit("Level " + FloatToString(level) + " is not in the database.");
+
+        auto formName = [&db](SpecieIndex idx) { return PokemonIdToName(std::string(db->String(db->Species()[idx].id))); };
+        if (val == "all")
+        {
+            // Streamed a line at a time as the whole output can be large.
+            for (size_t i = 0; i < db->Species().size(); ++i)
+            {
+                const auto idx = (SpecieIndex)i;
+                Utf8::PrintLine(formName(idx) + ": " + PerfectIvSearchString(*db, idx, encounter));
+            }
+        }
+        else
+        {
+            std::vector<SpecieIndex> forms;
+            try
+            {
+                forms = FindForms(*db, val);
+                if (forms.empty())
+                    throw std::runtime_error("'" + val + "' not found.");
+            }
+            catch (const std::exception& e)
+            {
+                LogErrorAndExit(Concat("Not a valid name or number: ", e.what()));
+            }
+            for (auto idx : forms)
+                Log((forms.size() > 1 ? formName(idx) + ": " : "") + PerfectIvSearchString(*db, idx, encounter));
+        }
+        ret = EXIT_SUCCESS;
+    }
+    else if (auto appraise = opts.OptionValue("appraise"); !appraise.empty())
+    {
+        const auto args = Split(appraise, ",", StringUtils::RemoveEmptyEntries);
+        if (args.size() < 2 || args.size() > 4)
+            LogErrorAndExit("appraise requires 2-4 comma-separated arguments.");
+
+        SpecieIndex idx{};
+        int cp{}, hp{}, stardust{};
         try
         {
-            auto number = IsNumber(val)
-                ? (PokedexNumber)std::stoul(val)
-                : PoGoCmp::PokemonByIdName(PoGoCmp::PokemonNameToId(val)).number;
-            //! @todo form support
-            auto pkm = PoGoCmp::PokemonByNumber.equal_range(number).first->second;
+            // The precomputed tables are built from the compiled-in data.
+            idx = ParseSpecie(*Database::Compiled(), args[0]);
+            cp = ParseValue(args[1], 10, INT_MAX);
+            if (args.size() > 2) hp = ParseValue(args[2], 10, INT_MAX);
+            if (args.size() > 3) stardust = ParseValue(args[3], 1, INT_MAX);
+        }
+        catch(const std::exception& e)
+        {
+            LogErrorAndExit(Concat("Invalid appraise arguments: ", e.what()));
+        }
 
-            // "<number>&cp<cpAtLevel1>,cp<cpAtLevel2>,..."
+        const auto candidates = Appraise(idx, cp, hp, stardust);
+        Log(std::to_string(candidates.size()) + " possible level and IV combinations:");
+        for (const auto& c : candidates)
+        {
+            const int atk = AtkIv(c.iv), def = DefIv(c.iv), sta = StaIv(c.iv);
             std::stringstream ss;
-            ss << number << "&";
-            const auto maxWildLevel = PoGoCmp::PlayerLevel.maxEncounterPlayerLevel
-                + PoGoCmp::WeatherBonus.cpBaseLevelBonus;
-            for (float level = 1; level <= maxWildLevel; ++level)
-                ss << "cp" << ComputeCp(pkm, { level, 15, 15, 15 }) << ",";
-            auto searchString = ss.str();
-            searchString.erase(searchString.end() - 1);
-            Log(searchString);
+            ss << "L" << IndexToLevel(c.level) << " " << atk << "/" << def << "/" << sta << " ("
+                << (int)std::round((atk + def + sta) * 100 / 45.f) << "%)";
+            Log(ss.str());
+        }
+        ret = EXIT_SUCCESS;
+    }
+
+    else if (auto cp = opts.OptionValue("cp"); !cp.empty())
+    {
+        if (opts.HasOption("--raidLevel"))
+            LogErrorAndExit("cp doesn't support --raidLevel.");
+
+        // Held until the end so that all of the results are computed from the same data.
+        const auto db = CurrentDatabase();
+        const auto species = db->Species();
+        for (const auto& arg : Split(cp, ",", StringUtils::RemoveEmptyEntries))
+        {
+            SpecieIndex idx{};
+            try
+            {
+                idx = ParseSpecie(*db, arg);
+            }
+            catch (const std::exception& e)
+            {
+                LogErrorAndExit(e.what());
+            }
+
+            const auto cpValue = db->ComputeCp(idx, pokemon.level, pokemon.atk, pokemon.def, pokemon.sta);
+            if (cpValue < 0)
+                LogErrorAndExit("Level " + FloatToString(pokemon.level) + " is not in the database.");
+            Log(PokemonIdToName(std::string(db->String(species[idx].id))) + ": " + std::to_string(cpValue));
+        }
+        ret = EXIT_SUCCESS;
+    }
+    else if (auto pvprank = opts.OptionValue("pvprank"); !pvprank.empty())
+    {
+        const auto args = Split(pvprank, ",", StringUtils::RemoveEmptyEntries);
+        if (args.empty() || args.size() > 2)
+            LogErrorAndExit("pvprank requires 1-2 comma-separated arguments.");
+
+        SpecieIndex idx{};
+        League league{League::Great};
+        int numResults = 10;
+        try
+        {
+            // The precomputed tables are built from the compiled-in data.
+            idx = ParseSpecie(*Database::Compiled(), args[0]);
+            if (args.size() > 1)
+            {
+                league = LeagueByName(args[1]);
+                if (league == League::NUM_LEAGUES)
+                    throw std::runtime_error("'" + args[1] + "' is not a valid league.");
+            }
+            if (auto resultsVal = opts.OptionValue("-r", "--results"); !resultsVal.empty())
+                numResults = ParseValue(resultsVal, INT_MIN, INT_MAX);
+            if (numResults < 0)
+                numResults = (int)NumIvCombinations;
         }
         catch(const std::exception& e)
         {
-            LogErrorAndExit(Concat("Not a valid name or number: ", e.what()));
+            LogErrorAndExit(Concat("Invalid pvprank arguments: ", e.what()));
         }
+
+        const auto& base = SpecieByIndex(idx);
+        auto printRank = [&](int rank, IvIndex iv, LevelIndex level)
+        {
+            std::stringstream ss;
+            ss << "#" << rank << " " << AtkIv(iv) << "/" << DefIv(iv) << "/" << StaIv(iv);
+            if (level == LevelIndex::Invalid)
+                ss << " exceeds the CP cap at every level";
+            else
+                ss << " L" << IndexToLevel(level) << " CP " << ComputeCp(base, level, AtkIv(iv), DefIv(iv), StaIv(iv))
+                    << " SP " << (int64_t)std::round(StatProduct(base, level, iv));
+            Log(ss.str());
+        };
+
+        const bool specificIvs = opts.HasOption("--ivs");
+        const auto ivs = ToIvIndex(pokemon.atk, pokemon.def, pokemon.sta);
+        if (auto rankFile = opts.OptionValue("--rankFile"); !rankFile.empty())
+        {
+            if (!specificIvs)
+                LogErrorAndExit("--rankFile can be used only together with --ivs.");
+            PvpRankFile file;
+            if (!file.Load(rankFile))
+                LogErrorAndExit("Failed to load '" + rankFile + "', or it doesn't match the current database.");
+            printRank(file.Rank(idx, league, ivs), ivs, file.Level(idx, league, ivs));
+        }
+        else
+        {
+            const auto tables = ComputePvpRanks(idx);
+            const auto& table = tables[(size_t)league];
+            if (specificIvs)
+            {
+                printRank(table.Rank(ivs), ivs, table.Level(ivs));
+            }
+            else
+            {
+                for (int rank = 1; rank <= std::min(numResults, (int)NumIvCombinations); ++rank)
+                {
+                    const auto iv = table.IvByRank(rank);
+                    printRank(rank, iv, table.Level(iv));
+                }
+            }
+        }
+        ret = EXIT_SUCCESS;
+    }
+    else if (auto path = opts.OptionValue("pvprank-export"); !path.empty())
+    {
+        if (!WritePvpRankFile(path))
+            LogErrorAndExit("Failed to write '" + path + "'.");
+        Log("PvP ranks written to '" + path + "'.");
         ret = EXIT_SUCCESS;
     }
 
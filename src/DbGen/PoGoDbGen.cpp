@@ -5,6 +5,8 @@
 ///! @todo try to remove the self-dependency
 #include "../Lib/PoGoDb.h"
 #include "../Lib/MathUtils.h"
+#include "../Lib/NameHash.h"
+#include "../Lib/DbSnapshot.h"
 
 #include <nlohmann/json.hpp>
 
@@ -18,6 +20,8 @@
 #include <set>
 #include <ctime>
 #include <map>
+#include <cmath>
+#include <numeric>
 
 std::string FloatLiteralToString(float f)
 {
@@ -28,6 +32,36 @@ std::string FloatLiteralToString(float f)
     return ss.str();
 }
 
+//! Returns the shortest literal which yields exactly the same float value when compiled.
+std::string ExactFloatLiteralToString(float f)
+{
+    std::stringstream ss;
+    for (auto precision = std::numeric_limits<float>::digits10; ; ++precision)
+    {
+        ss.str("");
+        ss << std::setprecision(precision) << f;
+        if (precision >= std::numeric_limits<float>::max_digits10 || std::stof(ss.str()) == f)
+            break;
+    }
+    if (ss.str().find_first_of(".e") != std::string::npos)
+        ss << "f";
+    return ss.str();
+}
+
+//! Returns the shortest literal which yields exactly the same double value when compiled.
+std::string ExactDoubleLiteralToString(double d)
+{
+    std::stringstream ss;
+    for (auto precision = std::numeric_limits<double>::digits10; ; ++precision)
+    {
+        ss.str("");
+        ss << std::setprecision(precision) << d;
+        if (precision >= std::numeric_limits<double>::max_digits10 || std::stod(ss.str()) == d)
+            break;
+    }
+    return ss.str();
+}
+
 using namespace std::string_literals;
 
 std::string DateTimeOffsetString(std::time_t timestampS)
@@ -47,6 +81,64 @@ void ReplaceAtEnd(std::string& str, const std::string& from, const std::string&
         str.replace(pos, from.size(), to);
 }
 
+//! Minimal perfect hash (hash and displace) of case-folded keys, see FoldNameChar(). The bucket of a key is
+//! NameHash(key, 0) % seeds.size() and its slot is NameHash(key, seed) % keys.size(), or -seed - 1 if the seed is
+//! negative.
+//! @param slots The index of the key in each slot.
+//! @return False if no seed was found for a bucket.
+bool GeneratePerfectHash(const std::vector<std::string>& keys, std::vector<int32_t>& seeds, std::vector<size_t>& slots)
+{
+    const size_t numBuckets = (keys.size() + 3) / 4;
+    std::vector<std::vector<size_t>> buckets(numBuckets);
+    for (size_t i = 0; i < keys.size(); ++i)
+        buckets[PoGoCmp::NameHash(keys[i], 0) % numBuckets].push_back(i);
+    std::vector<size_t> bucketOrder(numBuckets);
+    std::iota(bucketOrder.begin(), bucketOrder.end(), size_t{0});
+    std::stable_sort(bucketOrder.begin(), bucketOrder.end(),
+        [&buckets](size_t a, size_t b) { return buckets[a].size() > buckets[b].size(); });
+
+    const auto emptySlot = std::numeric_limits<size_t>::max();
+    seeds.assign(numBuckets, 0);
+    slots.assign(keys.size(), emptySlot);
+    size_t nextFreeSlot = 0;
+    for (auto bucketIdx : bucketOrder)
+    {
+        const auto& bucket = buckets[bucketIdx];
+        if (bucket.empty())
+            continue;
+        if (bucket.size() == 1)
+        {
+            // Single keys are placed directly into the free slots, encoded as negative seeds.
+            while (slots[nextFreeSlot] != emptySlot)
+                ++nextFreeSlot;
+            slots[nextFreeSlot] = bucket.front();
+            seeds[bucketIdx] = -int32_t(nextFreeSlot) - 1;
+            continue;
+        }
+        for (uint32_t seed = 1;; ++seed)
+        {
+            if (seed == std::numeric_limits<int32_t>::max())
+                return false;
+            std::vector<size_t> bucketSlots;
+            for (auto keyIdx : bucket)
+            {
+                const auto slot = PoGoCmp::NameHash(keys[keyIdx], seed) % keys.size();
+                if (slots[slot] != emptySlot || std::find(bucketSlots.begin(), bucketSlots.end(), slot) != bucketSlots.end())
+                    break;
+                bucketSlots.push_back(slot);
+            }
+            if (bucketSlots.size() == bucket.size())
+            {
+                for (size_t i = 0; i < bucketSlots.size(); ++i)
+                    slots[bucketSlots[i]] = bucket[i];
+                seeds[bucketIdx] = (int32_t)seed;
+                break;
+            }
+        }
+    }
+    return true;
+}
+
 //! @todo
 //! - rename to PoGoDataGen
 //! - separate functions (PoGoApi.h) and data (PoGoData.h)
@@ -55,7 +147,9 @@ int main(int argc, char **argv)
     auto args = Utf8::ParseArguments(argc, argv);
     if (args.size() != 2)
     {
-        std::cerr << "Exactly two arguments required. Usage: PoGoDbGen <inputJsonPath> <outputCppPath>\n";
+        std::cerr << "Exactly two arguments required. Usage: PoGoDbGen <inputJsonPath> <outputHeaderPath>\n"
+            "The data is written to a source file with the same name next to the header, e.g. PoGoDb.h -> PoGoDb.cpp,\n"
+            "and as a binary snapshot loadable at runtime, e.g. PoGoDb.bin.\n";
         return EXIT_FAILURE;
     }
 
@@ -75,6 +169,18 @@ int main(int argc, char **argv)
         return EXIT_FAILURE;
     }
 
+    // The header has only declarations for the tables so that there's exactly one instance of the data in a process.
+    const auto headerFileName = outputPath.substr(outputPath.find_last_of("/\\") + 1);
+    const auto sourcePath = outputPath.substr(0, outputPath.find_last_of('.')) + ".cpp";
+    const auto sourceFileName = sourcePath.substr(sourcePath.find_last_of("/\\") + 1);
+    const auto snapshotPath = outputPath.substr(0, outputPath.find_last_of('.')) + ".bin";
+    Utf8::ofstream source{ sourcePath };
+    if (!source.is_open())
+    {
+        Utf8::PrintLine("Failed to open " + sourcePath, Utf8::OutputStream::Err);
+        return EXIT_FAILURE;
+    }
+
     using namespace PoGoCmp;
 
     struct PokemonSpecieTemp
@@ -152,7 +258,7 @@ int main(int argc, char **argv)
 
     auto writeMove = [&](const Move& m)
     {
-        output
+        source
             << "{"
             << std::quoted(m.id) << ", "
             << "PokemonType::" << PokemonTypeToString(m.type) << ", "
@@ -417,17 +523,29 @@ int main(int argc, char **argv)
             << "\n"
             << "    Input file's timestamp " << dateTimeOffset << " */\n";
 
+    source  << "/** @file " << sourceFileName << "\n"
+            << "    @brief Data of " << headerFileName << ", generated by PoGoDbGen.\n"
+            << "\n"
+            << "    Input file's timestamp " << dateTimeOffset << " */\n"
+            << "#include \"" << headerFileName << "\"\n"
+            << "\n"
+            << "namespace PoGoCmp {\n"
+            << "\n";
+
     output <<
 R"(
 #pragma once
 
+#include "PoGoCmpApi.h"
 #include "Utf8.h"
 #include "StringUtils.h"
+#include "NameHash.h"
 
 #include <cstdint>
 #include <string>
+#include <string_view>
 #include <array>
-#include <map>
+#include <utility>
 #include <algorithm>
 #include <locale>
 #ifndef _WIN32
@@ -458,25 +576,61 @@ R"(enum class PokemonRarity : uint8_t
 };
 )";
 
-    auto vectorToString = [&](const auto& vec, int valuesPerRow, const char* literalPostfix)
+    //! @param depth Indentation depth of the declaration, 1 for struct members, 0 for namespace-scope variables.
+    auto vectorToString = [&](const auto& vec, int valuesPerRow, const char* literalPostfix, size_t depth = 1)
     {
+        std::string declIndent;
+        for (size_t i = 0; i < depth; ++i) declIndent += indent;
         std::stringstream ss;
         ss << "{{";
         auto size = vec.size();
         for (size_t i = 0; i < size; ++i)
         {
-            if (i % valuesPerRow == 0) ss << '\n' << indent << indent;
+            if (i % valuesPerRow == 0) ss << '\n' << declIndent << indent;
             else ss << ' ';
             ss << vec[i] << literalPostfix;
             if (i < size - 1) ss << ',';
         }
-        ss << '\n' << indent << "}};";
+        ss << '\n' << declIndent << "}};";
         return ss.str();
     };
 
+    // The CP multipliers are used for computing the half-level table below so make sure that the compiled values
+    // are bit-exactly the same as the ones used by the generator.
+    std::vector<std::string> cpMultiplierLiterals;
+    for (auto cpm : playerLevel.cpMultiplier)
+        cpMultiplierLiterals.push_back(ExactFloatLiteralToString(cpm));
+
+    // Half-level CPMs: the CP multiplier's square grows linearly between two whole levels.
+    std::vector<float> halfLevelCpMultiplier;
+    for (size_t i = 0; i < numLevels; ++i)
+    {
+        const auto cpmBase = playerLevel.cpMultiplier[i];
+        halfLevelCpMultiplier.push_back(cpmBase);
+        if (i + 1 < numLevels)
+        {
+            const auto cpmNext = playerLevel.cpMultiplier[i + 1];
+            const auto cpmStep = (std::pow(cpmNext, 2) - std::pow(cpmBase, 2)) / 2.f;
+            halfLevelCpMultiplier.push_back((float)std::sqrt(std::pow(cpmBase, 2) + cpmStep));
+        }
+    }
+    const auto numHalfLevels = halfLevelCpMultiplier.size();
+    std::vector<std::string> halfLevelCpMultiplierLiterals, halfLevelCpMultiplierSquaredLiterals;
+    std::vector<uint32_t> halfLevelCpMultiplierQ27;
+    for (auto cpm : halfLevelCpMultiplier)
+    {
+        halfLevelCpMultiplierLiterals.push_back(ExactFloatLiteralToString(cpm));
+        // A product of two floats is always exactly representable as a double.
+        halfLevelCpMultiplierSquaredLiterals.push_back(ExactDoubleLiteralToString((double)cpm * (double)cpm));
+        // All CPMs are >= 2^-4 so the 24-bit mantissa always fits in 27 fractional bits.
+        const auto fixed = std::ldexp(cpm, 27);
+        assert(fixed == std::floor(fixed) && fixed < (1u << 27));
+        halfLevelCpMultiplierQ27.push_back((uint32_t)fixed);
+    }
+
     output <<
         "\n"
-        "const struct PlayerLevelSettings\n" +
+        "constexpr struct PlayerLevelSettings\n" +
         "{\n"s +
         indent << "//! The required amount of XP to level up.\n" +
         indent + "std::array<uint32_t, " + std::to_string(numLevels) + "> requiredExperience" + vectorToString(playerLevel.requiredExperience, 10, "") + "\n" +
@@ -486,12 +640,22 @@ R"(enum class PokemonRarity : uint8_t
         indent + "//! Additional WeatherBonus.cpBaseLevelBonus can be added to this for wild encounters.\n" +
         indent + "uint8_t  maxEncounterPlayerLevel{" << playerLevel.maxEncounterPlayerLevel << "};\n" +
         indent + "//! Combat point (CP) multipliers for different Pokémon levels.\n" +
-        indent + "std::array<float, " + std::to_string(numLevels) + "> cpMultiplier" + vectorToString(playerLevel.cpMultiplier, 10, "f") + "\n" +
+        indent + "std::array<float, " + std::to_string(numLevels) + "> cpMultiplier" + vectorToString(cpMultiplierLiterals, 10, "") + "\n" +
         "} PlayerLevel;\n";
 
     output <<
         "\n"
-        "const struct PokemonUpgradeSettings\n" +
+        "//! CP multipliers for all Pokémon levels, [1,maxLevel], 0.5 steps, indexed using PoGoCmp::LevelIndex.\n"
+        "//! For whole levels the values are the same as in PlayerLevel.cpMultiplier.\n"
+        "constexpr std::array<float, " + std::to_string(numHalfLevels) + "> HalfLevelCpMultiplier" + vectorToString(halfLevelCpMultiplierLiterals, 10, "", 0) + "\n" +
+        "//! Squares of HalfLevelCpMultiplier, exact.\n"
+        "constexpr std::array<double, " + std::to_string(numHalfLevels) + "> HalfLevelCpMultiplierSquared" + vectorToString(halfLevelCpMultiplierSquaredLiterals, 5, "", 0) + "\n" +
+        "//! HalfLevelCpMultiplier as unsigned fixed-point numbers with 27 fractional bits, exact.\n"
+        "constexpr std::array<uint32_t, " + std::to_string(numHalfLevels) + "> HalfLevelCpMultiplierQ27" + vectorToString(halfLevelCpMultiplierQ27, 10, "", 0) + "\n";
+
+    output <<
+        "\n"
+        "constexpr struct PokemonUpgradeSettings\n" +
         "{\n"s +
         indent + "//! How many power-ups a level consists of.\n" +
         indent + "uint8_t upgradesPerLevel{" + std::to_string(pokemonUpgrades.upgradesPerLevel) + "};\n" +
@@ -505,7 +669,7 @@ R"(enum class PokemonRarity : uint8_t
 
     output <<
         "\n"
-        "const struct WeatherBonusSettings\n" +
+        "constexpr struct WeatherBonusSettings\n" +
         "{\n"s +
         indent + "//! Maximum level increase for a weather boosted Pokémon.\n" +
         indent + "uint8_t cpBaseLevelBonus{" + std::to_string(weatherBonus.cpBaseLevelBonus) + "};\n" +
@@ -566,6 +730,15 @@ enum class PokemonType : int8_t
 //! 0 is an invalid number.
 using PokedexNumber = std::uint16_t;
 
+//! A Pokémon's fast or charge moves: a range of PokemonMoves.
+struct MoveSpan
+{
+    //! Index of the first move in PokemonMoves.
+    uint16_t offset;
+    //! Number of moves.
+    uint16_t size;
+};
+
 struct PokemonSpecie
 {
     //! Pokédex number.
@@ -578,15 +751,16 @@ struct PokemonSpecie
     uint16_t baseSta;
     //! Pokémon's ID/specie name, uppercase with underscores.
     //! Use PokemonIdToName() to translate this into a proper name.
-    std::string id;
+    //! @note Refers to a string literal so data() is null-terminated.
+    std::string_view id;
     //! Primary type.
     PokemonType type;
     //! Secondary type, if applicable.
     PokemonType type2;
-    //! Fast move IDs.
-    std::vector<std::string> fastMoves;
-    //! Charge move IDs.
-    std::vector<std::string> chargeMoves;
+    //! Fast moves, iterate using begin() and end(), e.g. for (MoveId move : pkm.fastMoves).
+    MoveSpan fastMoves;
+    //! Charge moves.
+    MoveSpan chargeMoves;
     //! Rarity type.
     PokemonRarity rarity;
     //! How much tracked buddy walking is required for a candy, in kilometers.
@@ -594,57 +768,113 @@ struct PokemonSpecie
     //! If both malePercent and femalePercent are 0, it means the Pokémon is genderless.
     float malePercent;
     float femalePercent;
+    //! CP at level 1 with 0 IVs, the same as MinCp().
+    uint16_t minCp;
+    //! CP at max. level with perfect IVs, the same as MaxCp().
+    uint16_t maxCp;
+    //! baseAtk + baseDef + baseSta.
+    uint16_t total;
+    //! baseDef * baseSta.
+    uint32_t bulk;
 };
 
 )";
 
     output << "//! Type-effectiveness scalar table, use PokemonType enum to access.\n";
     output << "//! @sa AttackScalars\n";
-    output << "static const std::array<std::array<float, 18>, 18> TypeEffectiveness{{\n";
-    //output << "static const float TypeEffectiveness[18][18]{\n";
+    output << "POGOCMP_API extern const std::array<std::array<float, 18>, 18> TypeEffectiveness;\n\n";
+    source << "const std::array<std::array<float, 18>, 18> TypeEffectiveness{{\n";
     for (size_t i = 0; i < numTypes; ++i)
     {
-        output << indent << "{ ";
+        source << indent << "{ ";
         for (size_t j = 0; j < numTypes; ++j)
         {
             auto scalar = typeEffectiveness[i][j];
             assert(!MathUtils::IsZero(scalar));
-            output << typeEffectiveness[i][j];
-            if (!MathUtils::Equals(scalar, 1)) output << "f";
-            if (j < numTypes - 1) output << ",";
-            output << " ";
+            source << typeEffectiveness[i][j];
+            if (!MathUtils::Equals(scalar, 1)) source << "f";
+            if (j < numTypes - 1) source << ",";
+            source << " ";
         }
-        output << "}";
-        if (i < numTypes - 1) output << ",";
-        output << "\n";
+        source << "}";
+        if (i < numTypes - 1) source << ",";
+        source << "\n";
     }
-    output << "}};\n\n";
+    source << "}};\n\n";
     //output << "};\n\n";
 
 
-    auto writePokemon = [&](const PokemonSpecieTemp& pkm)
+    // Same computation as in ComputeCp(), operation by operation, so that the results are bit-exactly the same.
+    auto computeCp = [&halfLevelCpMultiplier](size_t levelIdx, int atk, int def, int sta)
     {
-        const auto quote = [](const std::string& m) { return "\"" + m + "\""; };
-        auto fm = pkm.fastMoves;
-        std::transform(fm.begin(), fm.end(), fm.begin(), quote);
-        auto cm = pkm.chargeMoves;
-        std::transform(cm.begin(), cm.end(), cm.begin(), quote);
+        const auto cpm = halfLevelCpMultiplier[levelIdx];
+        const auto cpmSquared = (double)cpm * (double)cpm;
+        return static_cast<int>(std::floor(
+            float(atk) * std::pow(float(def), 0.5f) * std::pow(float(sta), 0.5f) * cpmSquared / 10.f));
+    };
 
-        output << "{"
+    // The movesets of all Pokémon as one array of move IDs, identical movesets are stored only once.
+    std::vector<std::string> pokemonMoves;
+    std::map<std::vector<std::string>, size_t> moveSpanOffsets;
+    auto moveSpan = [&](const std::vector<std::string>& moveset)
+    {
+        auto it = moveSpanOffsets.find(moveset);
+        if (it == moveSpanOffsets.end())
+        {
+            it = moveSpanOffsets.emplace(moveset, pokemonMoves.size()).first;
+            for (const auto& move : moveset)
+                pokemonMoves.push_back("MoveId::" + move);
+        }
+        assert(it->second + moveset.size() <= UINT16_MAX);
+        return "{" + std::to_string(it->second) + ", " + std::to_string(moveset.size()) + "}";
+    };
+
+    // The parsed moves are keyed by the game's template IDs, e.g. "EMBER_FAST", the written ones by Move::id.
+    std::map<std::string, const Move*> movesById;
+    for (const auto& kvp : moves)
+    {
+        if (!movesById.emplace(kvp.second.id, &kvp.second).second)
+        {
+            std::cerr << "Duplicate move ID '" << kvp.second.id << "'\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    for (const auto& kvp : pokemonTable)
+    {
+        for (const auto* moveset : { &kvp.second.fastMoves, &kvp.second.chargeMoves })
+        {
+            for (const auto& move : *moveset)
+            {
+                if (movesById.find(move) == movesById.end())
+                {
+                    std::cerr << "Unknown move '" << move << "' in the moveset of " << kvp.second.id << "\n";
+                    return EXIT_FAILURE;
+                }
+            }
+        }
+    }
+
+    auto writePokemon = [&](const PokemonSpecieTemp& pkm)
+    {
+        source << "{"
             << pkm.number << ", " << pkm.baseAtk << ", " << pkm.baseDef << ", " << pkm.baseSta
             << ", " << std::quoted(!pkm.formId.empty() ? pkm.formId : pkm.id) << ", PokemonType::"
             << PokemonTypeToString(pkm.type) << ", PokemonType::" << PokemonTypeToString(pkm.type2) << ", "
-            << "{" << StringUtils::Join(fm, ", ") << "}, " << "{" << StringUtils::Join(cm, ", ") << "}"
+            << moveSpan(pkm.fastMoves) << ", " << moveSpan(pkm.chargeMoves)
             << ", PokemonRarity::" << PokemonRarityToString(pkm.rarity) << ", " << (int)pkm.buddyDistance
             << ", " << pkm.malePercent << ", " << pkm.femalePercent
+            << ", " << computeCp(0, pkm.baseAtk, pkm.baseDef, pkm.baseSta)
+            << ", " << computeCp(numHalfLevels - 1, pkm.baseAtk + 15, pkm.baseDef + 15, pkm.baseSta + 15)
+            << ", " << pkm.baseAtk + pkm.baseDef + pkm.baseSta << ", " << (uint32_t)pkm.baseDef * pkm.baseSta
             << "}";
     };
 
     auto writePokemonMapEntry = [&](const PokemonTable::key_type& key, const PokemonSpecieTemp& pkm)
     {
-        output << indent << "{ " << key << ", ";
+        source << indent << "{ " << key << ", ";
         writePokemon(pkm);
-        output << " },\n";
+        source << " },\n";
     };
 
     auto writeForms = [&](const auto& formRange)
@@ -662,10 +892,57 @@ struct PokemonSpecie
     };
 
     //output << "static const std::map<uint16_t, PokemonSpecie> PokemonByNumber {\n";
-    output << "//! A Pokémon can have multiple forms.\n";
     //output << "//! Use PokemonIndex() for the index in PoGoCmp::PokemonByNumber.\n";
     //output << "static const std::array<std::vector<PokemonSpecie>, " << pokemonTable.size() << "> PokemonByNumber{\n";
-    output << "static const std::multimap<uint16_t, PokemonSpecie> PokemonByNumber{\n";
+    output <<
+R"(//! Read-only std::multimap look-alike on top of a sorted array so that it can be constant-initialized,
+//! i.e. no heap allocations nor dynamic initialization at startup.
+template <typename Key, typename T, size_t N>
+struct ConstMultimap
+{
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<Key, T>;
+    using const_iterator = const value_type*;
+    using iterator = const_iterator;
+
+    //! Sorted by key, the values with the same key in insertion order.
+    std::array<value_type, N> values;
+
+    constexpr const_iterator begin() const { return values.data(); }
+    constexpr const_iterator end() const { return values.data() + N; }
+    constexpr size_t size() const { return N; }
+    constexpr bool empty() const { return N == 0; }
+
+    const_iterator lower_bound(const Key& key) const
+    {
+        return std::lower_bound(begin(), end(), key, [](const value_type& v, const Key& k) { return v.first < k; });
+    }
+    const_iterator upper_bound(const Key& key) const
+    {
+        return std::upper_bound(begin(), end(), key, [](const Key& k, const value_type& v) { return k < v.first; });
+    }
+    std::pair<const_iterator, const_iterator> equal_range(const Key& key) const
+    {
+        return { lower_bound(key), upper_bound(key) };
+    }
+    size_t count(const Key& key) const
+    {
+        const auto range = equal_range(key);
+        return size_t(range.second - range.first);
+    }
+    const_iterator find(const Key& key) const
+    {
+        const auto it = lower_bound(key);
+        return it != end() && it->first == key ? it : end();
+    }
+};
+
+)";
+    const auto pokemonByNumberType = "ConstMultimap<uint16_t, PokemonSpecie, " + std::to_string(pokemonTable.size()) + ">";
+    output << "//! A Pokémon can have multiple forms.\n";
+    output << "POGOCMP_API extern const " << pokemonByNumberType << " PokemonByNumber;\n";
+    source << "const " << pokemonByNumberType << " PokemonByNumber{{{\n";
     for(auto it = pokemonTable.begin(), end = pokemonTable.end();
         it != end;
         it = pokemonTable.upper_bound(it->first)) // iterate only unique keys
@@ -673,7 +950,114 @@ struct PokemonSpecie
         //output << indent;
         writeForms(pokemonTable.equal_range(it->first));
     }
-    output << "};\n";
+    source << "}}};\n";
+
+    // The same rows in the same order as PokemonByNumber, one array per column.
+    const auto numRows = std::to_string(pokemonTable.size());
+    const auto maxNumber = pokemonTable.empty() ? 0 : pokemonTable.rbegin()->first;
+    std::vector<int> numbers, baseAtks, baseDefs, baseStas, buddyDistances;
+    std::vector<std::string> types, types2, rarities;
+    std::vector<size_t> numberOffsets, statGroups;
+    for (const auto& [number, pkm] : pokemonTable)
+    {
+        while (numberOffsets.size() <= number) numberOffsets.push_back(numbers.size());
+        // The first earlier form with the same stats, if any, is the representative of the group.
+        auto statGroup = numbers.size();
+        for (auto row = numberOffsets[number]; row < numbers.size(); ++row)
+        {
+            if ((int)pkm.baseAtk == baseAtks[row] && (int)pkm.baseDef == baseDefs[row] && (int)pkm.baseSta == baseStas[row])
+            {
+                statGroup = statGroups[row];
+                break;
+            }
+        }
+        statGroups.push_back(statGroup);
+        numbers.push_back(number);
+        baseAtks.push_back(pkm.baseAtk);
+        baseDefs.push_back(pkm.baseDef);
+        baseStas.push_back(pkm.baseSta);
+        types.push_back("PokemonType::"s + PokemonTypeToString(pkm.type));
+        types2.push_back("PokemonType::"s + PokemonTypeToString(pkm.type2));
+        rarities.push_back("PokemonRarity::"s + PokemonRarityToString(pkm.rarity));
+        buddyDistances.push_back(pkm.buddyDistance);
+    }
+    while (numberOffsets.size() <= maxNumber + 1u) numberOffsets.push_back(numbers.size());
+
+    // Base IDs of the Pokémon whose forms all have the same stats, e.g. Unown.
+    const auto noBaseId = std::numeric_limits<uint16_t>::max();
+    std::vector<size_t> baseIdIndices(numbers.size(), noBaseId);
+    std::vector<std::string> baseIds;
+    {
+        auto it = pokemonTable.begin();
+        for (size_t number = 0; number + 1 < numberOffsets.size(); ++number)
+        {
+            const auto first = numberOffsets[number], last = numberOffsets[number + 1];
+            const bool sameStats = last - first > 1 && std::all_of(statGroups.begin() + first, statGroups.begin() + last,
+                [&](size_t statGroup) { return statGroup == first; });
+            if (sameStats)
+            {
+                std::fill(baseIdIndices.begin() + first, baseIdIndices.begin() + last, baseIds.size());
+                baseIds.push_back('"' + it->second.id + '"');
+            }
+            std::advance(it, last - first);
+        }
+    }
+
+    // The arrays are emitted as aggregate initializers of the columns, i.e. without the trailing semicolon.
+    auto column = [&](const auto& vec, int valuesPerRow)
+    {
+        auto str = vectorToString(vec, valuesPerRow, "");
+        str.pop_back();
+        return str;
+    };
+
+    output <<
+        "\n"
+        "//! Structure-of-arrays copy of the most commonly used PokemonByNumber columns for fast linear scans.\n"
+        "//! Row i is the i:th entry in PokemonByNumber's iteration order, i.e. PoGoCmp::SpecieIndex i.\n"
+        "struct PokemonColumnTable\n"
+        "{\n" +
+        indent + "std::array<PokedexNumber, " + numRows + "> number;\n" +
+        indent + "std::array<uint16_t, " + numRows + "> baseAtk;\n" +
+        indent + "std::array<uint16_t, " + numRows + "> baseDef;\n" +
+        indent + "std::array<uint16_t, " + numRows + "> baseSta;\n" +
+        indent + "std::array<PokemonType, " + numRows + "> type;\n" +
+        indent + "std::array<PokemonType, " + numRows + "> type2;\n" +
+        indent + "std::array<PokemonRarity, " + numRows + "> rarity;\n" +
+        indent + "std::array<uint8_t, " + numRows + "> buddyDistance;\n" +
+        indent + "//! Row of the first form with the same Pokédex number and base stats, i.e. the rows with the same statGroup\n" +
+        indent + "//! are forms that differ only by name and type.\n" +
+        indent + "std::array<uint16_t, " + numRows + "> statGroup;\n" +
+        indent + "//! Index to PokemonBaseIds if all forms of the Pokémon have the same base stats, NoBaseId otherwise.\n" +
+        indent + "std::array<uint16_t, " + numRows + "> baseId;\n" +
+        indent + "//! Rows [numberOffset[n], numberOffset[n + 1]) are the forms of Pokédex number n, empty if none.\n" +
+        indent + "std::array<uint16_t, " + std::to_string(numberOffsets.size()) + "> numberOffset;\n" +
+        "};\n"
+        "\n"
+        "POGOCMP_API extern const PokemonColumnTable PokemonColumns;\n"
+        "\n"
+        "//! Base IDs of the Pokémon whose forms all have the same base stats, e.g. UNOWN, see PokemonColumnTable::baseId.\n"
+        "POGOCMP_API extern const std::array<std::string_view, " + std::to_string(baseIds.size()) + "> PokemonBaseIds;\n"
+        "constexpr uint16_t NoBaseId = UINT16_MAX;\n";
+
+    source <<
+        "\n"
+        "const PokemonColumnTable PokemonColumns{\n" +
+        indent + "// number\n" + indent + column(numbers, 20) + ",\n" +
+        indent + "// baseAtk\n" + indent + column(baseAtks, 20) + ",\n" +
+        indent + "// baseDef\n" + indent + column(baseDefs, 20) + ",\n" +
+        indent + "// baseSta\n" + indent + column(baseStas, 20) + ",\n" +
+        indent + "// type\n" + indent + column(types, 5) + ",\n" +
+        indent + "// type2\n" + indent + column(types2, 5) + ",\n" +
+        indent + "// rarity\n" + indent + column(rarities, 5) + ",\n" +
+        indent + "// buddyDistance\n" + indent + column(buddyDistances, 20) + ",\n" +
+        indent + "// statGroup\n" + indent + column(statGroups, 20) + ",\n" +
+        indent + "// baseId\n" + indent + column(baseIdIndices, 20) + ",\n" +
+        indent + "// numberOffset\n" + indent + column(numberOffsets, 20) + "\n" +
+        "};\n"
+        "\n"
+        "const std::array<std::string_view, " + std::to_string(baseIds.size()) + "> PokemonBaseIds" +
+        vectorToString(baseIds, 8, "", 0) + "\n";
 
     output <<
 R"(
@@ -681,7 +1065,8 @@ R"(
 //! This structure holds the information for both mechanics.
 struct Move
 {
-    std::string id;
+    //! @note Refers to a string literal so data() is null-terminated.
+    std::string_view id;
     PokemonType type;
     float combatPower;
     float pvpPower;
@@ -692,20 +1077,209 @@ struct Move
     float damageWindowStartMs; // applies only for combat.
     float damageWindowEndMs; // applies only for combat.
 
-    bool IsFastMove() const { return combatEnergy > 0; }
-    bool IsChargeMove() const { return !IsFastMove(); }
+    constexpr bool IsFastMove() const { return combatEnergy > 0; }
+    constexpr bool IsChargeMove() const { return !IsFastMove(); }
 };
 
 )";
 
-    output << "static const std::array<Move, " << moves.size() << "> Moves{{\n";
-    for (auto&[name, move] : moves)
+    output << "//! Index to Moves, the enumerator names are the same as Move::id.\n";
+    output << "enum class MoveId : uint16_t\n";
+    output << "{\n";
+    for (const auto& kvp : movesById)
+        output << indent << kvp.first << ",\n";
+    output << indent << "//! Unspecified/invalid.\n";
+    output << indent << "NONE = UINT16_MAX\n";
+    output << "};\n\n";
+
+    const auto movesType = "std::array<Move, " + std::to_string(movesById.size()) + ">";
+    output << "//! Sorted by Move::id.\n";
+    output << "POGOCMP_API extern const " << movesType << " Moves;\n\n";
+    source << "\n";
+    source << "const " << movesType << " Moves{{\n";
+    for (const auto& kvp : movesById)
     {
-        output << indent;
-        writeMove(move);
-        output << ",\n";
+        source << indent;
+        writeMove(*kvp.second);
+        source << ",\n";
+    }
+    source << "}};\n\n";
+
+    const auto pokemonMovesType = "std::array<MoveId, " + std::to_string(pokemonMoves.size()) + ">";
+    output << "//! The movesets of all Pokémon, referenced by PokemonSpecie::fastMoves and PokemonSpecie::chargeMoves.\n";
+    output << "POGOCMP_API extern const " << pokemonMovesType << " PokemonMoves;\n\n";
+    source << "const " << pokemonMovesType << " PokemonMoves" << vectorToString(pokemonMoves, 5, "", 0) << "\n";
+
+    // Move indexes: a perfect hash of the IDs, the fast and charge moves partitioned and the moves grouped by type.
+    std::vector<std::string> moveKeys;
+    std::vector<const Move*> moveList;
+    for (const auto& kvp : movesById)
+    {
+        moveKeys.push_back(kvp.first);
+        moveList.push_back(kvp.second);
+    }
+    std::vector<int32_t> moveIdSeeds;
+    std::vector<size_t> moveIdSlots;
+    if (!GeneratePerfectHash(moveKeys, moveIdSeeds, moveIdSlots))
+    {
+        std::cerr << "Failed to generate perfect hash for the moves\n";
+        return EXIT_FAILURE;
+    }
+    std::vector<size_t> movesByKind, movesByType, movesByTypeOffsets;
+    for (bool fast : { true, false })
+    {
+        for (size_t i = 0; i < moveList.size(); ++i)
+            if (moveList[i]->IsFastMove() == fast)
+                movesByKind.push_back(i);
+    }
+    const auto numFastMoves = (size_t)std::count_if(moveList.begin(), moveList.end(),
+        [](const Move* move) { return move->IsFastMove(); });
+    for (int type = 0; type < (int)PokemonType::NUM_TYPES; ++type)
+    {
+        for (bool fast : { true, false })
+        {
+            movesByTypeOffsets.push_back(movesByType.size());
+            for (size_t i = 0; i < moveList.size(); ++i)
+                if ((int)moveList[i]->type == type && moveList[i]->IsFastMove() == fast)
+                    movesByType.push_back(i);
+        }
+    }
+    movesByTypeOffsets.push_back(movesByType.size());
+    if (movesByType.size() != moveKeys.size())
+    {
+        std::cerr << "Moves with an invalid type\n";
+        return EXIT_FAILURE;
     }
-    output << "}};\n\n";
+    auto moveIdsToString = [&](const std::vector<size_t>& indices)
+    {
+        std::vector<std::string> ids;
+        for (auto i : indices)
+            ids.push_back("MoveId::" + moveKeys[i]);
+        return vectorToString(ids, 4, "", 0);
+    };
+    const auto moveIdSeedsType = "std::array<int32_t, " + std::to_string(moveIdSeeds.size()) + ">";
+    const auto moveIdsType = "std::array<MoveId, " + std::to_string(moveKeys.size()) + ">";
+    const auto movesByTypeOffsetsType = "std::array<uint16_t, " + std::to_string(movesByTypeOffsets.size()) + ">";
+    output <<
+R"(//! Seeds of the perfect hash buckets of the move IDs, see PokemonNameSeeds.
+POGOCMP_API extern const )" << moveIdSeedsType << R"( MoveIdSeeds;
+//! Minimal perfect hash table of the move IDs, see MoveIdByName().
+POGOCMP_API extern const )" << moveIdsType << R"( MoveIdSlots;
+//! All moves, fast moves first and charge moves after them (see Move::IsFastMove()), sorted by ID within the two.
+POGOCMP_API extern const )" << moveIdsType << R"( MovesByKind;
+//! Number of fast moves at the beginning of MovesByKind.
+constexpr size_t NumFastMoves = )" << numFastMoves << R"(;
+//! All moves grouped by type and the groups by fast and charge moves, sorted by ID within the groups.
+POGOCMP_API extern const )" << moveIdsType << R"( MovesByType;
+//! Offsets of the groups in MovesByType: the fast moves of type t are [MovesByTypeOffsets[2t], MovesByTypeOffsets[2t+1])
+//! and the charge moves [MovesByTypeOffsets[2t+1], MovesByTypeOffsets[2t+2]).
+POGOCMP_API extern const )" << movesByTypeOffsetsType << R"( MovesByTypeOffsets;
+
+static inline const MoveId* begin(const MoveSpan& span) { return PokemonMoves.data() + span.offset; }
+static inline const MoveId* end(const MoveSpan& span) { return PokemonMoves.data() + span.offset + span.size; }
+
+static inline const Move& MoveById(MoveId id) { return Moves[(size_t)id]; }
+
+//! @param id Move::id, handled case-insensitively, see FoldNameChar().
+//! @return MoveId::NONE if not found. O(1), no allocations.
+static inline MoveId MoveIdByName(std::string_view id)
+{
+    const auto seed = MoveIdSeeds[NameHash(id, 0) % MoveIdSeeds.size()];
+    const auto slot = seed < 0 ? size_t(-(seed + 1)) : NameHash(id, (uint32_t)seed) % MoveIdSlots.size();
+    const auto move = MoveIdSlots[slot];
+    return NameEquals(MoveById(move).id, id) ? move : MoveId::NONE;
+}
+
+//! Range of moves in one of the move indexes, e.g. MovesByKind.
+struct MoveIdList
+{
+    const MoveId* first;
+    const MoveId* last;
+
+    const MoveId* begin() const { return first; }
+    const MoveId* end() const { return last; }
+    size_t size() const { return size_t(last - first); }
+    bool empty() const { return first == last; }
+};
+
+static inline MoveIdList FastMoves() { return { MovesByKind.data(), MovesByKind.data() + NumFastMoves }; }
+static inline MoveIdList ChargeMoves() { return { MovesByKind.data() + NumFastMoves, MovesByKind.data() + MovesByKind.size() }; }
+
+//! @param firstGroup, lastGroup [firstGroup, lastGroup) in MovesByTypeOffsets of the type.
+//! @return Empty if the type is invalid.
+static inline MoveIdList MovesByTypeGroups(PokemonType type, size_t firstGroup, size_t lastGroup)
+{
+    if (type <= PokemonType::NONE || type >= PokemonType::NUM_TYPES) return { nullptr, nullptr };
+    const auto offset = (size_t)type * 2;
+    return { MovesByType.data() + MovesByTypeOffsets[offset + firstGroup], MovesByType.data() + MovesByTypeOffsets[offset + lastGroup] };
+}
+
+//! @return Fast moves first, empty if the type is invalid.
+static inline MoveIdList MovesOfType(PokemonType type) { return MovesByTypeGroups(type, 0, 2); }
+static inline MoveIdList FastMovesOfType(PokemonType type) { return MovesByTypeGroups(type, 0, 1); }
+static inline MoveIdList ChargeMovesOfType(PokemonType type) { return MovesByTypeGroups(type, 1, 2); }
+
+)";
+    source << "\n";
+    source << "const " << moveIdSeedsType << " MoveIdSeeds" << vectorToString(moveIdSeeds, 16, "", 0) << "\n";
+    source << "const " << moveIdsType << " MoveIdSlots" << moveIdsToString(moveIdSlots) << "\n";
+    source << "const " << moveIdsType << " MovesByKind" << moveIdsToString(movesByKind) << "\n";
+    source << "const " << moveIdsType << " MovesByType" << moveIdsToString(movesByType) << "\n";
+    source << "const " << movesByTypeOffsetsType << " MovesByTypeOffsets" << vectorToString(movesByTypeOffsets, 20, "", 0) << "\n";
+
+    // Inverted index from the moves to the species/forms learning them, in compressed sparse row format.
+    std::vector<std::vector<size_t>> learnersByMove(moveKeys.size());
+    size_t specieIndex = 0;
+    for (const auto& kvp : pokemonTable)
+    {
+        for (const auto* moveset : { &kvp.second.fastMoves, &kvp.second.chargeMoves })
+        {
+            for (const auto& move : *moveset)
+            {
+                auto& learners = learnersByMove[std::lower_bound(moveKeys.begin(), moveKeys.end(), move) - moveKeys.begin()];
+                if (learners.empty() || learners.back() != specieIndex)
+                    learners.push_back(specieIndex);
+            }
+        }
+        ++specieIndex;
+    }
+    std::vector<size_t> moveLearners, moveLearnerOffsets;
+    for (const auto& learners : learnersByMove)
+    {
+        moveLearnerOffsets.push_back(moveLearners.size());
+        moveLearners.insert(moveLearners.end(), learners.begin(), learners.end());
+    }
+    moveLearnerOffsets.push_back(moveLearners.size());
+    const auto moveLearnersType = "std::array<uint16_t, " + std::to_string(moveLearners.size()) + ">";
+    const auto moveLearnerOffsetsType = "std::array<uint16_t, " + std::to_string(moveLearnerOffsets.size()) + ">";
+    output <<
+R"(//! The species/forms learning the moves, as fast or charge moves, as indices to PokemonByNumber in ascending order.
+//! The learners of move m are [MoveLearnerOffsets[m], MoveLearnerOffsets[m+1]), see LearnersOf().
+POGOCMP_API extern const )" << moveLearnersType << R"( MoveLearners;
+POGOCMP_API extern const )" << moveLearnerOffsetsType << R"( MoveLearnerOffsets;
+
+//! Range of MoveLearners.
+struct MoveLearnerList
+{
+    const uint16_t* first;
+    const uint16_t* last;
+
+    const uint16_t* begin() const { return first; }
+    const uint16_t* end() const { return last; }
+    size_t size() const { return size_t(last - first); }
+    bool empty() const { return first == last; }
+};
+
+//! @return Indices to PokemonByNumber in ascending order, empty if no Pokémon learns the move or it's invalid.
+static inline MoveLearnerList LearnersOf(MoveId move)
+{
+    if ((size_t)move >= Moves.size()) return { nullptr, nullptr };
+    return { MoveLearners.data() + MoveLearnerOffsets[(size_t)move], MoveLearners.data() + MoveLearnerOffsets[(size_t)move + 1] };
+}
+
+)";
+    source << "const " << moveLearnersType << " MoveLearners" << vectorToString(moveLearners, 20, "", 0) << "\n";
+    source << "const " << moveLearnerOffsetsType << " MoveLearnerOffsets" << vectorToString(moveLearnerOffsets, 20, "", 0) << "\n";
 
     output <<
 R"(//! Case-insensitive string comparison.
@@ -747,16 +1321,16 @@ struct StringLessThanI
     output <<
 R"(
 using PokedexRange = std::pair<PokedexNumber, PokedexNumber>;
-const PokedexRange Gen1Range{ PokedexNumber{1}, PokedexNumber{151} };
-const PokedexRange Gen2Range{ PokedexNumber{152}, PokedexNumber{251} };
-const PokedexRange Gen3Range{ PokedexNumber{252}, PokedexNumber{386} };
-const PokedexRange Gen4Range{ PokedexNumber{387}, PokedexNumber{493} };
-const PokedexRange LatestGenRange{ Gen4Range };
+constexpr PokedexRange Gen1Range{ PokedexNumber{1}, PokedexNumber{151} };
+constexpr PokedexRange Gen2Range{ PokedexNumber{152}, PokedexNumber{251} };
+constexpr PokedexRange Gen3Range{ PokedexNumber{252}, PokedexNumber{386} };
+constexpr PokedexRange Gen4Range{ PokedexNumber{387}, PokedexNumber{493} };
+constexpr PokedexRange LatestGenRange{ Gen4Range };
 //! Meltan and Melmetal
-const PokedexRange UnknownRange{ PokedexNumber{808}, PokedexNumber{809} };
+constexpr PokedexRange UnknownRange{ PokedexNumber{808}, PokedexNumber{809} };
 //! Range for known generations, unknown Pokémon appended to the end
-const PokedexRange MaxRange{ PokedexNumber{1}, (PokedexNumber)PoGoCmp::PokemonByNumber.size() };
-const std::array<PokedexRange, 2> ValidRanges{{
+constexpr PokedexRange MaxRange{ PokedexNumber{1}, PokedexNumber{)" << pokemonTable.size() << R"(} };
+constexpr std::array<PokedexRange, 2> ValidRanges{{
     { Gen1Range.first, LatestGenRange.second },
     { UnknownRange }
 }};
@@ -773,7 +1347,7 @@ struct Pokemon
     uint16_t sta;
 };
 
-const std::array<Pokemon, 6> RaidLevels{{
+constexpr std::array<Pokemon, 6> RaidLevels{{
     { 21, 15, 15, 600 },
     { 25, 15, 15, 1800 },
     { 30, 15, 15, 3600 },
@@ -803,59 +1377,132 @@ static inline const char* PokemonRarityToString(PokemonRarity rarity)
 }
 
 //! Maps Pokémon's base name to names of its forms, if Pokémon has multiple forms.
-//! Case-insensitive.
+//! Compare the names case-insensitively, the strings are null-terminated.
 //! @sa PokemonNameToId, PokemonIdToName
-static const std::multimap<std::string, std::string, StringLessThanI> FormNames{
 )";
+    size_t numFormNames = 0;
+    std::stringstream formNames;
     for (const auto& it : pokemonTable)
     {
         const auto& pkm = it.second;
         if (!pkm.formId.empty())
-            output << indent << "{ " << std::quoted(pkm.id) << ", " << std::quoted(pkm.formId) << " },\n" ;
+        {
+            formNames << indent << "{ " << std::quoted(pkm.id) << ", " << std::quoted(pkm.formId) << " },\n";
+            ++numFormNames;
+        }
     }
-    output << "};";
-    output <<
-R"(
-
-static inline PokemonSpecie PokemonByIdName(const std::string& id)
-{
-    if (auto it = std::find_if(
-            PokemonByNumber.begin(), PokemonByNumber.end(),
-            [&id](const auto& kvp) { return CompareI(kvp.second.id.c_str(), id.c_str()) == 0; }
-        );
-        it != PokemonByNumber.end())
+    const auto formNamesType = "std::array<std::pair<std::string_view, std::string_view>, " + std::to_string(numFormNames) + ">";
+    output << "POGOCMP_API extern const " << formNamesType << " FormNames;";
+    source << "\n";
+    source << "const " << formNamesType << " FormNames{{\n";
+    source << formNames.str();
+    source << "}};\n";
+
+    // Minimal perfect hash (hash and displace) of the case-folded IDs, names and aliases of the species and forms.
+    std::map<std::string, size_t> nameKeys; // case-folded name -> index to PokemonByNumber
+    auto foldName = [](std::string name)
     {
-        return it->second;
+        for (auto& c : name)
+            c = FoldNameChar(c);
+        return name;
+    };
+    bool nameConflicts = false;
+    auto addName = [&](const std::string& name, size_t index)
+    {
+        auto it = nameKeys.emplace(foldName(name), index);
+        if (!it.second && it.first->second != index)
+        {
+            std::cerr << "Name '" << name << "' is ambiguous\n";
+            nameConflicts = true;
+        }
+    };
+    size_t pokemonIndex = 0;
+    for (const auto& it : pokemonTable)
+    {
+        const auto& pkm = it.second;
+        const auto& id = !pkm.formId.empty() ? pkm.formId : pkm.id;
+        addName(id, pokemonIndex);
+        addName(PokemonIdToName(id), pokemonIndex);
+        // The base ID of a Pokémon with forms refers to the first form.
+        if (!pkm.formId.empty() && nameKeys.find(foldName(pkm.id)) == nameKeys.end())
+        {
+            addName(pkm.id, pokemonIndex);
+            addName(PokemonIdToName(pkm.id), pokemonIndex);
+        }
+        ++pokemonIndex;
     }
+    // The other aliases accepted by PokemonNameToId() case-fold to the IDs.
+    if (auto it = nameKeys.find("PORYGON_Z"); it != nameKeys.end())
+        addName("PorygonZ", it->second);
+    if (nameConflicts)
+        return EXIT_FAILURE;
 
-    if (auto it = std::find_if(
-            FormNames.begin(), FormNames.end(),
-            [&id](const auto& kvp) { return CompareI(kvp.first.c_str(), id.c_str()) == 0; }
-        );
-        it != FormNames.end())
+    const std::vector<std::pair<std::string, size_t>> names(nameKeys.begin(), nameKeys.end());
+    std::vector<std::string> nameKeyStrings;
+    for (const auto& kvp : names)
+        nameKeyStrings.push_back(kvp.first);
+    std::vector<int32_t> nameSeeds;
+    std::vector<size_t> nameSlots;
+    if (!GeneratePerfectHash(nameKeyStrings, nameSeeds, nameSlots))
     {
-        return PokemonByIdName(it->second);
+        std::cerr << "Failed to generate perfect hash for the names\n";
+        return EXIT_FAILURE;
     }
 
-    return {};
+    const auto nameSeedsType = "std::array<int32_t, " + std::to_string(nameSeeds.size()) + ">";
+    const auto pokemonNamesType = "std::array<PokemonNameEntry, " + std::to_string(names.size()) + ">";
+    output <<
+R"(
+
+//! Entry of the perfect hash table of the Pokémon names.
+struct PokemonNameEntry
+{
+    //! Case-folded ID, name or alias, see FoldNameChar().
+    std::string_view name;
+    //! Index to PokemonByNumber.
+    uint16_t index;
+};
+
+//! Seeds of the perfect hash buckets, the bucket of a name is NameHash(name, 0) % PokemonNameSeeds.size().
+//! The slot of a name in PokemonNames is NameHash(name, seed) % PokemonNames.size(), or -seed - 1 if the seed is negative.
+POGOCMP_API extern const )" << nameSeedsType << R"( PokemonNameSeeds;
+//! Minimal perfect hash table of the IDs, names and aliases of all Pokémon and forms, see PokemonIndexByName().
+POGOCMP_API extern const )" << pokemonNamesType << R"( PokemonNames;
+
+//! @param name ID, name or alias of a Pokémon or a form, or the base ID or name of a Pokémon with forms, which refers
+//! to its first form. Handled case-insensitively, spaces, hyphens and underscores are interchangeable.
+//! @return Index to PokemonByNumber, PokemonByNumber.size() if not found. O(1), no allocations.
+static inline size_t PokemonIndexByName(std::string_view name)
+{
+    const auto seed = PokemonNameSeeds[NameHash(name, 0) % PokemonNameSeeds.size()];
+    const auto slot = seed < 0 ? size_t(-(seed + 1)) : NameHash(name, (uint32_t)seed) % PokemonNames.size();
+    const auto& entry = PokemonNames[slot];
+    return NameEquals(entry.name, name) ? entry.index : PokemonByNumber.size();
+}
+
+//! @param id See PokemonIndexByName().
+static inline PokemonSpecie PokemonByIdName(std::string_view id)
+{
+    const auto index = PokemonIndexByName(id);
+    return index < PokemonByNumber.size() ? PokemonByNumber.begin()[index].second : PokemonSpecie{};
 }
 
-static inline bool IsValidIdName(const std::string& id)
+static inline bool IsValidIdName(std::string_view id)
 {
-    return PokemonByIdName(id).number != 0;
+    return PokemonIndexByName(id) < PokemonByNumber.size();
 }
 
 // Pokémon whose names don't directly match the ID name.
-static const std::string MrMimeName{ "Mr. Mime" };
-static const std::string FarfetchdName{ "Farfetch'd" };
-static const std::string HoOhName{ "Ho-Oh" };
-static const Utf8::String NidoranFemaleName{ u8"Nidoran♀" }; // u8"Nidoran\u2640"
-static const Utf8::String NidoranMaleName{ u8"Nidoran♂" }; // u8"Nidoran\u2642"
-static const std::string UnownExclamationName{ "Unown !" };
-static const std::string UnownQuestionName{ "Unown ?" };
+constexpr std::string_view MrMimeName{ "Mr. Mime" };
+constexpr std::string_view FarfetchdName{ "Farfetch'd" };
+constexpr std::string_view HoOhName{ "Ho-Oh" };
+constexpr std::string_view NidoranFemaleName{ u8"Nidoran♀" }; // u8"Nidoran\u2640"
+constexpr std::string_view NidoranMaleName{ u8"Nidoran♂" }; // u8"Nidoran\u2642"
+constexpr std::string_view UnownExclamationName{ "Unown !" };
+constexpr std::string_view UnownQuestionName{ "Unown ?" };
 // N.B. "Porygon2" and "Porygon Z" inconsitency
-static const std::string PorygonZName{ "Porygon Z" };
-static const std::string MimeJrName{ "Mime Jr." };
+constexpr std::string_view PorygonZName{ "Porygon Z" };
+constexpr std::string_view MimeJrName{ "Mime Jr." };
 // - Flabébé -> Unknown at the moment, probably FLABEBE
 
 //! Returns Pokémon's proper name (base, e.g. Rattata, or form, e.g. Rattata Normal) in ID name format (SCREAMING_SNAKE_CASE)
@@ -863,31 +1510,31 @@ static const std::string MimeJrName{ "Mime Jr." };
 //! @note "Nidoran Female", "Nidoran Male", "Mr Mime", "Ho Oh", "Mime Jr" and "PorygonZ" accepted also.
 static inline std::string PokemonNameToId(Utf8::String name)
 {
-    if (Utf8::CompareI(name.c_str(), NidoranFemaleName.c_str()) == 0 || Utf8::CompareI(name.c_str(), "Nidoran Female") == 0)
+    if (Utf8::CompareI(name.c_str(), NidoranFemaleName.data()) == 0 || Utf8::CompareI(name.c_str(), "Nidoran Female") == 0)
     {
         return "NIDORAN_FEMALE";
     }
-    else if (Utf8::CompareI(name.c_str(), NidoranMaleName.c_str()) == 0 || Utf8::CompareI(name.c_str(), "Nidoran Male") == 0)
+    else if (Utf8::CompareI(name.c_str(), NidoranMaleName.data()) == 0 || Utf8::CompareI(name.c_str(), "Nidoran Male") == 0)
     {
         return "NIDORAN_MALE";
     }
-    else if (Utf8::CompareI(name.c_str(), FarfetchdName.c_str()) == 0)
+    else if (Utf8::CompareI(name.c_str(), FarfetchdName.data()) == 0)
     {
         return "FARFETCHD";
     }
-    else if (Utf8::CompareI(name.c_str(), MrMimeName.c_str()) == 0 || Utf8::CompareI(name.c_str(), "Mr Mime") == 0)
+    else if (Utf8::CompareI(name.c_str(), MrMimeName.data()) == 0 || Utf8::CompareI(name.c_str(), "Mr Mime") == 0)
     {
         return "MR_MIME";
     }
-    else if (Utf8::CompareI(name.c_str(), UnownExclamationName.c_str()) == 0)
+    else if (Utf8::CompareI(name.c_str(), UnownExclamationName.data()) == 0)
     {
         return "UNOWN_EXCLAMATION_POINT";
     }
-    else if (Utf8::CompareI(name.c_str(), UnownQuestionName.c_str()) == 0)
+    else if (Utf8::CompareI(name.c_str(), UnownQuestionName.data()) == 0)
     {
         return "UNOWN_QUESTION_MARK";
     }
-    else if (Utf8::CompareI(name.c_str(), HoOhName.c_str()) == 0 || Utf8::CompareI(name.c_str(), "Ho Oh") == 0)
+    else if (Utf8::CompareI(name.c_str(), HoOhName.data()) == 0 || Utf8::CompareI(name.c_str(), "Ho Oh") == 0)
     {
         return "HO_OH";
     }
@@ -900,11 +1547,11 @@ static inline std::string PokemonNameToId(Utf8::String name)
     else if (Utf8::CompareI(name.c_str(), "Spinda 6") == 0) { return "SPINDA_05"; }
     else if (Utf8::CompareI(name.c_str(), "Spinda 7") == 0) { return "SPINDA_06"; }
     else if (Utf8::CompareI(name.c_str(), "Spinda 8") == 0) { return "SPINDA_07"; }
-    else if (Utf8::CompareI(name.c_str(), PorygonZName.c_str()) == 0 || Utf8::CompareI(name.c_str(), "PorygonZ") == 0)
+    else if (Utf8::CompareI(name.c_str(), PorygonZName.data()) == 0 || Utf8::CompareI(name.c_str(), "PorygonZ") == 0)
     {
         return "PORYGON_Z";
     }
-    else if (Utf8::CompareI(name.c_str(), MimeJrName.c_str()) == 0 || Utf8::CompareI(name.c_str(), "Mime Jr") == 0)
+    else if (Utf8::CompareI(name.c_str(), MimeJrName.data()) == 0 || Utf8::CompareI(name.c_str(), "Mime Jr") == 0)
     {
         return "MIME_JR";
     }
@@ -938,13 +1585,13 @@ static inline std::string PokemonNameToId(Utf8::String name)
 //! @param id Handled case-insensitively.
 static inline Utf8::String PokemonIdToName(const std::string& id)
 {
-    if (CompareI(id.c_str(), "NIDORAN_FEMALE") == 0) return NidoranFemaleName;
-    else if (CompareI(id.c_str(), "NIDORAN_MALE") == 0) return NidoranMaleName;
-    else if (CompareI(id.c_str(), "FARFETCHD") == 0) return FarfetchdName;
-    else if (CompareI(id.c_str(), "MR_MIME") == 0) return MrMimeName;
-    else if (CompareI(id.c_str(), "UNOWN_EXCLAMATION_POINT") == 0) return UnownExclamationName;
-    else if (CompareI(id.c_str(), "UNOWN_QUESTION_MARK") == 0) return UnownQuestionName;
-    else if (CompareI(id.c_str(), "HO_OH") == 0) return HoOhName;
+    if (CompareI(id.c_str(), "NIDORAN_FEMALE") == 0) return Utf8::String(NidoranFemaleName);
+    else if (CompareI(id.c_str(), "NIDORAN_MALE") == 0) return Utf8::String(NidoranMaleName);
+    else if (CompareI(id.c_str(), "FARFETCHD") == 0) return Utf8::String(FarfetchdName);
+    else if (CompareI(id.c_str(), "MR_MIME") == 0) return Utf8::String(MrMimeName);
+    else if (CompareI(id.c_str(), "UNOWN_EXCLAMATION_POINT") == 0) return Utf8::String(UnownExclamationName);
+    else if (CompareI(id.c_str(), "UNOWN_QUESTION_MARK") == 0) return Utf8::String(UnownQuestionName);
+    else if (CompareI(id.c_str(), "HO_OH") == 0) return Utf8::String(HoOhName);
     else if (CompareI(id.c_str(), "SPINDA_00") == 0) return "Spinda 1";
     else if (CompareI(id.c_str(), "SPINDA_01") == 0) return "Spinda 2";
     else if (CompareI(id.c_str(), "SPINDA_02") == 0) return "Spinda 3";
@@ -953,8 +1600,8 @@ static inline Utf8::String PokemonIdToName(const std::string& id)
     else if (CompareI(id.c_str(), "SPINDA_05") == 0) return "Spinda 6";
     else if (CompareI(id.c_str(), "SPINDA_06") == 0) return "Spinda 7";
     else if (CompareI(id.c_str(), "SPINDA_07") == 0) return "Spinda 8";
-    else if (CompareI(id.c_str(), "PORYGON_Z") == 0) return PorygonZName;
-    else if (CompareI(id.c_str(), "MIME_JR") == 0) return MimeJrName;
+    else if (CompareI(id.c_str(), "PORYGON_Z") == 0) return Utf8::String(PorygonZName);
+    else if (CompareI(id.c_str(), "MIME_JR") == 0) return Utf8::String(MimeJrName);
     else return StringUtils::SnakeCaseToTitleCaseCopy(id);
 }
 
@@ -963,11 +1610,68 @@ static inline std::string FormIdToBaseId(const std::string& id)
 {
     auto it = std::find_if(
         FormNames.begin(), FormNames.end(),
-        [&id](const auto& kvp) { return CompareI(kvp.second.c_str(), id.c_str()) == 0; }
+        [&id](const auto& kvp) { return CompareI(kvp.second.data(), id.c_str()) == 0; }
     );
-    return it != FormNames.end() ? it->first : id;
+    return it != FormNames.end() ? std::string(it->first) : id;
 }
 
 )";
     output << "}\n"; // ~namespace PoGoCmp
+    source << "\n";
+    source << "const " << nameSeedsType << " PokemonNameSeeds" << vectorToString(nameSeeds, 16, "", 0) << "\n";
+    source << "\n";
+    source << "const " << pokemonNamesType << " PokemonNames{{\n";
+    for (auto nameIdx : nameSlots)
+        source << indent << "{ " << std::quoted(names[nameIdx].first) << ", " << names[nameIdx].second << " },\n";
+    source << "}};\n";
+    source << "\n}\n"; // ~namespace PoGoCmp
+
+    // The same data as a binary snapshot, in the same order as the generated tables.
+    DbSnapshotData snapshot{};
+    auto snapshotMoveSpan = [&](const std::vector<std::string>& moveset)
+    {
+        return MoveSpan{ (uint16_t)moveSpanOffsets.at(moveset), (uint16_t)moveset.size() };
+    };
+    for (const auto& kvp : pokemonTable)
+    {
+        const auto& pkm = kvp.second;
+        snapshot.species.push_back({
+            pkm.number, pkm.baseAtk, pkm.baseDef, pkm.baseSta, snapshot.AddString(!pkm.formId.empty() ? pkm.formId : pkm.id),
+            pkm.type, pkm.type2, pkm.rarity, pkm.buddyDistance, snapshotMoveSpan(pkm.fastMoves),
+            snapshotMoveSpan(pkm.chargeMoves), pkm.malePercent, pkm.femalePercent,
+            (uint16_t)computeCp(0, pkm.baseAtk, pkm.baseDef, pkm.baseSta),
+            (uint16_t)computeCp(numHalfLevels - 1, pkm.baseAtk + 15, pkm.baseDef + 15, pkm.baseSta + 15),
+            uint16_t(pkm.baseAtk + pkm.baseDef + pkm.baseSta), 0, (uint32_t)pkm.baseDef * pkm.baseSta
+        });
+    }
+    std::map<std::string, MoveId> moveIds;
+    for (const auto& kvp : movesById)
+    {
+        const auto& move = *kvp.second;
+        moveIds.emplace(move.id, (MoveId)snapshot.moves.size());
+        snapshot.moves.push_back({
+            snapshot.AddString(move.id), move.type, {}, move.combatPower, move.pvpPower, move.combatDuration,
+            move.pvpDuration, move.combatEnergy, move.pvpEnergy, move.damageWindowStartMs, move.damageWindowEndMs
+        });
+    }
+    for (const auto& move : pokemonMoves)
+        snapshot.pokemonMoves.push_back(moveIds.at(move.substr(move.find("::") + 2)));
+    for (const auto& row : typeEffectiveness)
+        snapshot.typeEffectiveness.insert(snapshot.typeEffectiveness.end(), row.begin(), row.end());
+    for (size_t i = 0; i < numLevels; ++i)
+    {
+        snapshot.levels.push_back({
+            (uint32_t)playerLevel.requiredExperience[i], playerLevel.cpMultiplier[i],
+            (uint16_t)pokemonUpgrades.stardustCost[i], (uint8_t)pokemonUpgrades.candyCost[i], 0
+        });
+    }
+    snapshot.settings = {
+        (uint8_t)playerLevel.maxEggPlayerLevel, (uint8_t)playerLevel.maxEncounterPlayerLevel,
+        (uint8_t)pokemonUpgrades.upgradesPerLevel, (uint8_t)pokemonUpgrades.allowedLevelsAbovePlayer
+    };
+    if (!WriteDbSnapshot(snapshotPath, snapshot))
+    {
+        Utf8::PrintLine("Failed to write " + snapshotPath, Utf8::OutputStream::Err);
+        return EXIT_FAILURE;
+    }
 }
@@ -0,0 +1,132 @@
+/**
+    @file Appraisal.cpp
+    @brief */
+#include "Appraisal.h"
+#include "BaseStatsCache.h"
+#include "PoGoDb.h"
+
+#include <algorithm>
+#include <memory>
+
+namespace PoGoCmp
+{
+
+CpIndex::CpIndex(const IvSpace& space)
+{
+    const auto numLevels = IvSpace::NumLevels();
+    int maxCp = 0;
+    minCp = space.Cp(LevelIndex{0}, 0);
+    for (size_t level = 0; level < numLevels; ++level)
+    {
+        const auto* cp = space.CpTable((LevelIndex)level);
+        const auto minMax = std::minmax_element(cp, cp + NumIvCombinations);
+        minCp = std::min(minCp, (int)*minMax.first);
+        maxCp = std::max(maxCp, (int)*minMax.second);
+    }
+
+    // Histogram, prefix sum, scatter.
+    offsets.assign(maxCp - minCp + 2, 0);
+    for (size_t level = 0; level < numLevels; ++level)
+    {
+        const auto* cp = space.CpTable((LevelIndex)level);
+        for (size_t iv = 0; iv < NumIvCombinations; ++iv)
+            ++offsets[cp[iv] - minCp + 1];
+    }
+    for (size_t i = 1; i < offsets.size(); ++i)
+        offsets[i] += offsets[i - 1];
+
+    entries.resize(numLevels * NumIvCombinations);
+    std::vector<uint32_t> next(offsets.begin(), offsets.end() - 1);
+    for (size_t level = 0; level < numLevels; ++level)
+    {
+        const auto* cp = space.CpTable((LevelIndex)level);
+        for (size_t iv = 0; iv < NumIvCombinations; ++iv)
+            entries[next[cp[iv] - minCp]++] = { (LevelIndex)level, (IvIndex)iv };
+    }
+}
+
+const IvCandidate* CpIndex::Begin(int cp) const
+{
+    if (cp < minCp || cp > MaxCp()) return entries.data();
+    return entries.data() + offsets[cp - minCp];
+}
+
+const IvCandidate* CpIndex::End(int cp) const
+{
+    if (cp < minCp || cp > MaxCp()) return entries.data();
+    return entries.data() + offsets[cp - minCp + 1];
+}
+
+namespace
+{
+
+//! The game never shows CP or HP below 10.
+const int minShownValue = 10;
+
+} // ~unnamed namespace
+
+const CpIndex& CpIndexFor(SpecieIndex idx)
+{
+    static BaseStatsCache<CpIndex> cache;
+    return cache.Get(idx, [](SpecieIndex i) { return std::make_unique<const CpIndex>(IvSpaceFor(i)); });
+}
+
+LevelRange LevelsByStardustCost(int stardust)
+{
+    // stardustCost[i] is the cost of both power-ups of level i + 1.
+    const auto& costs = PoGoCmp::PokemonUpgrades.stardustCost;
+    const auto numLevels = std::min(IvSpace::NumLevels(), costs.size() * 2);
+    size_t first = numLevels, last = 0;
+    for (size_t level = 0; level < numLevels; ++level)
+    {
+        if (costs[level / 2] == stardust)
+        {
+            first = std::min(first, level);
+            last = level;
+        }
+    }
+    if (first > last) return { LevelIndex{1}, LevelIndex{0} };
+    return { (LevelIndex)first, (LevelIndex)last };
+}
+
+std::vector<IvCandidate> Appraise(SpecieIndex idx, int cp, int hp, int stardust)
+{
+    std::vector<IvCandidate> candidates;
+    if (cp < minShownValue) return candidates;
+
+    LevelRange levels{ LevelIndex{0}, LevelIndex(IvSpace::NumLevels() - 1) };
+    if (stardust > 0)
+    {
+        levels = LevelsByStardustCost(stardust);
+        if (levels.first > levels.last) return candidates;
+    }
+
+    const auto& space = IvSpaceFor(idx);
+    const auto& index = CpIndexFor(idx);
+    auto appendMatches = [&](int actualCp)
+    {
+        for (auto it = index.Begin(actualCp), end = index.End(actualCp); it != end; ++it)
+        {
+            if (it->level < levels.first || it->level > levels.last) continue;
+            if (hp > 0 && std::max(space.Sta(it->level, StaIv(it->iv)), minShownValue) != hp) continue;
+            candidates.push_back(*it);
+        }
+    };
+
+    if (cp == minShownValue)
+    {
+        for (int actualCp = index.MinCp(); actualCp <= minShownValue; ++actualCp)
+            appendMatches(actualCp);
+        std::sort(candidates.begin(), candidates.end(), [](const auto& a, const auto& b)
+        {
+            return std::tie(a.level, a.iv) < std::tie(b.level, b.iv);
+        });
+    }
+    else
+    {
+        appendMatches(cp);
+    }
+    return candidates;
+}
+
+} // ~namespace PoGoCmp
@@ -0,0 +1,61 @@
+/**
+    @file Appraisal.h
+    @brief Solving the possible levels and IVs of a Pokémon from the values observed in the game. */
+#pragma once
+
+#include "IvSpace.h"
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace PoGoCmp
+{
+
+//! A level and IV combination.
+struct IvCandidate
+{
+    LevelIndex level;
+    IvIndex iv;
+};
+
+//! All level and IV combinations of a specie ordered by CP, i.e. an inverted IvSpace::Cp().
+//! Built using a counting sort, the combinations with the same CP are ordered by level and IvIndex.
+class CpIndex
+{
+public:
+    explicit CpIndex(const IvSpace& space);
+
+    //! @return Pointers to the combinations with the CP in question, an empty range if none.
+    const IvCandidate* Begin(int cp) const;
+    const IvCandidate* End(int cp) const;
+
+    int MinCp() const { return minCp; }
+    int MaxCp() const { return minCp + (int)offsets.size() - 2; }
+
+private:
+    int minCp;
+    //! offsets[cp - minCp] is the index of the first entry with the CP, the last element is entries.size().
+    std::vector<uint32_t> offsets;
+    std::vector<IvCandidate> entries;
+};
+
+//! @return Cached CpIndex of the specie, computed on the first call, same semantics as with IvSpaceFor().
+//! @param idx [0, NumSpecies()), undefined behavior otherwise.
+const CpIndex& CpIndexFor(SpecieIndex idx);
+
+//! Inclusive range of levels.
+struct LevelRange { LevelIndex first, last; };
+
+//! @return The levels that require the given amount of stardust to power up, an empty range (first > last) if none.
+//! @note The stardust cost is the same for several consecutive levels so the result is always a range of levels.
+LevelRange LevelsByStardustCost(int stardust);
+
+//! @param idx [0, NumSpecies()), undefined behavior otherwise.
+//! @param cp CP as shown in the game, i.e. 10 matches also all values below 10.
+//! @param hp HP as shown in the game, i.e. 10 matches also all values below 10. 0 to ignore.
+//! @param stardust Stardust cost of the next power-up as shown in the game. 0 to ignore.
+//! @return All level and IV combinations matching the input, ordered by level and IvIndex.
+std::vector<IvCandidate> Appraise(SpecieIndex idx, int cp, int hp = 0, int stardust = 0);
+
+} // ~namespace PoGoCmp
@@ -0,0 +1,57 @@
+/**
+    @file BaseStatsCache.h
+    @brief Lazily computed per-specie data shared by the species/forms with identical base stats. */
+#pragma once
+
+#include "PoGoCmp.h"
+#include "PoGoDb.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+
+namespace PoGoCmp
+{
+
+//! Attack, defense and stamina. Everything derived from the stats alone, e.g. the CP of every level and IV
+//! combination, is the same for the species/forms with the same BaseStats.
+using BaseStats = std::tuple<int, int, int>;
+
+//! @param idx [0, NumSpecies()), undefined behavior otherwise.
+inline BaseStats BaseStatsOf(SpecieIndex idx)
+{
+    const auto& base = SpecieByIndex(idx);
+    return { base.baseAtk, base.baseDef, base.baseSta };
+}
+
+//! Thread-safe cache of T per BaseStats. The values are never removed so the references stay valid.
+template <typename T>
+class BaseStatsCache
+{
+public:
+    //! @param make Called as make(idx) -> std::unique_ptr<const T> if the value isn't cached yet. It's called
+    //! without holding the lock so that different stats can be computed concurrently. If two threads race for
+    //! the same stats, the first one to finish wins and the other result is discarded.
+    template <typename Make>
+    const T& Get(SpecieIndex idx, Make&& make)
+    {
+        const auto key = BaseStatsOf(idx);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = values.find(key);
+            if (it != values.end())
+                return *it->second;
+        }
+
+        auto value = make(idx);
+        std::lock_guard<std::mutex> lock(mutex);
+        return *values.emplace(key, std::move(value)).first->second;
+    }
+
+private:
+    std::mutex mutex;
+    std::map<BaseStats, std::unique_ptr<const T>> values;
+};
+
+} // ~namespace PoGoCmp
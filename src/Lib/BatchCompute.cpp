@@ -0,0 +1,257 @@
+/**
+    @file BatchCompute.cpp
+    @brief Batch versions of the CP and stat computations, SIMD-accelerated on x86. */
+#include "PoGoCmp.h"
+#include "PoGoDb.h"
+
+#include <atomic>
+#include <algorithm>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define POGOCMP_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+// MSVC allows using any intrinsics without special compiler flags, GCC and Clang need per-function target attributes.
+#if defined(__GNUC__) || defined(__clang__)
+#define POGOCMP_TARGET(isa) __attribute__((target(isa)))
+#else
+#define POGOCMP_TARGET(isa)
+#endif
+
+namespace PoGoCmp
+{
+
+namespace
+{
+
+//! Large enough for the widest instruction set.
+const size_t maxWidth = 8;
+
+//! Validated and gathered input for a block of elements, invalid lanes are computed using dummy values.
+struct Block
+{
+    alignas(32) float atk[maxWidth];
+    alignas(32) float def[maxWidth];
+    alignas(32) float sta[maxWidth];
+    alignas(32) float cpm[maxWidth];
+    alignas(32) double cpmSquared[maxWidth];
+    LevelIndex level[maxWidth];
+    bool valid[maxWidth];
+};
+
+void Gather(
+    const SpecieIndex* species, const LevelIndex* levels, const uint8_t* atk, const uint8_t* def, const uint8_t* sta,
+    size_t count, Block& block)
+{
+    const auto numSpecies = NumSpecies();
+    for (size_t i = 0; i < maxWidth; ++i)
+    {
+        block.valid[i] = i < count && species[i] < numSpecies &&
+            (size_t)levels[i] < PoGoCmp::HalfLevelCpMultiplier.size() &&
+            atk[i] <= 15 && def[i] <= 15 && sta[i] <= 15;
+        if (block.valid[i])
+        {
+            const auto& base = SpecieByIndex(species[i]);
+            block.atk[i] = float(base.baseAtk + atk[i]);
+            block.def[i] = float(base.baseDef + def[i]);
+            block.sta[i] = float(base.baseSta + sta[i]);
+            block.level[i] = levels[i];
+            block.cpm[i] = PoGoCmp::HalfLevelCpMultiplier[(size_t)levels[i]];
+            block.cpmSquared[i] = PoGoCmp::HalfLevelCpMultiplierSquared[(size_t)levels[i]];
+        }
+        else
+        {
+            block.atk[i] = block.def[i] = block.sta[i] = block.cpm[i] = 1.f;
+            block.cpmSquared[i] = 1.;
+            block.level[i] = LevelIndex{0};
+        }
+    }
+}
+
+// The kernels mimic the scalar functions operation by operation: the float product is computed in the same order,
+// widened to double for the CPM multiplication and division, and floored or truncated. The IEEE 754 sqrt() is
+// correctly rounded, i.e. the same as the square root emulated by ComputeCpInteger().
+
+void CpScalar(const Block& block, size_t count, int* cp)
+{
+    for (size_t i = 0; i < count; ++i)
+        cp[i] = ComputeCpInteger(block.level[i], (int)block.atk[i], (int)block.def[i], (int)block.sta[i]);
+}
+
+void StatsScalar(const Block& block, size_t count, int* atkOut, int* defOut, int* staOut)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        atkOut[i] = int(block.atk[i] * block.cpm[i]);
+        defOut[i] = int(block.def[i] * block.cpm[i]);
+        staOut[i] = int(block.sta[i] * block.cpm[i]);
+    }
+}
+
+#ifdef POGOCMP_X86
+
+POGOCMP_TARGET("sse4.1")
+void CpSse41(const Block& block, size_t /*count*/, int* cp)
+{
+    const auto ten = _mm_set1_pd(10.);
+    for (size_t i = 0; i < 8; i += 4)
+    {
+        const auto product = _mm_mul_ps(
+            _mm_mul_ps(_mm_load_ps(block.atk + i), _mm_sqrt_ps(_mm_load_ps(block.def + i))),
+            _mm_sqrt_ps(_mm_load_ps(block.sta + i)));
+        auto lo = _mm_cvtps_pd(product);
+        auto hi = _mm_cvtps_pd(_mm_movehl_ps(product, product));
+        lo = _mm_floor_pd(_mm_div_pd(_mm_mul_pd(lo, _mm_load_pd(block.cpmSquared + i)), ten));
+        hi = _mm_floor_pd(_mm_div_pd(_mm_mul_pd(hi, _mm_load_pd(block.cpmSquared + i + 2)), ten));
+        _mm_storeu_si128(
+            reinterpret_cast<__m128i*>(cp + i),
+            _mm_unpacklo_epi64(_mm_cvttpd_epi32(lo), _mm_cvttpd_epi32(hi)));
+    }
+}
+
+POGOCMP_TARGET("sse4.1")
+void StatsSse41(const Block& block, size_t /*count*/, int* atkOut, int* defOut, int* staOut)
+{
+    for (size_t i = 0; i < 8; i += 4)
+    {
+        const auto cpm = _mm_load_ps(block.cpm + i);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(atkOut + i), _mm_cvttps_epi32(_mm_mul_ps(_mm_load_ps(block.atk + i), cpm)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(defOut + i), _mm_cvttps_epi32(_mm_mul_ps(_mm_load_ps(block.def + i), cpm)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(staOut + i), _mm_cvttps_epi32(_mm_mul_ps(_mm_load_ps(block.sta + i), cpm)));
+    }
+}
+
+POGOCMP_TARGET("avx2")
+void CpAvx2(const Block& block, size_t /*count*/, int* cp)
+{
+    const auto ten = _mm256_set1_pd(10.);
+    const auto product = _mm256_mul_ps(
+        _mm256_mul_ps(_mm256_load_ps(block.atk), _mm256_sqrt_ps(_mm256_load_ps(block.def))),
+        _mm256_sqrt_ps(_mm256_load_ps(block.sta)));
+    auto lo = _mm256_cvtps_pd(_mm256_castps256_ps128(product));
+    auto hi = _mm256_cvtps_pd(_mm256_extractf128_ps(product, 1));
+    lo = _mm256_floor_pd(_mm256_div_pd(_mm256_mul_pd(lo, _mm256_load_pd(block.cpmSquared)), ten));
+    hi = _mm256_floor_pd(_mm256_div_pd(_mm256_mul_pd(hi, _mm256_load_pd(block.cpmSquared + 4)), ten));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(cp), _mm256_cvttpd_epi32(lo));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(cp + 4), _mm256_cvttpd_epi32(hi));
+}
+
+POGOCMP_TARGET("avx2")
+void StatsAvx2(const Block& block, size_t /*count*/, int* atkOut, int* defOut, int* staOut)
+{
+    const auto cpm = _mm256_load_ps(block.cpm);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(atkOut), _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_load_ps(block.atk), cpm)));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(defOut), _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_load_ps(block.def), cpm)));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(staOut), _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_load_ps(block.sta), cpm)));
+}
+
+#endif
+
+InstructionSet BestSupportedInstructionSet()
+{
+#if defined(POGOCMP_X86) && defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    const auto maxId = info[0];
+    __cpuid(info, 1);
+    const bool sse41 = (info[2] & (1 << 19)) != 0;
+    const bool osXsave = (info[2] & (1 << 27)) != 0;
+    const bool avx = (info[2] & (1 << 28)) != 0;
+    bool avx2 = false;
+    // The OS must also save the YMM registers on context switches.
+    if (maxId >= 7 && osXsave && avx && (_xgetbv(0) & 6) == 6)
+    {
+        __cpuidex(info, 7, 0);
+        avx2 = (info[1] & (1 << 5)) != 0;
+    }
+    if (avx2) return InstructionSet::Avx2;
+    if (sse41) return InstructionSet::Sse41;
+#elif defined(POGOCMP_X86)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return InstructionSet::Avx2;
+    if (__builtin_cpu_supports("sse4.1")) return InstructionSet::Sse41;
+#endif
+    return InstructionSet::Scalar;
+}
+
+std::atomic<InstructionSet>& CurrentInstructionSet()
+{
+    static std::atomic<InstructionSet> set{ BestSupportedInstructionSet() };
+    return set;
+}
+
+} // ~unnamed namespace
+
+InstructionSet BatchInstructionSet()
+{
+    return CurrentInstructionSet().load(std::memory_order_relaxed);
+}
+
+InstructionSet SetBatchInstructionSet(InstructionSet set)
+{
+    set = std::min(set, BestSupportedInstructionSet());
+    CurrentInstructionSet().store(set, std::memory_order_relaxed);
+    return set;
+}
+
+void ComputeCp(
+    const SpecieIndex* species, const LevelIndex* levels, const uint8_t* atk, const uint8_t* def, const uint8_t* sta,
+    size_t count, int* cp)
+{
+    auto kernel = &CpScalar;
+#ifdef POGOCMP_X86
+    switch (BatchInstructionSet())
+    {
+    case InstructionSet::Avx2: kernel = &CpAvx2; break;
+    case InstructionSet::Sse41: kernel = &CpSse41; break;
+    case InstructionSet::Scalar: break;
+    }
+#endif
+
+    Block block;
+    alignas(32) int result[maxWidth];
+    for (size_t i = 0; i < count; i += maxWidth)
+    {
+        const auto n = std::min(maxWidth, count - i);
+        Gather(species + i, levels + i, atk + i, def + i, sta + i, n, block);
+        kernel(block, n, result);
+        for (size_t j = 0; j < n; ++j)
+            cp[i + j] = block.valid[j] ? result[j] : -1;
+    }
+}
+
+void ComputeStats(
+    const SpecieIndex* species, const LevelIndex* levels, const uint8_t* atk, const uint8_t* def, const uint8_t* sta,
+    size_t count, int* atkOut, int* defOut, int* staOut)
+{
+    auto kernel = &StatsScalar;
+#ifdef POGOCMP_X86
+    switch (BatchInstructionSet())
+    {
+    case InstructionSet::Avx2: kernel = &StatsAvx2; break;
+    case InstructionSet::Sse41: kernel = &StatsSse41; break;
+    case InstructionSet::Scalar: break;
+    }
+#endif
+
+    Block block;
+    alignas(32) int atkResult[maxWidth], defResult[maxWidth], staResult[maxWidth];
+    for (size_t i = 0; i < count; i += maxWidth)
+    {
+        const auto n = std::min(maxWidth, count - i);
+        Gather(species + i, levels + i, atk + i, def + i, sta + i, n, block);
+        kernel(block, n, atkResult, defResult, staResult);
+        for (size_t j = 0; j < n; ++j)
+        {
+            atkOut[i + j] = block.valid[j] ? atkResult[j] : -1;
+            defOut[i + j] = block.valid[j] ? defResult[j] : -1;
+            staOut[i + j] = block.valid[j] ? staResult[j] : -1;
+        }
+    }
+}
+
+}
@@ -0,0 +1,221 @@
+/**
+    @file Database.cpp
+    @brief */
+#include "Database.h"
+#include "GameMaster.h"
+#include "NameHash.h"
+
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace PoGoCmp
+{
+
+namespace
+{
+
+template <typename T>
+DbSnapshotSpan<T> SpanOf(const std::vector<T>& v) { return { v.data(), v.size() }; }
+DbSnapshotSpan<char> SpanOf(const std::string& str) { return { str.data(), str.size() }; }
+
+bool EndsWith(const std::string& str, std::string_view suffix)
+{
+    return str.size() >= suffix.size() && str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+std::string FoldName(std::string_view name)
+{
+    std::string folded(name);
+    for (auto& c : folded)
+        c = FoldNameChar(c);
+    return folded;
+}
+
+//! Only accessed using std::atomic_load() and std::atomic_store().
+DatabasePtr publishedDatabase;
+//! Incremented after publishedDatabase is stored, so a reader that sees the new generation also sees the new
+//! database. A reader that sees the old generation but the new database only re-reads it once more in vain.
+std::atomic<uint64_t> publishedGeneration{ 0 };
+
+//! The database of the thread's previous CurrentDatabase() call.
+struct ThreadDatabase
+{
+    DatabasePtr db;
+    uint64_t generation;
+};
+
+thread_local ThreadDatabase threadDatabase;
+
+} // ~unnamed namespace
+
+DatabasePtr Database::Compiled()
+{
+    // Built once, the compiled-in data never changes.
+    static const DatabasePtr compiled = FromData(CompiledDbSnapshotData());
+    return compiled;
+}
+
+DatabasePtr Database::FromData(DbSnapshotData&& data)
+{
+    std::shared_ptr<Database> db{ new Database };
+    db->owned = std::move(data);
+    if (!db->Init()) return nullptr;
+    return db;
+}
+
+DatabasePtr Database::Load(const std::string& path)
+{
+    if (EndsWith(path, ".json"))
+    {
+        DbSnapshotData data;
+        if (!ReadGameMaster(path, data)) return nullptr;
+        return FromData(std::move(data));
+    }
+
+    std::shared_ptr<Database> db{ new Database };
+    if (!db->mapped.Load(path) || !db->Init()) return nullptr;
+    return db;
+}
+
+bool Database::Init()
+{
+    if (mapped.IsLoaded())
+    {
+        species = mapped.Species();
+        moves = mapped.Moves();
+        pokemonMoves = mapped.PokemonMoves();
+        typeEffectiveness = mapped.TypeEffectiveness();
+        levels = mapped.Levels();
+        settings = *mapped.Settings();
+        // DbSnapshot::Load() has validated the references already.
+        strings = mapped.String({ 0, 0 }).data();
+    }
+    else
+    {
+        species = SpanOf(owned.species);
+        moves = SpanOf(owned.moves);
+        pokemonMoves = SpanOf(owned.pokemonMoves);
+        typeEffectiveness = SpanOf(owned.typeEffectiveness);
+        levels = SpanOf(owned.levels);
+        settings = owned.settings;
+        strings = owned.strings.c_str();
+        if (!ValidateDbSnapshotRecords(species, moves, pokemonMoves, SpanOf(owned.strings), typeEffectiveness, levels))
+            return false;
+    }
+
+    if (species.size() >= (size_t)std::numeric_limits<SpecieIndex>::max() || levels.empty()) return false;
+
+    halfLevelCpm.reserve(levels.size() * 2 - 1);
+    for (size_t i = 0; i < levels.size(); ++i)
+    {
+        const auto cpmBase = levels[i].cpMultiplier;
+        halfLevelCpm.push_back(cpmBase);
+        if (i + 1 == levels.size()) break;
+        // Same as in PoGoDbGen: the CP multiplier's square grows linearly between two whole levels.
+        const auto cpmNext = levels[i + 1].cpMultiplier;
+        const auto cpmStep = (std::pow(cpmNext, 2) - std::pow(cpmBase, 2)) / 2.f;
+        halfLevelCpm.push_back((float)std::sqrt(std::pow(cpmBase, 2) + cpmStep));
+    }
+
+    specieIndexByName.reserve(species.size());
+    for (size_t i = 0; i < species.size(); ++i)
+        specieIndexByName.emplace(FoldName(String(species[i].id)), (SpecieIndex)i);
+    // The base ID of a specie with several forms, e.g. UNOWN for UNOWN_A...UNOWN_QUESTION, refers to the first form.
+    for (size_t first = 0, last; first < species.size(); first = last)
+    {
+        std::string_view prefix = String(species[first].id);
+        for (last = first + 1; last < species.size() && species[last].number == species[first].number; ++last)
+        {
+            const auto id = String(species[last].id);
+            size_t len = 0;
+            while (len < prefix.size() && len < id.size() && FoldNameChar(prefix[len]) == FoldNameChar(id[len]))
+                ++len;
+            prefix = prefix.substr(0, len);
+        }
+        if (last - first < 2) continue;
+        const auto underscore = prefix.rfind('_');
+        if (underscore == std::string_view::npos || underscore == 0) continue;
+        specieIndexByName.emplace(FoldName(prefix.substr(0, underscore)), (SpecieIndex)first);
+    }
+    return true;
+}
+
+SpecieIndex Database::SpecieIndexByName(std::string_view name) const
+{
+    const auto it = specieIndexByName.find(FoldName(name));
+    return it != specieIndexByName.end() ? it->second : (SpecieIndex)species.size();
+}
+
+float Database::CpMultiplier(float level) const
+{
+    const auto halfLevels = (level - 1.f) * 2.f;
+    if (!(halfLevels >= 0.f && halfLevels < halfLevelCpm.size()) || std::floor(halfLevels) != halfLevels)
+        return NAN;
+    return halfLevelCpm[(size_t)halfLevels];
+}
+
+int Database::ComputeCp(SpecieIndex idx, float level, int atk, int def, int sta) const
+{
+    if (idx >= species.size()) return -1;
+    if (atk < 0 || atk > 15) return -1;
+    if (def < 0 || def > 15) return -1;
+    if (sta < 0 || sta > 15) return -1;
+    const auto cpm = CpMultiplier(level);
+    if (std::isnan(cpm)) return -1;
+    const auto& base = species[idx];
+    return ComputeCpInteger(cpm, base.baseAtk + atk, base.baseDef + def, base.baseSta + sta);
+}
+
+int Database::ComputeStat(int base, int iv, float level) const
+{
+    const auto cpm = CpMultiplier(level);
+    if (std::isnan(cpm)) return -1;
+    return int(float(base + iv) * cpm);
+}
+
+DatabasePtr CurrentDatabase()
+{
+    // std::atomic_load() of a shared_ptr takes a lock in the common implementations, so it's done only when a new
+    // database has been published, and otherwise the read path is a single atomic load of the generation.
+    auto& cached = threadDatabase;
+    const auto generation = publishedGeneration.load(std::memory_order_acquire);
+    if (!cached.db || generation != cached.generation)
+    {
+        auto db = std::atomic_load(&publishedDatabase);
+        cached.db = db ? std::move(db) : Database::Compiled();
+        cached.generation = generation;
+    }
+    return cached.db;
+}
+
+void ReleaseCurrentDatabase()
+{
+    threadDatabase.db.reset();
+}
+
+uint64_t DatabaseGeneration()
+{
+    return publishedGeneration.load(std::memory_order_acquire);
+}
+
+void PublishDatabase(DatabasePtr db)
+{
+    if (!db) return;
+    std::atomic_store(&publishedDatabase, std::move(db));
+    publishedGeneration.fetch_add(1, std::memory_order_acq_rel);
+}
+
+std::future<bool> ReloadDatabaseAsync(const std::string& path)
+{
+    return std::async(std::launch::async, [path]
+    {
+        auto db = Database::Load(path);
+        if (!db) return false;
+        PublishDatabase(std::move(db));
+        return true;
+    });
+}
+
+} // ~namespace PoGoCmp
@@ -0,0 +1,112 @@
+/**
+    @file Database.h
+    @brief Replaceable game database for long-running processes. A Database is an immutable snapshot of the game
+    data; a new one can be loaded in the background and published with an atomic pointer swap so that the readers
+    keep using the snapshot they already hold and are never blocked. */
+#pragma once
+
+#include "DbSnapshot.h"
+#include "PoGoCmp.h"
+
+#include <cstdint>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace PoGoCmp
+{
+
+class Database;
+using DatabasePtr = std::shared_ptr<const Database>;
+
+//! Immutable game data, either owned or used in place from a memory-mapped DbSnapshot.
+//! The records and the strings stay valid for as long as the Database object is alive.
+class Database
+{
+public:
+    //! @return The compiled-in database.
+    static DatabasePtr Compiled();
+    //! @return Null if the data is inconsistent, e.g. a move span or a move ID is out of bounds.
+    static DatabasePtr FromData(DbSnapshotData&& data);
+    //! @param path A DbSnapshot file, or GAME_MASTER JSON if the extension is .json.
+    //! @return Null if the file couldn't be read or it's not valid.
+    static DatabasePtr Load(const std::string& path);
+
+    Database(const Database&) = delete;
+    Database& operator=(const Database&) = delete;
+
+    DbSnapshotSpan<DbSnapshotSpecie> Species() const { return species; }
+    DbSnapshotSpan<DbSnapshotMove> Moves() const { return moves; }
+    DbSnapshotSpan<MoveId> PokemonMoves() const { return pokemonMoves; }
+    DbSnapshotSpan<float> TypeEffectiveness() const { return typeEffectiveness; }
+    DbSnapshotSpan<DbSnapshotLevel> Levels() const { return levels; }
+    const DbSnapshotSettings& Settings() const { return settings; }
+    std::string_view String(const DbSnapshotString& str) const { return { strings + str.offset, str.size }; }
+
+    DbSnapshotSpan<MoveId> MovesOf(const MoveSpan& span) const { return { pokemonMoves.data + span.offset, span.size }; }
+    //! @param name Case-insensitive ID, see FoldNameChar(). The base ID of a specie with several forms, e.g.
+    //! "UNOWN" or "RATTATA", refers to its first form.
+    //! @return Index to Species(), Species().size() if not found.
+    SpecieIndex SpecieIndexByName(std::string_view name) const;
+    //! @param level [1, Levels().size()], half levels included.
+    //! @return NAN if the level is out of range. Looked up from a table computed once on load.
+    float CpMultiplier(float level) const;
+    //! Same as PoGoCmp::ComputeCp() for the compiled-in data, but using the stats and the levels of this database.
+    //! Computed with ComputeCpInteger().
+    //! @param idx Index to Species().
+    //! @param level See CpMultiplier().
+    //! @param atk, def, sta IVs, [0, 15].
+    //! @return -1 if any of the arguments is out of range.
+    int ComputeCp(SpecieIndex idx, float level, int atk, int def, int sta) const;
+    //! Same as PoGoCmp::ComputeStat(), but using the levels of this database.
+    //! @param level See CpMultiplier().
+    //! @return -1 if the level is out of range.
+    int ComputeStat(int base, int iv, float level) const;
+
+private:
+    Database() = default;
+    //! Sets the spans from owned, or from mapped if it's loaded.
+    bool Init();
+
+    DbSnapshotData owned;
+    DbSnapshot mapped;
+
+    DbSnapshotSpan<DbSnapshotSpecie> species{};
+    DbSnapshotSpan<DbSnapshotMove> moves{};
+    DbSnapshotSpan<MoveId> pokemonMoves{};
+    DbSnapshotSpan<float> typeEffectiveness{};
+    DbSnapshotSpan<DbSnapshotLevel> levels{};
+    DbSnapshotSettings settings{};
+    const char* strings{};
+    //! CP multipliers of all half levels, the ones between the whole levels interpolated as in PoGoDbGen.
+    std::vector<float> halfLevelCpm;
+    //! Folded ID -> index.
+    std::unordered_map<std::string, SpecieIndex> specieIndexByName;
+};
+
+//! @return The currently published database, the compiled-in one if nothing has been published. Lock-free:
+//! a thread re-reads the shared pointer only when a new database has been published since its previous call.
+//! Hold on to the returned pointer for the duration of a query so that all of it sees the same data.
+//! @note The calling thread keeps a reference to the returned database until its next call, see
+//! ReleaseCurrentDatabase().
+DatabasePtr CurrentDatabase();
+//! Drops the calling thread's reference kept by CurrentDatabase(). Call it before a thread goes idle so that
+//! a database replaced in the meantime isn't kept alive, with its file mapping, until the thread wakes up or exits.
+void ReleaseCurrentDatabase();
+//! Incremented by every PublishDatabase(), 0 for the compiled-in database.
+uint64_t DatabaseGeneration();
+//! Replaces the current database. The previous one is destroyed once the last reader releases it, the references
+//! kept by CurrentDatabase() included.
+//! @param db Ignored if null.
+void PublishDatabase(DatabasePtr db);
+//! Loads the database on a background thread, see Database::Load(), and publishes it if the loading succeeds.
+//! @return Whether the database was loaded and published. The destructor of the future waits for the loading to
+//! finish, so keep the future for as long as the caller shouldn't block.
+[[nodiscard]]
+std::future<bool> ReloadDatabaseAsync(const std::string& path);
+
+} // ~namespace PoGoCmp
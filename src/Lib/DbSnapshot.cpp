@@ -0,0 +1,333 @@
+/**
+    @file DbSnapshot.cpp
+    @brief */
+#include "DbSnapshot.h"
+#include "Utf8.h"
+
+#ifdef WIN32
+#include "MinimalWin32.h"
+#undef NOKERNEL
+#include <windows.h> // CreateFileMappingW & MapViewOfFile
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <array>
+#include <cstring>
+
+namespace PoGoCmp
+{
+
+namespace
+{
+
+const char fileMagic[4]{ 'P', 'G', 'D', 'B' };
+//! The records are mapped as is so the sections are aligned for the largest member of any record.
+const size_t sectionAlignment = 8;
+
+bool IsLittleEndianHost()
+{
+    const uint16_t value = 1;
+    uint8_t firstByte{};
+    std::memcpy(&firstByte, &value, 1);
+    return firstByte == 1;
+}
+
+//! CRC-32 (IEEE 802.3, reflected), the same as e.g. zlib's crc32().
+uint32_t Crc32(const uint8_t* data, size_t size)
+{
+    static const auto table = []
+    {
+        std::array<uint32_t, 256> t{};
+        for (uint32_t i = 0; i < 256; ++i)
+        {
+            uint32_t c = i;
+            for (int k = 0; k < 8; ++k)
+                c = c & 1 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            t[i] = c;
+        }
+        return t;
+    }();
+
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < size; ++i)
+        crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    return crc ^ 0xFFFFFFFFu;
+}
+
+//! @return The size of a record of the section, 0 for unknown sections.
+size_t RecordSize(DbSnapshotSectionId id)
+{
+    switch (id)
+    {
+    case DbSnapshotSectionId::Species: return sizeof(DbSnapshotSpecie);
+    case DbSnapshotSectionId::MoveData: return sizeof(DbSnapshotMove);
+    case DbSnapshotSectionId::PokemonMoveData: return sizeof(MoveId);
+    case DbSnapshotSectionId::Strings: return sizeof(char);
+    case DbSnapshotSectionId::TypeEffectivenessData: return sizeof(float);
+    case DbSnapshotSectionId::Levels: return sizeof(DbSnapshotLevel);
+    case DbSnapshotSectionId::Settings: return sizeof(DbSnapshotSettings);
+    default: return 0;
+    }
+}
+
+template <typename T>
+void Append(std::vector<uint8_t>& buffer, const T* values, size_t count)
+{
+    const auto* bytes = reinterpret_cast<const uint8_t*>(values);
+    buffer.insert(buffer.end(), bytes, bytes + count * sizeof(T));
+}
+
+bool IsValidType(PokemonType type)
+{
+    return type >= PokemonType::NONE && type < PokemonType::NUM_TYPES;
+}
+
+bool IsValidRarity(PokemonRarity rarity)
+{
+    return rarity >= PokemonRarity::NORMAL && rarity <= PokemonRarity::MYTHIC;
+}
+
+} // ~unnamed namespace
+
+DbSnapshotString DbSnapshotData::AddString(std::string_view str)
+{
+    const DbSnapshotString result{ (uint32_t)strings.size(), (uint32_t)str.size() };
+    strings.append(str);
+    strings.push_back('\0');
+    return result;
+}
+
+DbSnapshotData CompiledDbSnapshotData()
+{
+    DbSnapshotData data{};
+    for (const auto& kvp : PokemonByNumber)
+    {
+        const auto& pkm = kvp.second;
+        data.species.push_back({
+            pkm.number, pkm.baseAtk, pkm.baseDef, pkm.baseSta, data.AddString(pkm.id), pkm.type, pkm.type2,
+            pkm.rarity, pkm.buddyDistance, pkm.fastMoves, pkm.chargeMoves, pkm.malePercent, pkm.femalePercent,
+            pkm.minCp, pkm.maxCp, pkm.total, 0, pkm.bulk
+        });
+    }
+    for (const auto& move : PoGoCmp::Moves)
+    {
+        data.moves.push_back({
+            data.AddString(move.id), move.type, {}, move.combatPower, move.pvpPower, move.combatDuration,
+            move.pvpDuration, move.combatEnergy, move.pvpEnergy, move.damageWindowStartMs, move.damageWindowEndMs
+        });
+    }
+    data.pokemonMoves.assign(PoGoCmp::PokemonMoves.begin(), PoGoCmp::PokemonMoves.end());
+    for (const auto& row : PoGoCmp::TypeEffectiveness)
+        data.typeEffectiveness.insert(data.typeEffectiveness.end(), row.begin(), row.end());
+    for (size_t i = 0; i < PlayerLevel.cpMultiplier.size(); ++i)
+    {
+        data.levels.push_back({
+            PlayerLevel.requiredExperience[i], PlayerLevel.cpMultiplier[i], PokemonUpgrades.stardustCost[i],
+            PokemonUpgrades.candyCost[i], 0
+        });
+    }
+    data.settings = {
+        PlayerLevel.maxEggPlayerLevel, PlayerLevel.maxEncounterPlayerLevel, PokemonUpgrades.upgradesPerLevel,
+        PokemonUpgrades.allowedLevelsAbovePlayer
+    };
+    return data;
+}
+
+bool WriteDbSnapshot(const std::string& path, const DbSnapshotData& data)
+{
+    if (!IsLittleEndianHost()) return false;
+
+    std::vector<DbSnapshotSection> sections{
+        { DbSnapshotSectionId::Species, (uint32_t)data.species.size(), 0, 0 },
+        { DbSnapshotSectionId::MoveData, (uint32_t)data.moves.size(), 0, 0 },
+        { DbSnapshotSectionId::PokemonMoveData, (uint32_t)data.pokemonMoves.size(), 0, 0 },
+        { DbSnapshotSectionId::Strings, (uint32_t)data.strings.size(), 0, 0 },
+        { DbSnapshotSectionId::TypeEffectivenessData, (uint32_t)data.typeEffectiveness.size(), 0, 0 },
+        { DbSnapshotSectionId::Levels, (uint32_t)data.levels.size(), 0, 0 },
+        { DbSnapshotSectionId::Settings, 1, 0, 0 }
+    };
+
+    std::vector<uint8_t> buffer(sizeof(DbSnapshotHeader) + sections.size() * sizeof(DbSnapshotSection));
+    auto appendSection = [&](DbSnapshotSection& section, const auto* values)
+    {
+        buffer.resize((buffer.size() + sectionAlignment - 1) / sectionAlignment * sectionAlignment);
+        section.offset = (uint32_t)buffer.size();
+        section.size = section.count * (uint32_t)RecordSize(section.id);
+        Append(buffer, values, section.count);
+    };
+    appendSection(sections[0], data.species.data());
+    appendSection(sections[1], data.moves.data());
+    appendSection(sections[2], data.pokemonMoves.data());
+    appendSection(sections[3], data.strings.data());
+    appendSection(sections[4], data.typeEffectiveness.data());
+    appendSection(sections[5], data.levels.data());
+    appendSection(sections[6], &data.settings);
+    std::memcpy(&buffer[sizeof(DbSnapshotHeader)], sections.data(), sections.size() * sizeof(DbSnapshotSection));
+
+    DbSnapshotHeader header{};
+    std::memcpy(header.magic, fileMagic, sizeof(fileMagic));
+    header.version = DbSnapshotVersion;
+    header.fileSize = (uint32_t)buffer.size();
+    header.checksum = Crc32(buffer.data() + sizeof(header), buffer.size() - sizeof(header));
+    header.numSections = (uint32_t)sections.size();
+    std::memcpy(buffer.data(), &header, sizeof(header));
+
+    Utf8::ofstream file(path, std::ios::binary);
+    if (!file) return false;
+    file.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+    return (bool)file;
+}
+
+DbSnapshot::~DbSnapshot()
+{
+    Unload();
+}
+
+bool DbSnapshot::Load(const std::string& path)
+{
+    Unload();
+    if (!IsLittleEndianHost()) return false;
+
+#ifdef WIN32
+    HANDLE file = CreateFileW(
+        Utf8::ToWString(path).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+        nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER fileSize{};
+    HANDLE mapping = GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0
+        ? CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr)
+        : nullptr;
+    CloseHandle(file);
+    if (!mapping) return false;
+    // The view keeps the mapping alive.
+    const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!view) return false;
+    data = static_cast<const uint8_t*>(view);
+    size = (size_t)fileSize.QuadPart;
+#else
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st{};
+    void* view = fstat(fd, &st) == 0 && st.st_size > 0
+        ? mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0)
+        : MAP_FAILED;
+    // The mapping stays valid after closing the file.
+    close(fd);
+    if (view == MAP_FAILED) return false;
+    data = static_cast<const uint8_t*>(view);
+    size = (size_t)st.st_size;
+#endif
+
+    if (!Validate())
+    {
+        Unload();
+        return false;
+    }
+    return true;
+}
+
+void DbSnapshot::Unload()
+{
+    if (!data) return;
+#ifdef WIN32
+    UnmapViewOfFile(data);
+#else
+    munmap(const_cast<uint8_t*>(data), size);
+#endif
+    data = nullptr;
+    size = 0;
+}
+
+std::string_view DbSnapshot::String(const DbSnapshotString& str) const
+{
+    const auto strings = Section<char>(DbSnapshotSectionId::Strings);
+    return strings.empty() ? std::string_view{} : std::string_view{ strings.data + str.offset, str.size };
+}
+
+const DbSnapshotSection* DbSnapshot::FindSection(DbSnapshotSectionId id) const
+{
+    if (!data) return nullptr;
+    DbSnapshotHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    const auto* sections = reinterpret_cast<const DbSnapshotSection*>(data + sizeof(header));
+    for (size_t i = 0; i < header.numSections; ++i)
+        if (sections[i].id == id)
+            return &sections[i];
+    return nullptr;
+}
+
+bool DbSnapshot::Validate() const
+{
+    DbSnapshotHeader header;
+    if (size < sizeof(header)) return false;
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, fileMagic, sizeof(fileMagic)) != 0) return false;
+    if (header.version != DbSnapshotVersion || header.fileSize != size) return false;
+    if (header.numSections > (size - sizeof(header)) / sizeof(DbSnapshotSection)) return false;
+    if (Crc32(data + sizeof(header), size - sizeof(header)) != header.checksum) return false;
+
+    const auto* sections = reinterpret_cast<const DbSnapshotSection*>(data + sizeof(header));
+    for (size_t i = 0; i < header.numSections; ++i)
+    {
+        const auto& section = sections[i];
+        // FindSection() would see only the first one.
+        for (size_t j = 0; j < i; ++j)
+            if (sections[j].id == section.id) return false;
+        const auto recordSize = RecordSize(section.id);
+        if (recordSize == 0) continue; // unknown sections are allowed for forward compatibility
+        if (section.offset % sectionAlignment != 0 || (uint64_t)section.offset + section.size > size) return false;
+        if ((uint64_t)section.count * recordSize != section.size) return false;
+    }
+    for (auto id : {
+            DbSnapshotSectionId::Species, DbSnapshotSectionId::MoveData, DbSnapshotSectionId::PokemonMoveData,
+            DbSnapshotSectionId::Strings, DbSnapshotSectionId::TypeEffectivenessData, DbSnapshotSectionId::Levels,
+            DbSnapshotSectionId::Settings })
+    {
+        if (!FindSection(id)) return false;
+    }
+
+    return ValidateDbSnapshotRecords(Species(), Moves(), PokemonMoves(), Section<char>(DbSnapshotSectionId::Strings),
+            TypeEffectiveness(), Levels()) &&
+        Section<DbSnapshotSettings>(DbSnapshotSectionId::Settings).size() == 1;
+}
+
+bool ValidateDbSnapshotRecords(
+    DbSnapshotSpan<DbSnapshotSpecie> species,
+    DbSnapshotSpan<DbSnapshotMove> moves,
+    DbSnapshotSpan<MoveId> pokemonMoves,
+    DbSnapshotSpan<char> strings,
+    DbSnapshotSpan<float> typeEffectiveness,
+    DbSnapshotSpan<DbSnapshotLevel> levels)
+{
+    auto isValidString = [&strings](const DbSnapshotString& str)
+    {
+        return (uint64_t)str.offset + str.size < strings.size() && strings[str.offset + str.size] == '\0';
+    };
+    auto isValidSpan = [&pokemonMoves](const MoveSpan& span)
+    {
+        return (size_t)span.offset + span.size <= pokemonMoves.size();
+    };
+    for (const auto& pkm : species)
+    {
+        if (!isValidString(pkm.id) || !isValidSpan(pkm.fastMoves) || !isValidSpan(pkm.chargeMoves) ||
+            !IsValidType(pkm.type) || !IsValidType(pkm.type2) || !IsValidRarity(pkm.rarity))
+        {
+            return false;
+        }
+    }
+    for (const auto& move : moves)
+        if (!isValidString(move.id) || !IsValidType(move.type)) return false;
+    for (auto move : pokemonMoves)
+        if ((size_t)move >= moves.size()) return false;
+    for (const auto& level : levels)
+        if (!(level.cpMultiplier > 0.f && level.cpMultiplier <= 1.f)) return false;
+    const auto numTypes = (size_t)PokemonType::NUM_TYPES;
+    return typeEffectiveness.size() == numTypes * numTypes && !levels.empty();
+}
+
+} // ~namespace PoGoCmp
@@ -0,0 +1,233 @@
+/**
+    @file DbSnapshot.h
+    @brief Versioned, checksummed binary snapshot of the game data. PoGoDbGen writes it next to the generated
+    sources and it can be memory-mapped at runtime so that new game data can be used without recompiling. */
+#pragma once
+
+#include "PoGoDb.h"
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace PoGoCmp
+{
+
+//! Incremented whenever the layout of the records below changes.
+constexpr uint32_t DbSnapshotVersion = 1;
+
+//! The file consists of the header, a table of DbSnapshotSections and the sections, each aligned to 8 bytes.
+//! All values are little-endian. The records are used in place from the mapped file, so they have only
+//! fixed-width members and explicit padding.
+struct DbSnapshotHeader
+{
+    //! "PGDB"
+    char magic[4];
+    uint32_t version;
+    //! Size of the whole file in bytes.
+    uint32_t fileSize;
+    //! CRC-32 of the file after the header.
+    uint32_t checksum;
+    uint32_t numSections;
+    uint32_t reserved;
+};
+
+enum class DbSnapshotSectionId : uint32_t
+{
+    //! DbSnapshotSpecie per PokemonByNumber entry, in the same order, i.e. indexed by SpecieIndex.
+    Species = 1,
+    //! DbSnapshotMove per Moves entry, in the same order, i.e. indexed by MoveId.
+    MoveData,
+    //! MoveId per PokemonMoves entry, the move spans of DbSnapshotSpecie refer to these.
+    PokemonMoveData,
+    //! Null-terminated strings referred to by DbSnapshotString.
+    Strings,
+    //! TypeEffectiveness as floats, row-major.
+    TypeEffectivenessData,
+    //! DbSnapshotLevel per whole Pokémon level.
+    Levels,
+    //! A single DbSnapshotSettings.
+    Settings
+};
+
+struct DbSnapshotSection
+{
+    DbSnapshotSectionId id;
+    //! Number of records.
+    uint32_t count;
+    //! From the beginning of the file.
+    uint32_t offset;
+    //! In bytes.
+    uint32_t size;
+};
+
+//! String in the Strings section, not including the null terminator.
+struct DbSnapshotString
+{
+    uint32_t offset;
+    uint32_t size;
+};
+
+//! PokemonSpecie, see its documentation.
+struct DbSnapshotSpecie
+{
+    PokedexNumber number;
+    uint16_t baseAtk;
+    uint16_t baseDef;
+    uint16_t baseSta;
+    DbSnapshotString id;
+    PokemonType type;
+    PokemonType type2;
+    PokemonRarity rarity;
+    uint8_t buddyDistance;
+    MoveSpan fastMoves;
+    MoveSpan chargeMoves;
+    float malePercent;
+    float femalePercent;
+    uint16_t minCp;
+    uint16_t maxCp;
+    uint16_t total;
+    uint16_t reserved;
+    uint32_t bulk;
+};
+
+//! Move, see its documentation.
+struct DbSnapshotMove
+{
+    DbSnapshotString id;
+    PokemonType type;
+    uint8_t reserved[3];
+    float combatPower;
+    float pvpPower;
+    float combatDuration;
+    float pvpDuration;
+    float combatEnergy;
+    float pvpEnergy;
+    float damageWindowStartMs;
+    float damageWindowEndMs;
+
+    bool IsFastMove() const { return combatEnergy > 0; }
+    bool IsChargeMove() const { return !IsFastMove(); }
+};
+
+//! PlayerLevel and PokemonUpgrades of a level.
+struct DbSnapshotLevel
+{
+    uint32_t requiredExperience;
+    float cpMultiplier;
+    uint16_t stardustCost;
+    uint8_t candyCost;
+    uint8_t reserved;
+};
+
+//! The scalar members of PlayerLevel and PokemonUpgrades.
+struct DbSnapshotSettings
+{
+    uint8_t maxEggPlayerLevel;
+    uint8_t maxEncounterPlayerLevel;
+    uint8_t upgradesPerLevel;
+    uint8_t allowedLevelsAbovePlayer;
+};
+
+static_assert(sizeof(DbSnapshotHeader) == 24, "DbSnapshotHeader layout changed");
+static_assert(sizeof(DbSnapshotSection) == 16, "DbSnapshotSection layout changed");
+static_assert(sizeof(DbSnapshotSpecie) == 48, "DbSnapshotSpecie layout changed");
+static_assert(sizeof(DbSnapshotMove) == 44, "DbSnapshotMove layout changed");
+static_assert(sizeof(DbSnapshotLevel) == 12, "DbSnapshotLevel layout changed");
+static_assert(sizeof(DbSnapshotSettings) == 4, "DbSnapshotSettings layout changed");
+
+//! The contents of a snapshot to be written.
+struct DbSnapshotData
+{
+    std::vector<DbSnapshotSpecie> species;
+    std::vector<DbSnapshotMove> moves;
+    std::vector<MoveId> pokemonMoves;
+    std::vector<float> typeEffectiveness;
+    std::vector<DbSnapshotLevel> levels;
+    DbSnapshotSettings settings;
+    //! Null-terminated strings, use AddString().
+    std::string strings;
+
+    DbSnapshotString AddString(std::string_view str);
+};
+
+//! @return The compiled-in database as snapshot data.
+DbSnapshotData CompiledDbSnapshotData();
+
+//! @return False if the file couldn't be written, or if the host is not little-endian.
+bool WriteDbSnapshot(const std::string& path, const DbSnapshotData& data);
+
+//! Array of records in a mapped snapshot.
+template <typename T>
+struct DbSnapshotSpan
+{
+    const T* data;
+    size_t count;
+
+    const T* begin() const { return data; }
+    const T* end() const { return data + count; }
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    const T& operator[](size_t i) const { return data[i]; }
+};
+
+//! Checks the references between the records so that they can be used without bounds checks, and the values that
+//! index tables: the strings, the move spans and the move IDs are within bounds, the types and the rarities are
+//! valid, the type effectiveness table is NUM_TYPES x NUM_TYPES and there's at least one level, with a CP
+//! multiplier in (0, 1]. Shared by DbSnapshot::Load() and Database::FromData().
+//! @param strings All of the null-terminated strings.
+bool ValidateDbSnapshotRecords(
+    DbSnapshotSpan<DbSnapshotSpecie> species,
+    DbSnapshotSpan<DbSnapshotMove> moves,
+    DbSnapshotSpan<MoveId> pokemonMoves,
+    DbSnapshotSpan<char> strings,
+    DbSnapshotSpan<float> typeEffectiveness,
+    DbSnapshotSpan<DbSnapshotLevel> levels);
+
+//! Read-only memory mapping of a snapshot file. The records are used directly from the mapping: loading only
+//! validates the header, the checksum and the bounds of the sections and the references between them.
+class DbSnapshot
+{
+public:
+    DbSnapshot() = default;
+    ~DbSnapshot();
+    DbSnapshot(const DbSnapshot&) = delete;
+    DbSnapshot& operator=(const DbSnapshot&) = delete;
+
+    //! Unloads the previously loaded snapshot, if any.
+    //! @return False if the file couldn't be mapped, or it's not a valid snapshot of DbSnapshotVersion,
+    //! or the host is not little-endian.
+    bool Load(const std::string& path);
+    void Unload();
+    bool IsLoaded() const { return data != nullptr; }
+
+    //! The accessors below are empty if nothing is loaded.
+    DbSnapshotSpan<DbSnapshotSpecie> Species() const { return Section<DbSnapshotSpecie>(DbSnapshotSectionId::Species); }
+    DbSnapshotSpan<DbSnapshotMove> Moves() const { return Section<DbSnapshotMove>(DbSnapshotSectionId::MoveData); }
+    DbSnapshotSpan<MoveId> PokemonMoves() const { return Section<MoveId>(DbSnapshotSectionId::PokemonMoveData); }
+    DbSnapshotSpan<float> TypeEffectiveness() const { return Section<float>(DbSnapshotSectionId::TypeEffectivenessData); }
+    DbSnapshotSpan<DbSnapshotLevel> Levels() const { return Section<DbSnapshotLevel>(DbSnapshotSectionId::Levels); }
+    //! @return Null if nothing is loaded.
+    const DbSnapshotSettings* Settings() const { return Section<DbSnapshotSettings>(DbSnapshotSectionId::Settings).data; }
+    //! @return Null-terminated string, a valid reference guaranteed for the records of a loaded snapshot.
+    std::string_view String(const DbSnapshotString& str) const;
+
+private:
+    const DbSnapshotSection* FindSection(DbSnapshotSectionId id) const;
+    bool Validate() const;
+
+    template <typename T>
+    DbSnapshotSpan<T> Section(DbSnapshotSectionId id) const
+    {
+        const auto* section = FindSection(id);
+        if (!section) return { nullptr, 0 };
+        return { reinterpret_cast<const T*>(data + section->offset), section->count };
+    }
+
+    const uint8_t* data{};
+    size_t size{};
+};
+
+} // ~namespace PoGoCmp
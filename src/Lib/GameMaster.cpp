@@ -0,0 +1,476 @@
+/**
+    @file GameMaster.cpp
+    @brief */
+#include "GameMaster.h"
+#include "Utf8.h"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <istream>
+#include <map>
+#include <vector>
+
+namespace PoGoCmp
+{
+
+namespace
+{
+
+using nlohmann::json;
+
+const std::string_view typePrefix{ "POKEMON_TYPE_" };
+
+//! Matches <prefix>V<4 digits><infix><word>, e.g. "FORMS_V0122_POKEMON_MR_MIME", the same as the regexes of PoGoDbGen.
+bool MatchTemplateId(std::string_view id, std::string_view prefix, std::string_view infix, uint16_t& number)
+{
+    const auto digitsPos = prefix.size() + 1;
+    const auto restPos = digitsPos + 4 + infix.size();
+    if (id.size() <= restPos || id.substr(0, prefix.size()) != prefix || id[prefix.size()] != 'V' ||
+        id.substr(digitsPos + 4, infix.size()) != infix)
+    {
+        return false;
+    }
+    number = 0;
+    for (auto c : id.substr(digitsPos, 4))
+    {
+        if (c < '0' || c > '9') return false;
+        number = uint16_t(number * 10 + (c - '0'));
+    }
+    return std::all_of(id.begin() + restPos, id.end(),
+        [](char c) { return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '_'; });
+}
+
+PokemonType TypeByName(const std::string& name)
+{
+    return name.compare(0, typePrefix.size(), typePrefix) == 0
+        ? StringToPokemonType(name.c_str() + typePrefix.size())
+        : PokemonType::NONE;
+}
+
+void RemoveFastPostfix(std::string& id)
+{
+    const std::string_view postfix{ "_FAST" };
+    if (id.size() >= postfix.size() && id.compare(id.size() - postfix.size(), postfix.size(), postfix) == 0)
+        id.erase(id.size() - postfix.size());
+}
+
+template <typename T>
+void AssignIfFound(const json& object, const char* key, T& value)
+{
+    if (auto it = object.find(key); it != object.end())
+        value = it->get<T>();
+}
+
+//! The same CP computation as in PoGoDbGen, operation by operation, so that the results are bit-exactly the same.
+int ComputeCpAtCpm(float cpm, int atk, int def, int sta)
+{
+    const auto cpmSquared = (double)cpm * (double)cpm;
+    return static_cast<int>(std::floor(
+        float(atk) * std::pow(float(def), 0.5f) * std::pow(float(sta), 0.5f) * cpmSquared / 10.f));
+}
+
+//! The tables while reading, converted to DbSnapshotData in the end.
+class GameMasterReader
+{
+public:
+    void Read(const json& itemTemplate);
+    bool Finish(DbSnapshotData& data) const;
+
+private:
+    struct Specie
+    {
+        uint16_t baseAtk, baseDef, baseSta;
+        std::string id;
+        std::string formId;
+        PokemonType type{ PokemonType::NONE };
+        PokemonType type2{ PokemonType::NONE };
+        PokemonRarity rarity;
+        uint8_t buddyDistance;
+        float malePercent, femalePercent;
+        std::vector<std::string> fastMoves;
+        std::vector<std::string> chargeMoves;
+    };
+
+    struct MoveData
+    {
+        std::string id;
+        PokemonType type;
+        float combatPower, pvpPower, combatDuration, pvpDuration, combatEnergy, pvpEnergy;
+        float damageWindowStartMs, damageWindowEndMs;
+    };
+
+    void ReadSpecie(uint16_t number, const json& settings);
+
+    std::multimap<uint16_t, Specie> species;
+    //! Keyed by the game's template IDs, e.g. "EMBER_FAST".
+    std::map<std::string, MoveData> moves;
+    std::array<float, (size_t)PokemonType::NUM_TYPES * (size_t)PokemonType::NUM_TYPES> typeEffectiveness{};
+    std::vector<uint32_t> requiredExperience;
+    std::vector<float> cpMultiplier;
+    std::vector<uint8_t> candyCost;
+    std::vector<uint16_t> stardustCost;
+    DbSnapshotSettings settings{};
+};
+
+void GameMasterReader::Read(const json& itemTemplate)
+{
+    const std::string& templateId = itemTemplate.at("templateId").get_ref<const std::string&>();
+    uint16_t number{};
+    if (templateId == "PLAYER_LEVEL_SETTINGS")
+    {
+        const auto& playerLevel = itemTemplate.at("playerLevel");
+        requiredExperience = playerLevel.at("requiredExperience").get<std::vector<uint32_t>>();
+        cpMultiplier = playerLevel.at("cpMultiplier").get<std::vector<float>>();
+        settings.maxEggPlayerLevel = playerLevel.at("maxEggPlayerLevel").get<uint8_t>();
+        settings.maxEncounterPlayerLevel = playerLevel.at("maxEncounterPlayerLevel").get<uint8_t>();
+    }
+    else if (templateId == "POKEMON_UPGRADE_SETTINGS")
+    {
+        const auto& upgrades = itemTemplate.at("pokemonUpgrades");
+        settings.upgradesPerLevel = upgrades.at("upgradesPerLevel").get<uint8_t>();
+        settings.allowedLevelsAbovePlayer = upgrades.at("allowedLevelsAbovePlayer").get<uint8_t>();
+        candyCost = upgrades.at("candyCost").get<std::vector<uint8_t>>();
+        stardustCost = upgrades.at("stardustCost").get<std::vector<uint16_t>>();
+    }
+    else if (const auto type = TypeByName(templateId); type != PokemonType::NONE)
+    {
+        const auto& attackScalar = itemTemplate.at("typeEffective").at("attackScalar");
+        const auto numTypes = (size_t)PokemonType::NUM_TYPES;
+        for (size_t j = 0; j < numTypes && j < attackScalar.size(); ++j)
+            typeEffectiveness[(size_t)type * numTypes + j] = attackScalar[j].get<float>();
+    }
+    else if (MatchTemplateId(templateId, "COMBAT_", "_MOVE_", number))
+    {
+        const auto& combatMove = itemTemplate.at("combatMove");
+        MoveData move{};
+        move.id = combatMove.at("uniqueId").get<std::string>();
+        move.type = TypeByName(combatMove.at("type").get<std::string>());
+        // Missing e.g. for moves with 0 power, applies only for fast moves and for moves with no energy respectively.
+        AssignIfFound(combatMove, "power", move.pvpPower);
+        AssignIfFound(combatMove, "durationTurns", move.pvpDuration);
+        AssignIfFound(combatMove, "energyDelta", move.pvpEnergy);
+        moves[move.id] = move;
+    }
+    else if (MatchTemplateId(templateId, "", "_MOVE_", number))
+    {
+        const auto& moveSettings = itemTemplate.at("moveSettings");
+        auto& move = moves[moveSettings.at("movementId").get<std::string>()];
+        RemoveFastPostfix(move.id);
+        AssignIfFound(moveSettings, "power", move.combatPower);
+        AssignIfFound(moveSettings, "energyDelta", move.combatEnergy);
+        move.combatDuration = moveSettings.at("durationMs").get<float>();
+        move.damageWindowStartMs = moveSettings.at("damageWindowStartMs").get<float>();
+        move.damageWindowEndMs = moveSettings.at("damageWindowEndMs").get<float>();
+    }
+    else if (MatchTemplateId(templateId, "FORMS_", "_POKEMON_", number))
+    {
+        // Form information comes first, the species/forms are added here.
+        const auto& formSettings = itemTemplate.at("formSettings");
+        Specie pkm{};
+        pkm.id = formSettings.at("pokemon").get<std::string>();
+        if (auto forms = formSettings.find("forms"); forms != formSettings.end())
+        {
+            for (const auto& form : *forms)
+            {
+                pkm.formId = form.at("form").get<std::string>();
+                species.insert({ number, pkm });
+            }
+        }
+        else
+        {
+            species.insert({ number, pkm });
+        }
+    }
+    else if (MatchTemplateId(templateId, "SPAWN_", "_POKEMON_", number))
+    {
+        // There's extraneous information for every Pokémon with multiple forms, e.g. RATTATA, RATTATA_ALOLA and
+        // RATTATA_NORMAL, the ones without the form postfix are discarded.
+        const auto forms = species.equal_range(number);
+        const auto formId = templateId.substr(templateId.find("_POKEMON_") + 9);
+        auto it = std::distance(forms.first, forms.second) == 1
+            ? forms.first
+            : std::find_if(forms.first, forms.second, [&formId](const auto& form) { return formId == form.second.formId; });
+        if (it == forms.second) return;
+
+        auto& pkm = it->second;
+        const auto genderSettings = itemTemplate.find("genderSettings");
+        if (genderSettings == itemTemplate.end()) return;
+        const auto& gender = genderSettings->at("gender");
+        AssignIfFound(gender, "malePercent", pkm.malePercent);
+        AssignIfFound(gender, "femalePercent", pkm.femalePercent);
+        if (gender.find("genderlessPercent") != gender.end())
+            pkm.malePercent = pkm.femalePercent = 0.f;
+        pkm.malePercent *= 100;
+        pkm.femalePercent *= 100;
+    }
+    else if (MatchTemplateId(templateId, "", "_POKEMON_", number))
+    {
+        ReadSpecie(number, itemTemplate.at("pokemonSettings"));
+    }
+}
+
+void GameMasterReader::ReadSpecie(uint16_t number, const json& pokemonSettings)
+{
+    const auto& id = pokemonSettings.at("pokemonId").get_ref<const std::string&>();
+    const auto form = pokemonSettings.find("form");
+    const auto& formName = form != pokemonSettings.end() ? form->get_ref<const std::string&>() : id;
+    const auto forms = species.equal_range(number);
+    for (auto formIt = forms.first; formIt != forms.second; ++formIt)
+    {
+        auto& pkm = formIt->second;
+        // Also e.g. Unown and Spinda are missing the form and have only a single data entry for all forms.
+        if (!((!pkm.formId.empty() && formName == pkm.formId) || formName == pkm.id || pkm.formId.find(formName) == 0))
+            continue;
+
+        const auto& stats = pokemonSettings.at("stats");
+        pkm.baseAtk = stats.at("baseAttack").get<uint16_t>();
+        pkm.baseDef = stats.at("baseDefense").get<uint16_t>();
+        pkm.baseSta = stats.at("baseStamina").get<uint16_t>();
+        pkm.type = TypeByName(pokemonSettings.at("type").get<std::string>());
+        if (auto type2 = pokemonSettings.find("type2"); type2 != pokemonSettings.end())
+            pkm.type2 = TypeByName(type2->get<std::string>());
+
+        pkm.fastMoves.clear();
+        pkm.chargeMoves.clear();
+        if (auto quickMoves = pokemonSettings.find("quickMoves"); quickMoves != pokemonSettings.end())
+        {
+            for (const auto& move : *quickMoves)
+            {
+                pkm.fastMoves.push_back(move.get<std::string>());
+                RemoveFastPostfix(pkm.fastMoves.back());
+            }
+        }
+        AssignIfFound(pokemonSettings, "cinematicMoves", pkm.chargeMoves);
+
+        // Exists only for legendary and mythic Pokémon.
+        const auto rarity = pokemonSettings.find("rarity");
+        if (rarity != pokemonSettings.end() && *rarity == "POKEMON_RARITY_LEGENDARY")
+            pkm.rarity = PokemonRarity::LEGENDARY;
+        else if (rarity != pokemonSettings.end() && *rarity == "POKEMON_RARITY_MYTHIC")
+            pkm.rarity = PokemonRarity::MYTHIC;
+        else
+            pkm.rarity = PokemonRarity::NORMAL;
+
+        // Stored as double but is always a whole number.
+        pkm.buddyDistance = (uint8_t)pokemonSettings.at("kmBuddyDistance").get<double>();
+    }
+}
+
+bool GameMasterReader::Finish(DbSnapshotData& data) const
+{
+    data = {};
+    const auto numLevels = cpMultiplier.size();
+    if (numLevels == 0 || requiredExperience.size() != numLevels || candyCost.size() != numLevels ||
+        stardustCost.size() != numLevels)
+    {
+        return false;
+    }
+
+    // The written moves are keyed by Move::id, MoveId is the index in this order.
+    std::map<std::string, const MoveData*> movesById;
+    for (const auto& kvp : moves)
+        if (!movesById.emplace(kvp.second.id, &kvp.second).second) return false;
+    std::map<std::string, MoveId> moveIds;
+    for (const auto& kvp : movesById)
+        moveIds.emplace(kvp.first, (MoveId)moveIds.size());
+
+    // Identical movesets are stored only once, in the order of their first use.
+    std::map<std::vector<std::string>, size_t> moveSpanOffsets;
+    bool unknownMoves = false;
+    auto moveSpan = [&](const std::vector<std::string>& moveset)
+    {
+        auto it = moveSpanOffsets.find(moveset);
+        if (it == moveSpanOffsets.end())
+        {
+            it = moveSpanOffsets.emplace(moveset, data.pokemonMoves.size()).first;
+            for (const auto& move : moveset)
+            {
+                const auto id = moveIds.find(move);
+                unknownMoves |= id == moveIds.end();
+                data.pokemonMoves.push_back(id != moveIds.end() ? id->second : MoveId::NONE);
+            }
+        }
+        return MoveSpan{ (uint16_t)it->second, (uint16_t)moveset.size() };
+    };
+
+    for (const auto& [number, pkm] : species)
+    {
+        const auto fastMoves = moveSpan(pkm.fastMoves);
+        const auto chargeMoves = moveSpan(pkm.chargeMoves);
+        data.species.push_back({
+            number, pkm.baseAtk, pkm.baseDef, pkm.baseSta, data.AddString(!pkm.formId.empty() ? pkm.formId : pkm.id),
+            pkm.type, pkm.type2, pkm.rarity, pkm.buddyDistance, fastMoves, chargeMoves, pkm.malePercent,
+            pkm.femalePercent,
+            (uint16_t)ComputeCpAtCpm(cpMultiplier.front(), pkm.baseAtk, pkm.baseDef, pkm.baseSta),
+            (uint16_t)ComputeCpAtCpm(cpMultiplier.back(), pkm.baseAtk + 15, pkm.baseDef + 15, pkm.baseSta + 15),
+            uint16_t(pkm.baseAtk + pkm.baseDef + pkm.baseSta), 0, (uint32_t)pkm.baseDef * pkm.baseSta
+        });
+    }
+    if (unknownMoves) return false;
+
+    for (const auto& kvp : movesById)
+    {
+        const auto& move = *kvp.second;
+        data.moves.push_back({
+            data.AddString(move.id), move.type, {}, move.combatPower, move.pvpPower, move.combatDuration,
+            move.pvpDuration, move.combatEnergy, move.pvpEnergy, move.damageWindowStartMs, move.damageWindowEndMs
+        });
+    }
+    data.typeEffectiveness.assign(typeEffectiveness.begin(), typeEffectiveness.end());
+    for (size_t i = 0; i < numLevels; ++i)
+        data.levels.push_back({ requiredExperience[i], cpMultiplier[i], stardustCost[i], candyCost[i], 0 });
+    data.settings = settings;
+    return true;
+}
+
+//! SAX handler that builds a DOM of one item template at a time and hands it to GameMasterReader.
+class GameMasterSax
+{
+public:
+    explicit GameMasterSax(GameMasterReader& reader_) : reader(reader_) {}
+
+    size_t NumTemplates() const { return numTemplates; }
+
+    bool null() { return Value(nullptr); }
+    bool boolean(bool val) { return Value(val); }
+    bool number_integer(json::number_integer_t val) { return Value(val); }
+    bool number_unsigned(json::number_unsigned_t val) { return Value(val); }
+    bool number_float(json::number_float_t val, const json::string_t&) { return Value(val); }
+    bool string(json::string_t& val) { return Value(std::move(val)); }
+    // Not possible in JSON text.
+    bool binary(json::binary_t&) { return Value(nullptr); }
+
+    bool start_object(size_t)
+    {
+        ++depth;
+        // The root is depth 1, itemTemplates depth 2 and the templates depth 3.
+        if (depth == 3 && inTemplates)
+        {
+            itemTemplate = json::object();
+            stack.push_back(&itemTemplate);
+        }
+        else if (!stack.empty())
+        {
+            stack.push_back(Add(json::object()));
+        }
+        return true;
+    }
+
+    bool end_object()
+    {
+        --depth;
+        if (stack.empty()) return true;
+        stack.pop_back();
+        if (stack.empty())
+        {
+            reader.Read(itemTemplate);
+            itemTemplate = nullptr;
+            ++numTemplates;
+        }
+        return true;
+    }
+
+    bool start_array(size_t)
+    {
+        ++depth;
+        if (depth == 2 && lastKey == "itemTemplates")
+            inTemplates = true;
+        else if (!stack.empty())
+            stack.push_back(Add(json::array()));
+        return true;
+    }
+
+    bool end_array()
+    {
+        --depth;
+        if (depth == 1)
+            inTemplates = false;
+        else if (!stack.empty())
+            stack.pop_back();
+        return true;
+    }
+
+    bool key(json::string_t& val)
+    {
+        lastKey = std::move(val);
+        return true;
+    }
+
+    bool parse_error(size_t, const std::string&, const nlohmann::detail::exception&)
+    {
+        return false;
+    }
+
+private:
+    //! @return The added value.
+    json* Add(json&& value)
+    {
+        auto& parent = *stack.back();
+        if (parent.is_array())
+        {
+            parent.push_back(std::move(value));
+            return &parent.back();
+        }
+        return &(parent[lastKey] = std::move(value));
+    }
+
+    template <typename T>
+    bool Value(T&& value)
+    {
+        if (!stack.empty())
+            Add(json(std::forward<T>(value)));
+        return true;
+    }
+
+    GameMasterReader& reader;
+    json itemTemplate;
+    //! The containers of itemTemplate being built, innermost last.
+    std::vector<json*> stack;
+    std::string lastKey;
+    int depth{};
+    bool inTemplates{};
+    size_t numTemplates{};
+};
+
+} // ~unnamed namespace
+
+bool ReadGameMaster(std::istream& input, DbSnapshotData& data, GameMasterStats* stats)
+{
+    const auto start = std::chrono::steady_clock::now();
+    const auto startPos = input.tellg();
+    GameMasterReader reader;
+    GameMasterSax sax{ reader };
+    bool result = false;
+    try
+    {
+        result = json::sax_parse(input, &sax) && reader.Finish(data);
+    }
+    catch (const std::exception&)
+    {
+        // Missing or mistyped values in the templates.
+        result = false;
+    }
+
+    if (stats)
+    {
+        input.clear();
+        const auto endPos = input.tellg();
+        stats->bytes = startPos != std::streampos(-1) && endPos != std::streampos(-1) ? size_t(endPos - startPos) : 0;
+        stats->numTemplates = sax.NumTemplates();
+        stats->seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+    return result;
+}
+
+bool ReadGameMaster(const std::string& path, DbSnapshotData& data, GameMasterStats* stats)
+{
+    Utf8::ifstream input{ path, std::ios::binary };
+    if (!input.is_open()) return false;
+    return ReadGameMaster(input, data, stats);
+}
+
+} // ~namespace PoGoCmp
@@ -0,0 +1,36 @@
+/**
+    @file GameMaster.h
+    @brief Reading of the game's GAME_MASTER JSON at runtime, without the PoGoDbGen code generation step. */
+#pragma once
+
+#include "DbSnapshot.h"
+
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+
+namespace PoGoCmp
+{
+
+struct GameMasterStats
+{
+    //! Size of the input in bytes, 0 if the stream is not seekable.
+    size_t bytes;
+    //! Number of item templates read.
+    size_t numTemplates;
+    double seconds;
+
+    //! @return 0 if bytes or seconds is 0.
+    double MegabytesPerSecond() const { return bytes && seconds > 0 ? bytes / seconds / (1024 * 1024) : 0; }
+};
+
+//! Parses GAME_MASTER JSON into snapshot data the same way as PoGoDbGen does, so that for the same input the data is
+//! the same as CompiledDbSnapshotData() of the generated database. The input is read in a single streaming pass and
+//! only one item template at a time is kept in memory in addition to the result.
+//! @param stats Optional, filled also if the parsing fails.
+//! @return False if the input is not valid GAME_MASTER JSON or it refers to unknown Pokémon or moves.
+bool ReadGameMaster(std::istream& input, DbSnapshotData& data, GameMasterStats* stats = nullptr);
+//! @overload
+bool ReadGameMaster(const std::string& path, DbSnapshotData& data, GameMasterStats* stats = nullptr);
+
+} // ~namespace PoGoCmp
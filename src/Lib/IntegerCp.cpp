@@ -0,0 +1,193 @@
+/**
+    @file IntegerCp.cpp
+    @brief Integer-only implementation of the CP formula, bit-exactly emulating the IEEE 754 float/double rounding
+    of the floating-point implementation. */
+#include "PoGoCmp.h"
+#include "PoGoDb.h"
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+namespace PoGoCmp
+{
+
+namespace
+{
+
+//! Unrounded or rounded binary floating-point value: sig * 2^exp.
+struct Binary
+{
+    uint64_t sig;
+    int exp;
+};
+
+//! Minimal portable unsigned 128-bit integer, only what is needed below.
+struct UInt128
+{
+    uint64_t hi;
+    uint64_t lo;
+};
+
+int BitLength(uint64_t x)
+{
+#if defined(__GNUC__)
+    return x ? 64 - __builtin_clzll(x) : 0;
+#else
+    int len = 0;
+    for (int shift = 32; shift > 0; shift >>= 1)
+        if (x >> shift) { x >>= shift; len += shift; }
+    return len + (int)x;
+#endif
+}
+
+int BitLength(const UInt128& x)
+{
+    return x.hi ? 64 + BitLength(x.hi) : BitLength(x.lo);
+}
+
+UInt128 Multiply(uint64_t a, uint64_t b)
+{
+#if defined(__SIZEOF_INT128__)
+    __extension__ using UInt128Native = unsigned __int128;
+    const auto product = (UInt128Native)a * b;
+    return { uint64_t(product >> 64), uint64_t(product) };
+#else
+    const uint64_t aLo = a & 0xFFFFFFFF, aHi = a >> 32;
+    const uint64_t bLo = b & 0xFFFFFFFF, bHi = b >> 32;
+    const uint64_t ll = aLo * bLo, lh = aLo * bHi, hl = aHi * bLo, hh = aHi * bHi;
+    const uint64_t mid = (ll >> 32) + (lh & 0xFFFFFFFF) + (hl & 0xFFFFFFFF);
+    return { hh + (lh >> 32) + (hl >> 32) + (mid >> 32), (mid << 32) | (ll & 0xFFFFFFFF) };
+#endif
+}
+
+//! @param shift [1, 64)
+uint64_t ShiftRight(const UInt128& x, int shift)
+{
+    return (x.hi << (64 - shift)) | (x.lo >> shift);
+}
+
+//! Rounds sig to nearest with ties to even, discarding the low `shift` bits.
+//! @param sticky Whether there are non-zero bits below the ones in sig, i.e. sig is inexact.
+Binary RoundDiscarding(uint64_t sig, uint64_t discarded, int shift, int exp, int bits, bool sticky)
+{
+    const uint64_t half = uint64_t(1) << (shift - 1);
+    if (discarded > half || (discarded == half && (sticky || (sig & 1))))
+    {
+        ++sig;
+        // Carry to a new bit, e.g. 0xFFFFFF -> 0x1000000, the dropped bit is zero so this stays exact.
+        if (sig >> bits) { sig >>= 1; ++shift; }
+    }
+    return { sig, exp + shift };
+}
+
+//! Rounds to a float (bits 24) or a double (bits 53), the same way as the FPU does in the default rounding mode.
+Binary Round(uint64_t sig, int exp, int bits, bool sticky = false)
+{
+    const int shift = BitLength(sig) - bits;
+    if (shift <= 0) return { sig, exp };
+    return RoundDiscarding(sig >> shift, sig & ((uint64_t(1) << shift) - 1), shift, exp, bits, sticky);
+}
+
+Binary Round(const UInt128& sig, int exp, int bits)
+{
+    if (sig.hi == 0) return Round(sig.lo, exp, bits);
+    // The inputs are small enough so that the discarded bits always fit in 64 bits.
+    const int shift = BitLength(sig) - bits;
+    return RoundDiscarding(ShiftRight(sig, shift), sig.lo & ((uint64_t(1) << shift) - 1), shift, exp, bits, false);
+}
+
+uint64_t FloorSqrt(uint64_t x)
+{
+    uint64_t result = 0;
+    uint64_t bit = uint64_t(1) << 62;
+    while (bit > x) bit >>= 2;
+    while (bit)
+    {
+        if (x >= result + bit)
+        {
+            x -= result + bit;
+            result = (result >> 1) + bit;
+        }
+        else
+        {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return result;
+}
+
+//! Correctly rounded float square root of a positive integer, i.e. the same as sqrtf().
+Binary ComputeSqrt(uint32_t x)
+{
+    // Scale by 4^k so that the integer square root has the 24 bits of a float mantissa: x * 4^k in [2^46, 2^48).
+    const int len = BitLength(x);
+    const int k = len < 47 ? (47 - len + 1) / 2 : 0;
+    const uint64_t scaled = uint64_t(x) << (2 * k);
+    const uint64_t root = FloorSqrt(scaled);
+    // The exact root of an integer is never halfway between two integers: round up if x - r^2 > r.
+    if (scaled - root * root > root)
+        return Round(root + 1, -k, 24);
+    return { root, -k };
+}
+
+//! The total stats (base + IV) of all species are below this so their square roots are looked up from a table.
+const uint32_t numTabulatedSqrts = 1024;
+
+const auto sqrtTable = []
+{
+    std::array<Binary, numTabulatedSqrts> t{};
+    for (uint32_t i = 1; i < numTabulatedSqrts; ++i)
+        t[i] = ComputeSqrt(i);
+    return t;
+}();
+
+Binary Sqrt(uint32_t x)
+{
+    return x < numTabulatedSqrts ? sqrtTable[x] : ComputeSqrt(x);
+}
+
+//! @param cpm At most 27 significant bits so that its square fits in 64 bits.
+int ComputeCp(Binary cpm, int atk, int def, int sta)
+{
+    if (atk <= 0 || def <= 0 || sta <= 0) return 0;
+
+    // atk * pow(def, 0.5f) * pow(sta, 0.5f), float
+    const auto sqrtDef = Sqrt((uint32_t)def);
+    const auto sqrtSta = Sqrt((uint32_t)sta);
+    const auto product1 = Round((uint64_t)atk * sqrtDef.sig, sqrtDef.exp, 24);
+    const auto product2 = Round(product1.sig * sqrtSta.sig, product1.exp + sqrtSta.exp, 24);
+
+    // * cpm^2, double
+    const auto product3 = Round(Multiply(product2.sig, cpm.sig * cpm.sig), product2.exp + 2 * cpm.exp, 53);
+
+    // / 10, double: normalized to 64 bits to have enough quotient bits and a remainder for the sticky bit.
+    const int shift = 64 - BitLength(product3.sig);
+    const uint64_t dividend = product3.sig << shift;
+    const auto quotient = Round(dividend / 10, product3.exp - shift, 53, dividend % 10 != 0);
+
+    // floor
+    if (quotient.exp >= 0) return (int)(quotient.sig << quotient.exp);
+    if (quotient.exp <= -64) return 0;
+    return (int)(quotient.sig >> -quotient.exp);
+}
+
+} // ~unnamed namespace
+
+int ComputeCpInteger(LevelIndex level, int atk, int def, int sta)
+{
+    if ((size_t)level >= PoGoCmp::HalfLevelCpMultiplierQ27.size()) return -1;
+    return ComputeCp({ PoGoCmp::HalfLevelCpMultiplierQ27[(size_t)level], -27 }, atk, def, sta);
+}
+
+int ComputeCpInteger(float cpm, int atk, int def, int sta)
+{
+    if (!(cpm > 0.f && cpm <= 1.f)) return -1;
+    // Exact decomposition to the 24-bit significand and the exponent.
+    int exp = 0;
+    const auto sig = (uint64_t)std::ldexp(std::frexp(cpm, &exp), 24);
+    return ComputeCp({ sig, exp - 24 }, atk, def, sta);
+}
+
+} // ~namespace PoGoCmp
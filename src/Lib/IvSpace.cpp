@@ -0,0 +1,68 @@
+/**
+    @file IvSpace.cpp
+    @brief */
+#include "IvSpace.h"
+#include "BaseStatsCache.h"
+#include "PoGoDb.h"
+#include "Parallel.h"
+
+#include <algorithm>
+#include <memory>
+
+namespace PoGoCmp
+{
+
+size_t IvSpace::NumLevels()
+{
+    return PoGoCmp::HalfLevelCpMultiplier.size();
+}
+
+IvSpace::IvSpace(SpecieIndex idx) :
+    cp(NumLevels() * NumIvCombinations),
+    atk(NumLevels() * NumIvValues),
+    def(NumLevels() * NumIvValues),
+    sta(NumLevels() * NumIvValues)
+{
+    // The IV inputs are the same for every level, only the level changes between the batches.
+    std::vector<SpecieIndex> species(NumIvCombinations, idx);
+    std::vector<LevelIndex> levels(NumIvCombinations);
+    std::vector<uint8_t> atkIvs(NumIvCombinations), defIvs(NumIvCombinations), staIvs(NumIvCombinations);
+    for (size_t i = 0; i < NumIvCombinations; ++i)
+    {
+        atkIvs[i] = (uint8_t)AtkIv((IvIndex)i);
+        defIvs[i] = (uint8_t)DefIv((IvIndex)i);
+        staIvs[i] = (uint8_t)StaIv((IvIndex)i);
+    }
+
+    std::vector<int> result(NumIvCombinations);
+    std::vector<int> atkResult(NumIvValues), defResult(NumIvValues), staResult(NumIvValues);
+    for (size_t level = 0; level < NumLevels(); ++level)
+    {
+        std::fill(levels.begin(), levels.end(), (LevelIndex)level);
+        ComputeCp(
+            species.data(), levels.data(), atkIvs.data(), defIvs.data(), staIvs.data(), NumIvCombinations,
+            result.data());
+        std::copy(result.begin(), result.end(), cp.begin() + level * NumIvCombinations);
+
+        // IvIndex [0, 16) has atk and def IVs 0 and sta IVs [0, 15], so the stats are computed using sta IVs for all.
+        ComputeStats(
+            species.data(), levels.data(), staIvs.data(), staIvs.data(), staIvs.data(), NumIvValues,
+            atkResult.data(), defResult.data(), staResult.data());
+        std::copy(atkResult.begin(), atkResult.end(), atk.begin() + level * NumIvValues);
+        std::copy(defResult.begin(), defResult.end(), def.begin() + level * NumIvValues);
+        std::copy(staResult.begin(), staResult.end(), sta.begin() + level * NumIvValues);
+    }
+}
+
+const IvSpace& IvSpaceFor(SpecieIndex idx)
+{
+    static BaseStatsCache<IvSpace> cache;
+    return cache.Get(idx, [](SpecieIndex i) { return std::make_unique<const IvSpace>(i); });
+}
+
+void PrecomputeIvSpaces(const SpecieIndex* species, size_t count, unsigned numThreads)
+{
+    ParallelFor(count, numThreads, [species](size_t i) { IvSpaceFor(species[i]); });
+}
+
+} // ~namespace PoGoCmp
@@ -0,0 +1,66 @@
+/**
+    @file IvSpace.h
+    @brief Precomputed CP and stats of a Pokémon specie for every IV combination at every half level. */
+#pragma once
+
+#include "PoGoCmp.h"
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace PoGoCmp
+{
+
+//! Number of possible IV values per stat, [0,15].
+const size_t NumIvValues = 16;
+//! Number of IV combinations.
+const size_t NumIvCombinations = NumIvValues * NumIvValues * NumIvValues;
+
+//! Packed IV combination, atk << 8 | def << 4 | sta, i.e. [0, NumIvCombinations).
+using IvIndex = uint16_t;
+
+//! @param atk, def, sta [0, 15], undefined behavior otherwise.
+inline IvIndex ToIvIndex(int atk, int def, int sta) { return IvIndex(atk << 8 | def << 4 | sta); }
+inline int AtkIv(IvIndex iv) { return iv >> 8; }
+inline int DefIv(IvIndex iv) { return (iv >> 4) & 0xF; }
+inline int StaIv(IvIndex iv) { return iv & 0xF; }
+
+//! The whole IV space of a specie: CP for all IV combinations, and stats for all IV values, at every half level.
+//! The CP table consists of one 16x16x16 block per level, indexed by IvIndex, so that all IV combinations
+//! of a level are contiguous in memory. The stat tables are indexed by level and the IV of the stat in question.
+class IvSpace
+{
+public:
+    //! Computes the tables using the batch functions, bit-exactly same results as with ComputeCp() and ComputeStat().
+    //! @param idx [0, NumSpecies()), undefined behavior otherwise.
+    explicit IvSpace(SpecieIndex idx);
+
+    int Cp(LevelIndex level, IvIndex iv) const { return cp[(size_t)level * NumIvCombinations + iv]; }
+    int Atk(LevelIndex level, int atkIv) const { return atk[(size_t)level * NumIvValues + atkIv]; }
+    int Def(LevelIndex level, int defIv) const { return def[(size_t)level * NumIvValues + defIv]; }
+    //! Stamina, i.e. HP.
+    int Sta(LevelIndex level, int staIv) const { return sta[(size_t)level * NumIvValues + staIv]; }
+
+    //! @return NumIvCombinations CP values of the level, indexed by IvIndex.
+    const uint16_t* CpTable(LevelIndex level) const { return &cp[(size_t)level * NumIvCombinations]; }
+
+    //! @return The number of levels in the tables, i.e. valid LevelIndex range is [0, NumLevels()).
+    static size_t NumLevels();
+
+private:
+    std::vector<uint16_t> cp;
+    std::vector<uint16_t> atk, def, sta;
+};
+
+//! @return Cached IvSpace of the specie, computed on the first call. Species/forms with identical base stats
+//! share the same IvSpace. Thread-safe, the returned reference stays valid for the lifetime of the program.
+//! @param idx [0, NumSpecies()), undefined behavior otherwise.
+const IvSpace& IvSpaceFor(SpecieIndex idx);
+
+//! Computes and caches the IvSpaces of the given species in parallel.
+//! @param numThreads 0 for std::thread::hardware_concurrency().
+//! @note Each IvSpace takes roughly 650 kB, all species together take a few hundred MB.
+void PrecomputeIvSpaces(const SpecieIndex* species, size_t count, unsigned numThreads = 0);
+
+} // ~namespace PoGoCmp
@@ -0,0 +1,48 @@
+/**
+    @file NameHash.h
+    @brief Hashing of Pokémon IDs and names, shared by PoGoDbGen and the perfect hash table it generates. */
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string_view>
+
+namespace PoGoCmp
+{
+
+//! Folds a character of an ID or a name so that e.g. "Rattata Alola" and "RATTATA_ALOLA" are the same:
+//! ASCII letters are upper-cased and spaces and hyphens replaced with underscores, other bytes are kept as is.
+constexpr char FoldNameChar(char c)
+{
+    if (c >= 'a' && c <= 'z') return char(c - 'a' + 'A');
+    if (c == ' ' || c == '-') return '_';
+    return c;
+}
+
+//! 32-bit FNV-1a of the case-folded name, finalized with the MurmurHash3 mixer for better seed independence.
+constexpr uint32_t NameHash(std::string_view name, uint32_t seed)
+{
+    uint32_t h = 2166136261u ^ seed;
+    for (char c : name)
+    {
+        h ^= (uint8_t)FoldNameChar(c);
+        h *= 16777619u;
+    }
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h;
+}
+
+//! @return Whether the names are equal when case-folded, see FoldNameChar().
+constexpr bool NameEquals(std::string_view a, std::string_view b)
+{
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); ++i)
+        if (FoldNameChar(a[i]) != FoldNameChar(b[i])) return false;
+    return true;
+}
+
+} // ~namespace PoGoCmp
@@ -0,0 +1,40 @@
+/**
+    @file Parallel.h
+    @brief Minimal helpers for running work on multiple threads. */
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace PoGoCmp
+{
+
+//! Calls func(i) for i in [0, count) using numThreads threads, the calling thread included.
+//! The items are handed out one by one so the work is balanced even if the items differ in cost.
+//! @param numThreads 0 for std::thread::hardware_concurrency().
+template <typename Func>
+void ParallelFor(size_t count, unsigned numThreads, Func&& func)
+{
+    if (numThreads == 0)
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    numThreads = (unsigned)std::min<size_t>(numThreads, count);
+
+    std::atomic<size_t> next{ 0 };
+    auto worker = [&]
+    {
+        for (size_t i = next++; i < count; i = next++)
+            func(i);
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned i = 1; i < numThreads; ++i)
+        threads.emplace_back(worker);
+    worker();
+    for (auto& t : threads)
+        t.join();
+}
+
+} // ~namespace PoGoCmp
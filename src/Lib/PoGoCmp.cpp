@@ -4,34 +4,96 @@
 #include "PoGoCmp.h"
 #include "PoGoDb.h"
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 namespace PoGoCmp
 {
 
 const char* VersionString() { return "0.0.1"; }
 
+size_t NumSpecies()
+{
+    return PoGoCmp::PokemonByNumber.size();
+}
+
+const PokemonSpecie& SpecieByIndex(SpecieIndex idx)
+{
+    return PoGoCmp::PokemonByNumber.begin()[idx].second;
+}
+
+SpecieIndex SpecieIndexOf(const PokemonSpecie& base)
+{
+    // The ID is unique so the forms of the number are enough, unless the number is not set.
+    const auto forms = SpeciesByNumber(base.number);
+    for (size_t i = forms.first; i < forms.last; ++i)
+        if (SpecieByIndex((SpecieIndex)i).id == base.id)
+            return (SpecieIndex)i;
+    auto it = std::find_if(PoGoCmp::PokemonByNumber.begin(), PoGoCmp::PokemonByNumber.end(),
+        [&base](const auto& kvp) { return kvp.second.id == base.id; });
+    return (SpecieIndex)(it - PoGoCmp::PokemonByNumber.begin());
+}
+
+SpecieIndex SpecieIndexByName(std::string_view name)
+{
+    return (SpecieIndex)PoGoCmp::PokemonIndexByName(name);
+}
+
+SpecieRange AllSpecies()
+{
+    return { 0, (SpecieIndex)NumSpecies() };
+}
+
+SpecieRange SpeciesByNumber(uint16_t number)
+{
+    return SpeciesByNumber(number, number);
+}
+
+SpecieRange SpeciesByNumber(uint16_t first, uint16_t last)
+{
+    const auto& offsets = PoGoCmp::PokemonColumns.numberOffset;
+    const size_t maxNumber = offsets.size() - 2;
+    if (first > last || first > maxNumber) return { 0, 0 };
+    return { offsets[first], offsets[std::min<size_t>(last, maxNumber) + 1] };
+}
+
+LevelIndex LevelToIndex(float level)
+{
+    // Exact for all valid levels.
+    const auto idx = (level - 1.f) * 2.f;
+    if (!(idx >= 0.f && idx < (float)PoGoCmp::HalfLevelCpMultiplier.size())) return LevelIndex::Invalid;
+    if (idx != std::floor(idx)) return LevelIndex::Invalid;
+    return static_cast<LevelIndex>(idx);
+}
+
+float IndexToLevel(LevelIndex level)
+{
+    if ((size_t)level >= PoGoCmp::HalfLevelCpMultiplier.size()) return NAN;
+    return 1.f + (float)level / 2.f;
+}
+
 float GetCpm(float level)
 {
-    const auto numLevels = (float)PoGoCmp::PlayerLevel.cpMultiplier.size();
-    if (level  < 1 || level > numLevels) return NAN;
-    float levelIdx;
-    auto levelFact = std::modf(level, &levelIdx);
-    if (levelFact != 0.f && levelFact != 0.5f) return NAN;
-    levelIdx -= 1;
-    auto nextLevelIdx = std::min(levelIdx + 1, numLevels - 1);
-    auto cpmBase = PoGoCmp::PlayerLevel.cpMultiplier[(size_t)levelIdx];
-    auto cpmNext = PoGoCmp::PlayerLevel.cpMultiplier[(size_t)nextLevelIdx];
-    auto cpmStep = (std::pow(cpmNext, 2) - std::pow(cpmBase, 2)) / 2.f;
-    auto cpm = levelFact != 0.f ? std::sqrt(std::pow(cpmBase, 2) + cpmStep) : cpmBase;
-    return cpm;
+    return GetCpm(LevelToIndex(level));
+}
+
+float GetCpm(LevelIndex level)
+{
+    if ((size_t)level >= PoGoCmp::HalfLevelCpMultiplier.size()) return NAN;
+    return PoGoCmp::HalfLevelCpMultiplier[(size_t)level];
 }
 
 int ComputeCp(float level, float atk, float def, float sta)
 {
-    auto cpm = GetCpm(level);
-    if (std::isnan(cpm)) return -1;
-    return static_cast<int>(std::floor(atk * std::pow(def, 0.5f) * std::pow(sta, 0.5f) * std::pow(cpm, 2) / 10.f));
+    return ComputeCp(LevelToIndex(level), atk, def, sta);
+}
+
+int ComputeCp(LevelIndex level, float atk, float def, float sta)
+{
+    if ((size_t)level >= PoGoCmp::HalfLevelCpMultiplierSquared.size()) return -1;
+    const auto cpmSquared = PoGoCmp::HalfLevelCpMultiplierSquared[(size_t)level];
+    return static_cast<int>(std::floor(atk * std::pow(def, 0.5f) * std::pow(sta, 0.5f) * cpmSquared / 10.f));
 }
 
 int ComputeCp(const PoGoCmp::PokemonSpecie& base, float level, float atk, float def, float sta)
@@ -39,6 +101,8 @@ int ComputeCp(const PoGoCmp::PokemonSpecie& base, float level, float atk, float
     if (atk < 0 || atk > 15) return -1;
     if (def < 0 || def > 15) return -1;
     if (sta < 0 || sta > 15) return -1;
+    if (std::floor(atk) == atk && std::floor(def) == def && std::floor(sta) == sta)
+        return ComputeCp(base, LevelToIndex(level), (int)atk, (int)def, (int)sta);
     atk = base.baseAtk + atk;
     def = base.baseDef + def;
     sta = base.baseSta + sta;
@@ -50,27 +114,46 @@ int ComputeCp(const PoGoCmp::PokemonSpecie& base, const PoGoCmp::Pokemon& pkm)
     return ComputeCp(base, pkm.level, pkm.atk, pkm.def, pkm.sta);
 }
 
+int ComputeCp(const PoGoCmp::PokemonSpecie& base, LevelIndex level, int atk, int def, int sta)
+{
+    if (atk < 0 || atk > 15) return -1;
+    if (def < 0 || def > 15) return -1;
+    if (sta < 0 || sta > 15) return -1;
+    return ComputeCpInteger(level, base.baseAtk + atk, base.baseDef + def, base.baseSta + sta);
+}
+
 int ComputeStat(int base, int iv, float level)
 {
-    return int(float(base + iv) * GetCpm(level));
+    return ComputeStat(base, iv, LevelToIndex(level));
+}
+
+int ComputeStat(int base, int iv, LevelIndex level)
+{
+    if ((size_t)level >= PoGoCmp::HalfLevelCpMultiplier.size()) return -1;
+    return int(float(base + iv) * PoGoCmp::HalfLevelCpMultiplier[(size_t)level]);
 }
 
 int ComputeRaidBossCp(const PoGoCmp::PokemonSpecie& base, const PoGoCmp::Pokemon& pkm)
 {
-    auto atk = base.baseAtk + pkm.atk;
-    auto def = base.baseDef + pkm.def;
+    return ComputeRaidBossCp(base.baseAtk, base.baseDef, pkm);
+}
+
+int ComputeRaidBossCp(int baseAtk, int baseDef, const PoGoCmp::Pokemon& pkm)
+{
+    auto atk = baseAtk + pkm.atk;
+    auto def = baseDef + pkm.def;
     auto sta = pkm.sta; // raid bosses have a fixed stamina and base stamina is ignored
     return (int)std::floor(atk * std::sqrt(def) * std::sqrt(sta) / 10.f);
 }
 
 int MinCp(const PoGoCmp::PokemonSpecie& base)
 {
-    return ComputeCp(base, 1, 0, 0, 0);
+    return base.minCp;
 }
 
 int MaxCp(const PoGoCmp::PokemonSpecie& base)
 {
-    return ComputeCp(base, (float)PoGoCmp::PlayerLevel.cpMultiplier.size(), 15, 15, 15);
+    return base.maxCp;
 }
 
 }
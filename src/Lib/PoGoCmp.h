@@ -5,6 +5,11 @@
 
 #include "PoGoCmpApi.h"
 
+#include <cstdint>
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
 namespace PoGoCmp
 {
 
@@ -13,7 +18,73 @@ struct Pokemon;
 
 const char* VersionString();
 
+//! Index of a Pokémon specie/form in PokemonByNumber's iteration order.
+using SpecieIndex = uint16_t;
+
+//! @return The number of species/forms, i.e. PokemonByNumber.size().
+size_t NumSpecies();
+//! Random access to PokemonByNumber.
+//! @param idx [0, NumSpecies()), undefined behavior otherwise.
+const PokemonSpecie& SpecieByIndex(SpecieIndex idx);
+//! @return Index of the specie/form with the same ID, NumSpecies() if not found.
+SpecieIndex SpecieIndexOf(const PokemonSpecie& base);
+//! @param name ID, name or alias of a specie/form, see PokemonIndexByName().
+//! @return Index of the specie/form, NumSpecies() if not found. O(1), no allocations.
+SpecieIndex SpecieIndexByName(std::string_view name);
+
+//! Contiguous range of species/forms, [first, last), e.g. all forms of a Pokédex number.
+//! PokemonColumns holds the commonly used columns of the rows in the range.
+struct SpecieRange
+{
+    SpecieIndex first;
+    SpecieIndex last;
+
+    bool Empty() const { return first >= last; }
+    size_t Size() const { return Empty() ? 0 : size_t(last - first); }
+};
+
+//! @return All species/forms, i.e. [0, NumSpecies()).
+SpecieRange AllSpecies();
+//! @return The forms of the Pokédex number in O(1), an empty range if there are none.
+SpecieRange SpeciesByNumber(uint16_t number);
+//! @return The forms of the Pokédex numbers [first, last] in O(1), an empty range if there are none.
+SpecieRange SpeciesByNumber(uint16_t first, uint16_t last);
+
+//! @return Indices of the species/forms in the range for which pred(SpecieIndex) returns true, in order.
+//! The predicate is meant to read PokemonColumns so that the scan stays within a few contiguous arrays.
+template <typename Predicate>
+std::vector<SpecieIndex> FilterSpecies(SpecieRange range, Predicate pred)
+{
+    std::vector<SpecieIndex> result;
+    result.reserve(range.Size());
+    for (size_t i = range.first; i < range.last; ++i)
+        if (pred((SpecieIndex)i))
+            result.push_back((SpecieIndex)i);
+    return result;
+}
+
+//! Removes the species/forms for which pred(SpecieIndex) returns false, preserving the order.
+template <typename Predicate>
+void FilterSpecies(std::vector<SpecieIndex>& species, Predicate pred)
+{
+    size_t numKept = 0;
+    for (auto idx : species)
+        if (pred(idx))
+            species[numKept++] = idx;
+    species.resize(numKept);
+}
+
+//! Index to the half-level tables, e.g. HalfLevelCpMultiplier: level 1 is 0, level 1.5 is 1, level 2 is 2, and so on.
+enum class LevelIndex : uint8_t { Invalid = 0xFF };
+
+//! @return LevelIndex::Invalid if the level is not within [1,maxLevel] or not a multiple of 0.5.
+LevelIndex LevelToIndex(float level);
+//! @return NAN for an invalid index.
+float IndexToLevel(LevelIndex level);
+
+//! @return NAN on invalid input.
 float GetCpm(float level);
+float GetCpm(LevelIndex level);
 
 //! @param level [1,maxLevel], 0.5 steps, maxLevel 40 for now.
 //! @param atk baseAtk + atkIv, integer.
@@ -21,23 +92,69 @@ float GetCpm(float level);
 //! @param sta baseSta + staIv, integer.
 //! @note https://pokemongo.gamepress.gg/pokemon-stats-advanced
 int ComputeCp(float level, float atk, float def, float sta);
+//! Same as above but the CPM is only looked up from the precomputed table.
+int ComputeCp(LevelIndex level, float atk, float def, float sta);
+//! Integer-only implementation of the above, emulates the float and double rounding of each step. The results
+//! are the same on every platform and compiler, regardless of the floating-point environment.
+//! @param atk, def, sta Total stats, i.e. base + IV, [0, 1024): the results are verified to be identical to the
+//! above for all the stats of the game (IntegerCpTest). The square roots are emulated as correctly rounded sqrtf(),
+//! which pow(x, 0.5f) of some math libraries isn't for all larger values, e.g. glibc's for 3678.
+int ComputeCpInteger(LevelIndex level, int atk, int def, int sta);
+//! Same as above but with any CP multiplier, e.g. of a Database, instead of looking it up by the level.
+//! @param cpm (0, 1].
+//! @return -1 if the CPM is out of range.
+int ComputeCpInteger(float cpm, int atk, int def, int sta);
 //! @param base Pokémon's base stats.
 //! @param level [1,maxLevel], 0.5 steps, maxLevel 40 for now.
 //! @param atk [0, 15], integer.
 //! @param def [0, 15], integer.
 //! @param sta [0, 15], integer.
 //! @note The game doesn't show CP under 10 but this function returns the actual CP even for values below 10.
+//! Integer IVs are computed with ComputeCpInteger(), see below.
 //! @return < 0 on invalid input, > 0 otherwise
 int ComputeCp(const PokemonSpecie& base, float level, float atk, float def, float sta);
 int ComputeCp(const PokemonSpecie& base, const PoGoCmp::Pokemon& pkm);
+//! The CPM lookup path for ComputeCp(const PokemonSpecie&, float, float, float, float), yields identical results.
+//! Uses ComputeCpInteger() so that the results don't depend on the platform's pow().
+int ComputeCp(const PokemonSpecie& base, LevelIndex level, int atk, int def, int sta);
 
+//! @return < 0 on invalid input.
 int ComputeStat(int base, int iv, float level);
+int ComputeStat(int base, int iv, LevelIndex level);
+
+//! Instruction sets used by the batch functions below.
+enum class InstructionSet : uint8_t { Scalar, Sse41, Avx2 };
+
+//! @return The instruction set used by the batch functions, by default the best one supported by the CPU.
+InstructionSet BatchInstructionSet();
+//! Overrides the instruction set used by the batch functions, e.g. for testing purposes.
+//! @return The instruction set in use: the requested one if supported by the CPU, the best supported one otherwise.
+InstructionSet SetBatchInstructionSet(InstructionSet set);
+
+//! Batch version of ComputeCp(const PokemonSpecie&, LevelIndex, int, int, int), i.e.
+//! cp[i] = ComputeCp(SpecieByIndex(species[i]), levels[i], atk[i], def[i], sta[i]) for i in [0, count).
+//! The results are bit-exactly the same as with the scalar version.
+//! @note Invalid input yields -1 for the element in question.
+void ComputeCp(
+    const SpecieIndex* species, const LevelIndex* levels, const uint8_t* atk, const uint8_t* def, const uint8_t* sta,
+    size_t count, int* cp);
+
+//! Batch version of ComputeStat(int, int, LevelIndex) for all three stats of a Pokémon,
+//! e.g. atkOut[i] = ComputeStat(SpecieByIndex(species[i]).baseAtk, atk[i], levels[i]) for i in [0, count).
+//! @note Invalid input yields -1 for the element in question.
+void ComputeStats(
+    const SpecieIndex* species, const LevelIndex* levels, const uint8_t* atk, const uint8_t* def, const uint8_t* sta,
+    size_t count, int* atkOut, int* defOut, int* staOut);
 
 //! https://www.reddit.com/r/TheSilphRoad/comments/6wrw6a/raid_boss_cp_explained_if_it_hasnt_been_already/
 //! @note For some reasons raid bosses have have different arbitrary formula without CPM.
 int ComputeRaidBossCp(const PokemonSpecie& base, const PoGoCmp::Pokemon& pkm);
+//! @overload For base stats not from the compiled-in data, e.g. Database::Species().
+int ComputeRaidBossCp(int baseAtk, int baseDef, const PoGoCmp::Pokemon& pkm);
 
+//! @return PokemonSpecie::minCp, precomputed by the database generator.
 int MinCp(const PokemonSpecie& base);
+//! @return PokemonSpecie::maxCp, precomputed by the database generator.
 int MaxCp(const PokemonSpecie& base);
 
 } // ~namespace PoGoCmp
@@ -0,0 +1,3009 @@
+/** @file PoGoDb.cpp
+    @brief Data of PoGoDb.h, generated by PoGoDbGen.
+
+    Input file's timestamp 2019-02-08 03:52:57+0200 */
+#include "PoGoDb.h"
+
+namespace PoGoCmp {
+
+const std::array<std::array<float, 18>, 18> TypeEffectiveness{{
+    { 1, 1, 1, 1, 1, 0.625f, 1, 0.390625f, 0.625f, 1, 1, 1, 1, 1, 1, 1, 1, 1 },
+    { 1.6f, 1, 0.625f, 0.625f, 1, 1.6f, 0.625f, 0.390625f, 1.6f, 1, 1, 1, 1, 0.625f, 1.6f, 1, 1.6f, 0.625f },
+    { 1, 1.6f, 1, 1, 1, 0.625f, 1.6f, 1, 0.625f, 1, 1, 1.6f, 0.625f, 1, 1, 1, 1, 1 },
+    { 1, 1, 1, 0.625f, 0.625f, 0.625f, 1, 0.625f, 0.390625f, 1, 1, 1.6f, 1, 1, 1, 1, 1, 1.6f },
+    { 1, 1, 0.390625f, 1.6f, 1, 1.6f, 0.625f, 1, 1.6f, 1.6f, 1, 0.625f, 1.6f, 1, 1, 1, 1, 1 },
+    { 1, 0.625f, 1.6f, 1, 0.625f, 1, 1.6f, 1, 0.625f, 1.6f, 1, 1, 1, 1, 1.6f, 1, 1, 1 },
+    { 1, 0.625f, 0.625f, 0.625f, 1, 1, 1, 0.625f, 0.625f, 0.625f, 1, 1.6f, 1, 1.6f, 1, 1, 1.6f, 0.625f },
+    { 0.390625f, 1, 1, 1, 1, 1, 1, 1.6f, 1, 1, 1, 1, 1, 1.6f, 1, 1, 0.625f, 1 },
+    { 1, 1, 1, 1, 1, 1.6f, 1, 1, 0.625f, 0.625f, 0.625f, 1, 0.625f, 1, 1.6f, 1, 1, 1.6f },
+    { 1, 1, 1, 1, 1, 0.625f, 1.6f, 1, 1.6f, 0.625f, 0.625f, 1.6f, 1, 1, 1.6f, 0.625f, 1, 1 },
+    { 1, 1, 1, 1, 1.6f, 1.6f, 1, 1, 1, 1.6f, 0.625f, 0.625f, 1, 1, 1, 0.625f, 1, 1 },
+    { 1, 1, 0.625f, 0.625f, 1.6f, 1.6f, 0.625f, 1, 0.625f, 0.625f, 1.6f, 0.625f, 1, 1, 1, 0.625f, 1, 1 },
+    { 1, 1, 1.6f, 1, 0.390625f, 1, 1, 1, 1, 1, 1.6f, 0.625f, 0.625f, 1, 1, 0.625f, 1, 1 },
+    { 1, 1.6f, 1, 1.6f, 1, 1, 1, 1, 0.625f, 1, 1, 1, 1, 0.625f, 1, 1, 0.390625f, 1 },
+    { 1, 1, 1.6f, 1, 1.6f, 1, 1, 1, 0.625f, 0.625f, 0.625f, 1.6f, 1, 1, 0.625f, 1.6f, 1, 1 },
+    { 1, 1, 1, 1, 1, 1, 1, 1, 0.625f, 1, 1, 1, 1, 1, 1, 1.6f, 1, 0.390625f },
+    { 1, 0.625f, 1, 1, 1, 1, 1, 1.6f, 1, 1, 1, 1, 1, 1.6f, 1, 1, 0.625f, 0.625f },
+    { 1, 1.6f, 1, 0.625f, 1, 1, 1, 1, 0.625f, 0.625f, 1, 1, 1, 1, 1, 1.6f, 1.6f, 1 }
+}};
+
+const ConstMultimap<uint16_t, PokemonSpecie, 584> PokemonByNumber{{{
+    { 1, {1, 118, 111, 128, "BULBASAUR", PokemonType::GRASS, PokemonType::POISON, {0, 2}, {2, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 12, 1115, 357, 14208} },
+    { 2, {2, 151, 143, 155, "IVYSAUR", PokemonType::GRASS, PokemonType::POISON, {5, 2}, {7, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 19, 1699, 449, 22165} },
+    { 3, {3, 198, 189, 190, "VENUSAUR", PokemonType::GRASS, PokemonType::POISON, {5, 2}, {10, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 33, 2720, 577, 35910} },
+    { 4, {4, 116, 93, 118, "CHARMANDER", PokemonType::FIRE, PokemonType::NONE, {13, 2}, {15, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 10, 980, 327, 10974} },
+    { 5, {5, 158, 126, 151, "CHARMELEON", PokemonType::FIRE, PokemonType::NONE, {18, 2}, {20, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 19, 1653, 435, 19026} },
+    { 6, {6, 223, 173, 186, "CHARIZARD", PokemonType::FIRE, PokemonType::FLYING, {23, 2}, {25, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 35, 2889, 582, 32178} },
+    { 7, {7, 94, 121, 127, "SQUIRTLE", PokemonType::WATER, PokemonType::NONE, {28, 2}, {30, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 10, 946, 342, 15367} },
+    { 8, {8, 126, 155, 153, "WARTORTLE", PokemonType::WATER, PokemonType::NONE, {33, 2}, {35, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 17, 1488, 434, 23715} },
+    { 9, {9, 171, 207, 188, "BLASTOISE", PokemonType::WATER, PokemonType::NONE, {33, 2}, {38, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 29, 2466, 566, 38916} },
+    { 10, {10, 55, 55, 128, "CATERPIE", PokemonType::BUG, PokemonType::NONE, {41, 2}, {43, 1}, PokemonRarity::NORMAL, 1, 50, 50, 4, 437, 238, 7040} },
+    { 11, {11, 45, 80, 137, "METAPOD", PokemonType::BUG, PokemonType::NONE, {41, 2}, {43, 1}, PokemonRarity::NORMAL, 1, 50, 50, 4, 450, 262, 10960} },
+    { 12, {12, 167, 137, 155, "BUTTERFREE", PokemonType::BUG, PokemonType::FLYING, {44, 2}, {46, 3}, PokemonRarity::NORMAL, 1, 50, 50, 21, 1827, 459, 21235} },
+    { 13, {13, 63, 50, 120, "WEEDLE", PokemonType::BUG, PokemonType::POISON, {49, 2}, {43, 1}, PokemonRarity::NORMAL, 1, 50, 50, 4, 456, 233, 6000} },
+    { 14, {14, 46, 75, 128, "KAKUNA", PokemonType::BUG, PokemonType::POISON, {49, 2}, {43, 1}, PokemonRarity::NORMAL, 1, 50, 50, 3, 432, 249, 9600} },
+    { 15, {15, 169, 130, 163, "BEEDRILL", PokemonType::BUG, PokemonType::POISON, {51, 2}, {53, 3}, PokemonRarity::NORMAL, 1, 50, 50, 21, 1846, 462, 21190} },
+    { 16, {16, 85, 73, 120, "PIDGEY", PokemonType::NORMAL, PokemonType::FLYING, {56, 2}, {58, 3}, PokemonRarity::NORMAL, 1, 50, 50, 7, 680, 278, 8760} },
+    { 17, {17, 117, 105, 160, "PIDGEOTTO", PokemonType::NORMAL, PokemonType::FLYING, {61, 2}, {58, 3}, PokemonRarity::NORMAL, 1, 50, 50, 13, 1194, 382, 16800} },
+    { 18, {18, 166, 154, 195, "PIDGEOT", PokemonType::NORMAL, PokemonType::FLYING, {63, 2}, {65, 3}, PokemonRarity::NORMAL, 1, 50, 50, 25, 2129, 515, 30030} },
+    { 19, {19, 103, 70, 102, "RATTATA_NORMAL", PokemonType::NORMAL, PokemonType::NONE, {68, 2}, {70, 3}, PokemonRarity::NORMAL, 1, 50, 50, 7, 734, 275, 7140} },
+    { 19, {19, 103, 70, 102, "RATTATA_ALOLA", PokemonType::DARK, PokemonType::NORMAL, {68, 2}, {73, 3}, PokemonRarity::NORMAL, 1, 50, 50, 7, 734, 275, 7140} },
+    { 20, {20, 161, 139, 146, "RATICATE_NORMAL", PokemonType::NORMAL, PokemonType::NONE, {76, 2}, {78, 3}, PokemonRarity::NORMAL, 1, 50, 50, 20, 1730, 446, 20294} },
+    { 20, {20, 135, 154, 181, "RATICATE_ALOLA", PokemonType::DARK, PokemonType::NORMAL, {76, 2}, {81, 3}, PokemonRarity::NORMAL, 1, 50, 50, 19, 1705, 470, 27874} },
+    { 21, {21, 112, 60, 120, "SPEAROW", PokemonType::NORMAL, PokemonType::FLYING, {84, 2}, {86, 3}, PokemonRarity::NORMAL, 1, 50, 50, 8, 798, 292, 7200} },
+    { 22, {22, 182, 133, 163, "FEAROW", PokemonType::NORMAL, PokemonType::FLYING, {89, 2}, {91, 3}, PokemonRarity::NORMAL, 1, 50, 50, 23, 1997, 478, 21679} },
+    { 23, {23, 110, 97, 111, "EKANS", PokemonType::POISON, PokemonType::NONE, {94, 2}, {96, 3}, PokemonRarity::NORMAL, 3, 50, 50, 10, 927, 318, 10767} },
+    { 24, {24, 167, 153, 155, "ARBOK", PokemonType::POISON, PokemonType::NONE, {99, 3}, {102, 3}, PokemonRarity::NORMAL, 3, 50, 50, 22, 1921, 475, 23715} },
+    { 25, {25, 112, 96, 111, "PIKACHU", PokemonType::ELECTRIC, PokemonType::NONE, {105, 2}, {107, 3}, PokemonRarity::NORMAL, 1, 50, 50, 10, 938, 319, 10656} },
+    { 26, {26, 193, 151, 155, "RAICHU_NORMAL", PokemonType::ELECTRIC, PokemonType::NONE, {110, 2}, {112, 3}, PokemonRarity::NORMAL, 1, 50, 50, 26, 2182, 499, 23405} },
+    { 26, {26, 201, 154, 155, "RAICHU_ALOLA", PokemonType::ELECTRIC, PokemonType::PSYCHIC, {110, 2}, {115, 3}, PokemonRarity::NORMAL, 1, 50, 50, 27, 2286, 510, 23870} },
+    { 27, {27, 126, 120, 137, "SANDSHREW_NORMAL", PokemonType::GROUND, PokemonType::NONE, {118, 2}, {120, 3}, PokemonRarity::NORMAL, 3, 50, 50, 14, 1261, 383, 16440} },
+    { 27, {27, 125, 129, 137, "SANDSHREW_ALOLA", PokemonType::ICE, PokemonType::STEEL, {123, 2}, {125, 3}, PokemonRarity::NORMAL, 3, 50, 50, 14, 1293, 391, 17673} },
+    { 28, {28, 182, 175, 181, "SANDSLASH_NORMAL", PokemonType::GROUND, PokemonType::NONE, {128, 2}, {130, 3}, PokemonRarity::NORMAL, 3, 50, 50, 28, 2374, 538, 31675} },
+    { 28, {28, 177, 195, 181, "SANDSLASH_ALOLA", PokemonType::ICE, PokemonType::STEEL, {123, 2}, {133, 3}, PokemonRarity::NORMAL, 3, 50, 50, 29, 2432, 553, 35295} },
+    { 29, {29, 86, 89, 146, "NIDORAN_FEMALE", PokemonType::POISON, PokemonType::NONE, {136, 2}, {138, 3}, PokemonRarity::NORMAL, 3, 5000, 100, 8, 816, 321, 12994} },
+    { 30, {30, 117, 120, 172, "NIDORINA", PokemonType::POISON, PokemonType::NONE, {136, 2}, {141, 3}, PokemonRarity::NORMAL, 3, 0, 100, 14, 1309, 409, 20640} },
+    { 31, {31, 180, 173, 207, "NIDOQUEEN", PokemonType::POISON, PokemonType::GROUND, {144, 2}, {146, 3}, PokemonRarity::NORMAL, 3, 0, 100, 30, 2488, 560, 35811} },
+    { 32, {32, 105, 76, 130, "NIDORAN_MALE", PokemonType::POISON, PokemonType::NONE, {149, 2}, {151, 3}, PokemonRarity::NORMAL, 3, 100, 0, 9, 860, 311, 9880} },
+    { 33, {33, 137, 111, 156, "NIDORINO", PokemonType::POISON, PokemonType::NONE, {154, 2}, {156, 3}, PokemonRarity::NORMAL, 3, 100, 0, 15, 1393, 404, 17316} },
+    { 34, {34, 204, 156, 191, "NIDOKING", PokemonType::POISON, PokemonType::GROUND, {159, 2}, {161, 3}, PokemonRarity::NORMAL, 3, 100, 0, 31, 2567, 551, 29796} },
+    { 35, {35, 107, 108, 172, "CLEFAIRY", PokemonType::FAIRY, PokemonType::NONE, {164, 2}, {166, 3}, PokemonRarity::NORMAL, 1, 25, 75, 12, 1155, 387, 18576} },
+    { 36, {36, 178, 162, 216, "CLEFABLE", PokemonType::FAIRY, PokemonType::NONE, {169, 2}, {171, 4}, PokemonRarity::NORMAL, 1, 25, 75, 29, 2437, 556, 34992} },
+    { 37, {37, 96, 109, 116, "VULPIX_NORMAL", PokemonType::FIRE, PokemonType::NONE, {175, 2}, {177, 3}, PokemonRarity::NORMAL, 3, 25, 75, 9, 883, 321, 12644} },
+    { 37, {37, 96, 109, 116, "VULPIX_ALOLA", PokemonType::ICE, PokemonType::NONE, {180, 2}, {182, 3}, PokemonRarity::NORMAL, 3, 25, 75, 9, 883, 321, 12644} },
+    { 38, {38, 169, 190, 177, "NINETALES_NORMAL", PokemonType::FIRE, PokemonType::NONE, {185, 2}, {187, 4}, PokemonRarity::NORMAL, 3, 25, 75, 27, 2279, 536, 33630} },
+    { 38, {38, 170, 193, 177, "NINETALES_ALOLA", PokemonType::ICE, PokemonType::FAIRY, {191, 2}, {193, 4}, PokemonRarity::NORMAL, 3, 25, 75, 27, 2309, 540, 34161} },
+    { 39, {39, 80, 41, 251, "JIGGLYPUFF", PokemonType::NORMAL, PokemonType::FAIRY, {197, 2}, {199, 3}, PokemonRarity::NORMAL, 1, 25, 75, 7, 724, 372, 10291} },
+    { 40, {40, 156, 90, 295, "WIGGLYTUFF", PokemonType::NORMAL, PokemonType::FAIRY, {197, 2}, {202, 4}, PokemonRarity::NORMAL, 1, 25, 75, 22, 1926, 541, 26550} },
+    { 41, {41, 83, 73, 120, "ZUBAT", PokemonType::POISON, PokemonType::FLYING, {206, 2}, {208, 3}, PokemonRarity::NORMAL, 1, 50, 50, 6, 667, 276, 8760} },
+    { 42, {42, 161, 150, 181, "GOLBAT", PokemonType::POISON, PokemonType::FLYING, {211, 2}, {213, 3}, PokemonRarity::NORMAL, 1, 50, 50, 23, 1976, 492, 27150} },
+    { 43, {43, 131, 112, 128, "ODDISH", PokemonType::GRASS, PokemonType::POISON, {216, 2}, {218, 3}, PokemonRarity::NORMAL, 3, 50, 50, 13, 1228, 371, 14336} },
+    { 44, {44, 153, 136, 155, "GLOOM", PokemonType::GRASS, PokemonType::POISON, {216, 2}, {221, 3}, PokemonRarity::NORMAL, 3, 50, 50, 19, 1681, 444, 21080} },
+    { 45, {45, 202, 167, 181, "VILEPLUME", PokemonType::GRASS, PokemonType::POISON, {216, 2}, {224, 3}, PokemonRarity::NORMAL, 3, 50, 50, 31, 2559, 550, 30227} },
+    { 46, {46, 121, 99, 111, "PARAS", PokemonType::BUG, PokemonType::GRASS, {227, 2}, {229, 3}, PokemonRarity::NORMAL, 3, 50, 50, 11, 1018, 331, 10989} },
+    { 47, {47, 165, 146, 155, "PARASECT", PokemonType::BUG, PokemonType::GRASS, {232, 2}, {234, 3}, PokemonRarity::NORMAL, 3, 50, 50, 21, 1859, 466, 22630} },
+    { 48, {48, 100, 100, 155, "VENONAT", PokemonType::BUG, PokemonType::POISON, {237, 2}, {239, 3}, PokemonRarity::NORMAL, 3, 50, 50, 11, 1004, 355, 15500} },
+    { 49, {49, 179, 143, 172, "VENOMOTH", PokemonType::BUG, PokemonType::POISON, {242, 2}, {244, 3}, PokemonRarity::NORMAL, 3, 50, 50, 24, 2082, 494, 24596} },
+    { 50, {50, 109, 78, 67, "DIGLETT_NORMAL", PokemonType::GROUND, PokemonType::NONE, {247, 2}, {249, 3}, PokemonRarity::NORMAL, 3, 50, 50, 6, 676, 254, 5226} },
+    { 50, {50, 108, 81, 67, "DIGLETT_ALOLA", PokemonType::GROUND, PokemonType::STEEL, {252, 2}, {249, 3}, PokemonRarity::NORMAL, 3, 50, 50, 7, 681, 256, 5427} },
+    { 51, {51, 167, 136, 111, "DUGTRIO_NORMAL", PokemonType::GROUND, PokemonType::NONE, {254, 2}, {256, 3}, PokemonRarity::NORMAL, 3, 50, 50, 18, 1567, 414, 15096} },
+    { 51, {51, 201, 142, 111, "DUGTRIO_ALOLA", PokemonType::GROUND, PokemonType::STEEL, {259, 2}, {261, 3}, PokemonRarity::NORMAL, 3, 50, 50, 22, 1897, 454, 15762} },
+    { 52, {52, 92, 78, 120, "MEOWTH_NORMAL", PokemonType::NORMAL, PokemonType::NONE, {264, 2}, {266, 3}, PokemonRarity::NORMAL, 3, 50, 50, 7, 748, 290, 9360} },
+    { 52, {52, 99, 78, 120, "MEOWTH_ALOLA", PokemonType::DARK, PokemonType::NONE, {264, 2}, {266, 3}, PokemonRarity::NORMAL, 3, 50, 50, 8, 797, 297, 9360} },
+    { 53, {53, 150, 136, 163, "PERSIAN_NORMAL", PokemonType::NORMAL, PokemonType::NONE, {269, 2}, {271, 3}, PokemonRarity::NORMAL, 3, 50, 50, 19, 1689, 449, 22168} },
+    { 53, {53, 158, 136, 163, "PERSIAN_ALOLA", PokemonType::DARK, PokemonType::NONE, {269, 2}, {274, 3}, PokemonRarity::NORMAL, 3, 50, 50, 20, 1771, 457, 22168} },
+    { 54, {54, 122, 95, 137, "PSYDUCK", PokemonType::WATER, PokemonType::NONE, {277, 2}, {279, 3}, PokemonRarity::NORMAL, 3, 50, 50, 12, 1106, 354, 13015} },
+    { 55, {55, 191, 162, 190, "GOLDUCK", PokemonType::WATER, PokemonType::NONE, {282, 2}, {284, 3}, PokemonRarity::NORMAL, 3, 50, 50, 29, 2450, 543, 30780} },
+    { 56, {56, 148, 82, 120, "MANKEY", PokemonType::FIGHTING, PokemonType::NONE, {287, 2}, {289, 3}, PokemonRarity::NORMAL, 3, 50, 50, 12, 1164, 350, 9840} },
+    { 57, {57, 207, 138, 163, "PRIMEAPE", PokemonType::FIGHTING, PokemonType::NONE, {292, 2}, {294, 3}, PokemonRarity::NORMAL, 3, 50, 50, 27, 2288, 508, 22494} },
+    { 58, {58, 136, 93, 146, "GROWLITHE", PokemonType::FIRE, PokemonType::NONE, {297, 2}, {299, 3}, PokemonRarity::NORMAL, 3, 75, 25, 14, 1243, 375, 13578} },
+    { 59, {59, 227, 166, 207, "ARCANINE", PokemonType::FIRE, PokemonType::NONE, {302, 2}, {304, 3}, PokemonRarity::NORMAL, 3, 75, 25, 37, 3029, 600, 34362} },
+    { 60, {60, 101, 82, 120, "POLIWAG", PokemonType::WATER, PokemonType::NONE, {307, 2}, {309, 3}, PokemonRarity::NORMAL, 3, 50, 50, 8, 829, 303, 9840} },
+    { 61, {61, 130, 123, 163, "POLIWHIRL", PokemonType::WATER, PokemonType::NONE, {307, 2}, {312, 3}, PokemonRarity::NORMAL, 3, 50, 50, 16, 1419, 416, 20049} },
+    { 62, {62, 182, 184, 207, "POLIWRATH", PokemonType::WATER, PokemonType::FIGHTING, {315, 2}, {317, 3}, PokemonRarity::NORMAL, 3, 50, 50, 31, 2586, 573, 38088} },
+    { 63, {63, 195, 82, 93, "ABRA", PokemonType::PSYCHIC, PokemonType::NONE, {320, 2}, {322, 3}, PokemonRarity::NORMAL, 3, 75, 25, 15, 1342, 370, 7626} },
+    { 64, {64, 232, 117, 120, "KADABRA", PokemonType::PSYCHIC, PokemonType::NONE, {325, 2}, {327, 3}, PokemonRarity::NORMAL, 3, 75, 25, 24, 2059, 469, 14040} },
+    { 65, {65, 271, 167, 146, "ALAKAZAM", PokemonType::PSYCHIC, PokemonType::NONE, {325, 2}, {330, 4}, PokemonRarity::NORMAL, 3, 75, 25, 37, 3057, 584, 24382} },
+    { 66, {66, 137, 82, 172, "MACHOP", PokemonType::FIGHTING, PokemonType::NONE, {334, 2}, {336, 3}, PokemonRarity::NORMAL, 3, 75, 25, 14, 1278, 391, 14104} },
+    { 67, {67, 177, 125, 190, "MACHOKE", PokemonType::FIGHTING, PokemonType::NONE, {339, 2}, {341, 3}, PokemonRarity::NORMAL, 3, 75, 25, 24, 2031, 492, 23750} },
+    { 68, {68, 234, 159, 207, "MACHAMP", PokemonType::FIGHTING, PokemonType::NONE, {344, 2}, {346, 4}, PokemonRarity::NORMAL, 3, 75, 25, 37, 3056, 600, 32913} },
+    { 69, {69, 139, 61, 137, "BELLSPROUT", PokemonType::GRASS, PokemonType::POISON, {350, 2}, {352, 3}, PokemonRarity::NORMAL, 3, 50, 50, 11, 1033, 337, 8357} },
+    { 70, {70, 172, 92, 163, "WEEPINBELL", PokemonType::GRASS, PokemonType::POISON, {355, 2}, {357, 3}, PokemonRarity::NORMAL, 3, 50, 50, 18, 1611, 427, 14996} },
+    { 71, {71, 207, 135, 190, "VICTREEBEL", PokemonType::GRASS, PokemonType::POISON, {216, 2}, {360, 3}, PokemonRarity::NORMAL, 3, 50, 50, 29, 2431, 532, 25650} },
+    { 72, {72, 97, 149, 120, "TENTACOOL", PokemonType::WATER, PokemonType::POISON, {363, 2}, {365, 3}, PokemonRarity::NORMAL, 3, 50, 50, 11, 1040, 366, 17880} },
+    { 73, {73, 166, 209, 190, "TENTACRUEL", PokemonType::WATER, PokemonType::POISON, {368, 2}, {370, 3}, PokemonRarity::NORMAL, 3, 50, 50, 29, 2422, 565, 39710} },
+    { 74, {74, 132, 132, 120, "GEODUDE_NORMAL", PokemonType::ROCK, PokemonType::GROUND, {373, 2}, {375, 3}, PokemonRarity::NORMAL, 1, 50, 50, 14, 1293, 384, 15840} },
+    { 74, {74, 132, 132, 120, "GEODUDE_ALOLA", PokemonType::ROCK, PokemonType::ELECTRIC, {378, 2}, {380, 3}, PokemonRarity::NORMAL, 1, 50, 50, 14, 1293, 384, 15840} },
+    { 75, {75, 164, 164, 146, "GRAVELER_NORMAL", PokemonType::ROCK, PokemonType::GROUND, {383, 2}, {385, 3}, PokemonRarity::NORMAL, 1, 50, 50, 22, 1897, 474, 23944} },
+    { 75, {75, 164, 164, 146, "GRAVELER_ALOLA", PokemonType::ROCK, PokemonType::ELECTRIC, {378, 2}, {388, 3}, PokemonRarity::NORMAL, 1, 50, 50, 22, 1897, 474, 23944} },
+    { 76, {76, 211, 198, 190, "GOLEM_NORMAL", PokemonType::ROCK, PokemonType::GROUND, {383, 2}, {391, 3}, PokemonRarity::NORMAL, 1, 50, 50, 36, 2949, 599, 37620} },
+    { 76, {76, 211, 198, 190, "GOLEM_ALOLA", PokemonType::ROCK, PokemonType::ELECTRIC, {378, 2}, {394, 3}, PokemonRarity::NORMAL, 1, 50, 50, 36, 2949, 599, 37620} },
+    { 77, {77, 170, 127, 137, "PONYTA", PokemonType::FIRE, PokemonType::NONE, {397, 2}, {399, 3}, PokemonRarity::NORMAL, 3, 50, 50, 19, 1697, 434, 17399} },
+    { 78, {78, 207, 162, 163, "RAPIDASH", PokemonType::FIRE, PokemonType::NONE, {402, 2}, {404, 3}, PokemonRarity::NORMAL, 3, 50, 50, 29, 2461, 532, 26406} },
+    { 79, {79, 109, 98, 207, "SLOWPOKE", PokemonType::WATER, PokemonType::PSYCHIC, {282, 2}, {407, 3}, PokemonRarity::NORMAL, 3, 50, 50, 13, 1226, 414, 20286} },
+    { 80, {80, 177, 180, 216, "SLOWBRO", PokemonType::WATER, PokemonType::PSYCHIC, {282, 2}, {410, 3}, PokemonRarity::NORMAL, 3, 50, 50, 30, 2545, 573, 38880} },
+    { 81, {81, 165, 121, 93, "MAGNEMITE", PokemonType::ELECTRIC, PokemonType::STEEL, {413, 2}, {415, 3}, PokemonRarity::NORMAL, 3, 0, 0, 15, 1362, 379, 11253} },
+    { 82, {82, 223, 169, 137, "MAGNETON", PokemonType::ELECTRIC, PokemonType::STEEL, {418, 2}, {420, 3}, PokemonRarity::NORMAL, 3, 0, 0, 29, 2485, 529, 23153} },
+    { 83, {83, 124, 115, 141, "FARFETCHD", PokemonType::NORMAL, PokemonType::FLYING, {423, 2}, {425, 3}, PokemonRarity::NORMAL, 3, 50, 50, 13, 1236, 380, 16215} },
+    { 84, {84, 158, 83, 111, "DODUO", PokemonType::NORMAL, PokemonType::FLYING, {84, 2}, {428, 3}, PokemonRarity::NORMAL, 3, 50, 50, 13, 1200, 352, 9213} },
+    { 85, {85, 218, 140, 155, "DODRIO", PokemonType::NORMAL, PokemonType::FLYING, {431, 2}, {428, 3}, PokemonRarity::NORMAL, 3, 50, 50, 28, 2362, 513, 21700} },
+    { 86, {86, 85, 121, 163, "SEEL", PokemonType::WATER, PokemonType::NONE, {433, 2}, {435, 3}, PokemonRarity::NORMAL, 3, 50, 50, 10, 971, 369, 19723} },
+    { 87, {87, 139, 177, 207, "DEWGONG", PokemonType::WATER, PokemonType::ICE, {438, 2}, {440, 3}, PokemonRarity::NORMAL, 3, 50, 50, 23, 1985, 523, 36639} },
+    { 88, {88, 135, 90, 190, "GRIMER_NORMAL", PokemonType::POISON, PokemonType::NONE, {443, 2}, {445, 3}, PokemonRarity::NORMAL, 3, 50, 50, 15, 1374, 415, 17100} },
+    { 88, {88, 135, 90, 190, "GRIMER_ALOLA", PokemonType::POISON, PokemonType::DARK, {144, 2}, {448, 3}, PokemonRarity::NORMAL, 3, 50, 50, 15, 1374, 415, 17100} },
+    { 89, {89, 190, 172, 233, "MUK_NORMAL", PokemonType::POISON, PokemonType::NONE, {51, 2}, {451, 4}, PokemonRarity::NORMAL, 3, 50, 50, 33, 2757, 595, 40076} },
+    { 89, {89, 190, 172, 233, "MUK_ALOLA", PokemonType::POISON, PokemonType::DARK, {455, 3}, {458, 3}, PokemonRarity::NORMAL, 3, 50, 50, 33, 2757, 595, 40076} },
+    { 90, {90, 116, 134, 102, "SHELLDER", PokemonType::WATER, PokemonType::NONE, {461, 2}, {463, 3}, PokemonRarity::NORMAL, 3, 50, 50, 11, 1080, 352, 13668} },
+    { 91, {91, 186, 256, 137, "CLOYSTER", PokemonType::WATER, PokemonType::ICE, {466, 2}, {468, 3}, PokemonRarity::NORMAL, 3, 50, 50, 30, 2547, 579, 35072} },
+    { 92, {92, 186, 67, 102, "GASTLY", PokemonType::GHOST, PokemonType::POISON, {471, 2}, {473, 3}, PokemonRarity::NORMAL, 3, 50, 50, 13, 1229, 355, 6834} },
+    { 93, {93, 223, 107, 128, "HAUNTER", PokemonType::GHOST, PokemonType::POISON, {476, 2}, {478, 3}, PokemonRarity::NORMAL, 3, 50, 50, 23, 1963, 458, 13696} },
+    { 94, {94, 261, 149, 155, "GENGAR", PokemonType::GHOST, PokemonType::POISON, {481, 2}, {483, 3}, PokemonRarity::NORMAL, 3, 50, 50, 35, 2878, 565, 23095} },
+    { 95, {95, 85, 232, 111, "ONIX", PokemonType::ROCK, PokemonType::GROUND, {373, 2}, {486, 3}, PokemonRarity::NORMAL, 5, 50, 50, 12, 1101, 428, 25752} },
+    { 96, {96, 89, 136, 155, "DROWZEE", PokemonType::PSYCHIC, PokemonType::NONE, {489, 2}, {491, 3}, PokemonRarity::NORMAL, 3, 50, 50, 11, 1040, 380, 21080} },
+    { 97, {97, 144, 193, 198, "HYPNO", PokemonType::PSYCHIC, PokemonType::NONE, {494, 2}, {496, 3}, PokemonRarity::NORMAL, 3, 50, 50, 24, 2090, 535, 38214} },
+    { 98, {98, 181, 124, 102, "KRABBY", PokemonType::WATER, PokemonType::NONE, {307, 2}, {499, 3}, PokemonRarity::NORMAL, 3, 50, 50, 17, 1561, 407, 12648} },
+    { 99, {99, 240, 181, 146, "KINGLER", PokemonType::WATER, PokemonType::NONE, {502, 2}, {504, 3}, PokemonRarity::NORMAL, 3, 50, 50, 34, 2829, 567, 26426} },
+    { 100, {100, 109, 111, 120, "VOLTORB", PokemonType::ELECTRIC, PokemonType::NONE, {507, 2}, {509, 3}, PokemonRarity::NORMAL, 3, 0, 0, 11, 1010, 340, 13320} },
+    { 101, {101, 173, 173, 155, "ELECTRODE", PokemonType::ELECTRIC, PokemonType::NONE, {512, 2}, {514, 3}, PokemonRarity::NORMAL, 3, 0, 0, 25, 2099, 501, 26815} },
+    { 102, {102, 107, 125, 155, "EXEGGCUTE", PokemonType::GRASS, PokemonType::PSYCHIC, {517, 2}, {519, 3}, PokemonRarity::NORMAL, 3, 50, 50, 13, 1175, 387, 19375} },
+    { 103, {103, 233, 149, 216, "EXEGGUTOR_NORMAL", PokemonType::GRASS, PokemonType::PSYCHIC, {522, 2}, {524, 3}, PokemonRarity::NORMAL, 3, 50, 50, 36, 3014, 598, 32184} },
+    { 103, {103, 230, 153, 216, "EXEGGUTOR_ALOLA", PokemonType::GRASS, PokemonType::DRAGON, {527, 2}, {529, 3}, PokemonRarity::NORMAL, 3, 50, 50, 36, 3014, 599, 33048} },
+    { 104, {104, 90, 144, 137, "CUBONE", PokemonType::GROUND, PokemonType::NONE, {532, 2}, {534, 3}, PokemonRarity::NORMAL, 3, 50, 50, 11, 1019, 371, 19728} },
+    { 105, {105, 144, 186, 155, "MAROWAK_NORMAL", PokemonType::GROUND, PokemonType::NONE, {532, 2}, {537, 3}, PokemonRarity::NORMAL, 3, 50, 50, 21, 1835, 485, 28830} },
+    { 105, {105, 144, 186, 155, "MAROWAK_ALOLA", PokemonType::FIRE, PokemonType::GHOST, {540, 2}, {542, 3}, PokemonRarity::NORMAL, 3, 50, 50, 21, 1835, 485, 28830} },
+    { 106, {106, 224, 181, 137, "HITMONLEE", PokemonType::FIGHTING, PokemonType::NONE, {545, 2}, {547, 3}, PokemonRarity::NORMAL, 5, 100, 5000, 31, 2576, 542, 24797} },
+    { 107, {107, 193, 197, 137, "HITMONCHAN", PokemonType::FIGHTING, PokemonType::NONE, {344, 2}, {550, 4}, PokemonRarity::NORMAL, 5, 100, 0, 28, 2332, 527, 26989} },
+    { 108, {108, 108, 137, 207, "LICKITUNG", PokemonType::NORMAL, PokemonType::NONE, {554, 2}, {556, 3}, PokemonRarity::NORMAL, 3, 50, 50, 16, 1411, 452, 28359} },
+    { 109, {109, 119, 141, 120, "KOFFING", PokemonType::POISON, PokemonType::NONE, {559, 2}, {561, 3}, PokemonRarity::NORMAL, 3, 50, 50, 13, 1214, 380, 16920} },
+    { 110, {110, 174, 197, 163, "WEEZING", PokemonType::POISON, PokemonType::NONE, {559, 2}, {564, 4}, PokemonRarity::NORMAL, 3, 50, 50, 27, 2293, 534, 32111} },
+    { 111, {111, 140, 127, 190, "RHYHORN", PokemonType::GROUND, PokemonType::ROCK, {532, 2}, {568, 3}, PokemonRarity::NORMAL, 3, 50, 50, 19, 1651, 457, 24130} },
+    { 112, {112, 222, 171, 233, "RHYDON", PokemonType::GROUND, PokemonType::ROCK, {532, 2}, {571, 3}, PokemonRarity::NORMAL, 3, 50, 50, 39, 3179, 626, 39843} },
+    { 113, {113, 60, 128, 487, "CHANSEY", PokemonType::NORMAL, PokemonType::NONE, {164, 2}, {574, 3}, PokemonRarity::NORMAL, 5, 0, 100, 13, 1255, 675, 62336} },
+    { 114, {114, 183, 169, 163, "TANGELA", PokemonType::GRASS, PokemonType::NONE, {577, 2}, {579, 3}, PokemonRarity::NORMAL, 3, 50, 50, 26, 2238, 515, 27547} },
+    { 115, {115, 181, 165, 233, "KANGASKHAN", PokemonType::NORMAL, PokemonType::NONE, {582, 2}, {584, 3}, PokemonRarity::NORMAL, 3, 0, 100, 31, 2586, 579, 38445} },
+    { 116, {116, 129, 103, 102, "HORSEA", PokemonType::WATER, PokemonType::NONE, {587, 2}, {589, 3}, PokemonRarity::NORMAL, 3, 50, 50, 11, 1056, 334, 10506} },
+    { 117, {117, 187, 156, 146, "SEADRA", PokemonType::WATER, PokemonType::NONE, {592, 2}, {594, 3}, PokemonRarity::NORMAL, 3, 50, 50, 24, 2093, 489, 22776} },
+    { 118, {118, 123, 110, 128, "GOLDEEN", PokemonType::WATER, PokemonType::NONE, {597, 2}, {599, 3}, PokemonRarity::NORMAL, 3, 50, 50, 12, 1152, 361, 14080} },
+    { 119, {119, 175, 147, 190, "SEAKING", PokemonType::WATER, PokemonType::NONE, {602, 2}, {604, 3}, PokemonRarity::NORMAL, 3, 50, 50, 25, 2162, 512, 27930} },
+    { 120, {120, 137, 112, 102, "STARYU", PokemonType::WATER, PokemonType::NONE, {607, 2}, {609, 3}, PokemonRarity::NORMAL, 3, 0, 0, 12, 1157, 351, 11424} },
+    { 121, {121, 210, 184, 155, "STARMIE", PokemonType::WATER, PokemonType::PSYCHIC, {612, 2}, {614, 5}, PokemonRarity::NORMAL, 3, 0, 0, 31, 2584, 549, 28520} },
+    { 122, {122, 192, 205, 120, "MR_MIME", PokemonType::PSYCHIC, PokemonType::FAIRY, {619, 2}, {621, 3}, PokemonRarity::NORMAL, 5, 50, 50, 26, 2228, 517, 24600} },
+    { 123, {123, 218, 170, 172, "SCYTHER", PokemonType::BUG, PokemonType::FLYING, {624, 2}, {626, 3}, PokemonRarity::NORMAL, 5, 50, 50, 32, 2706, 560, 29240} },
+    { 124, {124, 223, 151, 163, "JYNX", PokemonType::ICE, PokemonType::PSYCHIC, {629, 2}, {631, 4}, PokemonRarity::NORMAL, 5, 0, 100, 30, 2555, 537, 24613} },
+    { 125, {125, 198, 158, 163, "ELECTABUZZ", PokemonType::ELECTRIC, PokemonType::NONE, {635, 2}, {637, 3}, PokemonRarity::NORMAL, 5, 75, 25, 28, 2334, 519, 25754} },
+    { 126, {126, 206, 154, 163, "MAGMAR", PokemonType::FIRE, PokemonType::NONE, {640, 2}, {642, 3}, PokemonRarity::NORMAL, 5, 75, 25, 28, 2394, 523, 25102} },
+    { 127, {127, 238, 182, 163, "PINSIR", PokemonType::BUG, PokemonType::NONE, {645, 2}, {647, 3}, PokemonRarity::NORMAL, 5, 50, 50, 36, 2959, 583, 29666} },
+    { 128, {128, 198, 183, 181, "TAUROS", PokemonType::NORMAL, PokemonType::NONE, {650, 2}, {652, 3}, PokemonRarity::NORMAL, 3, 100, 0, 31, 2620, 562, 33123} },
+    { 129, {129, 29, 85, 85, "MAGIKARP", PokemonType::WATER, PokemonType::NONE, {655, 1}, {43, 1}, PokemonRarity::NORMAL, 1, 50, 50, 2, 274, 199, 7225} },
+    { 130, {130, 237, 186, 216, "GYARADOS", PokemonType::WATER, PokemonType::FLYING, {656, 2}, {658, 3}, PokemonRarity::NORMAL, 1, 50, 50, 41, 3391, 639, 40176} },
+    { 131, {131, 165, 174, 277, "LAPRAS", PokemonType::WATER, PokemonType::ICE, {661, 2}, {663, 3}, PokemonRarity::NORMAL, 5, 50, 50, 32, 2641, 616, 48198} },
+    { 132, {132, 91, 91, 134, "DITTO", PokemonType::NORMAL, PokemonType::NONE, {666, 1}, {43, 1}, PokemonRarity::NORMAL, 3, 0, 0, 8, 832, 316, 12194} },
+    { 133, {133, 104, 114, 146, "EEVEE", PokemonType::NORMAL, PokemonType::NONE, {56, 2}, {667, 2}, PokemonRarity::NORMAL, 5, 87.5, 12.5, 11, 1071, 364, 16644} },
+    { 134, {134, 205, 161, 277, "VAPOREON", PokemonType::WATER, PokemonType::NONE, {669, 1}, {670, 3}, PokemonRarity::NORMAL, 5, 87.5, 12.5, 38, 3114, 643, 44597} },
+    { 135, {135, 232, 182, 163, "JOLTEON", PokemonType::ELECTRIC, PokemonType::NONE, {673, 2}, {675, 3}, PokemonRarity::NORMAL, 5, 87.5, 12.5, 35, 2888, 577, 29666} },
+    { 136, {136, 246, 179, 163, "FLAREON", PokemonType::FIRE, PokemonType::NONE, {678, 2}, {680, 3}, PokemonRarity::NORMAL, 5, 87.5, 12.5, 37, 3029, 588, 29177} },
+    { 137, {137, 153, 136, 163, "PORYGON", PokemonType::NORMAL, PokemonType::NONE, {683, 2}, {685, 3}, PokemonRarity::NORMAL, 3, 0, 0, 20, 1720, 452, 22168} },
+    { 138, {138, 155, 153, 111, "OMANYTE", PokemonType::ROCK, PokemonType::WATER, {688, 2}, {690, 3}, PokemonRarity::NORMAL, 5, 87.5, 12.5, 17, 1544, 419, 16983} },
+    { 139, {139, 207, 201, 172, "OMASTAR", PokemonType::ROCK, PokemonType::WATER, {693, 2}, {695, 3}, PokemonRarity::NORMAL, 5, 87.5, 12.5, 34, 2786, 580, 34572} },
+    { 140, {140, 148, 140, 102, "KABUTO", PokemonType::ROCK, PokemonType::WATER, {118, 2}, {698, 3}, PokemonRarity::NORMAL, 5, 87.5, 12.5, 15, 1370, 390, 14280} },
+    { 141, {141, 220, 186, 155, "KABUTOPS", PokemonType::ROCK, PokemonType::WATER, {701, 3}, {704, 3}, PokemonRarity::NORMAL, 5, 87.5, 12.5, 33, 2713, 561, 28830} },
+    { 142, {142, 221, 159, 190, "AERODACTYL", PokemonType::ROCK, PokemonType::FLYING, {707, 2}, {709, 4}, PokemonRarity::NORMAL, 5, 87.5, 12.5, 33, 2783, 570, 30210} },
+    { 143, {143, 190, 169, 330, "SNORLAX", PokemonType::NORMAL, PokemonType::NONE, {713, 2}, {715, 4}, PokemonRarity::NORMAL, 5, 87.5, 12.5, 39, 3225, 689, 55770} },
+    { 144, {144, 192, 236, 207, "ARTICUNO", PokemonType::ICE, PokemonType::FLYING, {719, 1}, {720, 3}, PokemonRarity::LEGENDARY, 20, 0, 0, 37, 3051, 635, 48852} },
+    { 145, {145, 253, 185, 207, "ZAPDOS", PokemonType::ELECTRIC, PokemonType::FLYING, {723, 1}, {724, 3}, PokemonRarity::LEGENDARY, 20, 0, 0, 43, 3527, 645, 38295} },
+    { 146, {146, 251, 181, 207, "MOLTRES", PokemonType::FIRE, PokemonType::FLYING, {727, 1}, {728, 3}, PokemonRarity::LEGENDARY, 20, 0, 0, 42, 3465, 639, 37467} },
+    { 147, {147, 119, 91, 121, "DRATINI", PokemonType::DRAGON, PokemonType::NONE, {731, 2}, {733, 3}, PokemonRarity::NORMAL, 5, 50, 50, 11, 1004, 331, 11011} },
+    { 148, {148, 163, 135, 156, "DRAGONAIR", PokemonType::DRAGON, PokemonType::NONE, {731, 2}, {736, 3}, PokemonRarity::NORMAL, 5, 50, 50, 20, 1780, 454, 21060} },
+    { 149, {149, 263, 198, 209, "DRAGONITE", PokemonType::DRAGON, PokemonType::FLYING, {739, 2}, {741, 3}, PokemonRarity::NORMAL, 5, 50, 50, 47, 3792, 670, 41382} },
+    { 150, {150, 300, 182, 214, "MEWTWO", PokemonType::PSYCHIC, PokemonType::NONE, {325, 2}, {744, 5}, PokemonRarity::LEGENDARY, 20, 0, 0, 52, 4178, 696, 38948} },
+    { 151, {151, 210, 210, 225, "MEW", PokemonType::PSYCHIC, PokemonType::NONE, {749, 14}, {763, 35}, PokemonRarity::MYTHIC, 20, 0, 0, 40, 3265, 645, 47250} },
+    { 152, {152, 92, 122, 128, "CHIKORITA", PokemonType::GRASS, PokemonType::NONE, {0, 2}, {798, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 10, 935, 342, 15616} },
+    { 153, {153, 122, 155, 155, "BAYLEEF", PokemonType::GRASS, PokemonType::NONE, {801, 2}, {803, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 16, 1454, 432, 24025} },
+    { 154, {154, 168, 202, 190, "MEGANIUM", PokemonType::GRASS, PokemonType::NONE, {5, 2}, {806, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 29, 2410, 560, 38380} },
+    { 155, {155, 116, 93, 118, "CYNDAQUIL", PokemonType::FIRE, PokemonType::NONE, {809, 2}, {811, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 10, 980, 327, 10974} },
+    { 156, {156, 158, 126, 151, "QUILAVA", PokemonType::FIRE, PokemonType::NONE, {809, 2}, {814, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 19, 1653, 435, 19026} },
+    { 157, {157, 223, 173, 186, "TYPHLOSION", PokemonType::FIRE, PokemonType::NONE, {817, 2}, {819, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 35, 2889, 582, 32178} },
+    { 158, {158, 117, 109, 137, "TOTODILE", PokemonType::WATER, PokemonType::NONE, {822, 2}, {824, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 12, 1131, 363, 14933} },
+    { 159, {159, 150, 142, 163, "CROCONAW", PokemonType::WATER, PokemonType::NONE, {822, 2}, {827, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 20, 1722, 455, 23146} },
+    { 160, {160, 205, 188, 198, "FERALIGATR", PokemonType::WATER, PokemonType::NONE, {830, 2}, {832, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 34, 2857, 591, 37224} },
+    { 161, {161, 79, 73, 111, "SENTRET", PokemonType::NORMAL, PokemonType::NONE, {835, 2}, {837, 3}, PokemonRarity::NORMAL, 1, 50, 50, 6, 618, 263, 8103} },
+    { 162, {162, 148, 125, 198, "FURRET", PokemonType::NORMAL, PokemonType::NONE, {840, 2}, {842, 3}, PokemonRarity::NORMAL, 1, 50, 50, 20, 1758, 471, 24750} },
+    { 163, {163, 67, 88, 155, "HOOTHOOT", PokemonType::NORMAL, PokemonType::FLYING, {845, 2}, {847, 3}, PokemonRarity::NORMAL, 1, 50, 50, 6, 677, 310, 13640} },
+    { 164, {164, 145, 156, 225, "NOCTOWL", PokemonType::NORMAL, PokemonType::FLYING, {850, 2}, {852, 3}, PokemonRarity::NORMAL, 1, 50, 50, 24, 2024, 526, 35100} },
+    { 165, {165, 72, 118, 120, "LEDYBA", PokemonType::BUG, PokemonType::FLYING, {855, 2}, {857, 3}, PokemonRarity::NORMAL, 1, 50, 50, 7, 728, 310, 14160} },
+    { 166, {166, 107, 179, 146, "LEDIAN", PokemonType::BUG, PokemonType::FLYING, {860, 2}, {862, 3}, PokemonRarity::NORMAL, 1, 50, 50, 15, 1346, 432, 26134} },
+    { 167, {167, 105, 73, 120, "SPINARAK", PokemonType::BUG, PokemonType::POISON, {865, 2}, {867, 3}, PokemonRarity::NORMAL, 1, 50, 50, 8, 816, 298, 8760} },
+    { 168, {168, 161, 124, 172, "ARIADOS", PokemonType::BUG, PokemonType::POISON, {870, 2}, {872, 3}, PokemonRarity::NORMAL, 1, 50, 50, 20, 1772, 457, 21328} },
+    { 169, {169, 194, 178, 198, "CROBAT", PokemonType::POISON, PokemonType::FLYING, {875, 2}, {877, 3}, PokemonRarity::NORMAL, 1, 50, 50, 32, 2646, 570, 35244} },
+    { 170, {170, 106, 97, 181, "CHINCHOU", PokemonType::WATER, PokemonType::ELECTRIC, {880, 2}, {882, 3}, PokemonRarity::NORMAL, 3, 50, 50, 12, 1119, 384, 17557} },
+    { 171, {171, 146, 137, 268, "LANTURN", PokemonType::WATER, PokemonType::ELECTRIC, {885, 2}, {887, 3}, PokemonRarity::NORMAL, 3, 50, 50, 24, 2085, 551, 36716} },
+    { 172, {172, 77, 53, 85, "PICHU", PokemonType::ELECTRIC, PokemonType::NONE, {890, 1}, {891, 3}, PokemonRarity::NORMAL, 1, 50, 50, 4, 473, 215, 4505} },
+    { 173, {173, 75, 79, 137, "CLEFFA", PokemonType::FAIRY, PokemonType::NONE, {164, 2}, {894, 3}, PokemonRarity::NORMAL, 1, 25, 75, 6, 671, 291, 10823} },
+    { 174, {174, 69, 32, 207, "IGGLYBUFF", PokemonType::NORMAL, PokemonType::FAIRY, {197, 2}, {897, 3}, PokemonRarity::NORMAL, 1, 25, 75, 4, 535, 308, 6624} },
+    { 175, {175, 67, 116, 111, "TOGEPI", PokemonType::FAIRY, PokemonType::NONE, {900, 2}, {902, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 6, 657, 294, 12876} },
+    { 176, {176, 139, 181, 146, "TOGETIC", PokemonType::FAIRY, PokemonType::FLYING, {905, 2}, {907, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 19, 1708, 466, 26426} },
+    { 177, {177, 134, 89, 120, "NATU", PokemonType::PSYCHIC, PokemonType::FLYING, {84, 2}, {910, 3}, PokemonRarity::NORMAL, 3, 50, 50, 12, 1102, 343, 10680} },
+    { 178, {178, 192, 146, 163, "XATU", PokemonType::PSYCHIC, PokemonType::FLYING, {913, 2}, {915, 3}, PokemonRarity::NORMAL, 3, 50, 50, 26, 2188, 501, 23798} },
+    { 179, {179, 114, 79, 146, "MAREEP", PokemonType::ELECTRIC, PokemonType::NONE, {918, 2}, {920, 3}, PokemonRarity::NORMAL, 5, 50, 50, 10, 991, 339, 11534} },
+    { 180, {180, 145, 109, 172, "FLAAFFY", PokemonType::ELECTRIC, PokemonType::NONE, {923, 2}, {925, 3}, PokemonRarity::NORMAL, 5, 50, 50, 17, 1521, 426, 18748} },
+    { 181, {181, 211, 169, 207, "AMPHAROS", PokemonType::ELECTRIC, PokemonType::NONE, {928, 2}, {930, 4}, PokemonRarity::NORMAL, 5, 50, 50, 34, 2852, 587, 34983} },
+    { 182, {182, 169, 186, 181, "BELLOSSOM", PokemonType::GRASS, PokemonType::NONE, {216, 2}, {934, 3}, PokemonRarity::NORMAL, 3, 50, 50, 27, 2281, 536, 33666} },
+    { 183, {183, 37, 93, 172, "MARILL", PokemonType::WATER, PokemonType::FAIRY, {937, 2}, {939, 3}, PokemonRarity::NORMAL, 3, 50, 50, 4, 461, 302, 15996} },
+    { 184, {184, 112, 152, 225, "AZUMARILL", PokemonType::WATER, PokemonType::FAIRY, {942, 2}, {944, 3}, PokemonRarity::NORMAL, 3, 50, 50, 18, 1588, 489, 34200} },
+    { 185, {185, 167, 176, 172, "SUDOWOODO", PokemonType::ROCK, PokemonType::NONE, {947, 2}, {949, 3}, PokemonRarity::NORMAL, 5, 50, 50, 25, 2148, 515, 30272} },
+    { 186, {186, 174, 179, 207, "POLITOED", PokemonType::WATER, PokemonType::NONE, {952, 2}, {954, 3}, PokemonRarity::NORMAL, 3, 50, 50, 29, 2449, 560, 37053} },
+    { 187, {187, 67, 94, 111, "HOPPIP", PokemonType::GRASS, PokemonType::FLYING, {957, 2}, {959, 3}, PokemonRarity::NORMAL, 3, 50, 50, 6, 600, 272, 10434} },
+    { 188, {188, 91, 120, 146, "SKIPLOOM", PokemonType::GRASS, PokemonType::FLYING, {957, 2}, {962, 3}, PokemonRarity::NORMAL, 3, 50, 50, 10, 976, 357, 17520} },
+    { 189, {189, 118, 183, 181, "JUMPLUFF", PokemonType::GRASS, PokemonType::FLYING, {965, 2}, {967, 3}, PokemonRarity::NORMAL, 3, 50, 50, 18, 1636, 482, 33123} },
+    { 190, {190, 136, 112, 146, "AIPOM", PokemonType::NORMAL, PokemonType::NONE, {970, 2}, {972, 3}, PokemonRarity::NORMAL, 3, 50, 50, 15, 1348, 394, 16352} },
+    { 191, {191, 55, 55, 102, "SUNKERN", PokemonType::GRASS, PokemonType::NONE, {975, 2}, {977, 3}, PokemonRarity::NORMAL, 3, 50, 50, 3, 395, 212, 5610} },
+    { 192, {192, 185, 135, 181, "SUNFLORA", PokemonType::GRASS, PokemonType::NONE, {980, 2}, {982, 3}, PokemonRarity::NORMAL, 3, 50, 50, 25, 2141, 501, 24435} },
+    { 193, {193, 154, 94, 163, "YANMA", PokemonType::BUG, PokemonType::FLYING, {985, 2}, {987, 3}, PokemonRarity::NORMAL, 3, 50, 50, 16, 1470, 411, 15322} },
+    { 194, {194, 75, 66, 146, "WOOPER", PokemonType::WATER, PokemonType::GROUND, {688, 2}, {990, 3}, PokemonRarity::NORMAL, 3, 50, 50, 6, 641, 287, 9636} },
+    { 195, {195, 152, 143, 216, "QUAGSIRE", PokemonType::WATER, PokemonType::GROUND, {688, 2}, {993, 3}, PokemonRarity::NORMAL, 3, 50, 50, 23, 1992, 511, 30888} },
+    { 196, {196, 261, 175, 163, "ESPEON", PokemonType::PSYCHIC, PokemonType::NONE, {619, 2}, {996, 3}, PokemonRarity::NORMAL, 5, 87.5, 12.5, 38, 3170, 599, 28525} },
+    { 197, {197, 126, 240, 216, "UMBREON", PokemonType::DARK, PokemonType::NONE, {999, 2}, {1001, 2}, PokemonRarity::NORMAL, 5, 87.5, 12.5, 25, 2137, 582, 51840} },
+    { 198, {198, 175, 87, 155, "MURKROW", PokemonType::DARK, PokemonType::FLYING, {1003, 2}, {1005, 3}, PokemonRarity::NORMAL, 3, 50, 50, 17, 1562, 417, 13485} },
+    { 199, {199, 177, 180, 216, "SLOWKING", PokemonType::WATER, PokemonType::PSYCHIC, {282, 2}, {1008, 3}, PokemonRarity::NORMAL, 3, 50, 50, 30, 2545, 573, 38880} },
+    { 200, {200, 167, 154, 155, "MISDREAVUS", PokemonType::GHOST, PokemonType::NONE, {1011, 2}, {1013, 3}, PokemonRarity::NORMAL, 3, 50, 50, 22, 1926, 476, 23870} },
+    { 201, {201, 136, 91, 134, "UNOWN_F", PokemonType::PSYCHIC, PokemonType::NONE, {1016, 1}, {43, 1}, PokemonRarity::NORMAL, 5, 0, 0, 13, 1185, 361, 12194} },
+    { 201, {201, 136, 91, 134, "UNOWN_A", PokemonType::PSYCHIC, PokemonType::NONE, {1016, 1}, {43, 1}, PokemonRarity::NORMAL, 5, 0, 0, 13, 1185, 361, 12194} },
+    { 201, {201, 136, 91, 134, "UNOWN_B", PokemonType::PSYCHIC, PokemonType::NONE, {1016, 1}, {43, 1}, PokemonRarity::NORMAL, 5, 0, 0, 13, 1185, 361, 12194} },
+    { 201, {201, 136, 91, 134, "UNOWN_C", PokemonType::PSYCHIC, PokemonType::NONE, {1016, 1}, {43, 1}, PokemonRarity::NORMAL, 5, 0, 0, 13, 1185, 361, 12194} },
+    { 201, {201, 136, 91, 134, "UNOWN_D", PokemonType::PSYCHIC, PokemonType::NONE, {1016, 1}, {43, 1}, PokemonRarity::NORMAL, 5, 0, 0, 13, 1185, 361, 12194} },
+    { 201, {201, 136, 91, 134, "UNOWN_E", PokemonType::PSYCHIC, PokemonType::NONE, {1016, 1}, {43, 1}, PokemonRarity::NORMAL, 5, 0, 0, 13, 1185, 361, 12194} },
+    { 201, {201, 136, 91, 134, "UNOWN_G", PokemonType::PSYCHIC, PokemonType::NONE, {1016, 1}, {43, 1}, PokemonRarity::NORMAL, 5, 0, 0, 13, 1185, 361, 12194} },
+    { 201, {201, 136, 91, 134, "UNOWN_H", PokemonType::PSYCHIC, PokemonType::NONE, {1016, 1}, {43, 1}, PokemonRarity::NORMAL, 5, 0, 0, 13, 1185, 361, 12194} },
+    { 201, {201, 136, 91, 134, "UNOWN_I", PokemonType::PSYCHIC, PokemonType::NONE, {1016, 1}, {43, 1}, PokemonRarity::NORMAL, 5, 0, 0, 13, 1185, 361, 12194} },
+    { 201, {201, 136, 91, 134, "UNOWN_J", PokemonType::PSYCHIC, PokemonType::NONE, {1016, 1}, {43, 1}, PokemonRarity::NORMAL, 5, 0, 0, 13, 1185, 361, 12194} },
+    { 201, {201, 136, 91, 134, "UNOWN_K", PokemonType::PSYCHIC, PokemonType::NONE, {1016, 1}, {43, 1}, PokemonRarity::NORMAL, 5, 0, 0, 13, 1185, 361, 12194} },
+    { 201, {201, 136, 91, 134, "UNOWN_L", PokemonType::PSYCHIC, PokemonType::NONE, {1016, 1}, {43, 1}, PokemonRarity::NORMAL, 5, 0, 0, 13, 1185, 361, 12194} },
+    { 201, {201, 136, 91, 134, "UNOWN_M", PokemonType::PSYCHIC, PokemonType::NONE, {1016, 1}, {43, 1}, PokemonRarity::NORMAL, 5, 0, 0, 13, 1185, 361, 12194} },
+    { 201, {201, 136, 91, 134, "UNOWN_N", PokemonType::PSYCHIC, PokemonType::NONE, {1016, 1}, {43, 1}, PokemonRarity::NORMAL, 5, 0, 0, 13, 1185, 361, 12194} },
+    { 201, {201, 136, 91, 134, "UNOWN_O", PokemonType::PSYCHIC, PokemonType::NONE, {1016, 1}, {43, 1}, PokemonRarity::NORMAL, 5, 0, 0, 13, 1185, 361, 12194} },
+    { 201, {201, 136, 91, 134, "UNOWN_P", PokemonType::PSYCHIC, PokemonType::NONE, {1016, 1}, {43, 1}, PokemonRarity::NORMAL, 5, 0, 0, 13, 1185, 361, 12194} },
+    { 201, {201, 136, 91, 134, "UNOWN_Q", PokemonType::PSYCHIC, PokemonType::NONE, {1016, 1}, {43, 1}, PokemonRarity::NORMAL, 5, 0, 0, 13, 1185, 361, 12194} },
+    { 201, {201, 136, 91, 134, "UNOWN_R", PokemonType::PSYCHIC, PokemonType::NONE, {1016, 1}, {43, 1}, PokemonRarity::NORMAL, 5, 0, 0, 13, 1185, 361, 12194} },
+    { 201, {201, 136, 91, 134, "UNOWN_S", PokemonType::PSYCHIC, PokemonType::NONE, {1016, 1}, {43, 1}, PokemonRarity::NORMAL, 5, 0, 0, 13, 1185, 361, 12194} },
+    { 201, {201, 136, 91, 134, "UNOWN_T", PokemonType::PSYCHIC, PokemonType::NONE, {1016, 1}, {43, 1}, PokemonRarity::NORMAL, 5, 0, 0, 13, 1185, 361, 12194} },
+    { 201, {201, 136, 91, 134, "UNOWN_U", PokemonType::PSYCHIC, PokemonType::NONE, {1016, 1}, {43, 1}, PokemonRarity::NORMAL, 5, 0, 0, 13, 1185, 361, 12194} },
+    { 201, {201, 136, 91, 134, "UNOWN_V", PokemonType::PSYCHIC, PokemonType::NONE, {1016, 1}, {43, 1}, PokemonRarity::NORMAL, 5, 0, 0, 13, 1185, 361, 12194} },
+    { 201, {201, 136, 91, 134, "UNOWN_W", PokemonType::PSYCHIC, PokemonType::NONE, {1016, 1}, {43, 1}, PokemonRarity::NORMAL, 5, 0, 0, 13, 1185, 361, 12194} },
+    { 201, {201, 136, 91, 134, "UNOWN_X", PokemonType::PSYCHIC, PokemonType::NONE, {1016, 1}, {43, 1}, PokemonRarity::NORMAL, 5, 0, 0, 13, 1185, 361, 12194} },
+    { 201, {201, 136, 91, 134, "UNOWN_Y", PokemonType::PSYCHIC, PokemonType::NONE, {1016, 1}, {43, 1}, PokemonRarity::NORMAL, 5, 0, 0, 13, 1185, 361, 12194} },
+    { 201, {201, 136, 91, 134, "UNOWN_Z", PokemonType::PSYCHIC, PokemonType::NONE, {1016, 1}, {43, 1}, PokemonRarity::NORMAL, 5, 0, 0, 13, 1185, 361, 12194} },
+    { 201, {201, 136, 91, 134, "UNOWN_EXCLAMATION_POINT", PokemonType::PSYCHIC, PokemonType::NONE, {1016, 1}, {43, 1}, PokemonRarity::NORMAL, 5, 0, 0, 13, 1185, 361, 12194} },
+    { 201, {201, 136, 91, 134, "UNOWN_QUESTION_MARK", PokemonType::PSYCHIC, PokemonType::NONE, {1016, 1}, {43, 1}, PokemonRarity::NORMAL, 5, 0, 0, 13, 1185, 361, 12194} },
+    { 202, {202, 60, 106, 382, "WOBBUFFET", PokemonType::PSYCHIC, PokemonType::NONE, {1017, 2}, {1019, 1}, PokemonRarity::NORMAL, 3, 50, 50, 10, 1026, 548, 40492} },
+    { 203, {203, 182, 133, 172, "GIRAFARIG", PokemonType::NORMAL, PokemonType::PSYCHIC, {1020, 2}, {1022, 3}, PokemonRarity::NORMAL, 3, 50, 50, 24, 2046, 487, 22876} },
+    { 204, {204, 108, 122, 137, "PINECO", PokemonType::BUG, PokemonType::NONE, {855, 2}, {1025, 3}, PokemonRarity::NORMAL, 5, 50, 50, 12, 1108, 367, 16714} },
+    { 205, {205, 161, 205, 181, "FORRETRESS", PokemonType::BUG, PokemonType::STEEL, {1028, 2}, {1030, 3}, PokemonRarity::NORMAL, 5, 50, 50, 27, 2282, 547, 37105} },
+    { 206, {206, 131, 128, 225, "DUNSPARCE", PokemonType::NORMAL, PokemonType::NONE, {1033, 2}, {1035, 3}, PokemonRarity::NORMAL, 3, 50, 50, 19, 1689, 484, 28800} },
+    { 207, {207, 143, 184, 163, "GLIGAR", PokemonType::GROUND, PokemonType::FLYING, {1038, 2}, {1040, 3}, PokemonRarity::NORMAL, 5, 50, 50, 21, 1857, 490, 29992} },
+    { 208, {208, 148, 272, 181, "STEELIX", PokemonType::STEEL, PokemonType::GROUND, {1043, 2}, {1045, 3}, PokemonRarity::NORMAL, 5, 50, 50, 29, 2414, 601, 49232} },
+    { 209, {209, 137, 85, 155, "SNUBBULL", PokemonType::FAIRY, PokemonType::NONE, {1048, 2}, {1050, 3}, PokemonRarity::NORMAL, 3, 25, 75, 13, 1237, 377, 13175} },
+    { 210, {210, 212, 131, 207, "GRANBULL", PokemonType::FAIRY, PokemonType::NONE, {1053, 2}, {1055, 3}, PokemonRarity::NORMAL, 3, 25, 75, 30, 2552, 550, 27117} },
+    { 211, {211, 184, 138, 163, "QWILFISH", PokemonType::WATER, PokemonType::POISON, {1058, 2}, {1060, 3}, PokemonRarity::NORMAL, 3, 50, 50, 24, 2051, 485, 22494} },
+    { 212, {212, 236, 181, 172, "SCIZOR", PokemonType::BUG, PokemonType::STEEL, {1063, 2}, {1065, 3}, PokemonRarity::NORMAL, 5, 50, 50, 36, 3001, 589, 31132} },
+    { 213, {213, 17, 396, 85, "SHUCKLE", PokemonType::BUG, PokemonType::ROCK, {1068, 2}, {1070, 3}, PokemonRarity::NORMAL, 3, 50, 50, 2, 405, 498, 33660} },
+    { 214, {214, 234, 179, 190, "HERACROSS", PokemonType::BUG, PokemonType::FIGHTING, {1073, 2}, {1075, 3}, PokemonRarity::NORMAL, 3, 50, 50, 38, 3101, 603, 34010} },
+    { 215, {215, 189, 146, 146, "SNEASEL", PokemonType::DARK, PokemonType::ICE, {1078, 2}, {1080, 3}, PokemonRarity::NORMAL, 3, 50, 50, 24, 2051, 481, 21316} },
+    { 216, {216, 142, 93, 155, "TEDDIURSA", PokemonType::NORMAL, PokemonType::NONE, {1083, 2}, {1085, 3}, PokemonRarity::NORMAL, 3, 50, 50, 15, 1328, 390, 14415} },
+    { 217, {217, 236, 144, 207, "URSARING", PokemonType::NORMAL, PokemonType::NONE, {1088, 3}, {1091, 3}, PokemonRarity::NORMAL, 3, 50, 50, 36, 2945, 587, 29808} },
+    { 218, {218, 118, 71, 120, "SLUGMA", PokemonType::FIRE, PokemonType::NONE, {1094, 2}, {1096, 3}, PokemonRarity::NORMAL, 1, 50, 50, 9, 895, 309, 8520} },
+    { 219, {219, 139, 191, 137, "MAGCARGO", PokemonType::FIRE, PokemonType::ROCK, {1094, 2}, {1099, 3}, PokemonRarity::NORMAL, 1, 50, 50, 19, 1702, 467, 26167} },
+    { 220, {220, 90, 69, 137, "SWINUB", PokemonType::ICE, PokemonType::GROUND, {1102, 2}, {1104, 3}, PokemonRarity::NORMAL, 3, 50, 50, 7, 741, 296, 9453} },
+    { 221, {221, 181, 138, 225, "PILOSWINE", PokemonType::ICE, PokemonType::GROUND, {1107, 2}, {1109, 3}, PokemonRarity::NORMAL, 3, 50, 50, 28, 2345, 544, 31050} },
+    { 222, {222, 118, 156, 146, "CORSOLA", PokemonType::WATER, PokemonType::ROCK, {937, 2}, {1112, 3}, PokemonRarity::NORMAL, 3, 25, 75, 15, 1378, 420, 22776} },
+    { 223, {223, 127, 69, 111, "REMORAID", PokemonType::WATER, PokemonType::NONE, {688, 2}, {1115, 3}, PokemonRarity::NORMAL, 1, 50, 50, 9, 912, 307, 7659} },
+    { 224, {224, 197, 141, 181, "OCTILLERY", PokemonType::WATER, PokemonType::NONE, {688, 2}, {1118, 3}, PokemonRarity::NORMAL, 1, 50, 50, 27, 2315, 519, 25521} },
+    { 225, {225, 128, 90, 128, "DELIBIRD", PokemonType::ICE, PokemonType::FLYING, {1121, 1}, {1122, 3}, PokemonRarity::NORMAL, 5, 50, 50, 12, 1094, 346, 11520} },
+    { 226, {226, 148, 226, 163, "MANTINE", PokemonType::WATER, PokemonType::FLYING, {1125, 3}, {1128, 3}, PokemonRarity::NORMAL, 5, 50, 50, 25, 2108, 537, 36838} },
+    { 227, {227, 148, 226, 163, "SKARMORY", PokemonType::STEEL, PokemonType::FLYING, {1131, 2}, {1133, 3}, PokemonRarity::NORMAL, 5, 50, 50, 25, 2108, 537, 36838} },
+    { 228, {228, 152, 83, 128, "HOUNDOUR", PokemonType::DARK, PokemonType::FIRE, {1136, 2}, {1138, 3}, PokemonRarity::NORMAL, 3, 50, 50, 13, 1234, 363, 10624} },
+    { 229, {229, 224, 144, 181, "HOUNDOOM", PokemonType::DARK, PokemonType::FIRE, {1141, 2}, {1143, 4}, PokemonRarity::NORMAL, 3, 50, 50, 31, 2635, 549, 26064} },
+    { 230, {230, 194, 194, 181, "KINGDRA", PokemonType::WATER, PokemonType::DRAGON, {1147, 2}, {1149, 3}, PokemonRarity::NORMAL, 3, 50, 50, 32, 2641, 569, 35114} },
+    { 231, {231, 107, 98, 207, "PHANPY", PokemonType::GROUND, PokemonType::NONE, {1152, 2}, {1154, 3}, PokemonRarity::NORMAL, 3, 50, 50, 13, 1206, 412, 20286} },
+    { 232, {232, 214, 185, 207, "DONPHAN", PokemonType::GROUND, PokemonType::NONE, {1157, 3}, {1160, 3}, PokemonRarity::NORMAL, 3, 50, 50, 37, 3013, 606, 38295} },
+    { 233, {233, 198, 180, 198, "PORYGON2", PokemonType::NORMAL, PokemonType::NONE, {1163, 2}, {685, 3}, PokemonRarity::NORMAL, 3, 0, 0, 33, 2711, 576, 35640} },
+    { 234, {234, 192, 131, 177, "STANTLER", PokemonType::NORMAL, PokemonType::NONE, {650, 2}, {1165, 3}, PokemonRarity::NORMAL, 3, 50, 50, 25, 2164, 500, 23187} },
+    { 235, {235, 40, 83, 146, "SMEARGLE", PokemonType::NORMAL, PokemonType::NONE, {1168, 1}, {43, 1}, PokemonRarity::NORMAL, 3, 50, 50, 3, 431, 269, 12118} },
+    { 236, {236, 64, 64, 111, "TYROGUE", PokemonType::FIGHTING, PokemonType::NONE, {1169, 2}, {1171, 3}, PokemonRarity::NORMAL, 5, 100, 0, 4, 492, 239, 7104} },
+    { 237, {237, 173, 207, 137, "HITMONTOP", PokemonType::FIGHTING, PokemonType::NONE, {1174, 2}, {1176, 3}, PokemonRarity::NORMAL, 5, 100, 0, 25, 2156, 517, 28359} },
+    { 238, {238, 153, 91, 128, "SMOOCHUM", PokemonType::ICE, PokemonType::PSYCHIC, {1179, 2}, {1181, 3}, PokemonRarity::NORMAL, 5, 0, 100, 14, 1291, 372, 11648} },
+    { 239, {239, 135, 101, 128, "ELEKID", PokemonType::ELECTRIC, PokemonType::NONE, {635, 2}, {1184, 3}, PokemonRarity::NORMAL, 5, 75, 25, 13, 1206, 364, 12928} },
+    { 240, {240, 151, 99, 128, "MAGBY", PokemonType::FIRE, PokemonType::NONE, {640, 2}, {1187, 3}, PokemonRarity::NORMAL, 5, 75, 25, 15, 1323, 378, 12672} },
+    { 241, {241, 157, 193, 216, "MILTANK", PokemonType::NORMAL, PokemonType::NONE, {650, 2}, {1190, 5}, PokemonRarity::NORMAL, 5, 0, 100, 28, 2354, 566, 41688} },
+    { 242, {242, 129, 169, 496, "BLISSEY", PokemonType::NORMAL, PokemonType::NONE, {164, 2}, {574, 3}, PokemonRarity::NORMAL, 5, 0, 100, 33, 2757, 794, 83824} },
+    { 243, {243, 241, 195, 207, "RAIKOU", PokemonType::ELECTRIC, PokemonType::NONE, {673, 2}, {1195, 4}, PokemonRarity::LEGENDARY, 20, 0, 0, 42, 3452, 643, 40365} },
+    { 244, {244, 235, 171, 251, "ENTEI", PokemonType::FIRE, PokemonType::NONE, {1199, 2}, {1201, 4}, PokemonRarity::LEGENDARY, 20, 0, 0, 43, 3473, 657, 42921} },
+    { 245, {245, 180, 235, 225, "SUICUNE", PokemonType::WATER, PokemonType::NONE, {1205, 2}, {1207, 4}, PokemonRarity::LEGENDARY, 20, 0, 0, 36, 2983, 640, 52875} },
+    { 246, {246, 115, 93, 137, "LARVITAR", PokemonType::ROCK, PokemonType::GROUND, {1211, 2}, {1213, 3}, PokemonRarity::NORMAL, 5, 50, 50, 11, 1040, 345, 12741} },
+    { 247, {247, 155, 133, 172, "PUPITAR", PokemonType::ROCK, PokemonType::GROUND, {1211, 2}, {1216, 3}, PokemonRarity::NORMAL, 5, 50, 50, 20, 1766, 460, 22876} },
+    { 248, {248, 251, 207, 225, "TYRANITAR", PokemonType::ROCK, PokemonType::DARK, {1219, 2}, {1221, 3}, PokemonRarity::NORMAL, 5, 50, 50, 47, 3834, 683, 46575} },
+    { 249, {249, 193, 310, 235, "LUGIA", PokemonType::PSYCHIC, PokemonType::FLYING, {1224, 2}, {1226, 3}, PokemonRarity::LEGENDARY, 20, 0, 0, 46, 3703, 738, 72850} },
+    { 250, {250, 239, 244, 214, "HO_OH", PokemonType::FIRE, PokemonType::FLYING, {1229, 3}, {1232, 3}, PokemonRarity::LEGENDARY, 20, 0, 0, 48, 3863, 697, 52216} },
+    { 251, {251, 210, 210, 225, "CELEBI", PokemonType::PSYCHIC, PokemonType::GRASS, {1235, 2}, {1237, 3}, PokemonRarity::MYTHIC, 20, 0, 0, 40, 3265, 645, 47250} },
+    { 252, {252, 124, 94, 120, "TREECKO", PokemonType::GRASS, PokemonType::NONE, {1240, 2}, {1242, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 11, 1053, 338, 11280} },
+    { 253, {253, 172, 120, 137, "GROVYLE", PokemonType::GRASS, PokemonType::NONE, {1245, 2}, {1247, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 19, 1673, 429, 16440} },
+    { 254, {254, 223, 169, 172, "SCEPTILE", PokemonType::GRASS, PokemonType::NONE, {1250, 2}, {1252, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 33, 2757, 564, 29068} },
+    { 255, {255, 130, 87, 128, "TORCHIC", PokemonType::FIRE, PokemonType::NONE, {1255, 2}, {1257, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 12, 1093, 345, 11136} },
+    { 256, {256, 163, 115, 155, "COMBUSKEN", PokemonType::FIRE, PokemonType::FIGHTING, {1260, 2}, {1262, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 19, 1652, 433, 17825} },
+    { 257, {257, 240, 141, 190, "BLAZIKEN", PokemonType::FIRE, PokemonType::FIGHTING, {1265, 2}, {1267, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 34, 2848, 571, 26790} },
+    { 258, {258, 126, 93, 137, "MUDKIP", PokemonType::WATER, PokemonType::NONE, {607, 2}, {1270, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 12, 1128, 356, 12741} },
+    { 259, {259, 156, 133, 172, "MARSHTOMP", PokemonType::WATER, PokemonType::GROUND, {693, 2}, {1273, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 20, 1776, 461, 22876} },
+    { 260, {260, 208, 175, 225, "SWAMPERT", PokemonType::WATER, PokemonType::GROUND, {693, 2}, {1276, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 36, 2974, 608, 39375} },
+    { 261, {261, 96, 61, 111, "POOCHYENA", PokemonType::DARK, PokemonType::NONE, {1279, 2}, {1281, 3}, PokemonRarity::NORMAL, 1, 50, 50, 6, 678, 268, 6771} },
+    { 262, {262, 171, 132, 172, "MIGHTYENA", PokemonType::DARK, PokemonType::NONE, {1284, 2}, {1286, 3}, PokemonRarity::NORMAL, 1, 50, 50, 22, 1926, 475, 22704} },
+    { 263, {263, 58, 80, 116, "ZIGZAGOON", PokemonType::NORMAL, PokemonType::NONE, {1152, 2}, {1289, 3}, PokemonRarity::NORMAL, 1, 50, 50, 4, 508, 254, 9280} },
+    { 264, {264, 142, 128, 186, "LINOONE", PokemonType::NORMAL, PokemonType::NONE, {1292, 2}, {1294, 3}, PokemonRarity::NORMAL, 1, 50, 50, 19, 1662, 456, 23808} },
+    { 265, {265, 75, 59, 128, "WURMPLE", PokemonType::BUG, PokemonType::NONE, {855, 2}, {43, 1}, PokemonRarity::NORMAL, 1, 50, 50, 5, 578, 262, 7552} },
+    { 266, {266, 60, 77, 137, "SILCOON", PokemonType::BUG, PokemonType::NONE, {865, 2}, {43, 1}, PokemonRarity::NORMAL, 1, 50, 50, 5, 553, 274, 10549} },
+    { 267, {267, 189, 98, 155, "BEAUTIFLY", PokemonType::BUG, PokemonType::FLYING, {1297, 2}, {1299, 3}, PokemonRarity::NORMAL, 1, 50, 50, 20, 1765, 442, 15190} },
+    { 268, {268, 60, 77, 137, "CASCOON", PokemonType::BUG, PokemonType::NONE, {865, 2}, {43, 1}, PokemonRarity::NORMAL, 1, 50, 50, 5, 553, 274, 10549} },
+    { 269, {269, 98, 162, 155, "DUSTOX", PokemonType::BUG, PokemonType::POISON, {44, 2}, {1302, 3}, PokemonRarity::NORMAL, 1, 50, 50, 13, 1224, 415, 25110} },
+    { 270, {270, 71, 77, 120, "LOTAD", PokemonType::WATER, PokemonType::GRASS, {1305, 2}, {1307, 2}, PokemonRarity::NORMAL, 3, 50, 50, 6, 598, 268, 9240} },
+    { 271, {271, 112, 119, 155, "LOMBRE", PokemonType::WATER, PokemonType::GRASS, {1309, 2}, {1311, 3}, PokemonRarity::NORMAL, 3, 50, 50, 13, 1197, 386, 18445} },
+    { 272, {272, 173, 176, 190, "LUDICOLO", PokemonType::WATER, PokemonType::GRASS, {1309, 2}, {1314, 4}, PokemonRarity::NORMAL, 3, 50, 50, 27, 2323, 539, 33440} },
+    { 273, {273, 71, 77, 120, "SEEDOT", PokemonType::GRASS, PokemonType::NONE, {1318, 2}, {1320, 3}, PokemonRarity::NORMAL, 3, 50, 50, 6, 598, 268, 9240} },
+    { 274, {274, 134, 78, 172, "NUZLEAF", PokemonType::GRASS, PokemonType::DARK, {1323, 2}, {1325, 3}, PokemonRarity::NORMAL, 3, 50, 50, 13, 1227, 384, 13416} },
+    { 275, {275, 200, 121, 207, "SHIFTRY", PokemonType::GRASS, PokemonType::DARK, {1323, 2}, {1328, 3}, PokemonRarity::NORMAL, 3, 50, 50, 27, 2333, 528, 25047} },
+    { 276, {276, 106, 61, 120, "TAILLOW", PokemonType::NORMAL, PokemonType::FLYING, {84, 2}, {1331, 1}, PokemonRarity::NORMAL, 1, 50, 50, 8, 765, 287, 7320} },
+    { 277, {277, 185, 124, 155, "SWELLOW", PokemonType::NORMAL, PokemonType::FLYING, {61, 2}, {1332, 3}, PokemonRarity::NORMAL, 1, 50, 50, 22, 1920, 464, 19220} },
+    { 278, {278, 106, 61, 120, "WINGULL", PokemonType::WATER, PokemonType::FLYING, {1335, 2}, {1337, 3}, PokemonRarity::NORMAL, 3, 50, 50, 8, 765, 287, 7320} },
+    { 279, {279, 175, 174, 155, "PELIPPER", PokemonType::WATER, PokemonType::FLYING, {1340, 2}, {1342, 3}, PokemonRarity::NORMAL, 3, 50, 50, 25, 2127, 504, 26970} },
+    { 280, {280, 79, 59, 99, "RALTS", PokemonType::PSYCHIC, PokemonType::FAIRY, {1235, 2}, {1345, 3}, PokemonRarity::NORMAL, 5, 50, 50, 5, 539, 237, 5841} },
+    { 281, {281, 117, 90, 116, "KIRLIA", PokemonType::PSYCHIC, PokemonType::FAIRY, {1235, 2}, {1348, 3}, PokemonRarity::NORMAL, 5, 50, 50, 10, 966, 323, 10440} },
+    { 282, {282, 237, 195, 169, "GARDEVOIR", PokemonType::PSYCHIC, PokemonType::FAIRY, {1235, 2}, {1351, 3}, PokemonRarity::NORMAL, 5, 50, 50, 38, 3093, 601, 32955} },
+    { 283, {283, 93, 87, 120, "SURSKIT", PokemonType::BUG, PokemonType::WATER, {1354, 2}, {1356, 3}, PokemonRarity::NORMAL, 1, 50, 50, 8, 791, 300, 10440} },
+    { 284, {284, 192, 150, 172, "MASQUERAIN", PokemonType::BUG, PokemonType::FLYING, {1359, 2}, {1361, 3}, PokemonRarity::NORMAL, 1, 50, 50, 27, 2270, 514, 25800} },
+    { 285, {285, 74, 110, 155, "SHROOMISH", PokemonType::GRASS, PokemonType::NONE, {957, 2}, {1364, 3}, PokemonRarity::NORMAL, 3, 50, 50, 8, 810, 339, 17050} },
+    { 286, {286, 241, 144, 155, "BRELOOM", PokemonType::GRASS, PokemonType::FIGHTING, {1367, 2}, {1369, 3}, PokemonRarity::NORMAL, 3, 50, 50, 31, 2628, 540, 22320} },
+    { 287, {287, 104, 92, 155, "SLAKOTH", PokemonType::NORMAL, PokemonType::NONE, {1372, 1}, {1373, 3}, PokemonRarity::NORMAL, 5, 50, 50, 10, 1002, 351, 14260} },
+    { 288, {288, 159, 145, 190, "VIGOROTH", PokemonType::NORMAL, PokemonType::NONE, {1376, 2}, {1378, 3}, PokemonRarity::NORMAL, 5, 50, 50, 23, 1968, 494, 27550} },
+    { 289, {289, 290, 166, 284, "SLAKING", PokemonType::NORMAL, PokemonType::NONE, {1372, 1}, {1381, 3}, PokemonRarity::NORMAL, 5, 50, 50, 55, 4431, 740, 47144} },
+    { 290, {290, 80, 126, 104, "NINCADA", PokemonType::BUG, PokemonType::GROUND, {227, 2}, {1384, 3}, PokemonRarity::NORMAL, 5, 50, 50, 8, 768, 310, 13104} },
+    { 291, {291, 199, 112, 156, "NINJASK", PokemonType::BUG, PokemonType::FLYING, {1387, 2}, {1389, 3}, PokemonRarity::NORMAL, 5, 50, 50, 23, 1969, 467, 17472} },
+    { 292, {292, 153, 73, 1, "SHEDINJA", PokemonType::BUG, PokemonType::GHOST, {1392, 2}, {1394, 3}, PokemonRarity::NORMAL, 5, 0, 0, 1, 393, 227, 73} },
+    { 293, {293, 92, 42, 162, "WHISMUR", PokemonType::NORMAL, PokemonType::NONE, {1397, 2}, {1399, 3}, PokemonRarity::NORMAL, 1, 50, 50, 6, 671, 296, 6804} },
+    { 294, {294, 134, 81, 197, "LOUDRED", PokemonType::NORMAL, PokemonType::NONE, {1211, 2}, {1399, 3}, PokemonRarity::NORMAL, 1, 50, 50, 14, 1327, 412, 15957} },
+    { 295, {295, 179, 137, 232, "EXPLOUD", PokemonType::NORMAL, PokemonType::NONE, {1033, 2}, {1402, 3}, PokemonRarity::NORMAL, 1, 50, 50, 28, 2347, 548, 31784} },
+    { 296, {296, 99, 54, 176, "MAKUHITA", PokemonType::FIGHTING, PokemonType::NONE, {1169, 2}, {1405, 3}, PokemonRarity::NORMAL, 3, 75, 25, 8, 817, 329, 9504} },
+    { 297, {297, 209, 114, 302, "HARIYAMA", PokemonType::FIGHTING, PokemonType::NONE, {1408, 2}, {1410, 3}, PokemonRarity::NORMAL, 3, 75, 25, 34, 2829, 625, 34428} },
+    { 298, {298, 36, 71, 137, "AZURILL", PokemonType::NORMAL, PokemonType::FAIRY, {1413, 2}, {1415, 3}, PokemonRarity::NORMAL, 3, 25, 75, 3, 364, 244, 9727} },
+    { 299, {299, 82, 215, 102, "NOSEPASS", PokemonType::ROCK, PokemonType::NONE, {1418, 2}, {1420, 3}, PokemonRarity::NORMAL, 3, 50, 50, 10, 993, 399, 21930} },
+    { 300, {300, 84, 79, 137, "SKITTY", PokemonType::NORMAL, PokemonType::NONE, {1423, 2}, {1425, 3}, PokemonRarity::NORMAL, 3, 25, 75, 7, 739, 300, 10823} },
+    { 301, {301, 132, 127, 172, "DELCATTY", PokemonType::NORMAL, PokemonType::NONE, {1428, 2}, {1430, 3}, PokemonRarity::NORMAL, 3, 25, 75, 17, 1496, 431, 21844} },
+    { 302, {302, 141, 136, 137, "SABLEYE", PokemonType::DARK, PokemonType::GHOST, {1433, 2}, {1435, 3}, PokemonRarity::NORMAL, 5, 50, 50, 17, 1476, 414, 18632} },
+    { 303, {303, 155, 141, 137, "MAWILE", PokemonType::STEEL, PokemonType::FAIRY, {1033, 2}, {1438, 3}, PokemonRarity::NORMAL, 5, 50, 50, 19, 1634, 433, 19317} },
+    { 304, {304, 121, 141, 137, "ARON", PokemonType::STEEL, PokemonType::ROCK, {1441, 2}, {1443, 3}, PokemonRarity::NORMAL, 1, 50, 50, 14, 1307, 399, 19317} },
+    { 305, {305, 158, 198, 155, "LAIRON", PokemonType::STEEL, PokemonType::ROCK, {1446, 2}, {1448, 3}, PokemonRarity::NORMAL, 1, 50, 50, 24, 2056, 511, 30690} },
+    { 306, {306, 198, 257, 172, "AGGRON", PokemonType::STEEL, PokemonType::ROCK, {1451, 2}, {1453, 3}, PokemonRarity::NORMAL, 1, 50, 50, 36, 3000, 627, 44204} },
+    { 307, {307, 78, 107, 102, "MEDITITE", PokemonType::FIGHTING, PokemonType::PSYCHIC, {1456, 2}, {1458, 3}, PokemonRarity::NORMAL, 3, 50, 50, 7, 693, 287, 10914} },
+    { 308, {308, 121, 152, 155, "MEDICHAM", PokemonType::FIGHTING, PokemonType::PSYCHIC, {1461, 2}, {1463, 3}, PokemonRarity::NORMAL, 3, 50, 50, 16, 1431, 428, 23560} },
+    { 309, {309, 123, 78, 120, "ELECTRIKE", PokemonType::ELECTRIC, PokemonType::NONE, {1466, 2}, {1468, 3}, PokemonRarity::NORMAL, 3, 50, 50, 10, 965, 321, 9360} },
+    { 310, {310, 215, 127, 172, "MANECTRIC", PokemonType::ELECTRIC, PokemonType::NONE, {1471, 2}, {1473, 3}, PokemonRarity::NORMAL, 3, 50, 50, 28, 2340, 514, 21844} },
+    { 311, {311, 167, 129, 155, "PLUSLE", PokemonType::ELECTRIC, PokemonType::NONE, {1476, 2}, {1468, 3}, PokemonRarity::NORMAL, 3, 50, 50, 20, 1778, 451, 19995} },
+    { 312, {312, 147, 150, 155, "MINUN", PokemonType::ELECTRIC, PokemonType::NONE, {1476, 2}, {1468, 3}, PokemonRarity::NORMAL, 3, 50, 50, 19, 1694, 452, 23250} },
+    { 313, {313, 143, 166, 163, "VOLBEAT", PokemonType::BUG, PokemonType::NONE, {1478, 2}, {1480, 3}, PokemonRarity::NORMAL, 3, 100, 0, 20, 1771, 472, 27058} },
+    { 314, {314, 143, 166, 163, "ILLUMISE", PokemonType::BUG, PokemonType::NONE, {1478, 2}, {1483, 3}, PokemonRarity::NORMAL, 3, 0, 100, 20, 1771, 472, 27058} },
+    { 315, {315, 186, 131, 137, "ROSELIA", PokemonType::GRASS, PokemonType::POISON, {1486, 2}, {1488, 3}, PokemonRarity::NORMAL, 3, 50, 50, 22, 1870, 454, 17947} },
+    { 316, {316, 80, 99, 172, "GULPIN", PokemonType::POISON, PokemonType::NONE, {1491, 2}, {1493, 3}, PokemonRarity::NORMAL, 1, 50, 50, 9, 866, 351, 17028} },
+    { 317, {317, 140, 159, 225, "SWALOT", PokemonType::POISON, PokemonType::NONE, {1496, 2}, {1498, 3}, PokemonRarity::NORMAL, 1, 50, 50, 23, 1978, 524, 35775} },
+    { 318, {318, 171, 39, 128, "CARVANHA", PokemonType::WATER, PokemonType::DARK, {1053, 2}, {1501, 3}, PokemonRarity::NORMAL, 3, 50, 50, 10, 1020, 338, 4992} },
+    { 319, {319, 243, 83, 172, "SHARPEDO", PokemonType::WATER, PokemonType::DARK, {656, 2}, {1504, 3}, PokemonRarity::NORMAL, 3, 50, 50, 25, 2181, 498, 14276} },
+    { 320, {320, 136, 68, 277, "WAILMER", PokemonType::WATER, PokemonType::NONE, {1507, 2}, {1509, 3}, PokemonRarity::NORMAL, 1, 50, 50, 16, 1468, 481, 18836} },
+    { 321, {321, 175, 87, 347, "WAILORD", PokemonType::WATER, PokemonType::NONE, {1512, 2}, {1514, 3}, PokemonRarity::NORMAL, 1, 50, 50, 26, 2280, 609, 30189} },
+    { 322, {322, 119, 79, 155, "NUMEL", PokemonType::FIRE, PokemonType::GROUND, {809, 2}, {1517, 3}, PokemonRarity::NORMAL, 3, 50, 50, 11, 1057, 353, 12245} },
+    { 323, {323, 194, 136, 172, "CAMERUPT", PokemonType::FIRE, PokemonType::GROUND, {1520, 2}, {1522, 3}, PokemonRarity::NORMAL, 3, 50, 50, 26, 2193, 502, 23392} },
+    { 324, {324, 151, 203, 172, "TORKOAL", PokemonType::FIRE, PokemonType::NONE, {1525, 2}, {1527, 3}, PokemonRarity::NORMAL, 3, 50, 50, 24, 2093, 526, 34916} },
+    { 325, {325, 125, 122, 155, "SPOINK", PokemonType::PSYCHIC, PokemonType::NONE, {1530, 2}, {1532, 3}, PokemonRarity::NORMAL, 1, 50, 50, 15, 1334, 402, 18910} },
+    { 326, {326, 171, 188, 190, "GRUMPIG", PokemonType::PSYCHIC, PokemonType::NONE, {1535, 2}, {1537, 3}, PokemonRarity::NORMAL, 1, 50, 50, 28, 2369, 549, 35720} },
+    { 327, {327, 116, 116, 155, "SPINDA_00", PokemonType::NORMAL, PokemonType::NONE, {1540, 2}, {1542, 3}, PokemonRarity::NORMAL, 3, 0, 0, 13, 1220, 387, 17980} },
+    { 327, {327, 116, 116, 155, "SPINDA_01", PokemonType::NORMAL, PokemonType::NONE, {1540, 2}, {1542, 3}, PokemonRarity::NORMAL, 3, 0, 0, 13, 1220, 387, 17980} },
+    { 327, {327, 116, 116, 155, "SPINDA_02", PokemonType::NORMAL, PokemonType::NONE, {1540, 2}, {1542, 3}, PokemonRarity::NORMAL, 3, 0, 0, 13, 1220, 387, 17980} },
+    { 327, {327, 116, 116, 155, "SPINDA_03", PokemonType::NORMAL, PokemonType::NONE, {1540, 2}, {1542, 3}, PokemonRarity::NORMAL, 3, 0, 0, 13, 1220, 387, 17980} },
+    { 327, {327, 116, 116, 155, "SPINDA_04", PokemonType::NORMAL, PokemonType::NONE, {1540, 2}, {1542, 3}, PokemonRarity::NORMAL, 3, 0, 0, 13, 1220, 387, 17980} },
+    { 327, {327, 116, 116, 155, "SPINDA_05", PokemonType::NORMAL, PokemonType::NONE, {1540, 2}, {1542, 3}, PokemonRarity::NORMAL, 3, 0, 0, 13, 1220, 387, 17980} },
+    { 327, {327, 116, 116, 155, "SPINDA_06", PokemonType::NORMAL, PokemonType::NONE, {1540, 2}, {1542, 3}, PokemonRarity::NORMAL, 3, 0, 0, 13, 1220, 387, 17980} },
+    { 327, {327, 116, 116, 155, "SPINDA_07", PokemonType::NORMAL, PokemonType::NONE, {1540, 2}, {1542, 3}, PokemonRarity::NORMAL, 3, 0, 0, 13, 1220, 387, 17980} },
+    { 328, {328, 162, 78, 128, "TRAPINCH", PokemonType::GROUND, PokemonType::NONE, {1545, 2}, {1547, 3}, PokemonRarity::NORMAL, 5, 50, 50, 14, 1274, 368, 9984} },
+    { 329, {329, 134, 99, 137, "VIBRAVA", PokemonType::GROUND, PokemonType::DRAGON, {1550, 2}, {1552, 3}, PokemonRarity::NORMAL, 5, 50, 50, 13, 1225, 370, 13563} },
+    { 330, {330, 205, 168, 190, "FLYGON", PokemonType::GROUND, PokemonType::DRAGON, {1555, 2}, {1557, 3}, PokemonRarity::NORMAL, 5, 50, 50, 32, 2661, 563, 31920} },
+    { 331, {331, 156, 74, 137, "CACNEA", PokemonType::GRASS, PokemonType::NONE, {1560, 2}, {1562, 3}, PokemonRarity::NORMAL, 3, 50, 50, 13, 1242, 367, 10138} },
+    { 332, {332, 221, 115, 172, "CACTURNE", PokemonType::GRASS, PokemonType::DARK, {1565, 2}, {1567, 3}, PokemonRarity::NORMAL, 3, 50, 50, 27, 2298, 508, 19780} },
+    { 333, {333, 76, 132, 128, "SWABLU", PokemonType::NORMAL, PokemonType::FLYING, {1570, 2}, {1572, 3}, PokemonRarity::NORMAL, 1, 50, 50, 8, 824, 336, 16896} },
+    { 334, {334, 141, 201, 181, "ALTARIA", PokemonType::DRAGON, PokemonType::FLYING, {1575, 2}, {1577, 3}, PokemonRarity::NORMAL, 1, 50, 50, 23, 2004, 523, 36381} },
+    { 335, {335, 222, 124, 177, "ZANGOOSE", PokemonType::NORMAL, PokemonType::NONE, {1580, 2}, {1582, 3}, PokemonRarity::NORMAL, 3, 50, 50, 29, 2418, 523, 21948} },
+    { 336, {336, 196, 118, 177, "SEVIPER", PokemonType::POISON, PokemonType::NONE, {159, 2}, {1585, 3}, PokemonRarity::NORMAL, 3, 50, 50, 25, 2105, 491, 20886} },
+    { 337, {337, 178, 153, 207, "LUNATONE", PokemonType::ROCK, PokemonType::PSYCHIC, {1588, 2}, {1590, 3}, PokemonRarity::NORMAL, 3, 0, 0, 27, 2327, 538, 31671} },
+    { 338, {338, 178, 153, 207, "SOLROCK", PokemonType::ROCK, PokemonType::PSYCHIC, {1588, 2}, {1593, 3}, PokemonRarity::NORMAL, 3, 0, 0, 27, 2327, 538, 31671} },
+    { 339, {339, 93, 82, 137, "BARBOACH", PokemonType::WATER, PokemonType::GROUND, {688, 2}, {1596, 3}, PokemonRarity::NORMAL, 1, 50, 50, 8, 819, 312, 11234} },
+    { 340, {340, 151, 141, 242, "WHISCASH", PokemonType::WATER, PokemonType::GROUND, {688, 2}, {1599, 3}, PokemonRarity::NORMAL, 1, 50, 50, 24, 2075, 534, 34122} },
+    { 341, {341, 141, 99, 125, "CORPHISH", PokemonType::WATER, PokemonType::NONE, {315, 2}, {1602, 3}, PokemonRarity::NORMAL, 3, 50, 50, 13, 1230, 365, 12375} },
+    { 342, {342, 224, 142, 160, "CRAWDAUNT", PokemonType::WATER, PokemonType::DARK, {1605, 2}, {1607, 3}, PokemonRarity::NORMAL, 3, 50, 50, 29, 2474, 526, 22720} },
+    { 343, {343, 77, 124, 120, "BALTOY", PokemonType::GROUND, PokemonType::PSYCHIC, {1610, 2}, {1612, 3}, PokemonRarity::NORMAL, 3, 0, 0, 8, 787, 321, 14880} },
+    { 344, {344, 140, 229, 155, "CLAYDOL", PokemonType::GROUND, PokemonType::PSYCHIC, {1615, 2}, {1617, 3}, PokemonRarity::NORMAL, 3, 0, 0, 23, 1971, 524, 35495} },
+    { 345, {345, 105, 150, 165, "LILEEP", PokemonType::ROCK, PokemonType::GRASS, {1620, 2}, {1622, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 14, 1291, 420, 24750} },
+    { 346, {346, 152, 194, 200, "CRADILY", PokemonType::ROCK, PokemonType::GRASS, {1620, 2}, {1625, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 26, 2211, 546, 38800} },
+    { 347, {347, 176, 100, 128, "ANORITH", PokemonType::ROCK, PokemonType::BUG, {1628, 2}, {1630, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 17, 1529, 404, 12800} },
+    { 348, {348, 222, 174, 181, "ARMALDO", PokemonType::ROCK, PokemonType::BUG, {1633, 2}, {1635, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 34, 2848, 577, 31494} },
+    { 349, {349, 29, 85, 85, "FEEBAS", PokemonType::WATER, PokemonType::NONE, {1638, 2}, {1019, 1}, PokemonRarity::NORMAL, 5, 50, 50, 2, 274, 199, 7225} },
+    { 350, {350, 192, 219, 216, "MILOTIC", PokemonType::WATER, PokemonType::NONE, {1640, 2}, {1514, 3}, PokemonRarity::NORMAL, 5, 50, 50, 36, 3005, 627, 47304} },
+    { 351, {351, 139, 139, 172, "CASTFORM_NORMAL", PokemonType::NORMAL, PokemonType::NONE, {1642, 2}, {1644, 2}, PokemonRarity::NORMAL, 5, 50, 50, 18, 1632, 450, 23908} },
+    { 351, {351, 139, 139, 172, "CASTFORM_SUNNY", PokemonType::FIRE, PokemonType::NONE, {809, 2}, {1646, 2}, PokemonRarity::NORMAL, 5, 50, 50, 18, 1632, 450, 23908} },
+    { 351, {351, 139, 139, 172, "CASTFORM_RAINY", PokemonType::WATER, PokemonType::NONE, {1648, 2}, {1650, 2}, PokemonRarity::NORMAL, 5, 50, 50, 18, 1632, 450, 23908} },
+    { 351, {351, 139, 139, 172, "CASTFORM_SNOWY", PokemonType::ICE, PokemonType::NONE, {1652, 2}, {1654, 2}, PokemonRarity::NORMAL, 5, 50, 50, 18, 1632, 450, 23908} },
+    { 352, {352, 161, 189, 155, "KECLEON", PokemonType::NORMAL, PokemonType::NONE, {1656, 2}, {1658, 6}, PokemonRarity::NORMAL, 5, 50, 50, 24, 2047, 505, 29295} },
+    { 353, {353, 138, 65, 127, "SHUPPET", PokemonType::GHOST, PokemonType::NONE, {1664, 2}, {1666, 3}, PokemonRarity::NORMAL, 3, 50, 50, 11, 1018, 330, 8255} },
+    { 354, {354, 218, 126, 162, "BANETTE", PokemonType::GHOST, PokemonType::NONE, {1669, 2}, {1671, 3}, PokemonRarity::NORMAL, 3, 50, 50, 27, 2298, 506, 20412} },
+    { 355, {355, 70, 162, 85, "DUSKULL", PokemonType::GHOST, PokemonType::NONE, {1674, 2}, {1666, 3}, PokemonRarity::NORMAL, 3, 50, 50, 7, 706, 317, 13770} },
+    { 356, {356, 124, 234, 120, "DUSCLOPS", PokemonType::GHOST, PokemonType::NONE, {1676, 2}, {1678, 3}, PokemonRarity::NORMAL, 3, 50, 50, 18, 1591, 478, 28080} },
+    { 357, {357, 136, 163, 223, "TROPIUS", PokemonType::GRASS, PokemonType::FLYING, {1681, 2}, {1683, 3}, PokemonRarity::NORMAL, 5, 50, 50, 22, 1941, 522, 36349} },
+    { 358, {358, 175, 170, 181, "CHIMECHO", PokemonType::PSYCHIC, PokemonType::NONE, {1686, 2}, {1688, 4}, PokemonRarity::NORMAL, 5, 50, 50, 27, 2259, 526, 30770} },
+    { 359, {359, 246, 120, 163, "ABSOL", PokemonType::DARK, PokemonType::NONE, {1692, 2}, {1694, 3}, PokemonRarity::NORMAL, 5, 50, 50, 30, 2526, 529, 19560} },
+    { 360, {360, 41, 86, 216, "WYNAUT", PokemonType::PSYCHIC, PokemonType::NONE, {1697, 2}, {1019, 1}, PokemonRarity::NORMAL, 3, 50, 50, 4, 534, 343, 18576} },
+    { 361, {361, 95, 95, 137, "SNORUNT", PokemonType::ICE, PokemonType::NONE, {1699, 2}, {1701, 3}, PokemonRarity::NORMAL, 3, 50, 50, 9, 888, 327, 13015} },
+    { 362, {362, 162, 162, 190, "GLALIE", PokemonType::ICE, PokemonType::NONE, {1704, 2}, {1706, 3}, PokemonRarity::NORMAL, 3, 50, 50, 25, 2105, 514, 30780} },
+    { 363, {363, 95, 90, 172, "SPHEAL", PokemonType::ICE, PokemonType::WATER, {1709, 2}, {1711, 3}, PokemonRarity::NORMAL, 3, 50, 50, 10, 962, 357, 15480} },
+    { 364, {364, 137, 132, 207, "SEALEO", PokemonType::ICE, PokemonType::WATER, {1714, 2}, {1711, 3}, PokemonRarity::NORMAL, 3, 50, 50, 20, 1714, 476, 27324} },
+    { 365, {365, 182, 176, 242, "WALREIN", PokemonType::ICE, PokemonType::WATER, {1716, 2}, {1718, 3}, PokemonRarity::NORMAL, 3, 50, 50, 33, 2726, 600, 42592} },
+    { 366, {366, 133, 135, 111, "CLAMPERL", PokemonType::WATER, PokemonType::NONE, {669, 1}, {1721, 3}, PokemonRarity::NORMAL, 3, 50, 50, 14, 1270, 379, 14985} },
+    { 367, {367, 197, 179, 146, "HUNTAIL", PokemonType::WATER, PokemonType::NONE, {33, 2}, {1724, 3}, PokemonRarity::NORMAL, 3, 50, 50, 28, 2340, 522, 26134} },
+    { 368, {368, 211, 179, 146, "GOREBYSS", PokemonType::WATER, PokemonType::NONE, {282, 2}, {1727, 3}, PokemonRarity::NORMAL, 3, 50, 50, 30, 2494, 536, 26134} },
+    { 369, {369, 162, 203, 225, "RELICANTH", PokemonType::WATER, PokemonType::ROCK, {277, 2}, {1730, 3}, PokemonRarity::NORMAL, 5, 87.5, 12.5, 30, 2528, 590, 45675} },
+    { 370, {370, 81, 128, 125, "LUVDISC", PokemonType::WATER, PokemonType::NONE, {1733, 2}, {1735, 3}, PokemonRarity::NORMAL, 3, 25, 75, 9, 848, 334, 16000} },
+    { 371, {371, 134, 93, 128, "BAGON", PokemonType::DRAGON, PokemonType::NONE, {1738, 2}, {1740, 3}, PokemonRarity::NORMAL, 5, 50, 50, 12, 1156, 355, 11904} },
+    { 372, {372, 172, 155, 163, "SHELGON", PokemonType::DRAGON, PokemonType::NONE, {1743, 2}, {1745, 3}, PokemonRarity::NORMAL, 5, 50, 50, 24, 2031, 490, 25265} },
+    { 373, {373, 277, 168, 216, "SALAMENCE", PokemonType::DRAGON, PokemonType::FLYING, {1748, 3}, {1751, 3}, PokemonRarity::NORMAL, 5, 50, 50, 46, 3749, 661, 36288} },
+    { 374, {374, 96, 132, 120, "BELDUM", PokemonType::STEEL, PokemonType::PSYCHIC, {1754, 1}, {43, 1}, PokemonRarity::NORMAL, 5, 0, 0, 10, 976, 348, 15840} },
+    { 375, {375, 138, 176, 155, "METANG", PokemonType::STEEL, PokemonType::PSYCHIC, {1755, 2}, {1757, 3}, PokemonRarity::NORMAL, 5, 0, 0, 20, 1721, 469, 27280} },
+    { 376, {376, 257, 228, 190, "METAGROSS", PokemonType::STEEL, PokemonType::PSYCHIC, {1760, 2}, {1762, 3}, PokemonRarity::NORMAL, 5, 0, 0, 47, 3791, 675, 43320} },
+    { 377, {377, 179, 309, 190, "REGIROCK", PokemonType::ROCK, PokemonType::NONE, {1765, 2}, {1767, 3}, PokemonRarity::LEGENDARY, 20, 0, 0, 38, 3122, 678, 58710} },
+    { 378, {378, 179, 309, 190, "REGICE", PokemonType::ICE, PokemonType::NONE, {1770, 2}, {1772, 3}, PokemonRarity::LEGENDARY, 20, 0, 0, 38, 3122, 678, 58710} },
+    { 379, {379, 143, 285, 190, "REGISTEEL", PokemonType::STEEL, PokemonType::NONE, {1775, 2}, {1777, 3}, PokemonRarity::LEGENDARY, 20, 0, 0, 29, 2447, 618, 54150} },
+    { 380, {380, 228, 246, 190, "LATIAS", PokemonType::DRAGON, PokemonType::PSYCHIC, {1780, 2}, {1782, 3}, PokemonRarity::LEGENDARY, 20, 0, 100, 43, 3510, 664, 46740} },
+    { 381, {381, 268, 212, 190, "LATIOS", PokemonType::DRAGON, PokemonType::PSYCHIC, {1780, 2}, {1785, 3}, PokemonRarity::LEGENDARY, 20, 100, 0, 47, 3812, 670, 40280} },
+    { 382, {382, 270, 228, 205, "KYOGRE", PokemonType::WATER, PokemonType::NONE, {1788, 1}, {1789, 3}, PokemonRarity::LEGENDARY, 20, 0, 0, 51, 4115, 703, 46740} },
+    { 383, {383, 270, 228, 205, "GROUDON", PokemonType::GROUND, PokemonType::NONE, {1555, 2}, {1792, 3}, PokemonRarity::LEGENDARY, 20, 0, 0, 51, 4115, 703, 46740} },
+    { 384, {384, 284, 170, 213, "RAYQUAZA", PokemonType::DRAGON, PokemonType::FLYING, {1795, 2}, {1797, 3}, PokemonRarity::LEGENDARY, 20, 0, 0, 47, 3835, 667, 36210} },
+    { 385, {385, 210, 210, 225, "JIRACHI", PokemonType::STEEL, PokemonType::PSYCHIC, {1235, 2}, {1800, 3}, PokemonRarity::MYTHIC, 20, 0, 0, 40, 3265, 645, 47250} },
+    { 386, {386, 345, 115, 137, "DEOXYS_NORMAL", PokemonType::PSYCHIC, PokemonType::NONE, {320, 2}, {1803, 3}, PokemonRarity::MYTHIC, 20, 0, 0, 38, 3160, 597, 15755} },
+    { 386, {386, 414, 46, 137, "DEOXYS_ATTACK", PokemonType::PSYCHIC, PokemonType::NONE, {1806, 2}, {1808, 3}, PokemonRarity::MYTHIC, 20, 0, 0, 29, 2580, 597, 6302} },
+    { 386, {386, 144, 330, 137, "DEOXYS_DEFENSE", PokemonType::PSYCHIC, PokemonType::NONE, {1811, 2}, {1813, 3}, PokemonRarity::MYTHIC, 20, 0, 0, 27, 2274, 611, 45210} },
+    { 386, {386, 230, 218, 137, "DEOXYS_SPEED", PokemonType::PSYCHIC, PokemonType::NONE, {320, 2}, {1816, 3}, PokemonRarity::MYTHIC, 20, 0, 0, 35, 2879, 585, 29866} },
+    { 387, {387, 119, 110, 146, "TURTWIG", PokemonType::GRASS, PokemonType::NONE, {1819, 2}, {1821, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 13, 1187, 375, 16060} },
+    { 388, {388, 157, 143, 181, "GROTLE", PokemonType::GRASS, PokemonType::NONE, {1824, 2}, {1826, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 22, 1890, 481, 25883} },
+    { 389, {389, 202, 188, 216, "TORTERRA", PokemonType::GRASS, PokemonType::GROUND, {1824, 2}, {1829, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 35, 2934, 606, 40608} },
+    { 390, {390, 113, 86, 127, "CHIMCHAR", PokemonType::FIRE, PokemonType::NONE, {13, 2}, {1832, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 10, 957, 326, 10922} },
+    { 391, {391, 158, 105, 162, "MONFERNO", PokemonType::FIRE, PokemonType::FIGHTING, {1520, 2}, {1835, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 18, 1574, 425, 17010} },
+    { 392, {392, 222, 151, 183, "INFERNAPE", PokemonType::FIRE, PokemonType::FIGHTING, {1838, 2}, {1840, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 32, 2683, 556, 27633} },
+    { 393, {393, 112, 102, 142, "PIPLUP", PokemonType::WATER, PokemonType::NONE, {1843, 2}, {1845, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 11, 1075, 356, 14484} },
+    { 394, {394, 150, 139, 162, "PRINPLUP", PokemonType::WATER, PokemonType::NONE, {502, 2}, {1848, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 19, 1701, 451, 22518} },
+    { 395, {395, 210, 186, 197, "EMPOLEON", PokemonType::WATER, PokemonType::STEEL, {1851, 2}, {1853, 3}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 35, 2900, 593, 36642} },
+    { 396, {396, 101, 58, 120, "STARLY", PokemonType::NORMAL, PokemonType::FLYING, {68, 2}, {1856, 2}, PokemonRarity::NORMAL, 1, 50, 50, 7, 719, 279, 6960} },
+    { 397, {397, 142, 94, 146, "STARAVIA", PokemonType::NORMAL, PokemonType::FLYING, {1858, 2}, {1860, 3}, PokemonRarity::NORMAL, 1, 50, 50, 14, 1299, 382, 13724} },
+    { 398, {398, 234, 140, 198, "STARAPTOR", PokemonType::NORMAL, PokemonType::FLYING, {1858, 2}, {1863, 3}, PokemonRarity::NORMAL, 1, 50, 50, 34, 2825, 572, 27720} },
+    { 399, {399, 80, 73, 153, "BIDOOF", PokemonType::NORMAL, PokemonType::NONE, {1866, 2}, {1868, 3}, PokemonRarity::NORMAL, 1, 50, 50, 7, 721, 306, 11169} },
+    { 400, {400, 162, 119, 188, "BIBAREL", PokemonType::NORMAL, PokemonType::WATER, {1871, 2}, {1873, 3}, PokemonRarity::NORMAL, 1, 50, 50, 21, 1823, 469, 22372} },
+    { 401, {401, 45, 74, 114, "KRICKETOT", PokemonType::BUG, PokemonType::NONE, {860, 2}, {43, 1}, PokemonRarity::NORMAL, 1, 50, 50, 3, 401, 233, 8436} },
+    { 402, {402, 160, 100, 184, "KRICKETUNE", PokemonType::BUG, PokemonType::NONE, {232, 2}, {1876, 3}, PokemonRarity::NORMAL, 1, 50, 50, 19, 1653, 444, 18400} },
+    { 403, {403, 117, 64, 128, "SHINX", PokemonType::ELECTRIC, PokemonType::NONE, {1879, 2}, {1881, 3}, PokemonRarity::NORMAL, 5, 50, 50, 9, 876, 309, 8192} },
+    { 404, {404, 159, 95, 155, "LUXIO", PokemonType::ELECTRIC, PokemonType::NONE, {1884, 2}, {1886, 3}, PokemonRarity::NORMAL, 5, 50, 50, 17, 1486, 409, 14725} },
+    { 405, {405, 232, 156, 190, "LUXRAY", PokemonType::ELECTRIC, PokemonType::NONE, {1889, 3}, {1892, 3}, PokemonRarity::NORMAL, 5, 50, 50, 35, 2888, 578, 29640} },
+    { 406, {406, 91, 109, 120, "BUDEW", PokemonType::GRASS, PokemonType::POISON, {1895, 2}, {1897, 2}, PokemonRarity::NORMAL, 3, 50, 50, 9, 856, 320, 13080} },
+    { 407, {407, 243, 185, 155, "ROSERADE", PokemonType::GRASS, PokemonType::POISON, {1486, 2}, {1899, 4}, PokemonRarity::NORMAL, 3, 50, 50, 36, 2971, 583, 28675} },
+    { 408, {408, 218, 71, 167, "CRANIDOS", PokemonType::ROCK, PokemonType::NONE, {1903, 2}, {1905, 3}, PokemonRarity::NORMAL, 5, 87.5, 12.5, 20, 1820, 456, 11857} },
+    { 409, {409, 295, 109, 219, "RAMPARDOS", PokemonType::ROCK, PokemonType::NONE, {1908, 2}, {1910, 3}, PokemonRarity::NORMAL, 5, 87.5, 12.5, 40, 3298, 623, 23871} },
+    { 410, {410, 76, 195, 102, "SHIELDON", PokemonType::ROCK, PokemonType::STEEL, {1913, 2}, {1915, 3}, PokemonRarity::NORMAL, 5, 87.5, 12.5, 9, 890, 373, 19890} },
+    { 411, {411, 94, 286, 155, "BASTIODON", PokemonType::ROCK, PokemonType::STEEL, {1918, 2}, {1920, 3}, PokemonRarity::NORMAL, 5, 87.5, 12.5, 17, 1539, 535, 44330} },
+    { 412, {412, 53, 83, 120, "BURMY_PLANT", PokemonType::BUG, PokemonType::NONE, {855, 2}, {43, 1}, PokemonRarity::NORMAL, 5, 50, 50, 4, 488, 256, 9960} },
+    { 412, {412, 53, 83, 120, "BURMY_SANDY", PokemonType::BUG, PokemonType::NONE, {855, 2}, {43, 1}, PokemonRarity::NORMAL, 5, 50, 50, 4, 488, 256, 9960} },
+    { 412, {412, 53, 83, 120, "BURMY_TRASH", PokemonType::BUG, PokemonType::NONE, {855, 2}, {43, 1}, PokemonRarity::NORMAL, 5, 50, 50, 4, 488, 256, 9960} },
+    { 413, {413, 141, 180, 155, "WORMADAM_PLANT", PokemonType::BUG, PokemonType::GRASS, {1923, 2}, {1925, 3}, PokemonRarity::NORMAL, 1, 5000, 100, 20, 1773, 476, 27900} },
+    { 413, {413, 141, 180, 155, "WORMADAM_SANDY", PokemonType::BUG, PokemonType::GROUND, {1923, 2}, {1928, 3}, PokemonRarity::NORMAL, 1, 0, 100, 20, 1773, 476, 27900} },
+    { 413, {413, 127, 175, 155, "WORMADAM_TRASH", PokemonType::BUG, PokemonType::STEEL, {1923, 2}, {1931, 3}, PokemonRarity::NORMAL, 1, 0, 100, 18, 1593, 457, 27125} },
+    { 414, {414, 185, 98, 172, "MOTHIM", PokemonType::BUG, PokemonType::FLYING, {1934, 2}, {1936, 3}, PokemonRarity::NORMAL, 1, 100, 10000, 21, 1815, 455, 16856} },
+    { 415, {415, 59, 83, 102, "COMBEE", PokemonType::BUG, PokemonType::FLYING, {1939, 1}, {1940, 1}, PokemonRarity::NORMAL, 3, 0, 100, 4, 494, 244, 8466} },
+    { 416, {416, 149, 190, 172, "VESPIQUEN", PokemonType::BUG, PokemonType::FLYING, {49, 2}, {1941, 3}, PokemonRarity::NORMAL, 3, 0, 100, 23, 2005, 511, 32680} },
+    { 417, {417, 94, 172, 155, "PACHIRISU", PokemonType::ELECTRIC, PokemonType::NONE, {512, 2}, {1944, 3}, PokemonRarity::NORMAL, 5, 87.5, 12.5, 13, 1213, 421, 26660} },
+    { 418, {418, 132, 67, 146, "BUIZEL", PokemonType::WATER, PokemonType::NONE, {1335, 2}, {1947, 3}, PokemonRarity::NORMAL, 3, 50, 50, 11, 1054, 345, 9782} },
+    { 419, {419, 221, 114, 198, "FLOATZEL", PokemonType::WATER, PokemonType::NONE, {1950, 2}, {1952, 3}, PokemonRarity::NORMAL, 3, 50, 50, 29, 2443, 533, 22572} },
+    { 420, {420, 108, 92, 128, "CHERUBI", PokemonType::GRASS, PokemonType::NONE, {957, 2}, {1955, 3}, PokemonRarity::NORMAL, 3, 50, 50, 10, 950, 328, 11776} },
+    { 421, {421, 170, 153, 172, "CHERRIM_OVERCAST", PokemonType::GRASS, PokemonType::NONE, {980, 2}, {1958, 3}, PokemonRarity::NORMAL, 3, 50, 50, 24, 2048, 495, 26316} },
+    { 421, {421, 170, 153, 172, "CHERRIM_SUNNY", PokemonType::GRASS, PokemonType::NONE, {980, 2}, {1958, 3}, PokemonRarity::NORMAL, 3, 50, 50, 24, 2048, 495, 26316} },
+    { 422, {422, 103, 105, 183, "SHELLOS_WEST_SEA", PokemonType::WATER, PokemonType::NONE, {1961, 2}, {1963, 3}, PokemonRarity::NORMAL, 5, 50, 50, 12, 1136, 391, 19215} },
+    { 422, {422, 103, 105, 183, "SHELLOS_EAST_SEA", PokemonType::WATER, PokemonType::NONE, {1961, 2}, {1963, 3}, PokemonRarity::NORMAL, 5, 50, 50, 12, 1136, 391, 19215} },
+    { 423, {423, 169, 143, 244, "GASTRODON_WEST_SEA", PokemonType::WATER, PokemonType::GROUND, {1961, 2}, {1966, 3}, PokemonRarity::NORMAL, 5, 50, 50, 27, 2324, 556, 34892} },
+    { 423, {423, 169, 143, 244, "GASTRODON_EAST_SEA", PokemonType::WATER, PokemonType::GROUND, {1961, 2}, {1966, 3}, PokemonRarity::NORMAL, 5, 50, 50, 27, 2324, 556, 34892} },
+    { 424, {424, 205, 143, 181, "AMBIPOM", PokemonType::NORMAL, PokemonType::NONE, {970, 2}, {1969, 3}, PokemonRarity::NORMAL, 3, 50, 50, 29, 2418, 529, 25883} },
+    { 425, {425, 117, 80, 207, "DRIFLOON", PokemonType::GHOST, PokemonType::FLYING, {1674, 2}, {1972, 3}, PokemonRarity::NORMAL, 5, 50, 50, 13, 1197, 404, 16560} },
+    { 426, {426, 180, 102, 312, "DRIFBLIM", PokemonType::GHOST, PokemonType::FLYING, {1674, 2}, {1972, 3}, PokemonRarity::NORMAL, 5, 50, 50, 28, 2382, 594, 31824} },
+    { 427, {427, 130, 105, 146, "BUNEARY", PokemonType::NORMAL, PokemonType::NONE, {1975, 2}, {1977, 2}, PokemonRarity::NORMAL, 3, 50, 50, 14, 1258, 381, 15330} },
+    { 428, {428, 156, 194, 163, "LOPUNNY", PokemonType::NORMAL, PokemonType::NONE, {1979, 2}, {1981, 3}, PokemonRarity::NORMAL, 3, 50, 50, 24, 2059, 513, 31622} },
+    { 429, {429, 211, 187, 155, "MISMAGIUS", PokemonType::GHOST, PokemonType::NONE, {481, 2}, {1984, 3}, PokemonRarity::NORMAL, 3, 50, 50, 31, 2615, 553, 28985} },
+    { 430, {430, 243, 103, 225, "HONCHKROW", PokemonType::DARK, PokemonType::FLYING, {1987, 2}, {1989, 4}, PokemonRarity::NORMAL, 3, 50, 50, 32, 2711, 571, 23175} },
+    { 431, {431, 109, 82, 135, "GLAMEOW", PokemonType::NORMAL, PokemonType::NONE, {835, 2}, {1993, 3}, PokemonRarity::NORMAL, 3, 25, 75, 10, 934, 326, 11070} },
+    { 432, {432, 172, 133, 174, "PURUGLY", PokemonType::NORMAL, PokemonType::NONE, {1996, 2}, {1998, 3}, PokemonRarity::NORMAL, 3, 25, 75, 23, 1953, 479, 23142} },
+    { 433, {433, 114, 94, 128, "CHINGLING", PokemonType::PSYCHIC, PokemonType::NONE, {2001, 2}, {2003, 3}, PokemonRarity::NORMAL, 5, 50, 50, 11, 1005, 336, 12032} },
+    { 434, {434, 121, 90, 160, "STUNKY", PokemonType::POISON, PokemonType::DARK, {264, 2}, {2006, 3}, PokemonRarity::NORMAL, 3, 50, 50, 12, 1151, 371, 14400} },
+    { 435, {435, 184, 132, 230, "SKUNTANK", PokemonType::POISON, PokemonType::DARK, {144, 2}, {2006, 3}, PokemonRarity::NORMAL, 3, 50, 50, 28, 2358, 546, 30360} },
+    { 436, {436, 43, 154, 149, "BRONZOR", PokemonType::STEEL, PokemonType::PSYCHIC, {1020, 2}, {2009, 3}, PokemonRarity::NORMAL, 3, 0, 0, 5, 603, 346, 22946} },
+    { 437, {437, 161, 213, 167, "BRONZONG", PokemonType::STEEL, PokemonType::PSYCHIC, {2012, 2}, {2014, 3}, PokemonRarity::NORMAL, 3, 0, 0, 26, 2239, 541, 35571} },
+    { 438, {438, 124, 133, 137, "BONSLY", PokemonType::ROCK, PokemonType::NONE, {947, 2}, {2017, 3}, PokemonRarity::NORMAL, 5, 50, 50, 14, 1302, 394, 18221} },
+    { 439, {439, 125, 142, 85, "MIME_JR", PokemonType::PSYCHIC, PokemonType::FAIRY, {2020, 2}, {2022, 3}, PokemonRarity::NORMAL, 5, 50, 50, 12, 1095, 352, 12070} },
+    { 440, {440, 25, 77, 225, "HAPPINY", PokemonType::NORMAL, PokemonType::NONE, {164, 2}, {2025, 1}, PokemonRarity::NORMAL, 5, 0, 100, 2, 371, 327, 17325} },
+    { 441, {441, 183, 91, 183, "CHATOT", PokemonType::NORMAL, PokemonType::FLYING, {89, 2}, {2026, 3}, PokemonRarity::NORMAL, 5, 50, 50, 20, 1791, 457, 16653} },
+    { 442, {442, 169, 199, 137, "SPIRITOMB", PokemonType::GHOST, PokemonType::DARK, {2029, 2}, {2031, 3}, PokemonRarity::NORMAL, 5, 50, 50, 24, 2072, 505, 27263} },
+    { 443, {443, 124, 84, 151, "GIBLE", PokemonType::DRAGON, PokemonType::GROUND, {2034, 2}, {2036, 3}, PokemonRarity::NORMAL, 5, 50, 50, 12, 1112, 359, 12684} },
+    { 444, {444, 172, 125, 169, "GABITE", PokemonType::DRAGON, PokemonType::GROUND, {2034, 2}, {2039, 3}, PokemonRarity::NORMAL, 5, 50, 50, 22, 1874, 466, 21125} },
+    { 445, {445, 261, 193, 239, "GARCHOMP", PokemonType::DRAGON, PokemonType::GROUND, {2042, 2}, {2044, 3}, PokemonRarity::NORMAL, 5, 50, 50, 49, 3962, 693, 46127} },
+    { 446, {446, 137, 117, 286, "MUNCHLAX", PokemonType::NORMAL, PokemonType::NONE, {2047, 2}, {2049, 3}, PokemonRarity::NORMAL, 5, 87.5, 12.5, 22, 1892, 540, 33462} },
+    { 447, {447, 127, 78, 120, "RIOLU", PokemonType::FIGHTING, PokemonType::NONE, {2052, 2}, {2054, 3}, PokemonRarity::NORMAL, 5, 87.5, 12.5, 10, 993, 325, 9360} },
+    { 448, {448, 236, 144, 172, "LUCARIO", PokemonType::FIGHTING, PokemonType::STEEL, {1408, 2}, {2057, 3}, PokemonRarity::NORMAL, 5, 87.5, 12.5, 32, 2703, 552, 24768} },
+    { 449, {449, 124, 118, 169, "HIPPOPOTAS", PokemonType::GROUND, PokemonType::NONE, {1048, 2}, {2060, 3}, PokemonRarity::NORMAL, 1, 50, 50, 15, 1358, 411, 19942} },
+    { 450, {450, 201, 191, 239, "HIPPOWDON", PokemonType::GROUND, PokemonType::NONE, {2063, 2}, {2065, 3}, PokemonRarity::NORMAL, 1, 50, 50, 37, 3085, 631, 45649} },
+    { 451, {451, 93, 151, 120, "SKORUPI", PokemonType::POISON, PokemonType::BUG, {870, 2}, {2068, 3}, PokemonRarity::NORMAL, 5, 50, 50, 11, 1009, 364, 18120} },
+    { 452, {452, 180, 202, 172, "DRAPION", PokemonType::POISON, PokemonType::DARK, {2071, 3}, {2074, 3}, PokemonRarity::NORMAL, 5, 50, 50, 29, 2453, 554, 34744} },
+    { 453, {453, 116, 76, 134, "CROAGUNK", PokemonType::POISON, PokemonType::FIGHTING, {2077, 2}, {2079, 3}, PokemonRarity::NORMAL, 3, 50, 50, 10, 952, 326, 10184} },
+    { 454, {454, 211, 133, 195, "TOXICROAK", PokemonType::POISON, PokemonType::FIGHTING, {2082, 2}, {2084, 3}, PokemonRarity::NORMAL, 3, 50, 50, 30, 2488, 539, 25935} },
+    { 455, {455, 187, 136, 179, "CARNIVINE", PokemonType::GRASS, PokemonType::NONE, {2087, 2}, {2089, 3}, PokemonRarity::NORMAL, 5, 50, 50, 25, 2159, 502, 24344} },
+    { 456, {456, 96, 116, 135, "FINNEON", PokemonType::WATER, PokemonType::NONE, {2092, 2}, {2094, 3}, PokemonRarity::NORMAL, 3, 50, 50, 10, 971, 347, 15660} },
+    { 457, {457, 142, 170, 170, "LUMINEON", PokemonType::WATER, PokemonType::NONE, {2097, 2}, {2099, 3}, PokemonRarity::NORMAL, 3, 50, 50, 21, 1814, 482, 28900} },
+    { 458, {458, 105, 179, 128, "MANTYKE", PokemonType::WATER, PokemonType::FLYING, {28, 2}, {1128, 3}, PokemonRarity::NORMAL, 5, 50, 50, 14, 1248, 412, 22912} },
+    { 459, {459, 115, 105, 155, "SNOVER", PokemonType::GRASS, PokemonType::ICE, {2102, 2}, {2104, 3}, PokemonRarity::NORMAL, 3, 50, 50, 12, 1159, 375, 16275} },
+    { 460, {460, 178, 158, 207, "ABOMASNOW", PokemonType::GRASS, PokemonType::ICE, {2107, 2}, {2109, 3}, PokemonRarity::NORMAL, 3, 50, 50, 28, 2362, 543, 32706} },
+    { 461, {461, 243, 171, 172, "WEAVILE", PokemonType::DARK, PokemonType::ICE, {1078, 2}, {2112, 3}, PokemonRarity::NORMAL, 3, 50, 50, 36, 3005, 586, 29412} },
+    { 462, {462, 238, 205, 172, "MAGNEZONE", PokemonType::ELECTRIC, PokemonType::STEEL, {418, 2}, {2115, 3}, PokemonRarity::NORMAL, 3, 0, 0, 39, 3205, 615, 35260} },
+    { 463, {463, 161, 181, 242, "LICKILICKY", PokemonType::NORMAL, PokemonType::NONE, {554, 2}, {2118, 3}, PokemonRarity::NORMAL, 3, 50, 50, 29, 2467, 584, 43802} },
+    { 464, {464, 241, 190, 251, "RHYPERIOR", PokemonType::GROUND, PokemonType::ROCK, {2121, 2}, {571, 3}, PokemonRarity::NORMAL, 3, 50, 50, 46, 3733, 682, 47690} },
+    { 465, {465, 207, 184, 225, "TANGROWTH", PokemonType::GRASS, PokemonType::NONE, {577, 2}, {2123, 3}, PokemonRarity::NORMAL, 3, 50, 50, 37, 3030, 616, 41400} },
+    { 466, {466, 249, 163, 181, "ELECTIVIRE", PokemonType::ELECTRIC, PokemonType::NONE, {635, 2}, {2126, 3}, PokemonRarity::NORMAL, 5, 75, 25, 37, 3079, 593, 29503} },
+    { 467, {467, 247, 172, 181, "MAGMORTAR", PokemonType::FIRE, PokemonType::NONE, {2129, 2}, {2131, 4}, PokemonRarity::NORMAL, 5, 75, 25, 38, 3132, 600, 31132} },
+    { 468, {468, 225, 217, 198, "TOGEKISS", PokemonType::FAIRY, PokemonType::FLYING, {2135, 2}, {2137, 4}, PokemonRarity::NORMAL, 3, 87.5, 12.5, 41, 3332, 640, 42966} },
+    { 469, {469, 231, 156, 200, "YANMEGA", PokemonType::BUG, PokemonType::FLYING, {2141, 2}, {2143, 3}, PokemonRarity::NORMAL, 3, 50, 50, 36, 2946, 587, 31200} },
+    { 470, {470, 216, 219, 163, "LEAFEON", PokemonType::GRASS, PokemonType::NONE, {2146, 2}, {2148, 3}, PokemonRarity::NORMAL, 5, 87.5, 12.5, 36, 2944, 598, 35697} },
+    { 471, {471, 238, 205, 163, "GLACEON", PokemonType::ICE, PokemonType::NONE, {1704, 2}, {2151, 3}, PokemonRarity::NORMAL, 5, 87.5, 12.5, 38, 3126, 606, 33415} },
+    { 472, {472, 185, 222, 181, "GLISCOR", PokemonType::GROUND, PokemonType::FLYING, {1038, 2}, {2154, 3}, PokemonRarity::NORMAL, 5, 50, 50, 32, 2692, 588, 40182} },
+    { 473, {473, 247, 146, 242, "MAMOSWINE", PokemonType::ICE, PokemonType::GROUND, {2157, 2}, {1109, 3}, PokemonRarity::NORMAL, 3, 50, 50, 41, 3328, 635, 35332} },
+    { 474, {474, 264, 150, 198, "PORYGON_Z", PokemonType::NORMAL, PokemonType::NONE, {1163, 2}, {2159, 4}, PokemonRarity::NORMAL, 3, 0, 0, 40, 3266, 612, 29700} },
+    { 475, {475, 237, 195, 169, "GALLADE", PokemonType::PSYCHIC, PokemonType::FIGHTING, {2163, 2}, {2165, 3}, PokemonRarity::NORMAL, 5, 100, 0, 38, 3093, 601, 32955} },
+    { 476, {476, 135, 275, 155, "PROBOPASS", PokemonType::ROCK, PokemonType::STEEL, {1418, 2}, {2168, 3}, PokemonRarity::NORMAL, 3, 50, 50, 24, 2080, 565, 42625} },
+    { 477, {477, 180, 254, 128, "DUSKNOIR", PokemonType::GHOST, PokemonType::NONE, {1674, 2}, {2171, 3}, PokemonRarity::NORMAL, 3, 50, 50, 28, 2388, 562, 32512} },
+    { 478, {478, 171, 150, 172, "FROSLASS", PokemonType::ICE, PokemonType::GHOST, {1699, 2}, {2174, 3}, PokemonRarity::NORMAL, 3, 0, 100, 24, 2040, 493, 25800} },
+    { 479, {479, 185, 159, 137, "ROTOM_NORMAL", PokemonType::ELECTRIC, PokemonType::GHOST, {2177, 2}, {2179, 3}, PokemonRarity::NORMAL, 5, 0, 0, 24, 2031, 481, 21783} },
+    { 479, {479, 204, 219, 137, "ROTOM_FROST", PokemonType::ELECTRIC, PokemonType::ICE, {2177, 2}, {2182, 3}, PokemonRarity::NORMAL, 5, 0, 0, 31, 2579, 560, 30003} },
+    { 479, {479, 204, 219, 137, "ROTOM_FAN", PokemonType::ELECTRIC, PokemonType::FLYING, {2185, 2}, {2179, 3}, PokemonRarity::NORMAL, 5, 0, 0, 31, 2579, 560, 30003} },
+    { 479, {479, 204, 219, 137, "ROTOM_MOW", PokemonType::ELECTRIC, PokemonType::GRASS, {2177, 2}, {2179, 3}, PokemonRarity::NORMAL, 5, 0, 0, 31, 2579, 560, 30003} },
+    { 479, {479, 204, 219, 137, "ROTOM_WASH", PokemonType::ELECTRIC, PokemonType::WATER, {2177, 2}, {887, 3}, PokemonRarity::NORMAL, 5, 0, 0, 31, 2579, 560, 30003} },
+    { 479, {479, 204, 219, 137, "ROTOM_HEAT", PokemonType::ELECTRIC, PokemonType::FIRE, {2177, 2}, {2187, 3}, PokemonRarity::NORMAL, 5, 0, 0, 31, 2579, 560, 30003} },
+    { 480, {480, 156, 270, 181, "UXIE", PokemonType::PSYCHIC, PokemonType::NONE, {1610, 2}, {2190, 3}, PokemonRarity::LEGENDARY, 20, 0, 0, 30, 2524, 607, 48870} },
+    { 481, {481, 212, 212, 190, "MESPRIT", PokemonType::PSYCHIC, PokemonType::NONE, {1610, 2}, {2193, 3}, PokemonRarity::LEGENDARY, 20, 0, 0, 37, 3058, 614, 40280} },
+    { 482, {482, 270, 151, 181, "AZELF", PokemonType::PSYCHIC, PokemonType::NONE, {1610, 2}, {2196, 3}, PokemonRarity::LEGENDARY, 20, 0, 0, 39, 3210, 602, 27331} },
+    { 483, {483, 275, 211, 205, "DIALGA", PokemonType::STEEL, PokemonType::DRAGON, {2199, 2}, {2201, 3}, PokemonRarity::LEGENDARY, 20, 0, 0, 50, 4038, 691, 43255} },
+    { 484, {484, 280, 215, 189, "PALKIA", PokemonType::WATER, PokemonType::DRAGON, {2204, 2}, {2206, 3}, PokemonRarity::LEGENDARY, 20, 0, 0, 49, 3991, 684, 40635} },
+    { 485, {485, 251, 213, 209, "HEATRAN", PokemonType::FIRE, PokemonType::STEEL, {2209, 2}, {2211, 3}, PokemonRarity::LEGENDARY, 20, 50, 50, 46, 3754, 673, 44517} },
+    { 486, {486, 287, 210, 221, "REGIGIGAS", PokemonType::NORMAL, PokemonType::NONE, {2214, 2}, {2216, 3}, PokemonRarity::LEGENDARY, 20, 0, 0, 54, 4346, 718, 46410} },
+    { 487, {487, 187, 225, 284, "GIRATINA_ALTERED", PokemonType::GHOST, PokemonType::DRAGON, {2219, 2}, {2221, 3}, PokemonRarity::LEGENDARY, 20, 0, 0, 41, 3379, 696, 63900} },
+    { 487, {487, 225, 187, 284, "GIRATINA_ORIGIN", PokemonType::GHOST, PokemonType::DRAGON, {2219, 2}, {2221, 3}, PokemonRarity::LEGENDARY, 20, 0, 0, 45, 3683, 696, 53108} },
+    { 488, {488, 152, 258, 260, "CRESSELIA", PokemonType::PSYCHIC, PokemonType::NONE, {325, 2}, {2224, 3}, PokemonRarity::LEGENDARY, 20, 0, 100, 34, 2857, 670, 67080} },
+    { 489, {489, 162, 162, 190, "PHIONE", PokemonType::WATER, PokemonType::NONE, {2227, 2}, {2229, 3}, PokemonRarity::MYTHIC, 20, 0, 0, 25, 2105, 514, 30780} },
+    { 490, {490, 210, 210, 225, "MANAPHY", PokemonType::WATER, PokemonType::NONE, {2227, 2}, {2232, 3}, PokemonRarity::MYTHIC, 20, 0, 0, 40, 3265, 645, 47250} },
+    { 491, {491, 285, 198, 172, "DARKRAI", PokemonType::DARK, PokemonType::NONE, {2235, 2}, {2237, 3}, PokemonRarity::MYTHIC, 20, 0, 0, 46, 3739, 655, 34056} },
+    { 492, {492, 210, 210, 225, "SHAYMIN_LAND", PokemonType::GRASS, PokemonType::NONE, {2240, 2}, {2242, 3}, PokemonRarity::MYTHIC, 20, 0, 0, 40, 3265, 645, 47250} },
+    { 492, {492, 261, 166, 225, "SHAYMIN_SKY", PokemonType::GRASS, PokemonType::FLYING, {2240, 2}, {2242, 3}, PokemonRarity::MYTHIC, 20, 0, 0, 44, 3592, 652, 37350} },
+    { 493, {493, 238, 238, 237, "ARCEUS_NORMAL", PokemonType::NORMAL, PokemonType::NONE, {2245, 2}, {2247, 3}, PokemonRarity::MYTHIC, 20, 0, 0, 49, 3989, 713, 56406} },
+    { 493, {493, 238, 238, 237, "ARCEUS_FIGHTING", PokemonType::FIGHTING, PokemonType::NONE, {2245, 2}, {2247, 3}, PokemonRarity::MYTHIC, 20, 0, 0, 49, 3989, 713, 56406} },
+    { 493, {493, 238, 238, 237, "ARCEUS_FLYING", PokemonType::FLYING, PokemonType::NONE, {2245, 2}, {2247, 3}, PokemonRarity::MYTHIC, 20, 0, 0, 49, 3989, 713, 56406} },
+    { 493, {493, 238, 238, 237, "ARCEUS_POISON", PokemonType::POISON, PokemonType::NONE, {2245, 2}, {2247, 3}, PokemonRarity::MYTHIC, 20, 0, 0, 49, 3989, 713, 56406} },
+    { 493, {493, 238, 238, 237, "ARCEUS_GROUND", PokemonType::GROUND, PokemonType::NONE, {2245, 2}, {2247, 3}, PokemonRarity::MYTHIC, 20, 0, 0, 49, 3989, 713, 56406} },
+    { 493, {493, 238, 238, 237, "ARCEUS_ROCK", PokemonType::ROCK, PokemonType::NONE, {2245, 2}, {2247, 3}, PokemonRarity::MYTHIC, 20, 0, 0, 49, 3989, 713, 56406} },
+    { 493, {493, 238, 238, 237, "ARCEUS_BUG", PokemonType::BUG, PokemonType::NONE, {2245, 2}, {2247, 3}, PokemonRarity::MYTHIC, 20, 0, 0, 49, 3989, 713, 56406} },
+    { 493, {493, 238, 238, 237, "ARCEUS_GHOST", PokemonType::GHOST, PokemonType::NONE, {2245, 2}, {2247, 3}, PokemonRarity::MYTHIC, 20, 0, 0, 49, 3989, 713, 56406} },
+    { 493, {493, 238, 238, 237, "ARCEUS_STEEL", PokemonType::STEEL, PokemonType::NONE, {2245, 2}, {2247, 3}, PokemonRarity::MYTHIC, 20, 0, 0, 49, 3989, 713, 56406} },
+    { 493, {493, 238, 238, 237, "ARCEUS_FIRE", PokemonType::FIRE, PokemonType::NONE, {2245, 2}, {2247, 3}, PokemonRarity::MYTHIC, 20, 0, 0, 49, 3989, 713, 56406} },
+    { 493, {493, 238, 238, 237, "ARCEUS_WATER", PokemonType::WATER, PokemonType::NONE, {2245, 2}, {2247, 3}, PokemonRarity::MYTHIC, 20, 0, 0, 49, 3989, 713, 56406} },
+    { 493, {493, 238, 238, 237, "ARCEUS_GRASS", PokemonType::GRASS, PokemonType::NONE, {2245, 2}, {2247, 3}, PokemonRarity::MYTHIC, 20, 0, 0, 49, 3989, 713, 56406} },
+    { 493, {493, 238, 238, 237, "ARCEUS_ELECTRIC", PokemonType::ELECTRIC, PokemonType::NONE, {2245, 2}, {2247, 3}, PokemonRarity::MYTHIC, 20, 0, 0, 49, 3989, 713, 56406} },
+    { 493, {493, 238, 238, 237, "ARCEUS_PSYCHIC", PokemonType::PSYCHIC, PokemonType::NONE, {2245, 2}, {2247, 3}, PokemonRarity::MYTHIC, 20, 0, 0, 49, 3989, 713, 56406} },
+    { 493, {493, 238, 238, 237, "ARCEUS_ICE", PokemonType::ICE, PokemonType::NONE, {2245, 2}, {2247, 3}, PokemonRarity::MYTHIC, 20, 0, 0, 49, 3989, 713, 56406} },
+    { 493, {493, 238, 238, 237, "ARCEUS_DRAGON", PokemonType::DRAGON, PokemonType::NONE, {2245, 2}, {2247, 3}, PokemonRarity::MYTHIC, 20, 0, 0, 49, 3989, 713, 56406} },
+    { 493, {493, 238, 238, 237, "ARCEUS_DARK", PokemonType::DARK, PokemonType::NONE, {2245, 2}, {2247, 3}, PokemonRarity::MYTHIC, 20, 0, 0, 49, 3989, 713, 56406} },
+    { 493, {493, 238, 238, 237, "ARCEUS_FAIRY", PokemonType::FAIRY, PokemonType::NONE, {2245, 2}, {2247, 3}, PokemonRarity::MYTHIC, 20, 0, 0, 49, 3989, 713, 56406} },
+    { 808, {808, 118, 99, 130, "MELTAN", PokemonType::STEEL, PokemonType::NONE, {890, 1}, {2250, 2}, PokemonRarity::MYTHIC, 20, 0, 0, 11, 1068, 347, 12870} },
+    { 809, {809, 226, 190, 264, "MELMETAL", PokemonType::STEEL, PokemonType::NONE, {890, 1}, {2252, 4}, PokemonRarity::MYTHIC, 20, 0, 0, 44, 3599, 680, 50160} },
+}}};
+
+const PokemonColumnTable PokemonColumns{
+    // number
+    {{
+        1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 19,
+        20, 20, 21, 22, 23, 24, 25, 26, 26, 27, 27, 28, 28, 29, 30, 31, 32, 33, 34, 35,
+        36, 37, 37, 38, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 50, 51, 51,
+        52, 52, 53, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69,
+        70, 71, 72, 73, 74, 74, 75, 75, 76, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86,
+        87, 88, 88, 89, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 103,
+        104, 105, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,
+        123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142,
+        143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162,
+        163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182,
+        183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 201,
+        201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+        201, 201, 201, 201, 201, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215,
+        216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235,
+        236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255,
+        256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275,
+        276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295,
+        296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315,
+        316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 327, 327, 327, 327, 327, 327, 327, 328,
+        329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348,
+        349, 350, 351, 351, 351, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365,
+        366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385,
+        386, 386, 386, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402,
+        403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 412, 412, 413, 413, 413, 414, 415, 416, 417, 418,
+        419, 420, 421, 421, 422, 422, 423, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435,
+        436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455,
+        456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475,
+        476, 477, 478, 479, 479, 479, 479, 479, 479, 480, 481, 482, 483, 484, 485, 486, 487, 487, 488, 489,
+        490, 491, 492, 492, 493, 493, 493, 493, 493, 493, 493, 493, 493, 493, 493, 493, 493, 493, 493, 493,
+        493, 493, 808, 809
+    }},
+    // baseAtk
+    {{
+        118, 151, 198, 116, 158, 223, 94, 126, 171, 55, 45, 167, 63, 46, 169, 85, 117, 166, 103, 103,
+        161, 135, 112, 182, 110, 167, 112, 193, 201, 126, 125, 182, 177, 86, 117, 180, 105, 137, 204, 107,
+        178, 96, 96, 169, 170, 80, 156, 83, 161, 131, 153, 202, 121, 165, 100, 179, 109, 108, 167, 201,
+        92, 99, 150, 158, 122, 191, 148, 207, 136, 227, 101, 130, 182, 195, 232, 271, 137, 177, 234, 139,
+        172, 207, 97, 166, 132, 132, 164, 164, 211, 211, 170, 207, 109, 177, 165, 223, 124, 158, 218, 85,
+        139, 135, 135, 190, 190, 116, 186, 186, 223, 261, 85, 89, 144, 181, 240, 109, 173, 107, 233, 230,
+        90, 144, 144, 224, 193, 108, 119, 174, 140, 222, 60, 183, 181, 129, 187, 123, 175, 137, 210, 192,
+        218, 223, 198, 206, 238, 198, 29, 237, 165, 91, 104, 205, 232, 246, 153, 155, 207, 148, 220, 221,
+        190, 192, 253, 251, 119, 163, 263, 300, 210, 92, 122, 168, 116, 158, 223, 117, 150, 205, 79, 148,
+        67, 145, 72, 107, 105, 161, 194, 106, 146, 77, 75, 69, 67, 139, 134, 192, 114, 145, 211, 169,
+        37, 112, 167, 174, 67, 91, 118, 136, 55, 185, 154, 75, 152, 261, 126, 175, 177, 167, 136, 136,
+        136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136,
+        136, 136, 136, 136, 136, 136, 60, 182, 108, 161, 131, 143, 148, 137, 212, 184, 236, 17, 234, 189,
+        142, 236, 118, 139, 90, 181, 118, 127, 197, 128, 148, 148, 152, 224, 194, 107, 214, 198, 192, 40,
+        64, 173, 153, 135, 151, 157, 129, 241, 235, 180, 115, 155, 251, 193, 239, 210, 124, 172, 223, 130,
+        163, 240, 126, 156, 208, 96, 171, 58, 142, 75, 60, 189, 60, 98, 71, 112, 173, 71, 134, 200,
+        106, 185, 106, 175, 79, 117, 237, 93, 192, 74, 241, 104, 159, 290, 80, 199, 153, 92, 134, 179,
+        99, 209, 36, 82, 84, 132, 141, 155, 121, 158, 198, 78, 121, 123, 215, 167, 147, 143, 143, 186,
+        80, 140, 171, 243, 136, 175, 119, 194, 151, 125, 171, 116, 116, 116, 116, 116, 116, 116, 116, 162,
+        134, 205, 156, 221, 76, 141, 222, 196, 178, 178, 93, 151, 141, 224, 77, 140, 105, 152, 176, 222,
+        29, 192, 139, 139, 139, 139, 161, 138, 218, 70, 124, 136, 175, 246, 41, 95, 162, 95, 137, 182,
+        133, 197, 211, 162, 81, 134, 172, 277, 96, 138, 257, 179, 179, 143, 228, 268, 270, 270, 284, 210,
+        345, 414, 144, 230, 119, 157, 202, 113, 158, 222, 112, 150, 210, 101, 142, 234, 80, 162, 45, 160,
+        117, 159, 232, 91, 243, 218, 295, 76, 94, 53, 53, 53, 141, 141, 127, 185, 59, 149, 94, 132,
+        221, 108, 170, 170, 103, 103, 169, 169, 205, 117, 180, 130, 156, 211, 243, 109, 172, 114, 121, 184,
+        43, 161, 124, 125, 25, 183, 169, 124, 172, 261, 137, 127, 236, 124, 201, 93, 180, 116, 211, 187,
+        96, 142, 105, 115, 178, 243, 238, 161, 241, 207, 249, 247, 225, 231, 216, 238, 185, 247, 264, 237,
+        135, 180, 171, 185, 204, 204, 204, 204, 204, 156, 212, 270, 275, 280, 251, 287, 187, 225, 152, 162,
+        210, 285, 210, 261, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238,
+        238, 238, 118, 226
+    }},
+    // baseDef
+    {{
+        111, 143, 189, 93, 126, 173, 121, 155, 207, 55, 80, 137, 50, 75, 130, 73, 105, 154, 70, 70,
+        139, 154, 60, 133, 97, 153, 96, 151, 154, 120, 129, 175, 195, 89, 120, 173, 76, 111, 156, 108,
+        162, 109, 109, 190, 193, 41, 90, 73, 150, 112, 136, 167, 99, 146, 100, 143, 78, 81, 136, 142,
+        78, 78, 136, 136, 95, 162, 82, 138, 93, 166, 82, 123, 184, 82, 117, 167, 82, 125, 159, 61,
+        92, 135, 149, 209, 132, 132, 164, 164, 198, 198, 127, 162, 98, 180, 121, 169, 115, 83, 140, 121,
+        177, 90, 90, 172, 172, 134, 256, 67, 107, 149, 232, 136, 193, 124, 181, 111, 173, 125, 149, 153,
+        144, 186, 186, 181, 197, 137, 141, 197, 127, 171, 128, 169, 165, 103, 156, 110, 147, 112, 184, 205,
+        170, 151, 158, 154, 182, 183, 85, 186, 174, 91, 114, 161, 182, 179, 136, 153, 201, 140, 186, 159,
+        169, 236, 185, 181, 91, 135, 198, 182, 210, 122, 155, 202, 93, 126, 173, 109, 142, 188, 73, 125,
+        88, 156, 118, 179, 73, 124, 178, 97, 137, 53, 79, 32, 116, 181, 89, 146, 79, 109, 169, 186,
+        93, 152, 176, 179, 94, 120, 183, 112, 55, 135, 94, 66, 143, 175, 240, 87, 180, 154, 91, 91,
+        91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+        91, 91, 91, 91, 91, 91, 106, 133, 122, 205, 128, 184, 272, 85, 131, 138, 181, 396, 179, 146,
+        93, 144, 71, 191, 69, 138, 156, 69, 141, 90, 226, 226, 83, 144, 194, 98, 185, 180, 131, 83,
+        64, 207, 91, 101, 99, 193, 169, 195, 171, 235, 93, 133, 207, 310, 244, 210, 94, 120, 169, 87,
+        115, 141, 93, 133, 175, 61, 132, 80, 128, 59, 77, 98, 77, 162, 77, 119, 176, 77, 78, 121,
+        61, 124, 61, 174, 59, 90, 195, 87, 150, 110, 144, 92, 145, 166, 126, 112, 73, 42, 81, 137,
+        54, 114, 71, 215, 79, 127, 136, 141, 141, 198, 257, 107, 152, 78, 127, 129, 150, 166, 166, 131,
+        99, 159, 39, 83, 68, 87, 79, 136, 203, 122, 188, 116, 116, 116, 116, 116, 116, 116, 116, 78,
+        99, 168, 74, 115, 132, 201, 124, 118, 153, 153, 82, 141, 99, 142, 124, 229, 150, 194, 100, 174,
+        85, 219, 139, 139, 139, 139, 189, 65, 126, 162, 234, 163, 170, 120, 86, 95, 162, 90, 132, 176,
+        135, 179, 179, 203, 128, 93, 155, 168, 132, 176, 228, 309, 309, 285, 246, 212, 228, 228, 170, 210,
+        115, 46, 330, 218, 110, 143, 188, 86, 105, 151, 102, 139, 186, 58, 94, 140, 73, 119, 74, 100,
+        64, 95, 156, 109, 185, 71, 109, 195, 286, 83, 83, 83, 180, 180, 175, 98, 83, 190, 172, 67,
+        114, 92, 153, 153, 105, 105, 143, 143, 143, 80, 102, 105, 194, 187, 103, 82, 133, 94, 90, 132,
+        154, 213, 133, 142, 77, 91, 199, 84, 125, 193, 117, 78, 144, 118, 191, 151, 202, 76, 133, 136,
+        116, 170, 179, 105, 158, 171, 205, 181, 190, 184, 163, 172, 217, 156, 219, 205, 222, 146, 150, 195,
+        275, 254, 150, 159, 219, 219, 219, 219, 219, 270, 212, 151, 211, 215, 213, 210, 225, 187, 258, 162,
+        210, 198, 210, 166, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238,
+        238, 238, 99, 190
+    }},
+    // baseSta
+    {{
+        128, 155, 190, 118, 151, 186, 127, 153, 188, 128, 137, 155, 120, 128, 163, 120, 160, 195, 102, 102,
+        146, 181, 120, 163, 111, 155, 111, 155, 155, 137, 137, 181, 181, 146, 172, 207, 130, 156, 191, 172,
+        216, 116, 116, 177, 177, 251, 295, 120, 181, 128, 155, 181, 111, 155, 155, 172, 67, 67, 111, 111,
+        120, 120, 163, 163, 137, 190, 120, 163, 146, 207, 120, 163, 207, 93, 120, 146, 172, 190, 207, 137,
+        163, 190, 120, 190, 120, 120, 146, 146, 190, 190, 137, 163, 207, 216, 93, 137, 141, 111, 155, 163,
+        207, 190, 190, 233, 233, 102, 137, 102, 128, 155, 111, 155, 198, 102, 146, 120, 155, 155, 216, 216,
+        137, 155, 155, 137, 137, 207, 120, 163, 190, 233, 487, 163, 233, 102, 146, 128, 190, 102, 155, 120,
+        172, 163, 163, 163, 163, 181, 85, 216, 277, 134, 146, 277, 163, 163, 163, 111, 172, 102, 155, 190,
+        330, 207, 207, 207, 121, 156, 209, 214, 225, 128, 155, 190, 118, 151, 186, 137, 163, 198, 111, 198,
+        155, 225, 120, 146, 120, 172, 198, 181, 268, 85, 137, 207, 111, 146, 120, 163, 146, 172, 207, 181,
+        172, 225, 172, 207, 111, 146, 181, 146, 102, 181, 163, 146, 216, 163, 216, 155, 216, 155, 134, 134,
+        134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134,
+        134, 134, 134, 134, 134, 134, 382, 172, 137, 181, 225, 163, 181, 155, 207, 163, 172, 85, 190, 146,
+        155, 207, 120, 137, 137, 225, 146, 111, 181, 128, 163, 163, 128, 181, 181, 207, 207, 198, 177, 146,
+        111, 137, 128, 128, 128, 216, 496, 207, 251, 225, 137, 172, 225, 235, 214, 225, 120, 137, 172, 128,
+        155, 190, 137, 172, 225, 111, 172, 116, 186, 128, 137, 155, 137, 155, 120, 155, 190, 120, 172, 207,
+        120, 155, 120, 155, 99, 116, 169, 120, 172, 155, 155, 155, 190, 284, 104, 156, 1, 162, 197, 232,
+        176, 302, 137, 102, 137, 172, 137, 137, 137, 155, 172, 102, 155, 120, 172, 155, 155, 163, 163, 137,
+        172, 225, 128, 172, 277, 347, 155, 172, 172, 155, 190, 155, 155, 155, 155, 155, 155, 155, 155, 128,
+        137, 190, 137, 172, 128, 181, 177, 177, 207, 207, 137, 242, 125, 160, 120, 155, 165, 200, 128, 181,
+        85, 216, 172, 172, 172, 172, 155, 127, 162, 85, 120, 223, 181, 163, 216, 137, 190, 172, 207, 242,
+        111, 146, 146, 225, 125, 128, 163, 216, 120, 155, 190, 190, 190, 190, 190, 190, 205, 205, 213, 225,
+        137, 137, 137, 137, 146, 181, 216, 127, 162, 183, 142, 162, 197, 120, 146, 198, 153, 188, 114, 184,
+        128, 155, 190, 120, 155, 167, 219, 102, 155, 120, 120, 120, 155, 155, 155, 172, 102, 172, 155, 146,
+        198, 128, 172, 172, 183, 183, 244, 244, 181, 207, 312, 146, 163, 155, 225, 135, 174, 128, 160, 230,
+        149, 167, 137, 85, 225, 183, 137, 151, 169, 239, 286, 120, 172, 169, 239, 120, 172, 134, 195, 179,
+        135, 170, 128, 155, 207, 172, 172, 242, 251, 225, 181, 181, 198, 200, 163, 163, 181, 242, 198, 169,
+        155, 128, 172, 137, 137, 137, 137, 137, 137, 181, 190, 181, 205, 189, 209, 221, 284, 284, 260, 190,
+        225, 172, 225, 225, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237,
+        237, 237, 130, 264
+    }},
+    // type
+    {{
+        PokemonType::GRASS, PokemonType::GRASS, PokemonType::GRASS, PokemonType::FIRE, PokemonType::FIRE,
+        PokemonType::FIRE, PokemonType::WATER, PokemonType::WATER, PokemonType::WATER, PokemonType::BUG,
+        PokemonType::BUG, PokemonType::BUG, PokemonType::BUG, PokemonType::BUG, PokemonType::BUG,
+        PokemonType::NORMAL, PokemonType::NORMAL, PokemonType::NORMAL, PokemonType::NORMAL, PokemonType::DARK,
+        PokemonType::NORMAL, PokemonType::DARK, PokemonType::NORMAL, PokemonType::NORMAL, PokemonType::POISON,
+        PokemonType::POISON, PokemonType::ELECTRIC, PokemonType::ELECTRIC, PokemonType::ELECTRIC, PokemonType::GROUND,
+        PokemonType::ICE, PokemonType::GROUND, PokemonType::ICE, PokemonType::POISON, PokemonType::POISON,
+        PokemonType::POISON, PokemonType::POISON, PokemonType::POISON, PokemonType::POISON, PokemonType::FAIRY,
+        PokemonType::FAIRY, PokemonType::FIRE, PokemonType::ICE, PokemonType::FIRE, PokemonType::ICE,
+        PokemonType::NORMAL, PokemonType::NORMAL, PokemonType::POISON, PokemonType::POISON, PokemonType::GRASS,
+        PokemonType::GRASS, PokemonType::GRASS, PokemonType::BUG, PokemonType::BUG, PokemonType::BUG,
+        PokemonType::BUG, PokemonType::GROUND, PokemonType::GROUND, PokemonType::GROUND, PokemonType::GROUND,
+        PokemonType::NORMAL, PokemonType::DARK, PokemonType::NORMAL, PokemonType::DARK, PokemonType::WATER,
+        PokemonType::WATER, PokemonType::FIGHTING, PokemonType::FIGHTING, PokemonType::FIRE, PokemonType::FIRE,
+        PokemonType::WATER, PokemonType::WATER, PokemonType::WATER, PokemonType::PSYCHIC, PokemonType::PSYCHIC,
+        PokemonType::PSYCHIC, PokemonType::FIGHTING, PokemonType::FIGHTING, PokemonType::FIGHTING, PokemonType::GRASS,
+        PokemonType::GRASS, PokemonType::GRASS, PokemonType::WATER, PokemonType::WATER, PokemonType::ROCK,
+        PokemonType::ROCK, PokemonType::ROCK, PokemonType::ROCK, PokemonType::ROCK, PokemonType::ROCK,
+        PokemonType::FIRE, PokemonType::FIRE, PokemonType::WATER, PokemonType::WATER, PokemonType::ELECTRIC,
+        PokemonType::ELECTRIC, PokemonType::NORMAL, PokemonType::NORMAL, PokemonType::NORMAL, PokemonType::WATER,
+        PokemonType::WATER, PokemonType::POISON, PokemonType::POISON, PokemonType::POISON, PokemonType::POISON,
+        PokemonType::WATER, PokemonType::WATER, PokemonType::GHOST, PokemonType::GHOST, PokemonType::GHOST,
+        PokemonType::ROCK, PokemonType::PSYCHIC, PokemonType::PSYCHIC, PokemonType::WATER, PokemonType::WATER,
+        PokemonType::ELECTRIC, PokemonType::ELECTRIC, PokemonType::GRASS, PokemonType::GRASS, PokemonType::GRASS,
+        PokemonType::GROUND, PokemonType::GROUND, PokemonType::FIRE, PokemonType::FIGHTING, PokemonType::FIGHTING,
+        PokemonType::NORMAL, PokemonType::POISON, PokemonType::POISON, PokemonType::GROUND, PokemonType::GROUND,
+        PokemonType::NORMAL, PokemonType::GRASS, PokemonType::NORMAL, PokemonType::WATER, PokemonType::WATER,
+        PokemonType::WATER, PokemonType::WATER, PokemonType::WATER, PokemonType::WATER, PokemonType::PSYCHIC,
+        PokemonType::BUG, PokemonType::ICE, PokemonType::ELECTRIC, PokemonType::FIRE, PokemonType::BUG,
+        PokemonType::NORMAL, PokemonType::WATER, PokemonType::WATER, PokemonType::WATER, PokemonType::NORMAL,
+        PokemonType::NORMAL, PokemonType::WATER, PokemonType::ELECTRIC, PokemonType::FIRE, PokemonType::NORMAL,
+        PokemonType::ROCK, PokemonType::ROCK, PokemonType::ROCK, PokemonType::ROCK, PokemonType::ROCK,
+        PokemonType::NORMAL, PokemonType::ICE, PokemonType::ELECTRIC, PokemonType::FIRE, PokemonType::DRAGON,
+        PokemonType::DRAGON, PokemonType::DRAGON, PokemonType::PSYCHIC, PokemonType::PSYCHIC, PokemonType::GRASS,
+        PokemonType::GRASS, PokemonType::GRASS, PokemonType::FIRE, PokemonType::FIRE, PokemonType::FIRE,
+        PokemonType::WATER, PokemonType::WATER, PokemonType::WATER, PokemonType::NORMAL, PokemonType::NORMAL,
+        PokemonType::NORMAL, PokemonType::NORMAL, PokemonType::BUG, PokemonType::BUG, PokemonType::BUG,
+        PokemonType::BUG, PokemonType::POISON, PokemonType::WATER, PokemonType::WATER, PokemonType::ELECTRIC,
+        PokemonType::FAIRY, PokemonType::NORMAL, PokemonType::FAIRY, PokemonType::FAIRY, PokemonType::PSYCHIC,
+        PokemonType::PSYCHIC, PokemonType::ELECTRIC, PokemonType::ELECTRIC, PokemonType::ELECTRIC, PokemonType::GRASS,
+        PokemonType::WATER, PokemonType::WATER, PokemonType::ROCK, PokemonType::WATER, PokemonType::GRASS,
+        PokemonType::GRASS, PokemonType::GRASS, PokemonType::NORMAL, PokemonType::GRASS, PokemonType::GRASS,
+        PokemonType::BUG, PokemonType::WATER, PokemonType::WATER, PokemonType::PSYCHIC, PokemonType::DARK,
+        PokemonType::DARK, PokemonType::WATER, PokemonType::GHOST, PokemonType::PSYCHIC, PokemonType::PSYCHIC,
+        PokemonType::PSYCHIC, PokemonType::PSYCHIC, PokemonType::PSYCHIC, PokemonType::PSYCHIC, PokemonType::PSYCHIC,
+        PokemonType::PSYCHIC, PokemonType::PSYCHIC, PokemonType::PSYCHIC, PokemonType::PSYCHIC, PokemonType::PSYCHIC,
+        PokemonType::PSYCHIC, PokemonType::PSYCHIC, PokemonType::PSYCHIC, PokemonType::PSYCHIC, PokemonType::PSYCHIC,
+        PokemonType::PSYCHIC, PokemonType::PSYCHIC, PokemonType::PSYCHIC, PokemonType::PSYCHIC, PokemonType::PSYCHIC,
+        PokemonType::PSYCHIC, PokemonType::PSYCHIC, PokemonType::PSYCHIC, PokemonType::PSYCHIC, PokemonType::PSYCHIC,
+        PokemonType::PSYCHIC, PokemonType::PSYCHIC, PokemonType::NORMAL, PokemonType::BUG, PokemonType::BUG,
+        PokemonType::NORMAL, PokemonType::GROUND, PokemonType::STEEL, PokemonType::FAIRY, PokemonType::FAIRY,
+        PokemonType::WATER, PokemonType::BUG, PokemonType::BUG, PokemonType::BUG, PokemonType::DARK,
+        PokemonType::NORMAL, PokemonType::NORMAL, PokemonType::FIRE, PokemonType::FIRE, PokemonType::ICE,
+        PokemonType::ICE, PokemonType::WATER, PokemonType::WATER, PokemonType::WATER, PokemonType::ICE,
+        PokemonType::WATER, PokemonType::STEEL, PokemonType::DARK, PokemonType::DARK, PokemonType::WATER,
+        PokemonType::GROUND, PokemonType::GROUND, PokemonType::NORMAL, PokemonType::NORMAL, PokemonType::NORMAL,
+        PokemonType::FIGHTING, PokemonType::FIGHTING, PokemonType::ICE, PokemonType::ELECTRIC, PokemonType::FIRE,
+        PokemonType::NORMAL, PokemonType::NORMAL, PokemonType::ELECTRIC, PokemonType::FIRE, PokemonType::WATER,
+        PokemonType::ROCK, PokemonType::ROCK, PokemonType::ROCK, PokemonType::PSYCHIC, PokemonType::FIRE,
+        PokemonType::PSYCHIC, PokemonType::GRASS, PokemonType::GRASS, PokemonType::GRASS, PokemonType::FIRE,
+        PokemonType::FIRE, PokemonType::FIRE, PokemonType::WATER, PokemonType::WATER, PokemonType::WATER,
+        PokemonType::DARK, PokemonType::DARK, PokemonType::NORMAL, PokemonType::NORMAL, PokemonType::BUG,
+        PokemonType::BUG, PokemonType::BUG, PokemonType::BUG, PokemonType::BUG, PokemonType::WATER,
+        PokemonType::WATER, PokemonType::WATER, PokemonType::GRASS, PokemonType::GRASS, PokemonType::GRASS,
+        PokemonType::NORMAL, PokemonType::NORMAL, PokemonType::WATER, PokemonType::WATER, PokemonType::PSYCHIC,
+        PokemonType::PSYCHIC, PokemonType::PSYCHIC, PokemonType::BUG, PokemonType::BUG, PokemonType::GRASS,
+        PokemonType::GRASS, PokemonType::NORMAL, PokemonType::NORMAL, PokemonType::NORMAL, PokemonType::BUG,
+        PokemonType::BUG, PokemonType::BUG, PokemonType::NORMAL, PokemonType::NORMAL, PokemonType::NORMAL,
+        PokemonType::FIGHTING, PokemonType::FIGHTING, PokemonType::NORMAL, PokemonType::ROCK, PokemonType::NORMAL,
+        PokemonType::NORMAL, PokemonType::DARK, PokemonType::STEEL, PokemonType::STEEL, PokemonType::STEEL,
+        PokemonType::STEEL, PokemonType::FIGHTING, PokemonType::FIGHTING, PokemonType::ELECTRIC, PokemonType::ELECTRIC,
+        PokemonType::ELECTRIC, PokemonType::ELECTRIC, PokemonType::BUG, PokemonType::BUG, PokemonType::GRASS,
+        PokemonType::POISON, PokemonType::POISON, PokemonType::WATER, PokemonType::WATER, PokemonType::WATER,
+        PokemonType::WATER, PokemonType::FIRE, PokemonType::FIRE, PokemonType::FIRE, PokemonType::PSYCHIC,
+        PokemonType::PSYCHIC, PokemonType::NORMAL, PokemonType::NORMAL, PokemonType::NORMAL, PokemonType::NORMAL,
+        PokemonType::NORMAL, PokemonType::NORMAL, PokemonType::NORMAL, PokemonType::NORMAL, PokemonType::GROUND,
+        PokemonType::GROUND, PokemonType::GROUND, PokemonType::GRASS, PokemonType::GRASS, PokemonType::NORMAL,
+        PokemonType::DRAGON, PokemonType::NORMAL, PokemonType::POISON, PokemonType::ROCK, PokemonType::ROCK,
+        PokemonType::WATER, PokemonType::WATER, PokemonType::WATER, PokemonType::WATER, PokemonType::GROUND,
+        PokemonType::GROUND, PokemonType::ROCK, PokemonType::ROCK, PokemonType::ROCK, PokemonType::ROCK,
+        PokemonType::WATER, PokemonType::WATER, PokemonType::NORMAL, PokemonType::FIRE, PokemonType::WATER,
+        PokemonType::ICE, PokemonType::NORMAL, PokemonType::GHOST, PokemonType::GHOST, PokemonType::GHOST,
+        PokemonType::GHOST, PokemonType::GRASS, PokemonType::PSYCHIC, PokemonType::DARK, PokemonType::PSYCHIC,
+        PokemonType::ICE, PokemonType::ICE, PokemonType::ICE, PokemonType::ICE, PokemonType::ICE,
+        PokemonType::WATER, PokemonType::WATER, PokemonType::WATER, PokemonType::WATER, PokemonType::WATER,
+        PokemonType::DRAGON, PokemonType::DRAGON, PokemonType::DRAGON, PokemonType::STEEL, PokemonType::STEEL,
+        PokemonType::STEEL, PokemonType::ROCK, PokemonType::ICE, PokemonType::STEEL, PokemonType::DRAGON,
+        PokemonType::DRAGON, PokemonType::WATER, PokemonType::GROUND, PokemonType::DRAGON, PokemonType::STEEL,
+        PokemonType::PSYCHIC, PokemonType::PSYCHIC, PokemonType::PSYCHIC, PokemonType::PSYCHIC, PokemonType::GRASS,
+        PokemonType::GRASS, PokemonType::GRASS, PokemonType::FIRE, PokemonType::FIRE, PokemonType::FIRE,
+        PokemonType::WATER, PokemonType::WATER, PokemonType::WATER, PokemonType::NORMAL, PokemonType::NORMAL,
+        PokemonType::NORMAL, PokemonType::NORMAL, PokemonType::NORMAL, PokemonType::BUG, PokemonType::BUG,
+        PokemonType::ELECTRIC, PokemonType::ELECTRIC, PokemonType::ELECTRIC, PokemonType::GRASS, PokemonType::GRASS,
+        PokemonType::ROCK, PokemonType::ROCK, PokemonType::ROCK, PokemonType::ROCK, PokemonType::BUG,
+        PokemonType::BUG, PokemonType::BUG, PokemonType::BUG, PokemonType::BUG, PokemonType::BUG,
+        PokemonType::BUG, PokemonType::BUG, PokemonType::BUG, PokemonType::ELECTRIC, PokemonType::WATER,
+        PokemonType::WATER, PokemonType::GRASS, PokemonType::GRASS, PokemonType::GRASS, PokemonType::WATER,
+        PokemonType::WATER, PokemonType::WATER, PokemonType::WATER, PokemonType::NORMAL, PokemonType::GHOST,
+        PokemonType::GHOST, PokemonType::NORMAL, PokemonType::NORMAL, PokemonType::GHOST, PokemonType::DARK,
+        PokemonType::NORMAL, PokemonType::NORMAL, PokemonType::PSYCHIC, PokemonType::POISON, PokemonType::POISON,
+        PokemonType::STEEL, PokemonType::STEEL, PokemonType::ROCK, PokemonType::PSYCHIC, PokemonType::NORMAL,
+        PokemonType::NORMAL, PokemonType::GHOST, PokemonType::DRAGON, PokemonType::DRAGON, PokemonType::DRAGON,
+        PokemonType::NORMAL, PokemonType::FIGHTING, PokemonType::FIGHTING, PokemonType::GROUND, PokemonType::GROUND,
+        PokemonType::POISON, PokemonType::POISON, PokemonType::POISON, PokemonType::POISON, PokemonType::GRASS,
+        PokemonType::WATER, PokemonType::WATER, PokemonType::WATER, PokemonType::GRASS, PokemonType::GRASS,
+        PokemonType::DARK, PokemonType::ELECTRIC, PokemonType::NORMAL, PokemonType::GROUND, PokemonType::GRASS,
+        PokemonType::ELECTRIC, PokemonType::FIRE, PokemonType::FAIRY, PokemonType::BUG, PokemonType::GRASS,
+        PokemonType::ICE, PokemonType::GROUND, PokemonType::ICE, PokemonType::NORMAL, PokemonType::PSYCHIC,
+        PokemonType::ROCK, PokemonType::GHOST, PokemonType::ICE, PokemonType::ELECTRIC, PokemonType::ELECTRIC,
+        PokemonType::ELECTRIC, PokemonType::ELECTRIC, PokemonType::ELECTRIC, PokemonType::ELECTRIC, PokemonType::PSYCHIC,
+        PokemonType::PSYCHIC, PokemonType::PSYCHIC, PokemonType::STEEL, PokemonType::WATER, PokemonType::FIRE,
+        PokemonType::NORMAL, PokemonType::GHOST, PokemonType::GHOST, PokemonType::PSYCHIC, PokemonType::WATER,
+        PokemonType::WATER, PokemonType::DARK, PokemonType::GRASS, PokemonType::GRASS, PokemonType::NORMAL,
+        PokemonType::FIGHTING, PokemonType::FLYING, PokemonType::POISON, PokemonType::GROUND, PokemonType::ROCK,
+        PokemonType::BUG, PokemonType::GHOST, PokemonType::STEEL, PokemonType::FIRE, PokemonType::WATER,
+        PokemonType::GRASS, PokemonType::ELECTRIC, PokemonType::PSYCHIC, PokemonType::ICE, PokemonType::DRAGON,
+        PokemonType::DARK, PokemonType::FAIRY, PokemonType::STEEL, PokemonType::STEEL
+    }},
+    // type2
+    {{
+        PokemonType::POISON, PokemonType::POISON, PokemonType::POISON, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::FLYING, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::FLYING, PokemonType::POISON, PokemonType::POISON, PokemonType::POISON,
+        PokemonType::FLYING, PokemonType::FLYING, PokemonType::FLYING, PokemonType::NONE, PokemonType::NORMAL,
+        PokemonType::NONE, PokemonType::NORMAL, PokemonType::FLYING, PokemonType::FLYING, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::PSYCHIC, PokemonType::NONE,
+        PokemonType::STEEL, PokemonType::NONE, PokemonType::STEEL, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::GROUND, PokemonType::NONE, PokemonType::NONE, PokemonType::GROUND, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::FAIRY,
+        PokemonType::FAIRY, PokemonType::FAIRY, PokemonType::FLYING, PokemonType::FLYING, PokemonType::POISON,
+        PokemonType::POISON, PokemonType::POISON, PokemonType::GRASS, PokemonType::GRASS, PokemonType::POISON,
+        PokemonType::POISON, PokemonType::NONE, PokemonType::STEEL, PokemonType::NONE, PokemonType::STEEL,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::FIGHTING, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::POISON,
+        PokemonType::POISON, PokemonType::POISON, PokemonType::POISON, PokemonType::POISON, PokemonType::GROUND,
+        PokemonType::ELECTRIC, PokemonType::GROUND, PokemonType::ELECTRIC, PokemonType::GROUND, PokemonType::ELECTRIC,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::PSYCHIC, PokemonType::PSYCHIC, PokemonType::STEEL,
+        PokemonType::STEEL, PokemonType::FLYING, PokemonType::FLYING, PokemonType::FLYING, PokemonType::NONE,
+        PokemonType::ICE, PokemonType::NONE, PokemonType::DARK, PokemonType::NONE, PokemonType::DARK,
+        PokemonType::NONE, PokemonType::ICE, PokemonType::POISON, PokemonType::POISON, PokemonType::POISON,
+        PokemonType::GROUND, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::PSYCHIC, PokemonType::PSYCHIC, PokemonType::DRAGON,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::GHOST, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::ROCK, PokemonType::ROCK,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::PSYCHIC, PokemonType::FAIRY,
+        PokemonType::FLYING, PokemonType::PSYCHIC, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::FLYING, PokemonType::ICE, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::WATER, PokemonType::WATER, PokemonType::WATER, PokemonType::WATER, PokemonType::FLYING,
+        PokemonType::NONE, PokemonType::FLYING, PokemonType::FLYING, PokemonType::FLYING, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::FLYING, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::FLYING, PokemonType::FLYING, PokemonType::FLYING, PokemonType::FLYING, PokemonType::POISON,
+        PokemonType::POISON, PokemonType::FLYING, PokemonType::ELECTRIC, PokemonType::ELECTRIC, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::FAIRY, PokemonType::NONE, PokemonType::FLYING, PokemonType::FLYING,
+        PokemonType::FLYING, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::FAIRY, PokemonType::FAIRY, PokemonType::NONE, PokemonType::NONE, PokemonType::FLYING,
+        PokemonType::FLYING, PokemonType::FLYING, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::FLYING, PokemonType::GROUND, PokemonType::GROUND, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::FLYING, PokemonType::PSYCHIC, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::PSYCHIC, PokemonType::NONE, PokemonType::STEEL,
+        PokemonType::NONE, PokemonType::FLYING, PokemonType::GROUND, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::POISON, PokemonType::STEEL, PokemonType::ROCK, PokemonType::FIGHTING, PokemonType::ICE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::ROCK, PokemonType::GROUND,
+        PokemonType::GROUND, PokemonType::ROCK, PokemonType::NONE, PokemonType::NONE, PokemonType::FLYING,
+        PokemonType::FLYING, PokemonType::FLYING, PokemonType::FIRE, PokemonType::FIRE, PokemonType::DRAGON,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::PSYCHIC, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::GROUND, PokemonType::GROUND, PokemonType::DARK, PokemonType::FLYING, PokemonType::FLYING,
+        PokemonType::GRASS, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::FIGHTING, PokemonType::FIGHTING, PokemonType::NONE, PokemonType::GROUND, PokemonType::GROUND,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::FLYING, PokemonType::NONE, PokemonType::POISON, PokemonType::GRASS,
+        PokemonType::GRASS, PokemonType::GRASS, PokemonType::NONE, PokemonType::DARK, PokemonType::DARK,
+        PokemonType::FLYING, PokemonType::FLYING, PokemonType::FLYING, PokemonType::FLYING, PokemonType::FAIRY,
+        PokemonType::FAIRY, PokemonType::FAIRY, PokemonType::WATER, PokemonType::FLYING, PokemonType::NONE,
+        PokemonType::FIGHTING, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::GROUND,
+        PokemonType::FLYING, PokemonType::GHOST, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::FAIRY, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::GHOST, PokemonType::FAIRY, PokemonType::ROCK, PokemonType::ROCK,
+        PokemonType::ROCK, PokemonType::PSYCHIC, PokemonType::PSYCHIC, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::POISON,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::DARK, PokemonType::DARK, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::GROUND, PokemonType::GROUND, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::DRAGON, PokemonType::DRAGON, PokemonType::NONE, PokemonType::DARK, PokemonType::FLYING,
+        PokemonType::FLYING, PokemonType::NONE, PokemonType::NONE, PokemonType::PSYCHIC, PokemonType::PSYCHIC,
+        PokemonType::GROUND, PokemonType::GROUND, PokemonType::NONE, PokemonType::DARK, PokemonType::PSYCHIC,
+        PokemonType::PSYCHIC, PokemonType::GRASS, PokemonType::GRASS, PokemonType::BUG, PokemonType::BUG,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::FLYING, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::WATER, PokemonType::WATER, PokemonType::WATER,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::ROCK, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::FLYING, PokemonType::PSYCHIC, PokemonType::PSYCHIC,
+        PokemonType::PSYCHIC, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::PSYCHIC,
+        PokemonType::PSYCHIC, PokemonType::NONE, PokemonType::NONE, PokemonType::FLYING, PokemonType::PSYCHIC,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::GROUND, PokemonType::NONE, PokemonType::FIGHTING, PokemonType::FIGHTING,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::STEEL, PokemonType::FLYING, PokemonType::FLYING,
+        PokemonType::FLYING, PokemonType::NONE, PokemonType::WATER, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::POISON, PokemonType::POISON,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::STEEL, PokemonType::STEEL, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::GRASS, PokemonType::GROUND, PokemonType::STEEL,
+        PokemonType::FLYING, PokemonType::FLYING, PokemonType::FLYING, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::GROUND, PokemonType::GROUND, PokemonType::NONE, PokemonType::FLYING,
+        PokemonType::FLYING, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::FLYING,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::DARK, PokemonType::DARK,
+        PokemonType::PSYCHIC, PokemonType::PSYCHIC, PokemonType::NONE, PokemonType::FAIRY, PokemonType::NONE,
+        PokemonType::FLYING, PokemonType::DARK, PokemonType::GROUND, PokemonType::GROUND, PokemonType::GROUND,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::STEEL, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::BUG, PokemonType::DARK, PokemonType::FIGHTING, PokemonType::FIGHTING, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::FLYING, PokemonType::ICE, PokemonType::ICE,
+        PokemonType::ICE, PokemonType::STEEL, PokemonType::NONE, PokemonType::ROCK, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::FLYING, PokemonType::FLYING, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::FLYING, PokemonType::GROUND, PokemonType::NONE, PokemonType::FIGHTING,
+        PokemonType::STEEL, PokemonType::NONE, PokemonType::GHOST, PokemonType::GHOST, PokemonType::ICE,
+        PokemonType::FLYING, PokemonType::GRASS, PokemonType::WATER, PokemonType::FIRE, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::DRAGON, PokemonType::DRAGON, PokemonType::STEEL,
+        PokemonType::NONE, PokemonType::DRAGON, PokemonType::DRAGON, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::FLYING, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE,
+        PokemonType::NONE, PokemonType::NONE, PokemonType::NONE, PokemonType::NONE
+    }},
+    // rarity
+    {{
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::LEGENDARY, PokemonRarity::LEGENDARY, PokemonRarity::LEGENDARY, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::LEGENDARY, PokemonRarity::MYTHIC, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::LEGENDARY, PokemonRarity::LEGENDARY, PokemonRarity::LEGENDARY,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::LEGENDARY, PokemonRarity::LEGENDARY,
+        PokemonRarity::MYTHIC, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::LEGENDARY, PokemonRarity::LEGENDARY, PokemonRarity::LEGENDARY, PokemonRarity::LEGENDARY,
+        PokemonRarity::LEGENDARY, PokemonRarity::LEGENDARY, PokemonRarity::LEGENDARY, PokemonRarity::LEGENDARY, PokemonRarity::MYTHIC,
+        PokemonRarity::MYTHIC, PokemonRarity::MYTHIC, PokemonRarity::MYTHIC, PokemonRarity::MYTHIC, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL,
+        PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::NORMAL, PokemonRarity::LEGENDARY,
+        PokemonRarity::LEGENDARY, PokemonRarity::LEGENDARY, PokemonRarity::LEGENDARY, PokemonRarity::LEGENDARY, PokemonRarity::LEGENDARY,
+        PokemonRarity::LEGENDARY, PokemonRarity::LEGENDARY, PokemonRarity::LEGENDARY, PokemonRarity::LEGENDARY, PokemonRarity::MYTHIC,
+        PokemonRarity::MYTHIC, PokemonRarity::MYTHIC, PokemonRarity::MYTHIC, PokemonRarity::MYTHIC, PokemonRarity::MYTHIC,
+        PokemonRarity::MYTHIC, PokemonRarity::MYTHIC, PokemonRarity::MYTHIC, PokemonRarity::MYTHIC, PokemonRarity::MYTHIC,
+        PokemonRarity::MYTHIC, PokemonRarity::MYTHIC, PokemonRarity::MYTHIC, PokemonRarity::MYTHIC, PokemonRarity::MYTHIC,
+        PokemonRarity::MYTHIC, PokemonRarity::MYTHIC, PokemonRarity::MYTHIC, PokemonRarity::MYTHIC, PokemonRarity::MYTHIC,
+        PokemonRarity::MYTHIC, PokemonRarity::MYTHIC, PokemonRarity::MYTHIC, PokemonRarity::MYTHIC
+    }},
+    // buddyDistance
+    {{
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 3, 3, 1, 1, 1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1,
+        1, 3, 3, 3, 3, 1, 1, 1, 1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 1, 1, 1, 1, 1, 1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 5, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 5, 5, 3, 3, 3, 3, 3, 5, 3, 3, 3, 3, 3, 3, 3, 3, 5,
+        5, 5, 5, 5, 5, 3, 1, 1, 5, 3, 5, 5, 5, 5, 3, 5, 5, 5, 5, 5,
+        5, 20, 20, 20, 5, 5, 5, 20, 20, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 3, 3, 1, 1, 1, 3, 3, 3, 3, 5, 5, 5, 3,
+        3, 3, 5, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 5, 5, 3, 3, 3, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 3, 3, 5, 5, 3, 5, 5, 3, 3, 3, 5, 3, 3, 3,
+        3, 3, 1, 1, 3, 3, 3, 1, 1, 5, 5, 5, 3, 3, 3, 3, 3, 3, 3, 3,
+        5, 5, 5, 5, 5, 5, 5, 20, 20, 20, 5, 5, 5, 20, 20, 20, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 3, 3, 3, 3, 3,
+        1, 1, 3, 3, 5, 5, 5, 1, 1, 3, 3, 5, 5, 5, 5, 5, 5, 1, 1, 1,
+        3, 3, 3, 3, 3, 3, 5, 5, 1, 1, 1, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        1, 1, 3, 3, 1, 1, 3, 3, 3, 1, 1, 3, 3, 3, 3, 3, 3, 3, 3, 5,
+        5, 5, 3, 3, 1, 1, 3, 3, 3, 3, 1, 1, 3, 3, 3, 3, 3, 3, 3, 3,
+        5, 5, 5, 5, 5, 5, 5, 3, 3, 3, 3, 5, 5, 5, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 5, 3, 5, 5, 5, 5, 5, 5, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1, 1, 1, 1, 1, 1, 1,
+        5, 5, 5, 3, 3, 5, 5, 5, 5, 5, 5, 5, 1, 1, 1, 1, 3, 3, 5, 3,
+        3, 3, 3, 3, 5, 5, 5, 5, 3, 5, 5, 3, 3, 3, 3, 3, 3, 5, 3, 3,
+        3, 3, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 1, 1, 5, 5, 3, 3, 5,
+        3, 3, 5, 3, 3, 3, 3, 3, 3, 3, 5, 5, 3, 3, 5, 5, 5, 3, 3, 5,
+        3, 3, 3, 5, 5, 5, 5, 5, 5, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20
+    }},
+    // statGroup
+    {{
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 18,
+        20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+        40, 41, 41, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59,
+        60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+        80, 81, 82, 83, 84, 84, 86, 86, 88, 88, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99,
+        100, 101, 101, 103, 103, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+        120, 121, 121, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139,
+        140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+        160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179,
+        180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199,
+        200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 218,
+        218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218,
+        218, 218, 218, 218, 218, 218, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259,
+        260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279,
+        280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299,
+        300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319,
+        320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339,
+        340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359,
+        360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 371, 371, 371, 371, 371, 371, 371, 379,
+        380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399,
+        400, 401, 402, 402, 402, 402, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419,
+        420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439,
+        440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459,
+        460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 469, 469, 472, 472, 474, 475, 476, 477, 478, 479,
+        480, 481, 482, 482, 484, 484, 486, 486, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499,
+        500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519,
+        520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539,
+        540, 541, 542, 543, 544, 544, 544, 544, 544, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559,
+        560, 561, 562, 563, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564,
+        564, 564, 582, 583
+    }},
+    // baseId
+    {{
+        65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 0, 0,
+        65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+        65535, 1, 1, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+        65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+        65535, 65535, 65535, 65535, 2, 2, 3, 3, 4, 4, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+        65535, 5, 5, 6, 6, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+        65535, 7, 7, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+        65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+        65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+        65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+        65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 8, 8,
+        8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+        8, 8, 8, 8, 8, 8, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+        65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+        65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+        65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+        65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+        65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+        65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 9, 9, 9, 9, 9, 9, 9, 9, 65535,
+        65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+        65535, 65535, 10, 10, 10, 10, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+        65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+        65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+        65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 11, 11, 11, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+        65535, 65535, 12, 12, 13, 13, 14, 14, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+        65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+        65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+        65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+        65535, 65535, 65535, 65535, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 65535, 65535
+    }},
+    // numberOffset
+    {{
+        0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+        20, 22, 23, 24, 25, 26, 27, 29, 31, 33, 34, 35, 36, 37, 38, 39, 40, 41, 43, 45,
+        46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 58, 60, 62, 64, 65, 66, 67, 68, 69,
+        70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 86, 88, 90, 91, 92,
+        93, 94, 95, 96, 97, 98, 99, 100, 101, 103, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114,
+        115, 116, 117, 118, 120, 121, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136,
+        137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156,
+        157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176,
+        177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196,
+        197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216,
+        217, 218, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263,
+        264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283,
+        284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303,
+        304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323,
+        324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343,
+        344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363,
+        364, 365, 366, 367, 368, 369, 370, 371, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390,
+        391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 406, 407, 408, 409, 410, 411, 412, 413,
+        414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433,
+        434, 435, 436, 437, 438, 439, 440, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456,
+        457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 472, 475, 476, 477, 478, 479, 480,
+        481, 482, 484, 486, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503,
+        504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523,
+        524, 525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543,
+        549, 550, 551, 552, 553, 554, 555, 556, 558, 559, 560, 561, 562, 564, 582, 582, 582, 582, 582, 582,
+        582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582,
+        582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582,
+        582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582,
+        582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582,
+        582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582,
+        582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582,
+        582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582,
+        582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582,
+        582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582,
+        582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582,
+        582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582,
+        582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582,
+        582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582,
+        582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582,
+        582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582,
+        582, 582, 582, 582, 582, 582, 582, 582, 582, 583, 584
+    }}
+};
+
+const std::array<std::string_view, 16> PokemonBaseIds{{
+    "RATTATA", "VULPIX", "GEODUDE", "GRAVELER", "GOLEM", "GRIMER", "MUK", "MAROWAK",
+    "UNOWN", "SPINDA", "CASTFORM", "BURMY", "CHERRIM", "SHELLOS", "GASTRODON", "ARCEUS"
+}};
+
+const std::array<Move, 197> Moves{{
+    {"ACID", PokemonType::POISON, 9, 6, 800, 1, 8, 5, 400, 600},
+    {"AERIAL_ACE", PokemonType::FLYING, 55, 55, 2400, 0, -33, -45, 1900, 2200},
+    {"AIR_CUTTER", PokemonType::FLYING, 60, 60, 2700, 0, -50, -55, 1800, 2500},
+    {"AIR_SLASH", PokemonType::FLYING, 14, 9, 1200, 2, 10, 9, 1000, 1200},
+    {"ANCIENT_POWER", PokemonType::ROCK, 70, 70, 3500, 0, -33, -45, 2850, 3100},
+    {"AQUA_JET", PokemonType::WATER, 45, 45, 2600, 0, -33, -45, 1700, 2100},
+    {"AQUA_TAIL", PokemonType::WATER, 50, 50, 1900, 0, -33, -35, 1200, 1650},
+    {"ASTONISH", PokemonType::GHOST, 8, 5, 1100, 2, 14, 9, 700, 1050},
+    {"AURORA_BEAM", PokemonType::ICE, 80, 80, 3550, 0, -50, -60, 3350, 3550},
+    {"AVALANCHE", PokemonType::ICE, 90, 90, 2700, 0, -50, -45, 1700, 2100},
+    {"BITE", PokemonType::DARK, 6, 4, 500, 0, 4, 2, 300, 500},
+    {"BLAST_BURN", PokemonType::FIRE, 110, 110, 3300, 0, -50, -50, 2750, 3200},
+    {"BLIZZARD", PokemonType::ICE, 130, 130, 3100, 0, -100, -75, 1500, 2900},
+    {"BODY_SLAM", PokemonType::NORMAL, 50, 60, 1900, 0, -33, -35, 1200, 1700},
+    {"BONE_CLUB", PokemonType::GROUND, 40, 40, 1600, 0, -33, -35, 1000, 1400},
+    {"BRAVE_BIRD", PokemonType::FLYING, 90, 90, 2000, 0, -100, -55, 1000, 1600},
+    {"BRICK_BREAK", PokemonType::FIGHTING, 40, 40, 1600, 0, -33, -35, 800, 1400},
+    {"BRINE", PokemonType::WATER, 60, 60, 2300, 0, -50, -50, 1500, 2100},
+    {"BUBBLE", PokemonType::WATER, 12, 8, 1200, 2, 14, 11, 750, 1000},
+    {"BUBBLE_BEAM", PokemonType::WATER, 45, 45, 1900, 0, -33, -40, 1450, 1700},
+    {"BUG_BITE", PokemonType::BUG, 5, 3, 500, 0, 6, 3, 250, 450},
+    {"BUG_BUZZ", PokemonType::BUG, 90, 90, 3700, 0, -50, -60, 2000, 3100},
+    {"BULLDOZE", PokemonType::GROUND, 80, 80, 3500, 0, -50, -60, 2600, 3100},
+    {"BULLET_PUNCH", PokemonType::STEEL, 9, 6, 900, 1, 10, 7, 300, 900},
+    {"BULLET_SEED", PokemonType::GRASS, 8, 5, 1100, 2, 14, 11, 850, 1050},
+    {"CHARGE_BEAM", PokemonType::ELECTRIC, 8, 5, 1100, 2, 15, 11, 850, 1050},
+    {"CLOSE_COMBAT", PokemonType::FIGHTING, 100, 100, 2300, 0, -100, -60, 1000, 2300},
+    {"CONFUSION", PokemonType::PSYCHIC, 20, 16, 1600, 3, 15, 12, 600, 1600},
+    {"COUNTER", PokemonType::FIGHTING, 12, 8, 900, 1, 8, 7, 700, 900},
+    {"CROSS_CHOP", PokemonType::FIGHTING, 50, 50, 1500, 0, -50, -35, 800, 1200},
+    {"CROSS_POISON", PokemonType::POISON, 40, 40, 1500, 0, -33, -35, 900, 1300},
+    {"CRUNCH", PokemonType::DARK, 70, 70, 3200, 0, -33, -45, 1300, 3000},
+    {"CUT", PokemonType::NORMAL, 5, 3, 500, 0, 5, 2, 300, 500},
+    {"DARK_PULSE", PokemonType::DARK, 80, 80, 3000, 0, -50, -50, 1400, 2300},
+    {"DAZZLING_GLEAM", PokemonType::FAIRY, 100, 110, 3500, 0, -50, -70, 2100, 3300},
+    {"DIG", PokemonType::GROUND, 100, 100, 4700, 0, -50, -80, 2800, 4500},
+    {"DISARMING_VOICE", PokemonType::FAIRY, 70, 70, 3900, 0, -33, -45, 3200, 3500},
+    {"DISCHARGE", PokemonType::ELECTRIC, 65, 65, 2500, 0, -33, -45, 1700, 2100},
+    {"DOOM_DESIRE", PokemonType::STEEL, 80, 80, 1700, 0, -50, -35, 1400, 1600},
+    {"DRACO_METEOR", PokemonType::DRAGON, 150, 150, 3600, 0, -100, -75, 3000, 3500},
+    {"DRAGON_BREATH", PokemonType::DRAGON, 6, 4, 500, 0, 4, 3, 300, 500},
+    {"DRAGON_CLAW", PokemonType::DRAGON, 50, 50, 1700, 0, -33, -35, 1100, 1300},
+    {"DRAGON_PULSE", PokemonType::DRAGON, 90, 90, 3600, 0, -50, -60, 2150, 3300},
+    {"DRAGON_TAIL", PokemonType::DRAGON, 15, 9, 1100, 2, 9, 10, 850, 1050},
+    {"DRAINING_KISS", PokemonType::FAIRY, 60, 60, 2600, 0, -50, -55, 1000, 1300},
+    {"DRILL_PECK", PokemonType::FLYING, 60, 60, 2300, 0, -33, -40, 1700, 2100},
+    {"DRILL_RUN", PokemonType::GROUND, 80, 80, 2800, 0, -50, -55, 1700, 2600},
+    {"DYNAMIC_PUNCH", PokemonType::FIGHTING, 90, 90, 2700, 0, -50, -50, 1200, 2700},
+    {"EARTHQUAKE", PokemonType::GROUND, 120, 120, 3600, 0, -100, -65, 2700, 3500},
+    {"EMBER", PokemonType::FIRE, 10, 6, 1000, 1, 10, 6, 600, 800},
+    {"ENERGY_BALL", PokemonType::GRASS, 90, 90, 3900, 0, -50, -60, 3000, 3800},
+    {"EXTRASENSORY", PokemonType::PSYCHIC, 12, 8, 1100, 2, 12, 10, 850, 1050},
+    {"FEINT_ATTACK", PokemonType::DARK, 10, 6, 900, 1, 9, 6, 750, 900},
+    {"FIRE_BLAST", PokemonType::FIRE, 140, 140, 4200, 0, -100, -80, 3100, 3900},
+    {"FIRE_FANG", PokemonType::FIRE, 11, 7, 900, 1, 8, 5, 640, 840},
+    {"FIRE_PUNCH", PokemonType::FIRE, 55, 55, 2200, 0, -33, -40, 1500, 1900},
+    {"FIRE_SPIN", PokemonType::FIRE, 14, 9, 1100, 2, 10, 10, 850, 1050},
+    {"FLAMETHROWER", PokemonType::FIRE, 70, 90, 2200, 0, -50, -55, 1500, 1700},
+    {"FLAME_BURST", PokemonType::FIRE, 70, 70, 2600, 0, -50, -55, 1000, 2100},
+    {"FLAME_CHARGE", PokemonType::FIRE, 70, 70, 3800, 0, -33, -50, 2900, 3450},
+    {"FLAME_WHEEL", PokemonType::FIRE, 60, 60, 2700, 0, -50, -55, 2100, 2400},
+    {"FLASH_CANNON", PokemonType::STEEL, 100, 110, 2700, 0, -100, -65, 1600, 2500},
+    {"FOCUS_BLAST", PokemonType::FIGHTING, 140, 150, 3500, 0, -100, -75, 3000, 3500},
+    {"FOUL_PLAY", PokemonType::DARK, 70, 70, 2000, 0, -50, -45, 1700, 1900},
+    {"FRENZY_PLANT", PokemonType::GRASS, 100, 100, 2600, 0, -50, -45, 2145, 2550},
+    {"FROST_BREATH", PokemonType::ICE, 10, 7, 900, 1, 8, 5, 450, 750},
+    {"FURY_CUTTER", PokemonType::BUG, 3, 2, 400, 0, 6, 4, 100, 400},
+    {"FUTURESIGHT", PokemonType::PSYCHIC, 120, 120, 2700, 0, -100, -65, 1400, 2700},
+    {"GIGA_DRAIN", PokemonType::GRASS, 50, 50, 3900, 0, -100, -80, 1200, 2200},
+    {"GRASS_KNOT", PokemonType::GRASS, 90, 90, 2600, 0, -50, -50, 1700, 2600},
+    {"GUNK_SHOT", PokemonType::POISON, 130, 130, 3100, 0, -100, -75, 1700, 2700},
+    {"GYRO_BALL", PokemonType::STEEL, 80, 80, 3300, 0, -50, -60, 3000, 3300},
+    {"HEART_STAMP", PokemonType::PSYCHIC, 40, 40, 1900, 0, -33, -40, 1100, 1600},
+    {"HEAT_WAVE", PokemonType::FIRE, 95, 95, 3000, 0, -100, -75, 1700, 2800},
+    {"HEAVY_SLAM", PokemonType::STEEL, 70, 70, 2100, 0, -50, -50, 1500, 1900},
+    {"HEX", PokemonType::GHOST, 10, 6, 1200, 2, 15, 11, 1000, 1200},
+    {"HIDDEN_POWER", PokemonType::NORMAL, 15, 9, 1500, 2, 15, 8, 1100, 1400},
+    {"HORN_ATTACK", PokemonType::NORMAL, 40, 40, 1850, 0, -33, -35, 800, 1650},
+    {"HURRICANE", PokemonType::FLYING, 110, 110, 2700, 0, -100, -65, 1200, 2400},
+    {"HYDRO_CANNON", PokemonType::WATER, 90, 90, 1900, 0, -50, -40, 500, 1600},
+    {"HYDRO_PUMP", PokemonType::WATER, 130, 130, 3300, 0, -100, -75, 900, 3000},
+    {"HYDRO_PUMP_BLASTOISE", PokemonType::WATER, 90, 90, 4500, 0, -100, -80, 2200, 4300},
+    {"HYPER_BEAM", PokemonType::NORMAL, 150, 150, 3800, 0, -100, -80, 3300, 3600},
+    {"HYPER_FANG", PokemonType::NORMAL, 80, 80, 2500, 0, -50, -50, 1500, 2000},
+    {"ICE_BEAM", PokemonType::ICE, 90, 90, 3300, 0, -50, -55, 1300, 2800},
+    {"ICE_PUNCH", PokemonType::ICE, 50, 55, 1900, 0, -33, -40, 1300, 1600},
+    {"ICE_SHARD", PokemonType::ICE, 12, 9, 1200, 2, 12, 10, 600, 900},
+    {"ICY_WIND", PokemonType::ICE, 60, 60, 3300, 0, -33, -45, 2000, 2800},
+    {"INFESTATION", PokemonType::BUG, 10, 6, 1100, 2, 14, 11, 850, 1050},
+    {"IRON_HEAD", PokemonType::STEEL, 60, 70, 1900, 0, -50, -50, 1300, 1700},
+    {"IRON_TAIL", PokemonType::STEEL, 15, 9, 1100, 2, 7, 6, 850, 1050},
+    {"KARATE_CHOP", PokemonType::FIGHTING, 8, 5, 800, 1, 10, 7, 600, 800},
+    {"LAST_RESORT", PokemonType::NORMAL, 90, 90, 2900, 0, -50, -55, 2700, 2850},
+    {"LEAF_BLADE", PokemonType::GRASS, 70, 70, 2400, 0, -33, -35, 1250, 2200},
+    {"LICK", PokemonType::GHOST, 5, 3, 500, 0, 6, 3, 200, 500},
+    {"LOW_KICK", PokemonType::FIGHTING, 6, 4, 600, 1, 6, 5, 300, 600},
+    {"LOW_SWEEP", PokemonType::FIGHTING, 40, 40, 1900, 0, -33, -40, 1300, 1650},
+    {"MAGNET_BOMB", PokemonType::STEEL, 70, 70, 2800, 0, -33, -45, 2200, 2600},
+    {"MEGAHORN", PokemonType::BUG, 90, 90, 2200, 0, -100, -55, 1700, 1900},
+    {"MEGA_DRAIN", PokemonType::GRASS, 25, 25, 2600, 0, -50, -55, 950, 2000},
+    {"METAL_CLAW", PokemonType::STEEL, 8, 5, 700, 1, 7, 6, 430, 630},
+    {"METEOR_MASH", PokemonType::STEEL, 100, 100, 2600, 0, -50, -50, 2300, 2500},
+    {"MIRROR_COAT", PokemonType::PSYCHIC, 60, 60, 2600, 0, -50, -55, 2300, 2500},
+    {"MOONBLAST", PokemonType::FAIRY, 130, 130, 3900, 0, -100, -70, 2200, 3700},
+    {"MUD_BOMB", PokemonType::GROUND, 55, 55, 2300, 0, -33, -40, 1700, 2100},
+    {"MUD_SHOT", PokemonType::GROUND, 5, 3, 600, 1, 7, 9, 350, 550},
+    {"MUD_SLAP", PokemonType::GROUND, 15, 9, 1400, 2, 12, 8, 1150, 1350},
+    {"NIGHT_SHADE", PokemonType::GHOST, 60, 60, 2600, 0, -50, -55, 2100, 2500},
+    {"NIGHT_SLASH", PokemonType::DARK, 50, 50, 2200, 0, -33, -40, 1300, 2000},
+    {"OMINOUS_WIND", PokemonType::GHOST, 50, 50, 2300, 0, -33, -40, 1850, 2100},
+    {"ORIGIN_PULSE", PokemonType::WATER, 130, 130, 1700, 0, -100, -60, 1400, 1600},
+    {"OUTRAGE", PokemonType::DRAGON, 110, 110, 3900, 0, -50, -60, 2500, 3700},
+    {"OVERHEAT", PokemonType::FIRE, 160, 150, 4000, 0, -100, -80, 2600, 3800},
+    {"PARABOLIC_CHARGE", PokemonType::ELECTRIC, 25, 25, 2800, 0, -50, -55, 1200, 2400},
+    {"PECK", PokemonType::FLYING, 10, 6, 1000, 1, 10, 5, 450, 900},
+    {"PETAL_BLIZZARD", PokemonType::GRASS, 110, 110, 2600, 0, -100, -65, 1700, 2300},
+    {"PLAY_ROUGH", PokemonType::FAIRY, 90, 90, 2900, 0, -50, -60, 1300, 2700},
+    {"POISON_FANG", PokemonType::POISON, 35, 40, 1700, 0, -33, -35, 900, 1400},
+    {"POISON_JAB", PokemonType::POISON, 10, 6, 800, 1, 7, 7, 200, 800},
+    {"POISON_STING", PokemonType::POISON, 5, 3, 600, 1, 7, 6, 375, 575},
+    {"POUND", PokemonType::NORMAL, 7, 5, 600, 1, 6, 4, 340, 540},
+    {"POWDER_SNOW", PokemonType::ICE, 6, 4, 1000, 1, 15, 8, 850, 1000},
+    {"POWER_GEM", PokemonType::ROCK, 80, 80, 2900, 0, -50, -60, 1950, 2700},
+    {"POWER_WHIP", PokemonType::GRASS, 90, 90, 2600, 0, -50, -50, 1250, 2350},
+    {"PRECIPICE_BLADES", PokemonType::GROUND, 130, 130, 1700, 0, -100, -60, 1400, 1600},
+    {"PRESENT", PokemonType::NORMAL, 5, 3, 1300, 2, 20, 12, 1100, 1300},
+    {"PSYBEAM", PokemonType::PSYCHIC, 70, 70, 3200, 0, -50, -60, 1300, 2700},
+    {"PSYCHIC", PokemonType::PSYCHIC, 100, 100, 2800, 0, -100, -70, 1300, 2600},
+    {"PSYCHO_BOOST", PokemonType::PSYCHIC, 70, 70, 4000, 0, -50, -40, 3500, 4000},
+    {"PSYCHO_CUT", PokemonType::PSYCHIC, 5, 3, 600, 1, 8, 9, 370, 570},
+    {"PSYSHOCK", PokemonType::PSYCHIC, 65, 70, 2700, 0, -33, -45, 2000, 2600},
+    {"PSYSTRIKE", PokemonType::PSYCHIC, 100, 100, 4400, 0, -50, -55, 3000, 4200},
+    {"QUICK_ATTACK", PokemonType::NORMAL, 8, 5, 800, 1, 10, 7, 250, 550},
+    {"RAZOR_LEAF", PokemonType::GRASS, 13, 11, 1000, 1, 7, 4, 600, 850},
+    {"REST", PokemonType::NORMAL, 50, 50, 1900, 0, -33, -35, 1500, 1700},
+    {"ROCK_BLAST", PokemonType::ROCK, 50, 50, 2100, 0, -33, -40, 1600, 2000},
+    {"ROCK_SLIDE", PokemonType::ROCK, 80, 80, 2700, 0, -50, -45, 1500, 2600},
+    {"ROCK_SMASH", PokemonType::FIGHTING, 15, 9, 1300, 2, 10, 7, 550, 800},
+    {"ROCK_THROW", PokemonType::ROCK, 12, 8, 900, 1, 7, 5, 500, 800},
+    {"ROCK_TOMB", PokemonType::ROCK, 70, 70, 3200, 0, -50, -60, 2250, 3000},
+    {"SAND_TOMB", PokemonType::GROUND, 80, 80, 4000, 0, -50, -60, 1700, 4000},
+    {"SCALD", PokemonType::WATER, 80, 80, 3700, 0, -50, -60, 1300, 3400},
+    {"SCALD_BLASTOISE", PokemonType::WATER, 50, 50, 4700, 0, -100, -80, 2500, 4600},
+    {"SCRATCH", PokemonType::NORMAL, 6, 4, 500, 0, 4, 2, 300, 500},
+    {"SEED_BOMB", PokemonType::GRASS, 55, 55, 2100, 0, -33, -40, 1200, 1900},
+    {"SHADOW_BALL", PokemonType::GHOST, 100, 100, 3000, 0, -50, -55, 2400, 2800},
+    {"SHADOW_CLAW", PokemonType::GHOST, 9, 6, 700, 1, 6, 8, 250, 500},
+    {"SHADOW_PUNCH", PokemonType::GHOST, 40, 40, 1700, 0, -33, -35, 1300, 1500},
+    {"SHADOW_SNEAK", PokemonType::GHOST, 50, 50, 2900, 0, -33, -45, 2200, 2700},
+    {"SIGNAL_BEAM", PokemonType::BUG, 75, 75, 2900, 0, -50, -55, 1800, 2600},
+    {"SILVER_WIND", PokemonType::BUG, 70, 70, 3700, 0, -33, -45, 1700, 3500},
+    {"SKY_ATTACK", PokemonType::FLYING, 80, 80, 2000, 0, -50, -45, 1500, 1700},
+    {"SLUDGE", PokemonType::POISON, 50, 50, 2100, 0, -33, -40, 1200, 1550},
+    {"SLUDGE_BOMB", PokemonType::POISON, 80, 80, 2300, 0, -50, -50, 1100, 2100},
+    {"SLUDGE_WAVE", PokemonType::POISON, 110, 110, 3200, 0, -100, -65, 2000, 3000},
+    {"SMACK_DOWN", PokemonType::ROCK, 16, 12, 1200, 2, 8, 8, 800, 1100},
+    {"SNARL", PokemonType::DARK, 12, 8, 1100, 2, 12, 10, 850, 1050},
+    {"SOLAR_BEAM", PokemonType::GRASS, 180, 150, 4900, 0, -100, -80, 2700, 4700},
+    {"SPARK", PokemonType::ELECTRIC, 6, 4, 700, 1, 9, 8, 300, 700},
+    {"SPLASH", PokemonType::WATER, 0, 0, 1730, 3, 20, 12, 1030, 1230},
+    {"STEEL_WING", PokemonType::STEEL, 11, 7, 800, 1, 6, 5, 500, 800},
+    {"STOMP", PokemonType::NORMAL, 55, 55, 1700, 0, -50, -40, 1100, 1500},
+    {"STONE_EDGE", PokemonType::ROCK, 100, 100, 2300, 0, -100, -55, 700, 2100},
+    {"STRUGGLE", PokemonType::NORMAL, 35, 35, 2200, 0, 0, -100, 1200, 2000},
+    {"STRUGGLE_BUG", PokemonType::BUG, 15, 9, 1500, 2, 15, 8, 1200, 1500},
+    {"SUBMISSION", PokemonType::FIGHTING, 60, 60, 2200, 0, -50, -50, 1800, 2000},
+    {"SUCKER_PUNCH", PokemonType::DARK, 7, 5, 700, 1, 8, 7, 300, 700},
+    {"SURF", PokemonType::WATER, 65, 65, 1700, 0, -50, -40, 1400, 1600},
+    {"SWIFT", PokemonType::NORMAL, 60, 60, 2800, 0, -50, -55, 2000, 2600},
+    {"TACKLE", PokemonType::NORMAL, 5, 3, 500, 0, 5, 2, 300, 500},
+    {"TAKE_DOWN", PokemonType::NORMAL, 8, 5, 1200, 2, 10, 8, 950, 1100},
+    {"THUNDER", PokemonType::ELECTRIC, 100, 100, 2400, 0, -100, -60, 1200, 2200},
+    {"THUNDERBOLT", PokemonType::ELECTRIC, 80, 90, 2500, 0, -50, -55, 1800, 2300},
+    {"THUNDER_PUNCH", PokemonType::ELECTRIC, 45, 55, 1800, 0, -33, -40, 1700, 1550},
+    {"THUNDER_SHOCK", PokemonType::ELECTRIC, 5, 3, 600, 1, 8, 9, 300, 600},
+    {"TRANSFORM", PokemonType::NORMAL, 0, 0, 2230, 2, 0, 0, 300, 700},
+    {"TWISTER", PokemonType::DRAGON, 45, 45, 2800, 0, -33, -45, 950, 2600},
+    {"VICE_GRIP", PokemonType::NORMAL, 35, 40, 1900, 0, -33, -40, 1100, 1500},
+    {"VINE_WHIP", PokemonType::GRASS, 7, 5, 600, 1, 6, 8, 350, 600},
+    {"VOLT_SWITCH", PokemonType::ELECTRIC, 20, 12, 2300, 4, 25, 10, 1800, 2100},
+    {"WATERFALL", PokemonType::WATER, 16, 12, 1200, 2, 8, 8, 950, 1100},
+    {"WATER_GUN", PokemonType::WATER, 5, 3, 500, 0, 5, 3, 300, 500},
+    {"WATER_GUN_FAST_BLASTOISE", PokemonType::WATER, 10, 6, 1000, 1, 6, 4, 300, 500},
+    {"WATER_PULSE", PokemonType::WATER, 70, 70, 3200, 0, -50, -60, 2200, 2900},
+    {"WEATHER_BALL_FIRE", PokemonType::FIRE, 60, 60, 1600, 0, -33, -35, 1350, 1600},
+    {"WEATHER_BALL_ICE", PokemonType::ICE, 60, 60, 1600, 0, -33, -35, 1350, 1600},
+    {"WEATHER_BALL_ROCK", PokemonType::ROCK, 60, 60, 1600, 0, -33, -35, 1350, 1600},
+    {"WEATHER_BALL_WATER", PokemonType::WATER, 60, 60, 1600, 0, -33, -35, 1350, 1600},
+    {"WILD_CHARGE", PokemonType::ELECTRIC, 90, 90, 2600, 0, -50, -50, 1700, 2100},
+    {"WING_ATTACK", PokemonType::FLYING, 8, 5, 800, 1, 9, 7, 550, 750},
+    {"WRAP", PokemonType::NORMAL, 60, 60, 2900, 0, -33, -45, 2050, 2700},
+    {"WRAP_GREEN", PokemonType::NORMAL, 25, 25, 2900, 0, -33, -45, 2050, 2700},
+    {"WRAP_PINK", PokemonType::NORMAL, 25, 25, 2900, 0, -33, -45, 2050, 2700},
+    {"X_SCISSOR", PokemonType::BUG, 45, 45, 1600, 0, -33, -35, 1200, 1400},
+    {"YAWN", PokemonType::NORMAL, 0, 0, 1700, 3, 15, 12, 1400, 1600},
+    {"ZAP_CANNON", PokemonType::ELECTRIC, 140, 150, 3700, 0, -100, -80, 3000, 3500},
+    {"ZEN_HEADBUTT", PokemonType::PSYCHIC, 12, 8, 1100, 2, 10, 6, 850, 1050},
+}};
+
+const std::array<MoveId, 2256> PokemonMoves{{
+    MoveId::VINE_WHIP, MoveId::TACKLE, MoveId::SLUDGE_BOMB, MoveId::SEED_BOMB, MoveId::POWER_WHIP,
+    MoveId::RAZOR_LEAF, MoveId::VINE_WHIP, MoveId::SLUDGE_BOMB, MoveId::SOLAR_BEAM, MoveId::POWER_WHIP,
+    MoveId::SLUDGE_BOMB, MoveId::PETAL_BLIZZARD, MoveId::SOLAR_BEAM, MoveId::EMBER, MoveId::SCRATCH,
+    MoveId::FLAME_CHARGE, MoveId::FLAME_BURST, MoveId::FLAMETHROWER, MoveId::EMBER, MoveId::FIRE_FANG,
+    MoveId::FIRE_PUNCH, MoveId::FLAME_BURST, MoveId::FLAMETHROWER, MoveId::FIRE_SPIN, MoveId::AIR_SLASH,
+    MoveId::FIRE_BLAST, MoveId::DRAGON_CLAW, MoveId::OVERHEAT, MoveId::BUBBLE, MoveId::TACKLE,
+    MoveId::AQUA_JET, MoveId::AQUA_TAIL, MoveId::WATER_PULSE, MoveId::WATER_GUN, MoveId::BITE,
+    MoveId::AQUA_JET, MoveId::ICE_BEAM, MoveId::HYDRO_PUMP, MoveId::FLASH_CANNON, MoveId::ICE_BEAM,
+    MoveId::HYDRO_PUMP, MoveId::BUG_BITE, MoveId::TACKLE, MoveId::STRUGGLE, MoveId::STRUGGLE_BUG,
+    MoveId::CONFUSION, MoveId::BUG_BUZZ, MoveId::PSYCHIC, MoveId::SIGNAL_BEAM, MoveId::BUG_BITE,
+    MoveId::POISON_STING, MoveId::INFESTATION, MoveId::POISON_JAB, MoveId::SLUDGE_BOMB, MoveId::AERIAL_ACE,
+    MoveId::X_SCISSOR, MoveId::QUICK_ATTACK, MoveId::TACKLE, MoveId::TWISTER, MoveId::AERIAL_ACE,
+    MoveId::AIR_CUTTER, MoveId::WING_ATTACK, MoveId::STEEL_WING, MoveId::AIR_SLASH, MoveId::STEEL_WING,
+    MoveId::HURRICANE, MoveId::AERIAL_ACE, MoveId::BRAVE_BIRD, MoveId::TACKLE, MoveId::QUICK_ATTACK,
+    MoveId::DIG, MoveId::HYPER_FANG, MoveId::BODY_SLAM, MoveId::CRUNCH, MoveId::HYPER_FANG,
+    MoveId::SHADOW_BALL, MoveId::BITE, MoveId::QUICK_ATTACK, MoveId::DIG, MoveId::HYPER_FANG,
+    MoveId::HYPER_BEAM, MoveId::CRUNCH, MoveId::HYPER_FANG, MoveId::HYPER_BEAM, MoveId::PECK,
+    MoveId::QUICK_ATTACK, MoveId::AERIAL_ACE, MoveId::DRILL_PECK, MoveId::SKY_ATTACK, MoveId::PECK,
+    MoveId::STEEL_WING, MoveId::AERIAL_ACE, MoveId::DRILL_RUN, MoveId::SKY_ATTACK, MoveId::POISON_STING,
+    MoveId::ACID, MoveId::WRAP, MoveId::POISON_FANG, MoveId::SLUDGE_BOMB, MoveId::BITE,
+    MoveId::ACID, MoveId::DRAGON_TAIL, MoveId::DARK_PULSE, MoveId::SLUDGE_WAVE, MoveId::GUNK_SHOT,
+    MoveId::THUNDER_SHOCK, MoveId::QUICK_ATTACK, MoveId::DISCHARGE, MoveId::THUNDERBOLT, MoveId::WILD_CHARGE,
+    MoveId::VOLT_SWITCH, MoveId::SPARK, MoveId::BRICK_BREAK, MoveId::THUNDER_PUNCH, MoveId::WILD_CHARGE,
+    MoveId::PSYCHIC, MoveId::THUNDER_PUNCH, MoveId::WILD_CHARGE, MoveId::SCRATCH, MoveId::MUD_SHOT,
+    MoveId::DIG, MoveId::ROCK_SLIDE, MoveId::SAND_TOMB, MoveId::METAL_CLAW, MoveId::POWDER_SNOW,
+    MoveId::BLIZZARD, MoveId::GYRO_BALL, MoveId::NIGHT_SLASH, MoveId::METAL_CLAW, MoveId::MUD_SHOT,
+    MoveId::EARTHQUAKE, MoveId::ROCK_TOMB, MoveId::BULLDOZE, MoveId::BLIZZARD, MoveId::GYRO_BALL,
+    MoveId::BULLDOZE, MoveId::BITE, MoveId::POISON_STING, MoveId::POISON_FANG, MoveId::BODY_SLAM,
+    MoveId::SLUDGE_BOMB, MoveId::POISON_FANG, MoveId::DIG, MoveId::SLUDGE_BOMB, MoveId::POISON_JAB,
+    MoveId::BITE, MoveId::EARTHQUAKE, MoveId::SLUDGE_WAVE, MoveId::STONE_EDGE, MoveId::PECK,
+    MoveId::POISON_STING, MoveId::HORN_ATTACK, MoveId::BODY_SLAM, MoveId::SLUDGE_BOMB, MoveId::POISON_JAB,
+    MoveId::POISON_STING, MoveId::HORN_ATTACK, MoveId::DIG, MoveId::SLUDGE_BOMB, MoveId::POISON_JAB,
+    MoveId::IRON_TAIL, MoveId::EARTHQUAKE, MoveId::SLUDGE_WAVE, MoveId::MEGAHORN, MoveId::POUND,
+    MoveId::ZEN_HEADBUTT, MoveId::DISARMING_VOICE, MoveId::BODY_SLAM, MoveId::MOONBLAST, MoveId::CHARGE_BEAM,
+    MoveId::ZEN_HEADBUTT, MoveId::DAZZLING_GLEAM, MoveId::PSYCHIC, MoveId::MOONBLAST, MoveId::METEOR_MASH,
+    MoveId::QUICK_ATTACK, MoveId::EMBER, MoveId::BODY_SLAM, MoveId::FLAMETHROWER, MoveId::FLAME_CHARGE,
+    MoveId::ZEN_HEADBUTT, MoveId::POWDER_SNOW, MoveId::DARK_PULSE, MoveId::ICE_BEAM, MoveId::BLIZZARD,
+    MoveId::FEINT_ATTACK, MoveId::FIRE_SPIN, MoveId::HEAT_WAVE, MoveId::OVERHEAT, MoveId::SOLAR_BEAM,
+    MoveId::PSYSHOCK, MoveId::FEINT_ATTACK, MoveId::POWDER_SNOW, MoveId::DAZZLING_GLEAM, MoveId::ICE_BEAM,
+    MoveId::BLIZZARD, MoveId::PSYSHOCK, MoveId::POUND, MoveId::FEINT_ATTACK, MoveId::DISARMING_VOICE,
+    MoveId::GYRO_BALL, MoveId::DAZZLING_GLEAM, MoveId::DAZZLING_GLEAM, MoveId::HYPER_BEAM, MoveId::PLAY_ROUGH,
+    MoveId::ICE_BEAM, MoveId::QUICK_ATTACK, MoveId::BITE, MoveId::POISON_FANG, MoveId::AIR_CUTTER,
+    MoveId::SWIFT, MoveId::WING_ATTACK, MoveId::BITE, MoveId::SHADOW_BALL, MoveId::AIR_CUTTER,
+    MoveId::POISON_FANG, MoveId::RAZOR_LEAF, MoveId::ACID, MoveId::SEED_BOMB, MoveId::SLUDGE_BOMB,
+    MoveId::MOONBLAST, MoveId::PETAL_BLIZZARD, MoveId::SLUDGE_BOMB, MoveId::MOONBLAST, MoveId::PETAL_BLIZZARD,
+    MoveId::SOLAR_BEAM, MoveId::MOONBLAST, MoveId::SCRATCH, MoveId::BUG_BITE, MoveId::CROSS_POISON,
+    MoveId::X_SCISSOR, MoveId::SEED_BOMB, MoveId::STRUGGLE_BUG, MoveId::FURY_CUTTER, MoveId::CROSS_POISON,
+    MoveId::X_SCISSOR, MoveId::SOLAR_BEAM, MoveId::BUG_BITE, MoveId::CONFUSION, MoveId::POISON_FANG,
+    MoveId::PSYBEAM, MoveId::SIGNAL_BEAM, MoveId::INFESTATION, MoveId::CONFUSION, MoveId::SILVER_WIND,
+    MoveId::PSYCHIC, MoveId::BUG_BUZZ, MoveId::MUD_SLAP, MoveId::SCRATCH, MoveId::DIG,
+    MoveId::MUD_BOMB, MoveId::ROCK_TOMB, MoveId::MUD_SLAP, MoveId::METAL_CLAW, MoveId::SUCKER_PUNCH,
+    MoveId::MUD_SLAP, MoveId::EARTHQUAKE, MoveId::MUD_BOMB, MoveId::STONE_EDGE, MoveId::METAL_CLAW,
+    MoveId::MUD_SLAP, MoveId::EARTHQUAKE, MoveId::MUD_BOMB, MoveId::IRON_HEAD, MoveId::SCRATCH,
+    MoveId::BITE, MoveId::NIGHT_SLASH, MoveId::DARK_PULSE, MoveId::FOUL_PLAY, MoveId::SCRATCH,
+    MoveId::FEINT_ATTACK, MoveId::FOUL_PLAY, MoveId::POWER_GEM, MoveId::PLAY_ROUGH, MoveId::FOUL_PLAY,
+    MoveId::DARK_PULSE, MoveId::PLAY_ROUGH, MoveId::WATER_GUN, MoveId::ZEN_HEADBUTT, MoveId::PSYBEAM,
+    MoveId::AQUA_TAIL, MoveId::CROSS_CHOP, MoveId::WATER_GUN, MoveId::CONFUSION, MoveId::PSYCHIC,
+    MoveId::HYDRO_PUMP, MoveId::ICE_BEAM, MoveId::KARATE_CHOP, MoveId::SCRATCH, MoveId::CROSS_CHOP,
+    MoveId::LOW_SWEEP, MoveId::BRICK_BREAK, MoveId::LOW_KICK, MoveId::COUNTER, MoveId::CLOSE_COMBAT,
+    MoveId::LOW_SWEEP, MoveId::NIGHT_SLASH, MoveId::EMBER, MoveId::BITE, MoveId::FLAME_WHEEL,
+    MoveId::BODY_SLAM, MoveId::FLAMETHROWER, MoveId::FIRE_FANG, MoveId::SNARL, MoveId::FIRE_BLAST,
+    MoveId::WILD_CHARGE, MoveId::CRUNCH, MoveId::BUBBLE, MoveId::MUD_SHOT, MoveId::BUBBLE_BEAM,
+    MoveId::MUD_BOMB, MoveId::BODY_SLAM, MoveId::WATER_PULSE, MoveId::MUD_BOMB, MoveId::BUBBLE_BEAM,
+    MoveId::BUBBLE, MoveId::ROCK_SMASH, MoveId::HYDRO_PUMP, MoveId::DYNAMIC_PUNCH, MoveId::ICE_PUNCH,
+    MoveId::ZEN_HEADBUTT, MoveId::CHARGE_BEAM, MoveId::PSYSHOCK, MoveId::SIGNAL_BEAM, MoveId::SHADOW_BALL,
+    MoveId::PSYCHO_CUT, MoveId::CONFUSION, MoveId::PSYBEAM, MoveId::DAZZLING_GLEAM, MoveId::SHADOW_BALL,
+    MoveId::FUTURESIGHT, MoveId::FOCUS_BLAST, MoveId::SHADOW_BALL, MoveId::FIRE_PUNCH, MoveId::ROCK_SMASH,
+    MoveId::KARATE_CHOP, MoveId::LOW_SWEEP, MoveId::BRICK_BREAK, MoveId::CROSS_CHOP, MoveId::LOW_KICK,
+    MoveId::KARATE_CHOP, MoveId::SUBMISSION, MoveId::BRICK_BREAK, MoveId::DYNAMIC_PUNCH, MoveId::BULLET_PUNCH,
+    MoveId::COUNTER, MoveId::HEAVY_SLAM, MoveId::DYNAMIC_PUNCH, MoveId::CLOSE_COMBAT, MoveId::ROCK_SLIDE,
+    MoveId::VINE_WHIP, MoveId::ACID, MoveId::POWER_WHIP, MoveId::SLUDGE_BOMB, MoveId::WRAP,
+    MoveId::BULLET_SEED, MoveId::ACID, MoveId::POWER_WHIP, MoveId::SLUDGE_BOMB, MoveId::SEED_BOMB,
+    MoveId::LEAF_BLADE, MoveId::SLUDGE_BOMB, MoveId::SOLAR_BEAM, MoveId::BUBBLE, MoveId::POISON_STING,
+    MoveId::BUBBLE_BEAM, MoveId::WATER_PULSE, MoveId::WRAP, MoveId::ACID, MoveId::POISON_JAB,
+    MoveId::HYDRO_PUMP, MoveId::SLUDGE_WAVE, MoveId::BLIZZARD, MoveId::ROCK_THROW, MoveId::TACKLE,
+    MoveId::ROCK_SLIDE, MoveId::ROCK_TOMB, MoveId::DIG, MoveId::ROCK_THROW, MoveId::VOLT_SWITCH,
+    MoveId::ROCK_SLIDE, MoveId::ROCK_TOMB, MoveId::THUNDERBOLT, MoveId::ROCK_THROW, MoveId::MUD_SLAP,
+    MoveId::DIG, MoveId::STONE_EDGE, MoveId::ROCK_BLAST, MoveId::THUNDERBOLT, MoveId::STONE_EDGE,
+    MoveId::ROCK_BLAST, MoveId::STONE_EDGE, MoveId::ROCK_BLAST, MoveId::EARTHQUAKE, MoveId::STONE_EDGE,
+    MoveId::ROCK_BLAST, MoveId::WILD_CHARGE, MoveId::TACKLE, MoveId::EMBER, MoveId::FLAME_CHARGE,
+    MoveId::FLAME_WHEEL, MoveId::STOMP, MoveId::LOW_KICK, MoveId::FIRE_SPIN, MoveId::FIRE_BLAST,
+    MoveId::DRILL_RUN, MoveId::HEAT_WAVE, MoveId::WATER_PULSE, MoveId::PSYSHOCK, MoveId::PSYCHIC,
+    MoveId::WATER_PULSE, MoveId::PSYCHIC, MoveId::ICE_BEAM, MoveId::SPARK, MoveId::THUNDER_SHOCK,
+    MoveId::DISCHARGE, MoveId::MAGNET_BOMB, MoveId::THUNDERBOLT, MoveId::SPARK, MoveId::CHARGE_BEAM,
+    MoveId::ZAP_CANNON, MoveId::MAGNET_BOMB, MoveId::FLASH_CANNON, MoveId::AIR_SLASH, MoveId::FURY_CUTTER,
+    MoveId::AERIAL_ACE, MoveId::AIR_CUTTER, MoveId::LEAF_BLADE, MoveId::DRILL_PECK, MoveId::AERIAL_ACE,
+    MoveId::BRAVE_BIRD, MoveId::FEINT_ATTACK, MoveId::STEEL_WING, MoveId::ICE_SHARD, MoveId::LICK,
+    MoveId::AURORA_BEAM, MoveId::ICY_WIND, MoveId::AQUA_TAIL, MoveId::FROST_BREATH, MoveId::IRON_TAIL,
+    MoveId::AURORA_BEAM, MoveId::WATER_PULSE, MoveId::BLIZZARD, MoveId::POISON_JAB, MoveId::MUD_SLAP,
+    MoveId::SLUDGE, MoveId::MUD_BOMB, MoveId::SLUDGE_BOMB, MoveId::CRUNCH, MoveId::GUNK_SHOT,
+    MoveId::SLUDGE_BOMB, MoveId::DARK_PULSE, MoveId::GUNK_SHOT, MoveId::SLUDGE_WAVE, MoveId::THUNDER_PUNCH,
+    MoveId::BITE, MoveId::POISON_JAB, MoveId::SNARL, MoveId::DARK_PULSE, MoveId::GUNK_SHOT,
+    MoveId::SLUDGE_WAVE, MoveId::ICE_SHARD, MoveId::TACKLE, MoveId::BUBBLE_BEAM, MoveId::WATER_PULSE,
+    MoveId::ICY_WIND, MoveId::FROST_BREATH, MoveId::ICE_SHARD, MoveId::AURORA_BEAM, MoveId::HYDRO_PUMP,
+    MoveId::AVALANCHE, MoveId::LICK, MoveId::ASTONISH, MoveId::NIGHT_SHADE, MoveId::DARK_PULSE,
+    MoveId::SLUDGE_BOMB, MoveId::SHADOW_CLAW, MoveId::ASTONISH, MoveId::SHADOW_PUNCH, MoveId::DARK_PULSE,
+    MoveId::SLUDGE_BOMB, MoveId::SUCKER_PUNCH, MoveId::HEX, MoveId::SHADOW_BALL, MoveId::FOCUS_BLAST,
+    MoveId::SLUDGE_BOMB, MoveId::SAND_TOMB, MoveId::STONE_EDGE, MoveId::HEAVY_SLAM, MoveId::POUND,
+    MoveId::CONFUSION, MoveId::PSYBEAM, MoveId::PSYSHOCK, MoveId::PSYCHIC, MoveId::ZEN_HEADBUTT,
+    MoveId::CONFUSION, MoveId::FUTURESIGHT, MoveId::PSYCHIC, MoveId::FOCUS_BLAST, MoveId::VICE_GRIP,
+    MoveId::BUBBLE_BEAM, MoveId::WATER_PULSE, MoveId::BUBBLE, MoveId::METAL_CLAW, MoveId::VICE_GRIP,
+    MoveId::X_SCISSOR, MoveId::WATER_PULSE, MoveId::SPARK, MoveId::TACKLE, MoveId::DISCHARGE,
+    MoveId::THUNDERBOLT, MoveId::GYRO_BALL, MoveId::SPARK, MoveId::VOLT_SWITCH, MoveId::DISCHARGE,
+    MoveId::THUNDERBOLT, MoveId::HYPER_BEAM, MoveId::CONFUSION, MoveId::BULLET_SEED, MoveId::SEED_BOMB,
+    MoveId::PSYCHIC, MoveId::ANCIENT_POWER, MoveId::BULLET_SEED, MoveId::EXTRASENSORY, MoveId::SEED_BOMB,
+    MoveId::PSYCHIC, MoveId::SOLAR_BEAM, MoveId::BULLET_SEED, MoveId::DRAGON_TAIL, MoveId::SEED_BOMB,
+    MoveId::DRAGON_PULSE, MoveId::SOLAR_BEAM, MoveId::MUD_SLAP, MoveId::ROCK_SMASH, MoveId::BONE_CLUB,
+    MoveId::DIG, MoveId::BULLDOZE, MoveId::BONE_CLUB, MoveId::DIG, MoveId::EARTHQUAKE,
+    MoveId::HEX, MoveId::ROCK_SMASH, MoveId::BONE_CLUB, MoveId::SHADOW_BALL, MoveId::FIRE_BLAST,
+    MoveId::LOW_KICK, MoveId::ROCK_SMASH, MoveId::CLOSE_COMBAT, MoveId::LOW_SWEEP, MoveId::STONE_EDGE,
+    MoveId::FIRE_PUNCH, MoveId::ICE_PUNCH, MoveId::THUNDER_PUNCH, MoveId::CLOSE_COMBAT, MoveId::LICK,
+    MoveId::ZEN_HEADBUTT, MoveId::HYPER_BEAM, MoveId::STOMP, MoveId::POWER_WHIP, MoveId::TACKLE,
+    MoveId::INFESTATION, MoveId::SLUDGE, MoveId::SLUDGE_BOMB, MoveId::DARK_PULSE, MoveId::SLUDGE_BOMB,
+    MoveId::SHADOW_BALL, MoveId::DARK_PULSE, MoveId::THUNDERBOLT, MoveId::BULLDOZE, MoveId::HORN_ATTACK,
+    MoveId::STOMP, MoveId::SURF, MoveId::EARTHQUAKE, MoveId::STONE_EDGE, MoveId::PSYCHIC,
+    MoveId::HYPER_BEAM, MoveId::DAZZLING_GLEAM, MoveId::VINE_WHIP, MoveId::INFESTATION, MoveId::GRASS_KNOT,
+    MoveId::SLUDGE_BOMB, MoveId::SOLAR_BEAM, MoveId::MUD_SLAP, MoveId::LOW_KICK, MoveId::CRUNCH,
+    MoveId::EARTHQUAKE, MoveId::OUTRAGE, MoveId::WATER_GUN, MoveId::BUBBLE, MoveId::BUBBLE_BEAM,
+    MoveId::DRAGON_PULSE, MoveId::FLASH_CANNON, MoveId::WATER_GUN, MoveId::DRAGON_BREATH, MoveId::AURORA_BEAM,
+    MoveId::DRAGON_PULSE, MoveId::HYDRO_PUMP, MoveId::PECK, MoveId::MUD_SHOT, MoveId::WATER_PULSE,
+    MoveId::HORN_ATTACK, MoveId::AQUA_TAIL, MoveId::PECK, MoveId::WATERFALL, MoveId::ICE_BEAM,
+    MoveId::WATER_PULSE, MoveId::MEGAHORN, MoveId::TACKLE, MoveId::WATER_GUN, MoveId::SWIFT,
+    MoveId::BUBBLE_BEAM, MoveId::POWER_GEM, MoveId::HIDDEN_POWER, MoveId::WATER_GUN, MoveId::HYDRO_PUMP,
+    MoveId::POWER_GEM, MoveId::PSYCHIC, MoveId::THUNDER, MoveId::ICE_BEAM, MoveId::CONFUSION,
+    MoveId::ZEN_HEADBUTT, MoveId::PSYBEAM, MoveId::PSYCHIC, MoveId::SHADOW_BALL, MoveId::FURY_CUTTER,
+    MoveId::AIR_SLASH, MoveId::NIGHT_SLASH, MoveId::X_SCISSOR, MoveId::AERIAL_ACE, MoveId::FROST_BREATH,
+    MoveId::CONFUSION, MoveId::DRAINING_KISS, MoveId::AVALANCHE, MoveId::PSYSHOCK, MoveId::FOCUS_BLAST,
+    MoveId::THUNDER_SHOCK, MoveId::LOW_KICK, MoveId::THUNDER_PUNCH, MoveId::THUNDERBOLT, MoveId::THUNDER,
+    MoveId::EMBER, MoveId::KARATE_CHOP, MoveId::FIRE_BLAST, MoveId::FIRE_PUNCH, MoveId::FLAMETHROWER,
+    MoveId::ROCK_SMASH, MoveId::BUG_BITE, MoveId::VICE_GRIP, MoveId::X_SCISSOR, MoveId::CLOSE_COMBAT,
+    MoveId::TACKLE, MoveId::ZEN_HEADBUTT, MoveId::HORN_ATTACK, MoveId::IRON_HEAD, MoveId::EARTHQUAKE,
+    MoveId::SPLASH, MoveId::BITE, MoveId::WATERFALL, MoveId::HYDRO_PUMP, MoveId::CRUNCH,
+    MoveId::OUTRAGE, MoveId::FROST_BREATH, MoveId::WATER_GUN, MoveId::HYDRO_PUMP, MoveId::SURF,
+    MoveId::BLIZZARD, MoveId::TRANSFORM, MoveId::DIG, MoveId::SWIFT, MoveId::WATER_GUN,
+    MoveId::WATER_PULSE, MoveId::HYDRO_PUMP, MoveId::AQUA_TAIL, MoveId::THUNDER_SHOCK, MoveId::VOLT_SWITCH,
+    MoveId::DISCHARGE, MoveId::THUNDERBOLT, MoveId::THUNDER, MoveId::EMBER, MoveId::FIRE_SPIN,
+    MoveId::FIRE_BLAST, MoveId::FLAMETHROWER, MoveId::OVERHEAT, MoveId::CHARGE_BEAM, MoveId::HIDDEN_POWER,
+    MoveId::SOLAR_BEAM, MoveId::HYPER_BEAM, MoveId::ZAP_CANNON, MoveId::WATER_GUN, MoveId::MUD_SHOT,
+    MoveId::ANCIENT_POWER, MoveId::BUBBLE_BEAM, MoveId::ROCK_BLAST, MoveId::MUD_SHOT, MoveId::WATER_GUN,
+    MoveId::ANCIENT_POWER, MoveId::HYDRO_PUMP, MoveId::ROCK_BLAST, MoveId::ANCIENT_POWER, MoveId::AQUA_JET,
+    MoveId::ROCK_TOMB, MoveId::MUD_SHOT, MoveId::ROCK_SMASH, MoveId::WATERFALL, MoveId::ANCIENT_POWER,
+    MoveId::WATER_PULSE, MoveId::STONE_EDGE, MoveId::STEEL_WING, MoveId::BITE, MoveId::ANCIENT_POWER,
+    MoveId::IRON_HEAD, MoveId::HYPER_BEAM, MoveId::ROCK_SLIDE, MoveId::ZEN_HEADBUTT, MoveId::LICK,
+    MoveId::HEAVY_SLAM, MoveId::HYPER_BEAM, MoveId::EARTHQUAKE, MoveId::OUTRAGE, MoveId::FROST_BREATH,
+    MoveId::ICE_BEAM, MoveId::ICY_WIND, MoveId::BLIZZARD, MoveId::CHARGE_BEAM, MoveId::ZAP_CANNON,
+    MoveId::THUNDERBOLT, MoveId::THUNDER, MoveId::FIRE_SPIN, MoveId::FIRE_BLAST, MoveId::HEAT_WAVE,
+    MoveId::OVERHEAT, MoveId::DRAGON_BREATH, MoveId::IRON_TAIL, MoveId::WRAP, MoveId::TWISTER,
+    MoveId::AQUA_TAIL, MoveId::WRAP, MoveId::AQUA_TAIL, MoveId::DRAGON_PULSE, MoveId::DRAGON_TAIL,
+    MoveId::STEEL_WING, MoveId::HURRICANE, MoveId::HYPER_BEAM, MoveId::OUTRAGE, MoveId::PSYCHIC,
+    MoveId::THUNDERBOLT, MoveId::ICE_BEAM, MoveId::FOCUS_BLAST, MoveId::FLAMETHROWER, MoveId::POUND,
+    MoveId::STEEL_WING, MoveId::CHARGE_BEAM, MoveId::SHADOW_CLAW, MoveId::VOLT_SWITCH, MoveId::STRUGGLE_BUG,
+    MoveId::FROST_BREATH, MoveId::DRAGON_TAIL, MoveId::INFESTATION, MoveId::POISON_JAB, MoveId::ROCK_SMASH,
+    MoveId::SNARL, MoveId::CUT, MoveId::WATERFALL, MoveId::PSYCHIC, MoveId::ANCIENT_POWER,
+    MoveId::DRAGON_CLAW, MoveId::PSYSHOCK, MoveId::ICE_BEAM, MoveId::BLIZZARD, MoveId::HYPER_BEAM,
+    MoveId::SOLAR_BEAM, MoveId::THUNDERBOLT, MoveId::THUNDER, MoveId::PSYCHIC, MoveId::ANCIENT_POWER,
+    MoveId::DRAGON_CLAW, MoveId::PSYSHOCK, MoveId::ICE_BEAM, MoveId::BLIZZARD, MoveId::HYPER_BEAM,
+    MoveId::SOLAR_BEAM, MoveId::THUNDERBOLT, MoveId::THUNDER, MoveId::FLAME_CHARGE, MoveId::LOW_SWEEP,
+    MoveId::OVERHEAT, MoveId::FOCUS_BLAST, MoveId::ENERGY_BALL, MoveId::STONE_EDGE, MoveId::GYRO_BALL,
+    MoveId::BULLDOZE, MoveId::ROCK_SLIDE, MoveId::GRASS_KNOT, MoveId::FLASH_CANNON, MoveId::WILD_CHARGE,
+    MoveId::DARK_PULSE, MoveId::DAZZLING_GLEAM, MoveId::SURF, MoveId::ENERGY_BALL, MoveId::GRASS_KNOT,
+    MoveId::BODY_SLAM, MoveId::RAZOR_LEAF, MoveId::TACKLE, MoveId::ENERGY_BALL, MoveId::GRASS_KNOT,
+    MoveId::ANCIENT_POWER, MoveId::PETAL_BLIZZARD, MoveId::SOLAR_BEAM, MoveId::EARTHQUAKE, MoveId::EMBER,
+    MoveId::TACKLE, MoveId::FLAME_CHARGE, MoveId::SWIFT, MoveId::FLAMETHROWER, MoveId::FLAME_CHARGE,
+    MoveId::DIG, MoveId::FLAMETHROWER, MoveId::EMBER, MoveId::SHADOW_CLAW, MoveId::FIRE_BLAST,
+    MoveId::OVERHEAT, MoveId::SOLAR_BEAM, MoveId::WATER_GUN, MoveId::SCRATCH, MoveId::CRUNCH,
+    MoveId::AQUA_JET, MoveId::WATER_PULSE, MoveId::CRUNCH, MoveId::ICE_PUNCH, MoveId::WATER_PULSE,
+    MoveId::WATERFALL, MoveId::BITE, MoveId::CRUNCH, MoveId::HYDRO_PUMP, MoveId::ICE_BEAM,
+    MoveId::SCRATCH, MoveId::QUICK_ATTACK, MoveId::DIG, MoveId::BRICK_BREAK, MoveId::GRASS_KNOT,
+    MoveId::QUICK_ATTACK, MoveId::SUCKER_PUNCH, MoveId::DIG, MoveId::BRICK_BREAK, MoveId::HYPER_BEAM,
+    MoveId::FEINT_ATTACK, MoveId::PECK, MoveId::AERIAL_ACE, MoveId::SKY_ATTACK, MoveId::NIGHT_SHADE,
+    MoveId::WING_ATTACK, MoveId::EXTRASENSORY, MoveId::PSYCHIC, MoveId::SKY_ATTACK, MoveId::NIGHT_SHADE,
+    MoveId::TACKLE, MoveId::BUG_BITE, MoveId::SILVER_WIND, MoveId::SWIFT, MoveId::AERIAL_ACE,
+    MoveId::STRUGGLE_BUG, MoveId::BUG_BITE, MoveId::BUG_BUZZ, MoveId::SILVER_WIND, MoveId::AERIAL_ACE,
+    MoveId::POISON_STING, MoveId::BUG_BITE, MoveId::NIGHT_SLASH, MoveId::SIGNAL_BEAM, MoveId::CROSS_POISON,
+    MoveId::POISON_STING, MoveId::INFESTATION, MoveId::SHADOW_SNEAK, MoveId::MEGAHORN, MoveId::CROSS_POISON,
+    MoveId::AIR_SLASH, MoveId::BITE, MoveId::SHADOW_BALL, MoveId::AIR_CUTTER, MoveId::SLUDGE_BOMB,
+    MoveId::BUBBLE, MoveId::SPARK, MoveId::WATER_PULSE, MoveId::THUNDERBOLT, MoveId::BUBBLE_BEAM,
+    MoveId::WATER_GUN, MoveId::CHARGE_BEAM, MoveId::HYDRO_PUMP, MoveId::THUNDERBOLT, MoveId::THUNDER,
+    MoveId::THUNDER_SHOCK, MoveId::THUNDERBOLT, MoveId::DISARMING_VOICE, MoveId::THUNDER_PUNCH, MoveId::GRASS_KNOT,
+    MoveId::PSYSHOCK, MoveId::SIGNAL_BEAM, MoveId::WILD_CHARGE, MoveId::SHADOW_BALL, MoveId::PSYCHIC,
+    MoveId::HIDDEN_POWER, MoveId::PECK, MoveId::ANCIENT_POWER, MoveId::PSYSHOCK, MoveId::DAZZLING_GLEAM,
+    MoveId::EXTRASENSORY, MoveId::HIDDEN_POWER, MoveId::ANCIENT_POWER, MoveId::DAZZLING_GLEAM, MoveId::AERIAL_ACE,
+    MoveId::NIGHT_SHADE, MoveId::PSYSHOCK, MoveId::DRILL_PECK, MoveId::AIR_SLASH, MoveId::FEINT_ATTACK,
+    MoveId::OMINOUS_WIND, MoveId::FUTURESIGHT, MoveId::AERIAL_ACE, MoveId::TACKLE, MoveId::THUNDER_SHOCK,
+    MoveId::BODY_SLAM, MoveId::THUNDERBOLT, MoveId::DISCHARGE, MoveId::TACKLE, MoveId::CHARGE_BEAM,
+    MoveId::POWER_GEM, MoveId::THUNDERBOLT, MoveId::DISCHARGE, MoveId::CHARGE_BEAM, MoveId::VOLT_SWITCH,
+    MoveId::ZAP_CANNON, MoveId::FOCUS_BLAST, MoveId::THUNDER, MoveId::POWER_GEM, MoveId::LEAF_BLADE,
+    MoveId::PETAL_BLIZZARD, MoveId::DAZZLING_GLEAM, MoveId::TACKLE, MoveId::BUBBLE, MoveId::BUBBLE_BEAM,
+    MoveId::AQUA_TAIL, MoveId::BODY_SLAM, MoveId::ROCK_SMASH, MoveId::BUBBLE, MoveId::PLAY_ROUGH,
+    MoveId::HYDRO_PUMP, MoveId::ICE_BEAM, MoveId::ROCK_THROW, MoveId::COUNTER, MoveId::STONE_EDGE,
+    MoveId::EARTHQUAKE, MoveId::ROCK_SLIDE, MoveId::MUD_SHOT, MoveId::BUBBLE, MoveId::HYDRO_PUMP,
+    MoveId::BLIZZARD, MoveId::SURF, MoveId::TACKLE, MoveId::BULLET_SEED, MoveId::GRASS_KNOT,
+    MoveId::DAZZLING_GLEAM, MoveId::SEED_BOMB, MoveId::GRASS_KNOT, MoveId::DAZZLING_GLEAM, MoveId::ENERGY_BALL,
+    MoveId::INFESTATION, MoveId::BULLET_SEED, MoveId::ENERGY_BALL, MoveId::DAZZLING_GLEAM, MoveId::SOLAR_BEAM,
+    MoveId::SCRATCH, MoveId::ASTONISH, MoveId::LOW_SWEEP, MoveId::SWIFT, MoveId::AERIAL_ACE,
+    MoveId::RAZOR_LEAF, MoveId::CUT, MoveId::ENERGY_BALL, MoveId::GRASS_KNOT, MoveId::SEED_BOMB,
+    MoveId::RAZOR_LEAF, MoveId::BULLET_SEED, MoveId::SOLAR_BEAM, MoveId::PETAL_BLIZZARD, MoveId::SLUDGE_BOMB,
+    MoveId::QUICK_ATTACK, MoveId::WING_ATTACK, MoveId::ANCIENT_POWER, MoveId::AERIAL_ACE, MoveId::SILVER_WIND,
+    MoveId::MUD_BOMB, MoveId::DIG, MoveId::BODY_SLAM, MoveId::SLUDGE_BOMB, MoveId::EARTHQUAKE,
+    MoveId::STONE_EDGE, MoveId::PSYBEAM, MoveId::PSYCHIC, MoveId::FUTURESIGHT, MoveId::FEINT_ATTACK,
+    MoveId::SNARL, MoveId::DARK_PULSE, MoveId::FOUL_PLAY, MoveId::PECK, MoveId::FEINT_ATTACK,
+    MoveId::DRILL_PECK, MoveId::FOUL_PLAY, MoveId::DARK_PULSE, MoveId::BLIZZARD, MoveId::PSYCHIC,
+    MoveId::FIRE_BLAST, MoveId::ASTONISH, MoveId::HEX, MoveId::SHADOW_SNEAK, MoveId::DARK_PULSE,
+    MoveId::OMINOUS_WIND, MoveId::HIDDEN_POWER, MoveId::COUNTER, MoveId::SPLASH, MoveId::MIRROR_COAT,
+    MoveId::TACKLE, MoveId::CONFUSION, MoveId::PSYCHIC, MoveId::THUNDERBOLT, MoveId::MIRROR_COAT,
+    MoveId::GYRO_BALL, MoveId::ROCK_TOMB, MoveId::SAND_TOMB, MoveId::BUG_BITE, MoveId::STRUGGLE_BUG,
+    MoveId::HEAVY_SLAM, MoveId::EARTHQUAKE, MoveId::ROCK_TOMB, MoveId::BITE, MoveId::ASTONISH,
+    MoveId::DIG, MoveId::ROCK_SLIDE, MoveId::DRILL_RUN, MoveId::FURY_CUTTER, MoveId::WING_ATTACK,
+    MoveId::DIG, MoveId::AERIAL_ACE, MoveId::NIGHT_SLASH, MoveId::IRON_TAIL, MoveId::DRAGON_TAIL,
+    MoveId::EARTHQUAKE, MoveId::HEAVY_SLAM, MoveId::CRUNCH, MoveId::TACKLE, MoveId::BITE,
+    MoveId::CRUNCH, MoveId::DAZZLING_GLEAM, MoveId::BRICK_BREAK, MoveId::BITE, MoveId::SNARL,
+    MoveId::CRUNCH, MoveId::PLAY_ROUGH, MoveId::CLOSE_COMBAT, MoveId::POISON_STING, MoveId::WATER_GUN,
+    MoveId::AQUA_TAIL, MoveId::ICE_BEAM, MoveId::SLUDGE_WAVE, MoveId::BULLET_PUNCH, MoveId::FURY_CUTTER,
+    MoveId::X_SCISSOR, MoveId::IRON_HEAD, MoveId::NIGHT_SLASH, MoveId::STRUGGLE_BUG, MoveId::ROCK_THROW,
+    MoveId::ROCK_BLAST, MoveId::STONE_EDGE, MoveId::GYRO_BALL, MoveId::COUNTER, MoveId::STRUGGLE_BUG,
+    MoveId::MEGAHORN, MoveId::CLOSE_COMBAT, MoveId::EARTHQUAKE, MoveId::ICE_SHARD, MoveId::FEINT_ATTACK,
+    MoveId::AVALANCHE, MoveId::ICE_PUNCH, MoveId::FOUL_PLAY, MoveId::SCRATCH, MoveId::LICK,
+    MoveId::CROSS_CHOP, MoveId::CRUNCH, MoveId::PLAY_ROUGH, MoveId::METAL_CLAW, MoveId::COUNTER,
+    MoveId::SHADOW_CLAW, MoveId::CLOSE_COMBAT, MoveId::HYPER_BEAM, MoveId::PLAY_ROUGH, MoveId::EMBER,
+    MoveId::ROCK_THROW, MoveId::FLAME_BURST, MoveId::FLAME_CHARGE, MoveId::ROCK_SLIDE, MoveId::HEAT_WAVE,
+    MoveId::OVERHEAT, MoveId::STONE_EDGE, MoveId::TACKLE, MoveId::POWDER_SNOW, MoveId::ICY_WIND,
+    MoveId::BODY_SLAM, MoveId::ROCK_SLIDE, MoveId::ICE_SHARD, MoveId::POWDER_SNOW, MoveId::AVALANCHE,
+    MoveId::BULLDOZE, MoveId::STONE_EDGE, MoveId::ROCK_BLAST, MoveId::POWER_GEM, MoveId::BUBBLE_BEAM,
+    MoveId::AURORA_BEAM, MoveId::WATER_PULSE, MoveId::ROCK_BLAST, MoveId::GUNK_SHOT, MoveId::WATER_PULSE,
+    MoveId::AURORA_BEAM, MoveId::PRESENT, MoveId::ICE_PUNCH, MoveId::ICY_WIND, MoveId::AERIAL_ACE,
+    MoveId::BUBBLE, MoveId::WING_ATTACK, MoveId::BULLET_SEED, MoveId::WATER_PULSE, MoveId::ICE_BEAM,
+    MoveId::AERIAL_ACE, MoveId::STEEL_WING, MoveId::AIR_SLASH, MoveId::BRAVE_BIRD, MoveId::SKY_ATTACK,
+    MoveId::FLASH_CANNON, MoveId::FEINT_ATTACK, MoveId::EMBER, MoveId::CRUNCH, MoveId::FLAMETHROWER,
+    MoveId::DARK_PULSE, MoveId::SNARL, MoveId::FIRE_FANG, MoveId::CRUNCH, MoveId::FIRE_BLAST,
+    MoveId::FOUL_PLAY, MoveId::FLAMETHROWER, MoveId::WATERFALL, MoveId::DRAGON_BREATH, MoveId::HYDRO_PUMP,
+    MoveId::BLIZZARD, MoveId::OUTRAGE, MoveId::TACKLE, MoveId::ROCK_SMASH, MoveId::BULLDOZE,
+    MoveId::ROCK_SLIDE, MoveId::BODY_SLAM, MoveId::TACKLE, MoveId::COUNTER, MoveId::MUD_SLAP,
+    MoveId::EARTHQUAKE, MoveId::HEAVY_SLAM, MoveId::PLAY_ROUGH, MoveId::HIDDEN_POWER, MoveId::CHARGE_BEAM,
+    MoveId::STOMP, MoveId::WILD_CHARGE, MoveId::MEGAHORN, MoveId::TACKLE, MoveId::ROCK_SMASH,
+    MoveId::TACKLE, MoveId::BRICK_BREAK, MoveId::ROCK_SLIDE, MoveId::LOW_SWEEP, MoveId::ROCK_SMASH,
+    MoveId::COUNTER, MoveId::CLOSE_COMBAT, MoveId::GYRO_BALL, MoveId::STONE_EDGE, MoveId::POWDER_SNOW,
+    MoveId::POUND, MoveId::ICE_BEAM, MoveId::ICE_PUNCH, MoveId::PSYSHOCK, MoveId::THUNDER_PUNCH,
+    MoveId::BRICK_BREAK, MoveId::DISCHARGE, MoveId::BRICK_BREAK, MoveId::FIRE_PUNCH, MoveId::FLAME_BURST,
+    MoveId::STOMP, MoveId::BODY_SLAM, MoveId::GYRO_BALL, MoveId::THUNDERBOLT, MoveId::ICE_BEAM,
+    MoveId::THUNDER, MoveId::THUNDERBOLT, MoveId::WILD_CHARGE, MoveId::SHADOW_BALL, MoveId::FIRE_SPIN,
+    MoveId::FIRE_FANG, MoveId::FLAMETHROWER, MoveId::FIRE_BLAST, MoveId::OVERHEAT, MoveId::IRON_HEAD,
+    MoveId::EXTRASENSORY, MoveId::SNARL, MoveId::HYDRO_PUMP, MoveId::BUBBLE_BEAM, MoveId::WATER_PULSE,
+    MoveId::ICE_BEAM, MoveId::BITE, MoveId::ROCK_SMASH, MoveId::STOMP, MoveId::CRUNCH,
+    MoveId::ANCIENT_POWER, MoveId::DIG, MoveId::CRUNCH, MoveId::ANCIENT_POWER, MoveId::BITE,
+    MoveId::IRON_TAIL, MoveId::FIRE_BLAST, MoveId::CRUNCH, MoveId::STONE_EDGE, MoveId::EXTRASENSORY,
+    MoveId::DRAGON_TAIL, MoveId::SKY_ATTACK, MoveId::HYDRO_PUMP, MoveId::FUTURESIGHT, MoveId::EXTRASENSORY,
+    MoveId::STEEL_WING, MoveId::HIDDEN_POWER, MoveId::BRAVE_BIRD, MoveId::FIRE_BLAST, MoveId::SOLAR_BEAM,
+    MoveId::CONFUSION, MoveId::CHARGE_BEAM, MoveId::HYPER_BEAM, MoveId::PSYCHIC, MoveId::DAZZLING_GLEAM,
+    MoveId::POUND, MoveId::BULLET_SEED, MoveId::ENERGY_BALL, MoveId::AERIAL_ACE, MoveId::GRASS_KNOT,
+    MoveId::QUICK_ATTACK, MoveId::BULLET_SEED, MoveId::LEAF_BLADE, MoveId::AERIAL_ACE, MoveId::GRASS_KNOT,
+    MoveId::FURY_CUTTER, MoveId::BULLET_SEED, MoveId::LEAF_BLADE, MoveId::AERIAL_ACE, MoveId::EARTHQUAKE,
+    MoveId::SCRATCH, MoveId::EMBER, MoveId::FLAME_CHARGE, MoveId::FLAMETHROWER, MoveId::ROCK_TOMB,
+    MoveId::PECK, MoveId::EMBER, MoveId::FLAME_CHARGE, MoveId::FLAMETHROWER, MoveId::ROCK_SLIDE,
+    MoveId::COUNTER, MoveId::FIRE_SPIN, MoveId::FOCUS_BLAST, MoveId::OVERHEAT, MoveId::BRAVE_BIRD,
+    MoveId::DIG, MoveId::SLUDGE, MoveId::STOMP, MoveId::MUD_BOMB, MoveId::SLUDGE,
+    MoveId::SURF, MoveId::EARTHQUAKE, MoveId::SLUDGE_WAVE, MoveId::SURF, MoveId::TACKLE,
+    MoveId::SNARL, MoveId::CRUNCH, MoveId::DIG, MoveId::POISON_FANG, MoveId::BITE,
+    MoveId::FIRE_FANG, MoveId::CRUNCH, MoveId::PLAY_ROUGH, MoveId::POISON_FANG, MoveId::DIG,
+    MoveId::GRASS_KNOT, MoveId::THUNDERBOLT, MoveId::SHADOW_CLAW, MoveId::TACKLE, MoveId::DIG,
+    MoveId::GRASS_KNOT, MoveId::THUNDER, MoveId::STRUGGLE_BUG, MoveId::INFESTATION, MoveId::SILVER_WIND,
+    MoveId::AIR_CUTTER, MoveId::BUG_BUZZ, MoveId::SILVER_WIND, MoveId::SLUDGE_BOMB, MoveId::BUG_BUZZ,
+    MoveId::WATER_GUN, MoveId::RAZOR_LEAF, MoveId::BUBBLE_BEAM, MoveId::ENERGY_BALL, MoveId::BUBBLE,
+    MoveId::RAZOR_LEAF, MoveId::BUBBLE_BEAM, MoveId::ICE_BEAM, MoveId::GRASS_KNOT, MoveId::HYDRO_PUMP,
+    MoveId::BLIZZARD, MoveId::SOLAR_BEAM, MoveId::ICE_BEAM, MoveId::BULLET_SEED, MoveId::QUICK_ATTACK,
+    MoveId::ENERGY_BALL, MoveId::GRASS_KNOT, MoveId::FOUL_PLAY, MoveId::RAZOR_LEAF, MoveId::FEINT_ATTACK,
+    MoveId::LEAF_BLADE, MoveId::GRASS_KNOT, MoveId::FOUL_PLAY, MoveId::LEAF_BLADE, MoveId::HURRICANE,
+    MoveId::FOUL_PLAY, MoveId::AERIAL_ACE, MoveId::AERIAL_ACE, MoveId::BRAVE_BIRD, MoveId::SKY_ATTACK,
+    MoveId::WATER_GUN, MoveId::QUICK_ATTACK, MoveId::WATER_PULSE, MoveId::AIR_CUTTER, MoveId::ICE_BEAM,
+    MoveId::WATER_GUN, MoveId::WING_ATTACK, MoveId::HYDRO_PUMP, MoveId::HURRICANE, MoveId::BLIZZARD,
+    MoveId::PSYSHOCK, MoveId::DISARMING_VOICE, MoveId::SHADOW_SNEAK, MoveId::PSYCHIC, MoveId::DISARMING_VOICE,
+    MoveId::SHADOW_SNEAK, MoveId::PSYCHIC, MoveId::DAZZLING_GLEAM, MoveId::SHADOW_BALL, MoveId::BUBBLE,
+    MoveId::BUG_BITE, MoveId::AQUA_JET, MoveId::BUBBLE_BEAM, MoveId::SIGNAL_BEAM, MoveId::INFESTATION,
+    MoveId::AIR_SLASH, MoveId::AIR_CUTTER, MoveId::OMINOUS_WIND, MoveId::SILVER_WIND, MoveId::SEED_BOMB,
+    MoveId::GRASS_KNOT, MoveId::ENERGY_BALL, MoveId::COUNTER, MoveId::BULLET_SEED, MoveId::DYNAMIC_PUNCH,
+    MoveId::SEED_BOMB, MoveId::SLUDGE_BOMB, MoveId::YAWN, MoveId::BODY_SLAM, MoveId::NIGHT_SLASH,
+    MoveId::BRICK_BREAK, MoveId::SCRATCH, MoveId::COUNTER, MoveId::BODY_SLAM, MoveId::BULLDOZE,
+    MoveId::BRICK_BREAK, MoveId::HYPER_BEAM, MoveId::PLAY_ROUGH, MoveId::EARTHQUAKE, MoveId::NIGHT_SLASH,
+    MoveId::BUG_BUZZ, MoveId::AERIAL_ACE, MoveId::FURY_CUTTER, MoveId::METAL_CLAW, MoveId::SHADOW_BALL,
+    MoveId::BUG_BUZZ, MoveId::AERIAL_ACE, MoveId::BUG_BITE, MoveId::SHADOW_CLAW, MoveId::SHADOW_SNEAK,
+    MoveId::AERIAL_ACE, MoveId::DIG, MoveId::POUND, MoveId::ASTONISH, MoveId::STOMP,
+    MoveId::DISARMING_VOICE, MoveId::FLAMETHROWER, MoveId::CRUNCH, MoveId::DISARMING_VOICE, MoveId::FIRE_BLAST,
+    MoveId::HEAVY_SLAM, MoveId::LOW_SWEEP, MoveId::CROSS_CHOP, MoveId::COUNTER, MoveId::BULLET_PUNCH,
+    MoveId::HEAVY_SLAM, MoveId::CLOSE_COMBAT, MoveId::DYNAMIC_PUNCH, MoveId::SPLASH, MoveId::BUBBLE,
+    MoveId::BUBBLE_BEAM, MoveId::ICE_BEAM, MoveId::BODY_SLAM, MoveId::ROCK_THROW, MoveId::SPARK,
+    MoveId::ROCK_BLAST, MoveId::ROCK_SLIDE, MoveId::THUNDERBOLT, MoveId::FEINT_ATTACK, MoveId::TACKLE,
+    MoveId::DIG, MoveId::DISARMING_VOICE, MoveId::WILD_CHARGE, MoveId::FEINT_ATTACK, MoveId::ZEN_HEADBUTT,
+    MoveId::PLAY_ROUGH, MoveId::DISARMING_VOICE, MoveId::WILD_CHARGE, MoveId::SHADOW_CLAW, MoveId::FEINT_ATTACK,
+    MoveId::POWER_GEM, MoveId::FOUL_PLAY, MoveId::SHADOW_SNEAK, MoveId::PLAY_ROUGH, MoveId::VICE_GRIP,
+    MoveId::IRON_HEAD, MoveId::TACKLE, MoveId::METAL_CLAW, MoveId::IRON_HEAD, MoveId::ROCK_TOMB,
+    MoveId::BODY_SLAM, MoveId::METAL_CLAW, MoveId::IRON_TAIL, MoveId::BODY_SLAM, MoveId::ROCK_SLIDE,
+    MoveId::HEAVY_SLAM, MoveId::DRAGON_TAIL, MoveId::IRON_TAIL, MoveId::THUNDER, MoveId::STONE_EDGE,
+    MoveId::HEAVY_SLAM, MoveId::CONFUSION, MoveId::ROCK_SMASH, MoveId::ICE_PUNCH, MoveId::PSYSHOCK,
+    MoveId::LOW_SWEEP, MoveId::PSYCHO_CUT, MoveId::COUNTER, MoveId::ICE_PUNCH, MoveId::PSYCHIC,
+    MoveId::DYNAMIC_PUNCH, MoveId::QUICK_ATTACK, MoveId::SPARK, MoveId::THUNDERBOLT, MoveId::DISCHARGE,
+    MoveId::SWIFT, MoveId::SNARL, MoveId::CHARGE_BEAM, MoveId::THUNDER, MoveId::WILD_CHARGE,
+    MoveId::FLAME_BURST, MoveId::SPARK, MoveId::QUICK_ATTACK, MoveId::STRUGGLE_BUG, MoveId::TACKLE,
+    MoveId::SIGNAL_BEAM, MoveId::BUG_BUZZ, MoveId::THUNDERBOLT, MoveId::SILVER_WIND, MoveId::BUG_BUZZ,
+    MoveId::DAZZLING_GLEAM, MoveId::POISON_JAB, MoveId::RAZOR_LEAF, MoveId::PETAL_BLIZZARD, MoveId::SLUDGE_BOMB,
+    MoveId::DAZZLING_GLEAM, MoveId::POUND, MoveId::ROCK_SMASH, MoveId::SLUDGE, MoveId::GUNK_SHOT,
+    MoveId::ICE_BEAM, MoveId::ROCK_SMASH, MoveId::INFESTATION, MoveId::GUNK_SHOT, MoveId::SLUDGE_BOMB,
+    MoveId::ICE_BEAM, MoveId::AQUA_JET, MoveId::CRUNCH, MoveId::POISON_FANG, MoveId::HYDRO_PUMP,
+    MoveId::CRUNCH, MoveId::POISON_FANG, MoveId::SPLASH, MoveId::WATER_GUN, MoveId::HEAVY_SLAM,
+    MoveId::WATER_PULSE, MoveId::BODY_SLAM, MoveId::ZEN_HEADBUTT, MoveId::WATER_GUN, MoveId::SURF,
+    MoveId::BLIZZARD, MoveId::HYPER_BEAM, MoveId::BULLDOZE, MoveId::HEAT_WAVE, MoveId::STOMP,
+    MoveId::EMBER, MoveId::ROCK_SMASH, MoveId::EARTHQUAKE, MoveId::OVERHEAT, MoveId::SOLAR_BEAM,
+    MoveId::FIRE_SPIN, MoveId::EMBER, MoveId::OVERHEAT, MoveId::SOLAR_BEAM, MoveId::EARTHQUAKE,
+    MoveId::SPLASH, MoveId::ZEN_HEADBUTT, MoveId::PSYBEAM, MoveId::SHADOW_BALL, MoveId::MIRROR_COAT,
+    MoveId::CHARGE_BEAM, MoveId::EXTRASENSORY, MoveId::PSYCHIC, MoveId::SHADOW_BALL, MoveId::MIRROR_COAT,
+    MoveId::SUCKER_PUNCH, MoveId::PSYCHO_CUT, MoveId::DIG, MoveId::ROCK_TOMB, MoveId::ICY_WIND,
+    MoveId::MUD_SHOT, MoveId::STRUGGLE_BUG, MoveId::SAND_TOMB, MoveId::DIG, MoveId::CRUNCH,
+    MoveId::MUD_SHOT, MoveId::DRAGON_BREATH, MoveId::SAND_TOMB, MoveId::BULLDOZE, MoveId::BUG_BUZZ,
+    MoveId::MUD_SHOT, MoveId::DRAGON_TAIL, MoveId::EARTHQUAKE, MoveId::DRAGON_CLAW, MoveId::STONE_EDGE,
+    MoveId::POISON_STING, MoveId::SUCKER_PUNCH, MoveId::GRASS_KNOT, MoveId::BRICK_BREAK, MoveId::SEED_BOMB,
+    MoveId::POISON_JAB, MoveId::SUCKER_PUNCH, MoveId::DARK_PULSE, MoveId::DYNAMIC_PUNCH, MoveId::GRASS_KNOT,
+    MoveId::PECK, MoveId::ASTONISH, MoveId::DISARMING_VOICE, MoveId::AERIAL_ACE, MoveId::ICE_BEAM,
+    MoveId::PECK, MoveId::DRAGON_BREATH, MoveId::SKY_ATTACK, MoveId::DAZZLING_GLEAM, MoveId::DRAGON_PULSE,
+    MoveId::FURY_CUTTER, MoveId::SHADOW_CLAW, MoveId::CLOSE_COMBAT, MoveId::NIGHT_SLASH, MoveId::DIG,
+    MoveId::POISON_FANG, MoveId::CRUNCH, MoveId::WRAP, MoveId::ROCK_THROW, MoveId::CONFUSION,
+    MoveId::PSYCHIC, MoveId::ROCK_SLIDE, MoveId::MOONBLAST, MoveId::PSYCHIC, MoveId::ROCK_SLIDE,
+    MoveId::SOLAR_BEAM, MoveId::AQUA_TAIL, MoveId::ICE_BEAM, MoveId::MUD_BOMB, MoveId::WATER_PULSE,
+    MoveId::BLIZZARD, MoveId::MUD_BOMB, MoveId::VICE_GRIP, MoveId::BUBBLE_BEAM, MoveId::AQUA_JET,
+    MoveId::WATERFALL, MoveId::SNARL, MoveId::VICE_GRIP, MoveId::BUBBLE_BEAM, MoveId::NIGHT_SLASH,
+    MoveId::CONFUSION, MoveId::EXTRASENSORY, MoveId::GYRO_BALL, MoveId::PSYBEAM, MoveId::DIG,
+    MoveId::EXTRASENSORY, MoveId::CONFUSION, MoveId::GYRO_BALL, MoveId::PSYCHIC, MoveId::EARTHQUAKE,
+    MoveId::ACID, MoveId::INFESTATION, MoveId::GRASS_KNOT, MoveId::MIRROR_COAT, MoveId::ANCIENT_POWER,
+    MoveId::GRASS_KNOT, MoveId::BULLDOZE, MoveId::STONE_EDGE, MoveId::STRUGGLE_BUG, MoveId::SCRATCH,
+    MoveId::CROSS_POISON, MoveId::AQUA_JET, MoveId::ANCIENT_POWER, MoveId::FURY_CUTTER, MoveId::STRUGGLE_BUG,
+    MoveId::CROSS_POISON, MoveId::WATER_PULSE, MoveId::ROCK_BLAST, MoveId::SPLASH, MoveId::TACKLE,
+    MoveId::WATERFALL, MoveId::DRAGON_TAIL, MoveId::TACKLE, MoveId::HEX, MoveId::HURRICANE,
+    MoveId::ENERGY_BALL, MoveId::FIRE_BLAST, MoveId::SOLAR_BEAM, MoveId::WATER_GUN, MoveId::TACKLE,
+    MoveId::HYDRO_PUMP, MoveId::THUNDER, MoveId::POWDER_SNOW, MoveId::TACKLE, MoveId::BLIZZARD,
+    MoveId::ICE_BEAM, MoveId::LICK, MoveId::SUCKER_PUNCH, MoveId::FOUL_PLAY, MoveId::FLAMETHROWER,
+    MoveId::THUNDER, MoveId::ICE_BEAM, MoveId::AERIAL_ACE, MoveId::SHADOW_SNEAK, MoveId::FEINT_ATTACK,
+    MoveId::ASTONISH, MoveId::OMINOUS_WIND, MoveId::NIGHT_SHADE, MoveId::SHADOW_SNEAK, MoveId::HEX,
+    MoveId::SHADOW_CLAW, MoveId::SHADOW_BALL, MoveId::DAZZLING_GLEAM, MoveId::THUNDER, MoveId::HEX,
+    MoveId::ASTONISH, MoveId::HEX, MoveId::FEINT_ATTACK, MoveId::SHADOW_PUNCH, MoveId::ICE_PUNCH,
+    MoveId::FIRE_PUNCH, MoveId::AIR_SLASH, MoveId::RAZOR_LEAF, MoveId::STOMP, MoveId::AERIAL_ACE,
+    MoveId::LEAF_BLADE, MoveId::EXTRASENSORY, MoveId::ASTONISH, MoveId::ENERGY_BALL, MoveId::SHADOW_BALL,
+    MoveId::PSYSHOCK, MoveId::PSYSHOCK, MoveId::PSYCHO_CUT, MoveId::SNARL, MoveId::DARK_PULSE,
+    MoveId::THUNDER, MoveId::MEGAHORN, MoveId::SPLASH, MoveId::COUNTER, MoveId::POWDER_SNOW,
+    MoveId::HEX, MoveId::AVALANCHE, MoveId::ICY_WIND, MoveId::SHADOW_BALL, MoveId::ICE_SHARD,
+    MoveId::FROST_BREATH, MoveId::AVALANCHE, MoveId::GYRO_BALL, MoveId::SHADOW_BALL, MoveId::WATER_GUN,
+    MoveId::ROCK_SMASH, MoveId::AURORA_BEAM, MoveId::BODY_SLAM, MoveId::WATER_PULSE, MoveId::WATER_GUN,
+    MoveId::POWDER_SNOW, MoveId::WATERFALL, MoveId::FROST_BREATH, MoveId::BLIZZARD, MoveId::EARTHQUAKE,
+    MoveId::WATER_PULSE, MoveId::BODY_SLAM, MoveId::ICE_BEAM, MoveId::WATER_PULSE, MoveId::CRUNCH,
+    MoveId::ICE_BEAM, MoveId::AQUA_TAIL, MoveId::DRAINING_KISS, MoveId::PSYCHIC, MoveId::WATER_PULSE,
+    MoveId::ANCIENT_POWER, MoveId::AQUA_TAIL, MoveId::HYDRO_PUMP, MoveId::WATER_GUN, MoveId::SPLASH,
+    MoveId::DRAINING_KISS, MoveId::WATER_PULSE, MoveId::AQUA_JET, MoveId::BITE, MoveId::EMBER,
+    MoveId::FLAMETHROWER, MoveId::TWISTER, MoveId::CRUNCH, MoveId::EMBER, MoveId::DRAGON_BREATH,
+    MoveId::FLAMETHROWER, MoveId::DRAGON_PULSE, MoveId::TWISTER, MoveId::DRAGON_TAIL, MoveId::FIRE_FANG,
+    MoveId::BITE, MoveId::FIRE_BLAST, MoveId::HYDRO_PUMP, MoveId::DRACO_METEOR, MoveId::TAKE_DOWN,
+    MoveId::ZEN_HEADBUTT, MoveId::METAL_CLAW, MoveId::PSYCHIC, MoveId::GYRO_BALL, MoveId::PSYSHOCK,
+    MoveId::BULLET_PUNCH, MoveId::ZEN_HEADBUTT, MoveId::PSYCHIC, MoveId::FLASH_CANNON, MoveId::EARTHQUAKE,
+    MoveId::ROCK_THROW, MoveId::ROCK_SMASH, MoveId::STONE_EDGE, MoveId::ZAP_CANNON, MoveId::FOCUS_BLAST,
+    MoveId::FROST_BREATH, MoveId::ROCK_SMASH, MoveId::BLIZZARD, MoveId::EARTHQUAKE, MoveId::FOCUS_BLAST,
+    MoveId::METAL_CLAW, MoveId::ROCK_SMASH, MoveId::FLASH_CANNON, MoveId::HYPER_BEAM, MoveId::FOCUS_BLAST,
+    MoveId::DRAGON_BREATH, MoveId::ZEN_HEADBUTT, MoveId::PSYCHIC, MoveId::OUTRAGE, MoveId::THUNDER,
+    MoveId::PSYCHIC, MoveId::DRAGON_CLAW, MoveId::SOLAR_BEAM, MoveId::WATERFALL, MoveId::HYDRO_PUMP,
+    MoveId::BLIZZARD, MoveId::THUNDER, MoveId::EARTHQUAKE, MoveId::FIRE_BLAST, MoveId::SOLAR_BEAM,
+    MoveId::AIR_SLASH, MoveId::DRAGON_TAIL, MoveId::OUTRAGE, MoveId::AERIAL_ACE, MoveId::ANCIENT_POWER,
+    MoveId::DAZZLING_GLEAM, MoveId::PSYCHIC, MoveId::DOOM_DESIRE, MoveId::PSYCHO_BOOST, MoveId::THUNDERBOLT,
+    MoveId::HYPER_BEAM, MoveId::ZEN_HEADBUTT, MoveId::POISON_JAB, MoveId::PSYCHO_BOOST, MoveId::ZAP_CANNON,
+    MoveId::DARK_PULSE, MoveId::ZEN_HEADBUTT, MoveId::COUNTER, MoveId::PSYCHO_BOOST, MoveId::THUNDERBOLT,
+    MoveId::ROCK_SLIDE, MoveId::PSYCHO_BOOST, MoveId::THUNDERBOLT, MoveId::SWIFT, MoveId::TACKLE,
+    MoveId::RAZOR_LEAF, MoveId::ENERGY_BALL, MoveId::SEED_BOMB, MoveId::BODY_SLAM, MoveId::BITE,
+    MoveId::RAZOR_LEAF, MoveId::ENERGY_BALL, MoveId::SOLAR_BEAM, MoveId::BODY_SLAM, MoveId::STONE_EDGE,
+    MoveId::SOLAR_BEAM, MoveId::EARTHQUAKE, MoveId::FLAME_WHEEL, MoveId::FLAMETHROWER, MoveId::FLAME_CHARGE,
+    MoveId::FLAME_WHEEL, MoveId::FLAMETHROWER, MoveId::LOW_SWEEP, MoveId::FIRE_SPIN, MoveId::ROCK_SMASH,
+    MoveId::SOLAR_BEAM, MoveId::FLAMETHROWER, MoveId::CLOSE_COMBAT, MoveId::BUBBLE, MoveId::POUND,
+    MoveId::BUBBLE_BEAM, MoveId::DRILL_PECK, MoveId::ICY_WIND, MoveId::BUBBLE_BEAM, MoveId::HYDRO_PUMP,
+    MoveId::ICY_WIND, MoveId::WATERFALL, MoveId::METAL_CLAW, MoveId::HYDRO_PUMP, MoveId::BLIZZARD,
+    MoveId::FLASH_CANNON, MoveId::AERIAL_ACE, MoveId::BRAVE_BIRD, MoveId::WING_ATTACK, MoveId::QUICK_ATTACK,
+    MoveId::AERIAL_ACE, MoveId::BRAVE_BIRD, MoveId::HEAT_WAVE, MoveId::BRAVE_BIRD, MoveId::HEAT_WAVE,
+    MoveId::CLOSE_COMBAT, MoveId::TACKLE, MoveId::TAKE_DOWN, MoveId::HYPER_FANG, MoveId::CRUNCH,
+    MoveId::GRASS_KNOT, MoveId::WATER_GUN, MoveId::TAKE_DOWN, MoveId::HYPER_FANG, MoveId::HYPER_BEAM,
+    MoveId::SURF, MoveId::BUG_BUZZ, MoveId::X_SCISSOR, MoveId::AERIAL_ACE, MoveId::TACKLE,
+    MoveId::SPARK, MoveId::DISCHARGE, MoveId::THUNDERBOLT, MoveId::SWIFT, MoveId::SPARK,
+    MoveId::BITE, MoveId::THUNDERBOLT, MoveId::WILD_CHARGE, MoveId::CRUNCH, MoveId::SPARK,
+    MoveId::SNARL, MoveId::HIDDEN_POWER, MoveId::HYPER_BEAM, MoveId::WILD_CHARGE, MoveId::CRUNCH,
+    MoveId::HIDDEN_POWER, MoveId::RAZOR_LEAF, MoveId::ENERGY_BALL, MoveId::GRASS_KNOT, MoveId::SOLAR_BEAM,
+    MoveId::SLUDGE_BOMB, MoveId::DAZZLING_GLEAM, MoveId::GRASS_KNOT, MoveId::ZEN_HEADBUTT, MoveId::TAKE_DOWN,
+    MoveId::ROCK_TOMB, MoveId::ANCIENT_POWER, MoveId::BULLDOZE, MoveId::ZEN_HEADBUTT, MoveId::SMACK_DOWN,
+    MoveId::ROCK_SLIDE, MoveId::OUTRAGE, MoveId::FLAMETHROWER, MoveId::TACKLE, MoveId::IRON_TAIL,
+    MoveId::ROCK_TOMB, MoveId::ANCIENT_POWER, MoveId::HEAVY_SLAM, MoveId::SMACK_DOWN, MoveId::IRON_TAIL,
+    MoveId::STONE_EDGE, MoveId::FLAMETHROWER, MoveId::FLASH_CANNON, MoveId::CONFUSION, MoveId::BUG_BITE,
+    MoveId::PSYBEAM, MoveId::ENERGY_BALL, MoveId::BUG_BUZZ, MoveId::PSYBEAM, MoveId::BULLDOZE,
+    MoveId::BUG_BUZZ, MoveId::PSYBEAM, MoveId::IRON_HEAD, MoveId::BUG_BUZZ, MoveId::AIR_SLASH,
+    MoveId::BUG_BITE, MoveId::PSYBEAM, MoveId::AERIAL_ACE, MoveId::BUG_BUZZ, MoveId::BUG_BITE,
+    MoveId::BUG_BUZZ, MoveId::BUG_BUZZ, MoveId::POWER_GEM, MoveId::X_SCISSOR, MoveId::THUNDER,
+    MoveId::THUNDERBOLT, MoveId::THUNDER_PUNCH, MoveId::AQUA_JET, MoveId::WATER_PULSE, MoveId::SWIFT,
+    MoveId::WATER_GUN, MoveId::WATERFALL, MoveId::AQUA_JET, MoveId::HYDRO_PUMP, MoveId::SWIFT,
+    MoveId::DAZZLING_GLEAM, MoveId::PETAL_BLIZZARD, MoveId::SEED_BOMB, MoveId::DAZZLING_GLEAM, MoveId::HYPER_BEAM,
+    MoveId::SOLAR_BEAM, MoveId::MUD_SLAP, MoveId::HIDDEN_POWER, MoveId::WATER_PULSE, MoveId::MUD_BOMB,
+    MoveId::BODY_SLAM, MoveId::WATER_PULSE, MoveId::EARTHQUAKE, MoveId::BODY_SLAM, MoveId::LOW_SWEEP,
+    MoveId::HYPER_BEAM, MoveId::AERIAL_ACE, MoveId::OMINOUS_WIND, MoveId::ICY_WIND, MoveId::SHADOW_BALL,
+    MoveId::POUND, MoveId::QUICK_ATTACK, MoveId::FIRE_PUNCH, MoveId::SWIFT, MoveId::POUND,
+    MoveId::LOW_KICK, MoveId::FIRE_PUNCH, MoveId::HYPER_BEAM, MoveId::FOCUS_BLAST, MoveId::SHADOW_BALL,
+    MoveId::DARK_PULSE, MoveId::DAZZLING_GLEAM, MoveId::PECK, MoveId::SNARL, MoveId::BRAVE_BIRD,
+    MoveId::PSYCHIC, MoveId::DARK_PULSE, MoveId::SKY_ATTACK, MoveId::PLAY_ROUGH, MoveId::THUNDERBOLT,
+    MoveId::AERIAL_ACE, MoveId::SCRATCH, MoveId::SHADOW_CLAW, MoveId::PLAY_ROUGH, MoveId::THUNDER,
+    MoveId::AERIAL_ACE, MoveId::ZEN_HEADBUTT, MoveId::ASTONISH, MoveId::WRAP, MoveId::SHADOW_BALL,
+    MoveId::PSYSHOCK, MoveId::CRUNCH, MoveId::FLAMETHROWER, MoveId::SLUDGE_BOMB, MoveId::GYRO_BALL,
+    MoveId::PSYSHOCK, MoveId::HEAVY_SLAM, MoveId::FEINT_ATTACK, MoveId::CONFUSION, MoveId::FLASH_CANNON,
+    MoveId::PSYCHIC, MoveId::HEAVY_SLAM, MoveId::ROCK_TOMB, MoveId::EARTHQUAKE, MoveId::ROCK_SLIDE,
+    MoveId::CONFUSION, MoveId::POUND, MoveId::PSYBEAM, MoveId::PSYCHIC, MoveId::PSYSHOCK,
+    MoveId::PSYCHIC, MoveId::NIGHT_SHADE, MoveId::SKY_ATTACK, MoveId::HEAT_WAVE, MoveId::FEINT_ATTACK,
+    MoveId::SUCKER_PUNCH, MoveId::SHADOW_SNEAK, MoveId::OMINOUS_WIND, MoveId::SHADOW_BALL, MoveId::TAKE_DOWN,
+    MoveId::MUD_SHOT, MoveId::DIG, MoveId::TWISTER, MoveId::BODY_SLAM, MoveId::DIG,
+    MoveId::TWISTER, MoveId::FLAMETHROWER, MoveId::DRAGON_TAIL, MoveId::MUD_SHOT, MoveId::OUTRAGE,
+    MoveId::EARTHQUAKE, MoveId::FIRE_BLAST, MoveId::TACKLE, MoveId::LICK, MoveId::GUNK_SHOT,
+    MoveId::BODY_SLAM, MoveId::BULLDOZE, MoveId::COUNTER, MoveId::QUICK_ATTACK, MoveId::BRICK_BREAK,
+    MoveId::LOW_SWEEP, MoveId::CROSS_CHOP, MoveId::FLASH_CANNON, MoveId::SHADOW_BALL, MoveId::CLOSE_COMBAT,
+    MoveId::DIG, MoveId::ROCK_TOMB, MoveId::BODY_SLAM, MoveId::FIRE_FANG, MoveId::BITE,
+    MoveId::EARTHQUAKE, MoveId::STONE_EDGE, MoveId::BODY_SLAM, MoveId::CROSS_POISON, MoveId::AQUA_TAIL,
+    MoveId::SLUDGE_BOMB, MoveId::POISON_STING, MoveId::INFESTATION, MoveId::BITE, MoveId::CRUNCH,
+    MoveId::AQUA_TAIL, MoveId::SLUDGE_BOMB, MoveId::POISON_STING, MoveId::POISON_JAB, MoveId::BRICK_BREAK,
+    MoveId::LOW_SWEEP, MoveId::SLUDGE_BOMB, MoveId::POISON_JAB, MoveId::COUNTER, MoveId::DYNAMIC_PUNCH,
+    MoveId::MUD_BOMB, MoveId::SLUDGE_BOMB, MoveId::BITE, MoveId::VINE_WHIP, MoveId::POWER_WHIP,
+    MoveId::ENERGY_BALL, MoveId::CRUNCH, MoveId::POUND, MoveId::WATER_GUN, MoveId::WATER_PULSE,
+    MoveId::ICE_BEAM, MoveId::SILVER_WIND, MoveId::WATERFALL, MoveId::WATER_GUN, MoveId::WATER_PULSE,
+    MoveId::BLIZZARD, MoveId::SILVER_WIND, MoveId::POWDER_SNOW, MoveId::ICE_SHARD, MoveId::ICE_BEAM,
+    MoveId::ENERGY_BALL, MoveId::STOMP, MoveId::POWDER_SNOW, MoveId::RAZOR_LEAF, MoveId::BLIZZARD,
+    MoveId::ENERGY_BALL, MoveId::OUTRAGE, MoveId::AVALANCHE, MoveId::FOCUS_BLAST, MoveId::FOUL_PLAY,
+    MoveId::ZAP_CANNON, MoveId::WILD_CHARGE, MoveId::FLASH_CANNON, MoveId::HYPER_BEAM, MoveId::EARTHQUAKE,
+    MoveId::SOLAR_BEAM, MoveId::MUD_SLAP, MoveId::SMACK_DOWN, MoveId::ANCIENT_POWER, MoveId::SLUDGE_BOMB,
+    MoveId::SOLAR_BEAM, MoveId::THUNDER_PUNCH, MoveId::WILD_CHARGE, MoveId::THUNDER, MoveId::FIRE_SPIN,
+    MoveId::KARATE_CHOP, MoveId::BRICK_BREAK, MoveId::FIRE_PUNCH, MoveId::FIRE_BLAST, MoveId::PSYCHIC,
+    MoveId::AIR_SLASH, MoveId::HIDDEN_POWER, MoveId::ANCIENT_POWER, MoveId::DAZZLING_GLEAM, MoveId::AERIAL_ACE,
+    MoveId::FLAMETHROWER, MoveId::BUG_BITE, MoveId::WING_ATTACK, MoveId::ANCIENT_POWER, MoveId::AERIAL_ACE,
+    MoveId::BUG_BUZZ, MoveId::RAZOR_LEAF, MoveId::QUICK_ATTACK, MoveId::SOLAR_BEAM, MoveId::LEAF_BLADE,
+    MoveId::ENERGY_BALL, MoveId::AVALANCHE, MoveId::ICY_WIND, MoveId::ICE_BEAM, MoveId::EARTHQUAKE,
+    MoveId::AERIAL_ACE, MoveId::NIGHT_SLASH, MoveId::MUD_SLAP, MoveId::POWDER_SNOW, MoveId::SOLAR_BEAM,
+    MoveId::HYPER_BEAM, MoveId::ZAP_CANNON, MoveId::BLIZZARD, MoveId::CONFUSION, MoveId::LOW_KICK,
+    MoveId::CLOSE_COMBAT, MoveId::PSYCHIC, MoveId::LEAF_BLADE, MoveId::MAGNET_BOMB, MoveId::ROCK_SLIDE,
+    MoveId::THUNDERBOLT, MoveId::OMINOUS_WIND, MoveId::PSYCHIC, MoveId::DARK_PULSE, MoveId::AVALANCHE,
+    MoveId::CRUNCH, MoveId::SHADOW_BALL, MoveId::ASTONISH, MoveId::THUNDER_SHOCK, MoveId::OMINOUS_WIND,
+    MoveId::THUNDERBOLT, MoveId::THUNDER, MoveId::BLIZZARD, MoveId::THUNDERBOLT, MoveId::THUNDER,
+    MoveId::ASTONISH, MoveId::AIR_SLASH, MoveId::OVERHEAT, MoveId::THUNDERBOLT, MoveId::THUNDER,
+    MoveId::FUTURESIGHT, MoveId::SWIFT, MoveId::THUNDER, MoveId::FUTURESIGHT, MoveId::SWIFT,
+    MoveId::BLIZZARD, MoveId::FUTURESIGHT, MoveId::SWIFT, MoveId::FIRE_BLAST, MoveId::DRAGON_BREATH,
+    MoveId::METAL_CLAW, MoveId::DRACO_METEOR, MoveId::IRON_HEAD, MoveId::THUNDER, MoveId::DRAGON_BREATH,
+    MoveId::DRAGON_TAIL, MoveId::DRACO_METEOR, MoveId::FIRE_BLAST, MoveId::HYDRO_PUMP, MoveId::FIRE_SPIN,
+    MoveId::BUG_BITE, MoveId::FIRE_BLAST, MoveId::IRON_HEAD, MoveId::STONE_EDGE, MoveId::ZEN_HEADBUTT,
+    MoveId::ROCK_SMASH, MoveId::STONE_EDGE, MoveId::AVALANCHE, MoveId::HEAVY_SLAM, MoveId::DRAGON_BREATH,
+    MoveId::SHADOW_CLAW, MoveId::DRAGON_CLAW, MoveId::ANCIENT_POWER, MoveId::SHADOW_SNEAK, MoveId::AURORA_BEAM,
+    MoveId::MOONBLAST, MoveId::FUTURESIGHT, MoveId::WATERFALL, MoveId::BUBBLE, MoveId::BUBBLE_BEAM,
+    MoveId::WATER_PULSE, MoveId::SURF, MoveId::BUBBLE_BEAM, MoveId::PSYCHIC, MoveId::SURF,
+    MoveId::SNARL, MoveId::FEINT_ATTACK, MoveId::FOCUS_BLAST, MoveId::SHADOW_BALL, MoveId::DARK_PULSE,
+    MoveId::HIDDEN_POWER, MoveId::ZEN_HEADBUTT, MoveId::ENERGY_BALL, MoveId::GRASS_KNOT, MoveId::SOLAR_BEAM,
+    MoveId::IRON_TAIL, MoveId::SHADOW_CLAW, MoveId::FUTURESIGHT, MoveId::HYPER_BEAM, MoveId::OUTRAGE,
+    MoveId::FLASH_CANNON, MoveId::THUNDERBOLT, MoveId::FLASH_CANNON, MoveId::THUNDERBOLT, MoveId::HYPER_BEAM,
+    MoveId::ROCK_SLIDE
+}};
+
+const std::array<int32_t, 50> MoveIdSeeds{{
+    3, 2, 4, 7, 24, 5, 11, 183, 0, 8, 91, 18, 52, 256, 421, 8,
+    38, 413, 20, 2, -113, 40, 390, 1, 3, 12, 1038, 9, 21, 23, 122, 8,
+    299, 23, 31, 467, 464, 66, 242, 471, -140, 94, 9, 9303, 0, 0, 2508, 5,
+    460, 1
+}};
+const std::array<MoveId, 197> MoveIdSlots{{
+    MoveId::EMBER, MoveId::COUNTER, MoveId::PSYSHOCK, MoveId::METAL_CLAW,
+    MoveId::RAZOR_LEAF, MoveId::OVERHEAT, MoveId::FLAMETHROWER, MoveId::BULLET_PUNCH,
+    MoveId::ROCK_SMASH, MoveId::OUTRAGE, MoveId::ICE_SHARD, MoveId::PSYCHIC,
+    MoveId::TRANSFORM, MoveId::AVALANCHE, MoveId::CHARGE_BEAM, MoveId::SLUDGE_WAVE,
+    MoveId::HEAT_WAVE, MoveId::TACKLE, MoveId::SIGNAL_BEAM, MoveId::AQUA_JET,
+    MoveId::WRAP_PINK, MoveId::HEAVY_SLAM, MoveId::SNARL, MoveId::BLAST_BURN,
+    MoveId::PECK, MoveId::FIRE_SPIN, MoveId::SMACK_DOWN, MoveId::HYPER_BEAM,
+    MoveId::SKY_ATTACK, MoveId::FLAME_WHEEL, MoveId::POISON_STING, MoveId::SURF,
+    MoveId::WRAP_GREEN, MoveId::BITE, MoveId::DRAGON_PULSE, MoveId::FURY_CUTTER,
+    MoveId::LEAF_BLADE, MoveId::WEATHER_BALL_FIRE, MoveId::ICE_PUNCH, MoveId::BULLDOZE,
+    MoveId::SUCKER_PUNCH, MoveId::LOW_SWEEP, MoveId::KARATE_CHOP, MoveId::ENERGY_BALL,
+    MoveId::PARABOLIC_CHARGE, MoveId::LOW_KICK, MoveId::PETAL_BLIZZARD, MoveId::FLAME_CHARGE,
+    MoveId::WRAP, MoveId::PSYSTRIKE, MoveId::HYDRO_PUMP, MoveId::WEATHER_BALL_WATER,
+    MoveId::FLASH_CANNON, MoveId::STEEL_WING, MoveId::MUD_SHOT, MoveId::FROST_BREATH,
+    MoveId::LAST_RESORT, MoveId::BUBBLE_BEAM, MoveId::ZEN_HEADBUTT, MoveId::CLOSE_COMBAT,
+    MoveId::FIRE_FANG, MoveId::DRAGON_BREATH, MoveId::VICE_GRIP, MoveId::CRUNCH,
+    MoveId::VINE_WHIP, MoveId::MEGA_DRAIN, MoveId::SHADOW_PUNCH, MoveId::PRESENT,
+    MoveId::POISON_FANG, MoveId::EXTRASENSORY, MoveId::MOONBLAST, MoveId::WATER_PULSE,
+    MoveId::SHADOW_SNEAK, MoveId::PSYBEAM, MoveId::BUG_BUZZ, MoveId::DYNAMIC_PUNCH,
+    MoveId::POISON_JAB, MoveId::DOOM_DESIRE, MoveId::BLIZZARD, MoveId::SILVER_WIND,
+    MoveId::INFESTATION, MoveId::HURRICANE, MoveId::SHADOW_CLAW, MoveId::DAZZLING_GLEAM,
+    MoveId::PRECIPICE_BLADES, MoveId::SAND_TOMB, MoveId::CROSS_CHOP, MoveId::OMINOUS_WIND,
+    MoveId::AQUA_TAIL, MoveId::BRAVE_BIRD, MoveId::BULLET_SEED, MoveId::HEX,
+    MoveId::WEATHER_BALL_ROCK, MoveId::SCRATCH, MoveId::THUNDER_SHOCK, MoveId::WILD_CHARGE,
+    MoveId::ORIGIN_PULSE, MoveId::DISCHARGE, MoveId::ASTONISH, MoveId::FRENZY_PLANT,
+    MoveId::BONE_CLUB, MoveId::THUNDERBOLT, MoveId::PLAY_ROUGH, MoveId::ZAP_CANNON,
+    MoveId::SHADOW_BALL, MoveId::FIRE_BLAST, MoveId::IRON_TAIL, MoveId::HORN_ATTACK,
+    MoveId::CONFUSION, MoveId::ANCIENT_POWER, MoveId::DRAGON_CLAW, MoveId::BRINE,
+    MoveId::LICK, MoveId::FEINT_ATTACK, MoveId::SCALD, MoveId::AIR_SLASH,
+    MoveId::GYRO_BALL, MoveId::WING_ATTACK, MoveId::REST, MoveId::THUNDER,
+    MoveId::SPLASH, MoveId::ACID, MoveId::VOLT_SWITCH, MoveId::GIGA_DRAIN,
+    MoveId::TAKE_DOWN, MoveId::SOLAR_BEAM, MoveId::EARTHQUAKE, MoveId::GRASS_KNOT,
+    MoveId::METEOR_MASH, MoveId::ROCK_TOMB, MoveId::MUD_SLAP, MoveId::STRUGGLE_BUG,
+    MoveId::AIR_CUTTER, MoveId::IRON_HEAD, MoveId::PSYCHO_CUT, MoveId::SCALD_BLASTOISE,
+    MoveId::GUNK_SHOT, MoveId::WATER_GUN_FAST_BLASTOISE, MoveId::TWISTER, MoveId::BUBBLE,
+    MoveId::POUND, MoveId::AURORA_BEAM, MoveId::FOCUS_BLAST, MoveId::STRUGGLE,
+    MoveId::QUICK_ATTACK, MoveId::ROCK_THROW, MoveId::WATER_GUN, MoveId::HYDRO_CANNON,
+    MoveId::WEATHER_BALL_ICE, MoveId::SWIFT, MoveId::MAGNET_BOMB, MoveId::DRAINING_KISS,
+    MoveId::SLUDGE_BOMB, MoveId::WATERFALL, MoveId::ICE_BEAM, MoveId::STONE_EDGE,
+    MoveId::YAWN, MoveId::BODY_SLAM, MoveId::SEED_BOMB, MoveId::MEGAHORN,
+    MoveId::DRACO_METEOR, MoveId::SLUDGE, MoveId::CUT, MoveId::HEART_STAMP,
+    MoveId::BRICK_BREAK, MoveId::DISARMING_VOICE, MoveId::CROSS_POISON, MoveId::SPARK,
+    MoveId::ROCK_BLAST, MoveId::DRAGON_TAIL, MoveId::NIGHT_SHADE, MoveId::PSYCHO_BOOST,
+    MoveId::HYDRO_PUMP_BLASTOISE, MoveId::MIRROR_COAT, MoveId::POWER_WHIP, MoveId::AERIAL_ACE,
+    MoveId::NIGHT_SLASH, MoveId::POWDER_SNOW, MoveId::DIG, MoveId::POWER_GEM,
+    MoveId::HIDDEN_POWER, MoveId::FOUL_PLAY, MoveId::BUG_BITE, MoveId::STOMP,
+    MoveId::DRILL_PECK, MoveId::FUTURESIGHT, MoveId::MUD_BOMB, MoveId::ROCK_SLIDE,
+    MoveId::SUBMISSION, MoveId::THUNDER_PUNCH, MoveId::FLAME_BURST, MoveId::X_SCISSOR,
+    MoveId::HYPER_FANG, MoveId::FIRE_PUNCH, MoveId::ICY_WIND, MoveId::DARK_PULSE,
+    MoveId::DRILL_RUN
+}};
+const std::array<MoveId, 197> MovesByKind{{
+    MoveId::ACID, MoveId::AIR_SLASH, MoveId::ASTONISH, MoveId::BITE,
+    MoveId::BUBBLE, MoveId::BUG_BITE, MoveId::BULLET_PUNCH, MoveId::BULLET_SEED,
+    MoveId::CHARGE_BEAM, MoveId::CONFUSION, MoveId::COUNTER, MoveId::CUT,
+    MoveId::DRAGON_BREATH, MoveId::DRAGON_TAIL, MoveId::EMBER, MoveId::EXTRASENSORY,
+    MoveId::FEINT_ATTACK, MoveId::FIRE_FANG, MoveId::FIRE_SPIN, MoveId::FROST_BREATH,
+    MoveId::FURY_CUTTER, MoveId::HEX, MoveId::HIDDEN_POWER, MoveId::ICE_SHARD,
+    MoveId::INFESTATION, MoveId::IRON_TAIL, MoveId::KARATE_CHOP, MoveId::LICK,
+    MoveId::LOW_KICK, MoveId::METAL_CLAW, MoveId::MUD_SHOT, MoveId::MUD_SLAP,
+    MoveId::PECK, MoveId::POISON_JAB, MoveId::POISON_STING, MoveId::POUND,
+    MoveId::POWDER_SNOW, MoveId::PRESENT, MoveId::PSYCHO_CUT, MoveId::QUICK_ATTACK,
+    MoveId::RAZOR_LEAF, MoveId::ROCK_SMASH, MoveId::ROCK_THROW, MoveId::SCRATCH,
+    MoveId::SHADOW_CLAW, MoveId::SMACK_DOWN, MoveId::SNARL, MoveId::SPARK,
+    MoveId::SPLASH, MoveId::STEEL_WING, MoveId::STRUGGLE_BUG, MoveId::SUCKER_PUNCH,
+    MoveId::TACKLE, MoveId::TAKE_DOWN, MoveId::THUNDER_SHOCK, MoveId::VINE_WHIP,
+    MoveId::VOLT_SWITCH, MoveId::WATERFALL, MoveId::WATER_GUN, MoveId::WATER_GUN_FAST_BLASTOISE,
+    MoveId::WING_ATTACK, MoveId::YAWN, MoveId::ZEN_HEADBUTT, MoveId::AERIAL_ACE,
+    MoveId::AIR_CUTTER, MoveId::ANCIENT_POWER, MoveId::AQUA_JET, MoveId::AQUA_TAIL,
+    MoveId::AURORA_BEAM, MoveId::AVALANCHE, MoveId::BLAST_BURN, MoveId::BLIZZARD,
+    MoveId::BODY_SLAM, MoveId::BONE_CLUB, MoveId::BRAVE_BIRD, MoveId::BRICK_BREAK,
+    MoveId::BRINE, MoveId::BUBBLE_BEAM, MoveId::BUG_BUZZ, MoveId::BULLDOZE,
+    MoveId::CLOSE_COMBAT, MoveId::CROSS_CHOP, MoveId::CROSS_POISON, MoveId::CRUNCH,
+    MoveId::DARK_PULSE, MoveId::DAZZLING_GLEAM, MoveId::DIG, MoveId::DISARMING_VOICE,
+    MoveId::DISCHARGE, MoveId::DOOM_DESIRE, MoveId::DRACO_METEOR, MoveId::DRAGON_CLAW,
+    MoveId::DRAGON_PULSE, MoveId::DRAINING_KISS, MoveId::DRILL_PECK, MoveId::DRILL_RUN,
+    MoveId::DYNAMIC_PUNCH, MoveId::EARTHQUAKE, MoveId::ENERGY_BALL, MoveId::FIRE_BLAST,
+    MoveId::FIRE_PUNCH, MoveId::FLAMETHROWER, MoveId::FLAME_BURST, MoveId::FLAME_CHARGE,
+    MoveId::FLAME_WHEEL, MoveId::FLASH_CANNON, MoveId::FOCUS_BLAST, MoveId::FOUL_PLAY,
+    MoveId::FRENZY_PLANT, MoveId::FUTURESIGHT, MoveId::GIGA_DRAIN, MoveId::GRASS_KNOT,
+    MoveId::GUNK_SHOT, MoveId::GYRO_BALL, MoveId::HEART_STAMP, MoveId::HEAT_WAVE,
+    MoveId::HEAVY_SLAM, MoveId::HORN_ATTACK, MoveId::HURRICANE, MoveId::HYDRO_CANNON,
+    MoveId::HYDRO_PUMP, MoveId::HYDRO_PUMP_BLASTOISE, MoveId::HYPER_BEAM, MoveId::HYPER_FANG,
+    MoveId::ICE_BEAM, MoveId::ICE_PUNCH, MoveId::ICY_WIND, MoveId::IRON_HEAD,
+    MoveId::LAST_RESORT, MoveId::LEAF_BLADE, MoveId::LOW_SWEEP, MoveId::MAGNET_BOMB,
+    MoveId::MEGAHORN, MoveId::MEGA_DRAIN, MoveId::METEOR_MASH, MoveId::MIRROR_COAT,
+    MoveId::MOONBLAST, MoveId::MUD_BOMB, MoveId::NIGHT_SHADE, MoveId::NIGHT_SLASH,
+    MoveId::OMINOUS_WIND, MoveId::ORIGIN_PULSE, MoveId::OUTRAGE, MoveId::OVERHEAT,
+    MoveId::PARABOLIC_CHARGE, MoveId::PETAL_BLIZZARD, MoveId::PLAY_ROUGH, MoveId::POISON_FANG,
+    MoveId::POWER_GEM, MoveId::POWER_WHIP, MoveId::PRECIPICE_BLADES, MoveId::PSYBEAM,
+    MoveId::PSYCHIC, MoveId::PSYCHO_BOOST, MoveId::PSYSHOCK, MoveId::PSYSTRIKE,
+    MoveId::REST, MoveId::ROCK_BLAST, MoveId::ROCK_SLIDE, MoveId::ROCK_TOMB,
+    MoveId::SAND_TOMB, MoveId::SCALD, MoveId::SCALD_BLASTOISE, MoveId::SEED_BOMB,
+    MoveId::SHADOW_BALL, MoveId::SHADOW_PUNCH, MoveId::SHADOW_SNEAK, MoveId::SIGNAL_BEAM,
+    MoveId::SILVER_WIND, MoveId::SKY_ATTACK, MoveId::SLUDGE, MoveId::SLUDGE_BOMB,
+    MoveId::SLUDGE_WAVE, MoveId::SOLAR_BEAM, MoveId::STOMP, MoveId::STONE_EDGE,
+    MoveId::STRUGGLE, MoveId::SUBMISSION, MoveId::SURF, MoveId::SWIFT,
+    MoveId::THUNDER, MoveId::THUNDERBOLT, MoveId::THUNDER_PUNCH, MoveId::TRANSFORM,
+    MoveId::TWISTER, MoveId::VICE_GRIP, MoveId::WATER_PULSE, MoveId::WEATHER_BALL_FIRE,
+    MoveId::WEATHER_BALL_ICE, MoveId::WEATHER_BALL_ROCK, MoveId::WEATHER_BALL_WATER, MoveId::WILD_CHARGE,
+    MoveId::WRAP, MoveId::WRAP_GREEN, MoveId::WRAP_PINK, MoveId::X_SCISSOR,
+    MoveId::ZAP_CANNON
+}};
+const std::array<MoveId, 197> MovesByType{{
+    MoveId::CUT, MoveId::HIDDEN_POWER, MoveId::POUND, MoveId::PRESENT,
+    MoveId::QUICK_ATTACK, MoveId::SCRATCH, MoveId::TACKLE, MoveId::TAKE_DOWN,
+    MoveId::YAWN, MoveId::BODY_SLAM, MoveId::HORN_ATTACK, MoveId::HYPER_BEAM,
+    MoveId::HYPER_FANG, MoveId::LAST_RESORT, MoveId::REST, MoveId::STOMP,
+    MoveId::STRUGGLE, MoveId::SWIFT, MoveId::TRANSFORM, MoveId::VICE_GRIP,
+    MoveId::WRAP, MoveId::WRAP_GREEN, MoveId::WRAP_PINK, MoveId::COUNTER,
+    MoveId::KARATE_CHOP, MoveId::LOW_KICK, MoveId::ROCK_SMASH, MoveId::BRICK_BREAK,
+    MoveId::CLOSE_COMBAT, MoveId::CROSS_CHOP, MoveId::DYNAMIC_PUNCH, MoveId::FOCUS_BLAST,
+    MoveId::LOW_SWEEP, MoveId::SUBMISSION, MoveId::AIR_SLASH, MoveId::PECK,
+    MoveId::WING_ATTACK, MoveId::AERIAL_ACE, MoveId::AIR_CUTTER, MoveId::BRAVE_BIRD,
+    MoveId::DRILL_PECK, MoveId::HURRICANE, MoveId::SKY_ATTACK, MoveId::ACID,
+    MoveId::POISON_JAB, MoveId::POISON_STING, MoveId::CROSS_POISON, MoveId::GUNK_SHOT,
+    MoveId::POISON_FANG, MoveId::SLUDGE, MoveId::SLUDGE_BOMB, MoveId::SLUDGE_WAVE,
+    MoveId::MUD_SHOT, MoveId::MUD_SLAP, MoveId::BONE_CLUB, MoveId::BULLDOZE,
+    MoveId::DIG, MoveId::DRILL_RUN, MoveId::EARTHQUAKE, MoveId::MUD_BOMB,
+    MoveId::PRECIPICE_BLADES, MoveId::SAND_TOMB, MoveId::ROCK_THROW, MoveId::SMACK_DOWN,
+    MoveId::ANCIENT_POWER, MoveId::POWER_GEM, MoveId::ROCK_BLAST, MoveId::ROCK_SLIDE,
+    MoveId::ROCK_TOMB, MoveId::STONE_EDGE, MoveId::WEATHER_BALL_ROCK, MoveId::BUG_BITE,
+    MoveId::FURY_CUTTER, MoveId::INFESTATION, MoveId::STRUGGLE_BUG, MoveId::BUG_BUZZ,
+    MoveId::MEGAHORN, MoveId::SIGNAL_BEAM, MoveId::SILVER_WIND, MoveId::X_SCISSOR,
+    MoveId::ASTONISH, MoveId::HEX, MoveId::LICK, MoveId::SHADOW_CLAW,
+    MoveId::NIGHT_SHADE, MoveId::OMINOUS_WIND, MoveId::SHADOW_BALL, MoveId::SHADOW_PUNCH,
+    MoveId::SHADOW_SNEAK, MoveId::BULLET_PUNCH, MoveId::IRON_TAIL, MoveId::METAL_CLAW,
+    MoveId::STEEL_WING, MoveId::DOOM_DESIRE, MoveId::FLASH_CANNON, MoveId::GYRO_BALL,
+    MoveId::HEAVY_SLAM, MoveId::IRON_HEAD, MoveId::MAGNET_BOMB, MoveId::METEOR_MASH,
+    MoveId::EMBER, MoveId::FIRE_FANG, MoveId::FIRE_SPIN, MoveId::BLAST_BURN,
+    MoveId::FIRE_BLAST, MoveId::FIRE_PUNCH, MoveId::FLAMETHROWER, MoveId::FLAME_BURST,
+    MoveId::FLAME_CHARGE, MoveId::FLAME_WHEEL, MoveId::HEAT_WAVE, MoveId::OVERHEAT,
+    MoveId::WEATHER_BALL_FIRE, MoveId::BUBBLE, MoveId::SPLASH, MoveId::WATERFALL,
+    MoveId::WATER_GUN, MoveId::WATER_GUN_FAST_BLASTOISE, MoveId::AQUA_JET, MoveId::AQUA_TAIL,
+    MoveId::BRINE, MoveId::BUBBLE_BEAM, MoveId::HYDRO_CANNON, MoveId::HYDRO_PUMP,
+    MoveId::HYDRO_PUMP_BLASTOISE, MoveId::ORIGIN_PULSE, MoveId::SCALD, MoveId::SCALD_BLASTOISE,
+    MoveId::SURF, MoveId::WATER_PULSE, MoveId::WEATHER_BALL_WATER, MoveId::BULLET_SEED,
+    MoveId::RAZOR_LEAF, MoveId::VINE_WHIP, MoveId::ENERGY_BALL, MoveId::FRENZY_PLANT,
+    MoveId::GIGA_DRAIN, MoveId::GRASS_KNOT, MoveId::LEAF_BLADE, MoveId::MEGA_DRAIN,
+    MoveId::PETAL_BLIZZARD, MoveId::POWER_WHIP, MoveId::SEED_BOMB, MoveId::SOLAR_BEAM,
+    MoveId::CHARGE_BEAM, MoveId::SPARK, MoveId::THUNDER_SHOCK, MoveId::VOLT_SWITCH,
+    MoveId::DISCHARGE, MoveId::PARABOLIC_CHARGE, MoveId::THUNDER, MoveId::THUNDERBOLT,
+    MoveId::THUNDER_PUNCH, MoveId::WILD_CHARGE, MoveId::ZAP_CANNON, MoveId::CONFUSION,
+    MoveId::EXTRASENSORY, MoveId::PSYCHO_CUT, MoveId::ZEN_HEADBUTT, MoveId::FUTURESIGHT,
+    MoveId::HEART_STAMP, MoveId::MIRROR_COAT, MoveId::PSYBEAM, MoveId::PSYCHIC,
+    MoveId::PSYCHO_BOOST, MoveId::PSYSHOCK, MoveId::PSYSTRIKE, MoveId::FROST_BREATH,
+    MoveId::ICE_SHARD, MoveId::POWDER_SNOW, MoveId::AURORA_BEAM, MoveId::AVALANCHE,
+    MoveId::BLIZZARD, MoveId::ICE_BEAM, MoveId::ICE_PUNCH, MoveId::ICY_WIND,
+    MoveId::WEATHER_BALL_ICE, MoveId::DRAGON_BREATH, MoveId::DRAGON_TAIL, MoveId::DRACO_METEOR,
+    MoveId::DRAGON_CLAW, MoveId::DRAGON_PULSE, MoveId::OUTRAGE, MoveId::TWISTER,
+    MoveId::BITE, MoveId::FEINT_ATTACK, MoveId::SNARL, MoveId::SUCKER_PUNCH,
+    MoveId::CRUNCH, MoveId::DARK_PULSE, MoveId::FOUL_PLAY, MoveId::NIGHT_SLASH,
+    MoveId::DAZZLING_GLEAM, MoveId::DISARMING_VOICE, MoveId::DRAINING_KISS, MoveId::MOONBLAST,
+    MoveId::PLAY_ROUGH
+}};
+const std::array<uint16_t, 37> MovesByTypeOffsets{{
+    0, 9, 23, 27, 34, 37, 43, 46, 52, 54, 62, 64, 71, 75, 80, 84, 89, 93, 100, 103,
+    113, 118, 131, 134, 144, 148, 155, 159, 167, 170, 177, 179, 184, 188, 192, 192, 197
+}};
+const std::array<uint16_t, 2843> MoveLearners{{
+    24, 25, 49, 50, 51, 79, 80, 81, 83, 199, 396, 397, 14, 15, 16, 17, 22, 23, 96, 97,
+    98, 140, 180, 182, 183, 193, 195, 207, 210, 251, 269, 270, 296, 297, 298, 320, 321, 334, 335, 336,
+    384, 406, 411, 438, 453, 454, 459, 475, 488, 495, 496, 522, 532, 533, 536, 15, 16, 47, 48, 96,
+    186, 311, 322, 328, 5, 17, 96, 140, 186, 195, 271, 328, 411, 438, 475, 532, 545, 117, 155, 156,
+    157, 158, 159, 168, 170, 192, 193, 210, 290, 291, 396, 398, 423, 438, 465, 467, 529, 532, 533, 556,
+    557, 6, 7, 157, 175, 327, 362, 392, 398, 424, 479, 480, 6, 64, 99, 135, 151, 164, 165, 200,
+    255, 390, 421, 423, 515, 516, 107, 108, 207, 217, 250, 337, 339, 347, 384, 407, 409, 412, 488, 489,
+    490, 497, 541, 543, 544, 545, 546, 547, 548, 99, 100, 106, 134, 267, 268, 417, 418, 558, 106, 141,
+    259, 265, 415, 416, 525, 535, 537, 542, 555, 7, 8, 20, 21, 25, 33, 34, 35, 47, 48, 60,
+    61, 68, 102, 104, 147, 159, 177, 186, 250, 253, 254, 290, 291, 292, 306, 338, 339, 347, 362, 363,
+    421, 425, 427, 445, 446, 461, 498, 499, 513, 514, 516, 519, 30, 32, 42, 44, 83, 100, 148, 161,
+    168, 203, 216, 274, 316, 323, 365, 391, 401, 405, 419, 432, 436, 452, 521, 524, 538, 544, 550, 18,
+    33, 36, 39, 41, 68, 70, 169, 196, 200, 211, 264, 275, 285, 331, 332, 342, 348, 349, 364, 417,
+    418, 420, 444, 445, 484, 485, 486, 487, 507, 510, 513, 514, 120, 121, 122, 17, 97, 98, 271, 294,
+    301, 321, 453, 454, 455, 494, 27, 66, 76, 77, 178, 179, 253, 280, 283, 284, 331, 332, 382, 511,
+    517, 531, 6, 70, 71, 72, 82, 113, 114, 133, 187, 200, 201, 203, 266, 270, 315, 316, 327, 342,
+    392, 450, 451, 522, 559, 560, 70, 71, 82, 105, 113, 133, 137, 155, 187, 200, 266, 289, 314, 315,
+    327, 342, 392, 393, 450, 451, 559, 560, 9, 10, 12, 13, 52, 54, 144, 182, 183, 184, 248, 249,
+    309, 310, 312, 327, 334, 336, 458, 469, 470, 471, 472, 473, 474, 475, 476, 477, 533, 554, 11, 55,
+    183, 311, 313, 334, 335, 357, 358, 380, 459, 472, 473, 474, 475, 476, 477, 533, 31, 32, 120, 128,
+    168, 265, 275, 332, 366, 380, 397, 465, 473, 510, 537, 78, 124, 256, 341, 430, 512, 80, 117, 118,
+    119, 204, 205, 206, 209, 270, 296, 297, 298, 317, 329, 330, 481, 482, 483, 40, 73, 95, 154, 162,
+    168, 188, 197, 198, 277, 295, 324, 325, 326, 354, 370, 439, 440, 443, 526, 538, 67, 78, 123, 124,
+    144, 254, 258, 261, 281, 341, 386, 449, 455, 512, 539, 11, 54, 55, 65, 74, 75, 92, 93, 111,
+    112, 117, 139, 141, 167, 213, 216, 247, 295, 313, 324, 325, 326, 351, 388, 389, 394, 395, 422, 439,
+    472, 473, 474, 500, 501, 503, 539, 549, 550, 551, 558, 67, 78, 124, 202, 246, 258, 261, 276, 281,
+    301, 330, 332, 341, 352, 414, 442, 502, 511, 512, 518, 64, 66, 76, 260, 340, 511, 52, 53, 184,
+    185, 398, 399, 515, 19, 21, 69, 102, 132, 147, 175, 176, 177, 252, 253, 254, 260, 272, 273, 290,
+    291, 292, 305, 306, 339, 362, 363, 379, 387, 421, 425, 456, 461, 462, 498, 499, 516, 519, 542, 168,
+    208, 25, 42, 60, 61, 63, 103, 104, 107, 108, 126, 127, 168, 214, 215, 217, 272, 383, 413, 441,
+    493, 494, 541, 561, 40, 44, 45, 46, 74, 130, 168, 192, 193, 199, 204, 205, 206, 253, 286, 295,
+    326, 358, 359, 385, 408, 439, 464, 481, 482, 483, 493, 532, 18, 20, 29, 34, 37, 56, 57, 84,
+    86, 120, 121, 150, 173, 178, 179, 211, 250, 251, 291, 302, 305, 307, 308, 336, 344, 371, 372, 373,
+    374, 375, 376, 377, 378, 379, 386, 394, 507, 508, 513, 39, 45, 189, 324, 325, 337, 338, 339, 344,
+    345, 384, 26, 94, 115, 116, 152, 196, 197, 283, 353, 355, 356, 460, 439, 427, 552, 553, 134, 164,
+    165, 274, 380, 385, 426, 434, 435, 552, 553, 556, 557, 5, 168, 381, 435, 556, 557, 119, 133, 134,
+    165, 385, 426, 25, 119, 166, 168, 252, 293, 350, 381, 401, 427, 437, 438, 509, 553, 141, 422, 424,
+    22, 97, 98, 194, 215, 450, 23, 91, 250, 72, 77, 78, 330, 341, 352, 383, 518, 31, 35, 38,
+    58, 59, 88, 121, 129, 132, 145, 160, 171, 202, 212, 249, 252, 258, 276, 298, 304, 333, 367, 368,
+    381, 395, 419, 430, 432, 437, 446, 486, 487, 502, 509, 514, 527, 528, 536, 3, 4, 41, 68, 90,
+    143, 153, 172, 173, 174, 262, 263, 272, 284, 299, 300, 366, 367, 368, 403, 425, 426, 447, 448, 168,
+    169, 170, 205, 206, 208, 296, 314, 317, 329, 402, 412, 444, 445, 463, 472, 519, 523, 524, 534, 562,
+    563, 118, 181, 193, 289, 293, 294, 370, 394, 395, 412, 549, 550, 551, 43, 44, 45, 46, 62, 63,
+    98, 180, 191, 195, 214, 215, 259, 272, 318, 319, 344, 345, 346, 407, 410, 501, 506, 525, 561, 5,
+    69, 91, 122, 143, 153, 163, 174, 216, 273, 288, 292, 294, 339, 403, 427, 437, 509, 531, 551, 553,
+    554, 4, 69, 273, 288, 306, 427, 514, 4, 75, 124, 143, 284, 410, 491, 492, 531, 5, 43, 91,
+    153, 163, 288, 301, 368, 449, 531, 554, 3, 4, 41, 68, 143, 153, 167, 172, 173, 272, 273, 288,
+    299, 300, 337, 338, 406, 425, 426, 447, 448, 449, 466, 468, 498, 499, 508, 532, 3, 4, 262, 284,
+    354, 3, 41, 90, 168, 172, 173, 262, 299, 300, 447, 68, 90, 447, 448, 8, 95, 133, 168, 271,
+    430, 433, 452, 468, 501, 512, 526, 582, 583, 75, 109, 112, 141, 167, 168, 198, 301, 431, 432, 433,
+    492, 525, 561, 60, 61, 62, 63, 214, 215, 259, 273, 317, 318, 319, 346, 406, 525, 100, 106, 141,
+    148, 161, 168, 416, 419, 432, 535, 53, 96, 140, 251, 256, 298, 335, 386, 399, 459, 536, 75, 112,
+    195, 213, 293, 549, 550, 551, 558, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576,
+    577, 578, 579, 580, 581, 131, 168, 169, 170, 178, 190, 204, 205, 208, 296, 297, 307, 308, 315, 317,
+    318, 329, 382, 383, 396, 397, 456, 463, 464, 562, 563, 25, 102, 103, 104, 268, 360, 361, 510, 30,
+    32, 45, 115, 168, 248, 257, 281, 285, 394, 395, 416, 429, 500, 43, 91, 163, 263, 366, 454, 455,
+    505, 78, 110, 160, 249, 252, 276, 340, 341, 349, 350, 364, 467, 500, 501, 555, 109, 122, 217, 402,
+    408, 409, 410, 415, 489, 490, 493, 541, 542, 138, 154, 192, 193, 218, 219, 220, 221, 222, 223, 224,
+    225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244,
+    245, 277, 294, 462, 463, 484, 485, 486, 487, 532, 538, 562, 563, 36, 37, 128, 135, 145, 17, 166,
+    319, 323, 402, 7, 8, 65, 72, 83, 106, 134, 138, 147, 148, 151, 156, 177, 188, 201, 203, 274,
+    289, 293, 316, 323, 363, 404, 423, 427, 436, 451, 452, 480, 547, 553, 20, 21, 46, 116, 125, 130,
+    154, 159, 160, 166, 168, 179, 261, 277, 286, 295, 333, 365, 401, 433, 440, 457, 462, 482, 483, 488,
+    492, 527, 538, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579, 580,
+    581, 583, 18, 19, 20, 21, 456, 457, 7, 8, 42, 44, 46, 65, 93, 136, 138, 161, 167, 168,
+    177, 201, 255, 270, 282, 285, 289, 315, 316, 322, 342, 360, 361, 384, 390, 405, 406, 420, 421, 520,
+    522, 523, 535, 72, 124, 176, 259, 269, 282, 351, 352, 410, 99, 105, 106, 259, 265, 416, 523, 525,
+    535, 99, 105, 161, 264, 269, 371, 372, 373, 374, 375, 376, 377, 378, 415, 450, 451, 489, 490, 535,
+    14, 55, 103, 126, 127, 131, 168, 185, 206, 311, 328, 361, 396, 397, 515, 516, 529, 59, 145, 159,
+    256, 288, 347, 348, 474, 552, 554, 38, 100, 164, 165, 252, 292, 349, 350, 387, 467, 468, 564, 565,
+    566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579, 580, 581, 66, 76, 77, 143,
+    284, 531, 81, 96, 199, 297, 298, 318, 319, 411, 534, 539, 99, 107, 125, 160, 260, 406, 510, 527,
+    67, 77, 91, 123, 132, 142, 283, 492, 530, 539, 66, 67, 76, 123, 168, 207, 280, 340, 351, 448,
+    488, 511, 517, 94, 95, 540, 38, 136, 185, 258, 278, 413, 30, 31, 32, 57, 59, 114, 261, 335,
+    348, 349, 429, 433, 451, 452, 552, 40, 246, 247, 369, 370, 396, 400, 414, 39, 40, 49, 50, 51,
+    388, 558, 56, 57, 58, 59, 70, 71, 101, 211, 303, 390, 391, 484, 485, 518, 29, 31, 70, 71,
+    113, 135, 155, 156, 157, 158, 203, 211, 212, 267, 268, 303, 304, 379, 380, 381, 390, 391, 437, 507,
+    508, 509, 56, 57, 58, 59, 86, 88, 101, 120, 121, 128, 129, 132, 276, 484, 485, 486, 487, 528,
+    537, 107, 180, 181, 194, 407, 409, 505, 30, 60, 61, 67, 140, 184, 251, 256, 331, 334, 386, 393,
+    536, 195, 217, 328, 407, 409, 489, 490, 506, 541, 543, 545, 546, 132, 147, 160, 166, 274, 434, 438,
+    466, 509, 524, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579, 580,
+    581, 5, 43, 153, 163, 168, 174, 263, 288, 301, 367, 368, 548, 22, 23, 36, 97, 135, 136, 180,
+    192, 194, 215, 300, 320, 384, 385, 494, 505, 2, 50, 51, 171, 199, 209, 359, 481, 46, 62, 63,
+    201, 254, 260, 261, 276, 306, 333, 345, 347, 495, 496, 24, 33, 34, 47, 48, 54, 305, 306, 362,
+    363, 387, 14, 35, 37, 38, 83, 101, 102, 103, 104, 168, 359, 383, 387, 441, 464, 499, 517, 518,
+    12, 13, 24, 33, 34, 36, 37, 82, 184, 185, 255, 310, 312, 382, 477, 515, 516, 517, 39, 45,
+    46, 111, 130, 168, 190, 191, 282, 286, 296, 337, 360, 450, 491, 492, 503, 504, 520, 30, 32, 42,
+    44, 264, 265, 282, 405, 415, 418, 523, 524, 537, 542, 62, 137, 138, 197, 198, 266, 346, 477, 0,
+    1, 79, 80, 125, 519, 269, 54, 64, 74, 111, 139, 213, 369, 394, 472, 473, 474, 475, 503, 11,
+    28, 40, 55, 65, 92, 93, 111, 112, 117, 118, 130, 138, 139, 167, 168, 181, 191, 213, 216, 247,
+    286, 295, 325, 326, 352, 370, 388, 389, 395, 422, 429, 430, 434, 435, 439, 494, 501, 503, 504, 531,
+    539, 541, 560, 440, 441, 442, 443, 74, 75, 167, 352, 371, 372, 373, 374, 375, 376, 377, 378, 413,
+    558, 43, 44, 73, 92, 111, 141, 168, 190, 192, 194, 282, 324, 351, 412, 429, 497, 500, 503, 15,
+    18, 19, 20, 21, 22, 26, 41, 47, 97, 150, 178, 179, 194, 210, 297, 317, 320, 322, 353, 355,
+    356, 453, 454, 455, 479, 491, 495, 511, 534, 1, 2, 49, 50, 51, 81, 170, 171, 199, 208, 209,
+    314, 315, 316, 318, 319, 359, 411, 444, 445, 446, 463, 464, 482, 483, 524, 534, 86, 87, 88, 89,
+    155, 156, 257, 266, 267, 343, 399, 29, 78, 84, 85, 159, 168, 202, 250, 262, 264, 275, 280, 300,
+    343, 349, 388, 389, 442, 466, 502, 540, 583, 72, 76, 120, 121, 122, 123, 128, 129, 144, 158, 168,
+    201, 275, 280, 281, 290, 291, 307, 338, 340, 351, 360, 361, 367, 392, 417, 431, 432, 433, 448, 449,
+    555, 84, 85, 86, 87, 88, 89, 110, 202, 257, 262, 263, 343, 388, 389, 431, 502, 540, 31, 56,
+    57, 84, 85, 157, 248, 249, 299, 348, 371, 372, 373, 374, 375, 376, 377, 378, 465, 467, 502, 513,
+    29, 110, 248, 379, 380, 3, 29, 52, 56, 60, 61, 62, 63, 66, 157, 175, 176, 178, 207, 260,
+    299, 332, 334, 398, 447, 488, 495, 496, 498, 0, 49, 52, 80, 117, 118, 119, 204, 208, 329, 330,
+    382, 444, 481, 19, 48, 73, 74, 75, 109, 122, 127, 139, 186, 191, 287, 326, 335, 369, 370, 408,
+    412, 415, 416, 489, 490, 493, 497, 506, 512, 542, 561, 108, 168, 174, 261, 308, 336, 346, 386, 408,
+    496, 556, 557, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579, 580,
+    581, 108, 410, 185, 217, 324, 325, 336, 346, 406, 407, 409, 506, 556, 557, 11, 54, 73, 184, 190,
+    327, 357, 55, 182, 183, 210, 311, 313, 328, 358, 520, 521, 22, 23, 180, 181, 271, 293, 321, 385,
+    494, 505, 101, 126, 302, 303, 360, 0, 1, 2, 14, 24, 33, 34, 36, 37, 49, 50, 79, 80,
+    81, 101, 102, 107, 108, 109, 126, 127, 131, 186, 209, 212, 313, 330, 359, 361, 464, 498, 499, 515,
+    516, 517, 518, 529, 25, 35, 38, 83, 103, 104, 255, 304, 466, 468, 528, 69, 104, 168, 214, 254,
+    273, 289, 305, 354, 362, 393, 413, 462, 494, 561, 1, 2, 43, 51, 53, 81, 118, 119, 131, 154,
+    168, 171, 174, 206, 209, 277, 294, 316, 367, 368, 389, 403, 435, 437, 445, 446, 449, 464, 482, 483,
+    527, 529, 534, 538, 562, 563, 27, 28, 94, 95, 115, 116, 187, 343, 353, 355, 356, 460, 461, 462,
+    478, 526, 540, 146, 246, 342, 364, 369, 400, 414, 424, 16, 17, 23, 98, 159, 166, 168, 271, 294,
+    321, 505, 90, 125, 128, 278, 285, 290, 302, 337, 338, 366, 411, 523, 35, 58, 86, 87, 88, 89,
+    110, 123, 129, 158, 168, 202, 212, 257, 263, 265, 281, 292, 350, 381, 397, 431, 446, 468, 514, 528,
+    537, 554, 555, 9, 10, 12, 13, 146, 149, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228,
+    229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 279, 309, 310,
+    312, 428, 458, 469, 470, 471, 11, 53, 168, 183, 249, 257, 258, 311, 313, 357, 358, 379, 398, 399,
+    458, 459, 77, 58, 109, 179, 371, 372, 373, 374, 375, 376, 377, 378, 382, 383, 406, 493, 506, 129,
+    148, 168, 203, 303, 304, 365, 401, 457, 528, 559, 560, 47, 137, 150, 172, 182, 207, 353, 355, 356,
+    443, 460, 479, 480, 491, 549, 550, 551, 0, 6, 9, 10, 15, 18, 19, 84, 90, 105, 110, 115,
+    126, 127, 137, 145, 150, 169, 170, 172, 173, 182, 196, 197, 200, 204, 205, 247, 248, 253, 264, 266,
+    275, 276, 278, 279, 280, 285, 302, 305, 307, 308, 309, 329, 340, 344, 348, 357, 358, 366, 400, 402,
+    403, 404, 405, 444, 453, 456, 460, 467, 469, 470, 471, 481, 500, 510, 513, 522, 428, 456, 457, 465,
+    507, 508, 138, 142, 152, 162, 168, 188, 198, 287, 308, 350, 354, 404, 406, 408, 413, 434, 436, 478,
+    496, 530, 543, 544, 545, 546, 547, 548, 549, 552, 26, 85, 87, 94, 115, 116, 127, 142, 152, 162,
+    167, 168, 187, 188, 189, 196, 197, 247, 285, 287, 307, 343, 353, 355, 356, 357, 440, 442, 443, 460,
+    461, 478, 495, 540, 543, 544, 545, 546, 547, 548, 582, 583, 27, 28, 103, 124, 142, 189, 283, 478,
+    530, 26, 94, 142, 152, 189, 196, 283, 287, 530, 543, 544, 546, 547, 548, 582, 583, 149, 15, 16,
+    164, 425, 426, 507, 508, 113, 114, 144, 347, 392, 393, 0, 1, 2, 79, 131, 169, 171, 519, 529,
+    27, 28, 85, 87, 89, 116, 152, 168, 198, 287, 478, 136, 147, 158, 168, 177, 274, 363, 393, 401,
+    419, 436, 452, 480, 521, 559, 560, 7, 8, 64, 65, 92, 93, 133, 134, 137, 138, 148, 151, 155,
+    156, 175, 176, 188, 211, 212, 216, 255, 267, 268, 302, 303, 304, 314, 322, 323, 364, 365, 390, 391,
+    404, 417, 418, 420, 421, 422, 423, 424, 457, 479, 480, 520, 521, 6, 71, 82, 92, 93, 100, 105,
+    113, 114, 135, 136, 151, 158, 175, 176, 187, 267, 268, 270, 289, 322, 364, 391, 399, 417, 418, 419,
+    420, 422, 424, 479, 484, 485, 486, 487, 520, 521, 522, 559, 26, 27, 28, 69, 89, 168, 191, 278,
+    287, 344, 345, 354, 461, 462, 526, 530, 16, 48, 181, 210, 251, 270, 321, 323, 454, 455, 533, 536,
+    24, 79, 82, 164, 165, 387, 497, 14, 52, 53, 114, 140, 144, 256, 459, 477, 331, 333, 95, 154,
+    162, 198, 277, 431, 441, 526, 538, 39, 40, 42, 64, 73, 112, 125, 130, 139, 145, 160, 190, 213,
+    278, 285, 286, 345, 365, 369, 423, 429, 430, 434, 435, 440, 441, 442, 443, 465, 466, 497, 504, 527,
+    555, 562, 563
+}};
+const std::array<uint16_t, 198> MoveLearnerOffsets{{
+    0, 12, 55, 64, 77, 101, 112, 126, 149, 158, 169, 212, 212, 239, 272, 275, 286, 302, 302, 326,
+    348, 378, 396, 411, 417, 435, 456, 471, 511, 531, 537, 544, 579, 581, 604, 632, 671, 682, 694, 695,
+    698, 711, 717, 723, 737, 740, 746, 749, 757, 795, 819, 841, 854, 879, 901, 908, 917, 928, 956, 961,
+    971, 975, 989, 1003, 1017, 1017, 1027, 1038, 1065, 1065, 1091, 1099, 1113, 1113, 1121, 1136, 1149, 1193, 1198, 1203,
+    1203, 1234, 1234, 1282, 1288, 1323, 1332, 1341, 1360, 1377, 1387, 1416, 1422, 1422, 1432, 1440, 1450, 1463, 1466, 1472,
+    1472, 1487, 1488, 1495, 1502, 1516, 1542, 1561, 1568, 1581, 1593, 1593, 1621, 1633, 1633, 1649, 1657, 1671, 1682, 1700,
+    1718, 1737, 1751, 1759, 1765, 1765, 1766, 1779, 1823, 1827, 1841, 1859, 1859, 1889, 1916, 1916, 1927, 1949, 1981, 1998,
+    2020, 2025, 2025, 2025, 2049, 2063, 2091, 2121, 2123, 2135, 2142, 2152, 2162, 2167, 2204, 2212, 2215, 2230, 2266, 2283,
+    2291, 2302, 2314, 2343, 2386, 2402, 2403, 2419, 2431, 2448, 2516, 2522, 2550, 2592, 2601, 2617, 2618, 2625, 2631, 2640,
+    2651, 2667, 2713, 2713, 2752, 2752, 2752, 2752, 2752, 2768, 2780, 2787, 2787, 2787, 2796, 2798, 2807, 2843
+}};
+
+const std::array<std::pair<std::string_view, std::string_view>, 120> FormNames{{
+    { "RATTATA", "RATTATA_NORMAL" },
+    { "RATTATA", "RATTATA_ALOLA" },
+    { "RATICATE", "RATICATE_NORMAL" },
+    { "RATICATE", "RATICATE_ALOLA" },
+    { "RAICHU", "RAICHU_NORMAL" },
+    { "RAICHU", "RAICHU_ALOLA" },
+    { "SANDSHREW", "SANDSHREW_NORMAL" },
+    { "SANDSHREW", "SANDSHREW_ALOLA" },
+    { "SANDSLASH", "SANDSLASH_NORMAL" },
+    { "SANDSLASH", "SANDSLASH_ALOLA" },
+    { "VULPIX", "VULPIX_NORMAL" },
+    { "VULPIX", "VULPIX_ALOLA" },
+    { "NINETALES", "NINETALES_NORMAL" },
+    { "NINETALES", "NINETALES_ALOLA" },
+    { "DIGLETT", "DIGLETT_NORMAL" },
+    { "DIGLETT", "DIGLETT_ALOLA" },
+    { "DUGTRIO", "DUGTRIO_NORMAL" },
+    { "DUGTRIO", "DUGTRIO_ALOLA" },
+    { "MEOWTH", "MEOWTH_NORMAL" },
+    { "MEOWTH", "MEOWTH_ALOLA" },
+    { "PERSIAN", "PERSIAN_NORMAL" },
+    { "PERSIAN", "PERSIAN_ALOLA" },
+    { "GEODUDE", "GEODUDE_NORMAL" },
+    { "GEODUDE", "GEODUDE_ALOLA" },
+    { "GRAVELER", "GRAVELER_NORMAL" },
+    { "GRAVELER", "GRAVELER_ALOLA" },
+    { "GOLEM", "GOLEM_NORMAL" },
+    { "GOLEM", "GOLEM_ALOLA" },
+    { "GRIMER", "GRIMER_NORMAL" },
+    { "GRIMER", "GRIMER_ALOLA" },
+    { "MUK", "MUK_NORMAL" },
+    { "MUK", "MUK_ALOLA" },
+    { "EXEGGUTOR", "EXEGGUTOR_NORMAL" },
+    { "EXEGGUTOR", "EXEGGUTOR_ALOLA" },
+    { "MAROWAK", "MAROWAK_NORMAL" },
+    { "MAROWAK", "MAROWAK_ALOLA" },
+    { "UNOWN", "UNOWN_F" },
+    { "UNOWN", "UNOWN_A" },
+    { "UNOWN", "UNOWN_B" },
+    { "UNOWN", "UNOWN_C" },
+    { "UNOWN", "UNOWN_D" },
+    { "UNOWN", "UNOWN_E" },
+    { "UNOWN", "UNOWN_G" },
+    { "UNOWN", "UNOWN_H" },
+    { "UNOWN", "UNOWN_I" },
+    { "UNOWN", "UNOWN_J" },
+    { "UNOWN", "UNOWN_K" },
+    { "UNOWN", "UNOWN_L" },
+    { "UNOWN", "UNOWN_M" },
+    { "UNOWN", "UNOWN_N" },
+    { "UNOWN", "UNOWN_O" },
+    { "UNOWN", "UNOWN_P" },
+    { "UNOWN", "UNOWN_Q" },
+    { "UNOWN", "UNOWN_R" },
+    { "UNOWN", "UNOWN_S" },
+    { "UNOWN", "UNOWN_T" },
+    { "UNOWN", "UNOWN_U" },
+    { "UNOWN", "UNOWN_V" },
+    { "UNOWN", "UNOWN_W" },
+    { "UNOWN", "UNOWN_X" },
+    { "UNOWN", "UNOWN_Y" },
+    { "UNOWN", "UNOWN_Z" },
+    { "UNOWN", "UNOWN_EXCLAMATION_POINT" },
+    { "UNOWN", "UNOWN_QUESTION_MARK" },
+    { "SPINDA", "SPINDA_00" },
+    { "SPINDA", "SPINDA_01" },
+    { "SPINDA", "SPINDA_02" },
+    { "SPINDA", "SPINDA_03" },
+    { "SPINDA", "SPINDA_04" },
+    { "SPINDA", "SPINDA_05" },
+    { "SPINDA", "SPINDA_06" },
+    { "SPINDA", "SPINDA_07" },
+    { "CASTFORM", "CASTFORM_NORMAL" },
+    { "CASTFORM", "CASTFORM_SUNNY" },
+    { "CASTFORM", "CASTFORM_RAINY" },
+    { "CASTFORM", "CASTFORM_SNOWY" },
+    { "DEOXYS", "DEOXYS_NORMAL" },
+    { "DEOXYS", "DEOXYS_ATTACK" },
+    { "DEOXYS", "DEOXYS_DEFENSE" },
+    { "DEOXYS", "DEOXYS_SPEED" },
+    { "BURMY", "BURMY_PLANT" },
+    { "BURMY", "BURMY_SANDY" },
+    { "BURMY", "BURMY_TRASH" },
+    { "WORMADAM", "WORMADAM_PLANT" },
+    { "WORMADAM", "WORMADAM_SANDY" },
+    { "WORMADAM", "WORMADAM_TRASH" },
+    { "CHERRIM", "CHERRIM_OVERCAST" },
+    { "CHERRIM", "CHERRIM_SUNNY" },
+    { "SHELLOS", "SHELLOS_WEST_SEA" },
+    { "SHELLOS", "SHELLOS_EAST_SEA" },
+    { "GASTRODON", "GASTRODON_WEST_SEA" },
+    { "GASTRODON", "GASTRODON_EAST_SEA" },
+    { "ROTOM", "ROTOM_NORMAL" },
+    { "ROTOM", "ROTOM_FROST" },
+    { "ROTOM", "ROTOM_FAN" },
+    { "ROTOM", "ROTOM_MOW" },
+    { "ROTOM", "ROTOM_WASH" },
+    { "ROTOM", "ROTOM_HEAT" },
+    { "GIRATINA", "GIRATINA_ALTERED" },
+    { "GIRATINA", "GIRATINA_ORIGIN" },
+    { "SHAYMIN", "SHAYMIN_LAND" },
+    { "SHAYMIN", "SHAYMIN_SKY" },
+    { "ARCEUS", "ARCEUS_NORMAL" },
+    { "ARCEUS", "ARCEUS_FIGHTING" },
+    { "ARCEUS", "ARCEUS_FLYING" },
+    { "ARCEUS", "ARCEUS_POISON" },
+    { "ARCEUS", "ARCEUS_GROUND" },
+    { "ARCEUS", "ARCEUS_ROCK" },
+    { "ARCEUS", "ARCEUS_BUG" },
+    { "ARCEUS", "ARCEUS_GHOST" },
+    { "ARCEUS", "ARCEUS_STEEL" },
+    { "ARCEUS", "ARCEUS_FIRE" },
+    { "ARCEUS", "ARCEUS_WATER" },
+    { "ARCEUS", "ARCEUS_GRASS" },
+    { "ARCEUS", "ARCEUS_ELECTRIC" },
+    { "ARCEUS", "ARCEUS_PSYCHIC" },
+    { "ARCEUS", "ARCEUS_ICE" },
+    { "ARCEUS", "ARCEUS_DRAGON" },
+    { "ARCEUS", "ARCEUS_DARK" },
+    { "ARCEUS", "ARCEUS_FAIRY" },
+}};
+
+const std::array<int32_t, 158> PokemonNameSeeds{{
+    1, 70, 0, 27, 4, 163, 351, 0, 98, 122, 43, 5, 25, 17, 131, 59,
+    2, 401, 4, 206, 11, 4, 59, 0, 570, 556, 16, 107, 28, 47, 5, 9,
+    285, 0, 76, 10, 6, 1, 2, 1, 6, 358, 4, -136, 46, 198, 183, 45,
+    22, 154, 237, 2, 3, 3, 3, 27, 6, 22, 5, 6, 15, 175, 76, 16,
+    550, 7, 210, 2, -150, -151, 4, 18, 1, -320, 11, 1, 42, 339, 28, 33,
+    7, 167, 453, 5, 41, 646, 0, 3, -360, 248, 38, -372, 33, 11, 6, 231,
+    530, 3, 456, 339, 26, 70, 216, 5, 26, 775, 19, 1, 37, 1572, 165, 322,
+    371, 282, 23, 3, 544, 658, 84, 3, 4, 1, 1, 1139, 403, 194, 156, 573,
+    6520, 1184, 134, 718, 13, 0, 3172, 1049, 17, 26, 23, 297, 2, 198, 11173, 1,
+    4, 1, 152, 17, 79, -541, -586, 4, 5, 21, 94, -594, 105, 36
+}};
+
+const std::array<PokemonNameEntry, 631> PokemonNames{{
+    { "SNORLAX", 160 },
+    { "UNOWN_S", 236 },
+    { "VULPIX", 41 },
+    { "SABLEYE", 346 },
+    { "RAICHU_ALOLA", 28 },
+    { "MANKEY", 66 },
+    { "PACHIRISU", 478 },
+    { "ANORITH", 398 },
+    { "MIGHTYENA", 306 },
+    { "DEOXYS_ATTACK", 441 },
+    { "NIDORAN_FEMALE", 33 },
+    { "GRIMER_ALOLA", 102 },
+    { "GASTRODON", 486 },
+    { "GOLEM_ALOLA", 89 },
+    { "MEGANIUM", 171 },
+    { "PORYGON", 154 },
+    { "CACNEA", 382 },
+    { "SEAKING", 136 },
+    { "SHUPPET", 407 },
+    { "GEODUDE", 84 },
+    { "ELECTABUZZ", 142 },
+    { "PIDGEOTTO", 16 },
+    { "NIDORAN_MALE", 36 },
+    { "CORPHISH", 392 },
+    { "SCEPTILE", 298 },
+    { "TORTERRA", 446 },
+    { "ARCEUS_STEEL", 572 },
+    { "WORMADAM_PLANT", 472 },
+    { "PLUSLE", 355 },
+    { "BUIZEL", 479 },
+    { "MIME_JR", 503 },
+    { "YANMA", 210 },
+    { "SANDSHREW_NORMAL", 29 },
+    { "ROTOM_MOW", 546 },
+    { "GOLDUCK", 65 },
+    { "HEATRAN", 554 },
+    { "TOXICROAK", 518 },
+    { "NUZLEAF", 318 },
+    { "HITMONTOP", 281 },
+    { "KAKUNA", 13 },
+    { "TEDDIURSA", 260 },
+    { "CHINGLING", 497 },
+    { "SPINDA_6", 376 },
+    { "HIPPOWDON", 514 },
+    { "UNOWN_H", 225 },
+    { "FLYGON", 381 },
+    { "NIDOQUEEN", 35 },
+    { "PORYGON2", 277 },
+    { "HIPPOPOTAS", 513 },
+    { "NINETALES_ALOLA", 44 },
+    { "EXEGGCUTE", 117 },
+    { "HOPPIP", 204 },
+    { "MAROWAK_ALOLA", 122 },
+    { "UNOWN_P", 233 },
+    { "METANG", 429 },
+    { "PORYGONZ", 538 },
+    { "CHIMCHAR", 447 },
+    { "ONIX", 110 },
+    { "POLIWAG", 70 },
+    { "ARCEUS_DARK", 580 },
+    { "JIRACHI", 439 },
+    { "BRONZOR", 500 },
+    { "WEEDLE", 12 },
+    { "CROCONAW", 176 },
+    { "TOGETIC", 193 },
+    { "SHELLDER", 105 },
+    { "SNEASEL", 259 },
+    { "SPINARAK", 184 },
+    { "SALAMENCE", 427 },
+    { "LUNATONE", 388 },
+    { "ARCEUS_GHOST", 571 },
+    { "SILCOON", 310 },
+    { "GEODUDE_NORMAL", 84 },
+    { "SPOINK", 369 },
+    { "IGGLYBUFF", 191 },
+    { "NIDORAN♀", 33 },
+    { "GASTLY", 107 },
+    { "UNOWN_W", 240 },
+    { "PRINPLUP", 451 },
+    { "SCIZOR", 256 },
+    { "MIME_JR.", 503 },
+    { "CHERRIM", 482 },
+    { "EXEGGUTOR", 118 },
+    { "REGISTEEL", 433 },
+    { "REGIGIGAS", 555 },
+    { "HOOTHOOT", 180 },
+    { "TAUROS", 145 },
+    { "LAPRAS", 148 },
+    { "AGGRON", 350 },
+    { "ZAPDOS", 162 },
+    { "WAILMER", 364 },
+    { "GASTRODON_EAST_SEA", 487 },
+    { "UNOWN_M", 230 },
+    { "DEOXYS_SPEED", 443 },
+    { "LOTAD", 314 },
+    { "SUICUNE", 289 },
+    { "PICHU", 189 },
+    { "CLEFFA", 190 },
+    { "NINETALES_NORMAL", 43 },
+    { "GENGAR", 109 },
+    { "TORKOAL", 368 },
+    { "ARCEUS_FAIRY", 581 },
+    { "CASTFORM_RAINY", 404 },
+    { "CRAWDAUNT", 393 },
+    { "ARCEUS", 564 },
+    { "POLIWRATH", 72 },
+    { "HYPNO", 112 },
+    { "MAMOSWINE", 537 },
+    { "UNOWN_A", 219 },
+    { "PIDGEY", 15 },
+    { "LAIRON", 349 },
+    { "VICTREEBEL", 81 },
+    { "WORMADAM_SANDY", 473 },
+    { "SURSKIT", 327 },
+    { "GROWLITHE", 68 },
+    { "LOUDRED", 338 },
+    { "ARCEUS_PSYCHIC", 577 },
+    { "PALKIA", 553 },
+    { "ARCEUS_GRASS", 575 },
+    { "MEOWTH", 60 },
+    { "CHERUBI", 481 },
+    { "ROTOM_FROST", 544 },
+    { "ARCEUS_FLYING", 566 },
+    { "FURRET", 179 },
+    { "WOOPER", 211 },
+    { "HITMONCHAN", 124 },
+    { "CASTFORM", 402 },
+    { "LOPUNNY", 492 },
+    { "GIRATINA_ORIGIN", 557 },
+    { "RATTATA_ALOLA", 19 },
+    { "TYROGUE", 280 },
+    { "BALTOY", 394 },
+    { "ARBOK", 25 },
+    { "DUGTRIO_ALOLA", 59 },
+    { "SMEARGLE", 279 },
+    { "PIDGEOT", 17 },
+    { "VENOMOTH", 55 },
+    { "GARCHOMP", 509 },
+    { "SNUBBULL", 253 },
+    { "UMBREON", 214 },
+    { "SPINDA", 371 },
+    { "GROUDON", 437 },
+    { "UNOWN_F", 218 },
+    { "SANDSLASH_ALOLA", 32 },
+    { "GIRATINA", 556 },
+    { "WHISMUR", 337 },
+    { "ARCEUS_BUG", 570 },
+    { "TORCHIC", 299 },
+    { "STARAVIA", 454 },
+    { "ABRA", 73 },
+    { "SKITTY", 344 },
+    { "WOBBUFFET", 246 },
+    { "PERSIAN_ALOLA", 63 },
+    { "RAMPARDOS", 466 },
+    { "MOLTRES", 163 },
+    { "DIALGA", 552 },
+    { "HAUNTER", 108 },
+    { "LILEEP", 396 },
+    { "PELIPPER", 323 },
+    { "DUGTRIO_NORMAL", 58 },
+    { "DRAGONAIR", 165 },
+    { "UNOWN_N", 231 },
+    { "SWELLOW", 321 },
+    { "PINSIR", 144 },
+    { "DEOXYS_NORMAL", 440 },
+    { "LUCARIO", 512 },
+    { "GOLBAT", 48 },
+    { "DODUO", 97 },
+    { "SHIELDON", 467 },
+    { "PERSIAN_NORMAL", 62 },
+    { "GOLEM", 88 },
+    { "SPINDA_02", 373 },
+    { "DUSCLOPS", 410 },
+    { "POOCHYENA", 305 },
+    { "ARCEUS_ROCK", 569 },
+    { "MANAPHY", 560 },
+    { "BEEDRILL", 14 },
+    { "FLAREON", 153 },
+    { "SPINDA_03", 374 },
+    { "LUXRAY", 462 },
+    { "NINETALES", 43 },
+    { "SPEAROW", 22 },
+    { "BELLSPROUT", 79 },
+    { "ROTOM_HEAT", 548 },
+    { "HONCHKROW", 494 },
+    { "KINGLER", 114 },
+    { "GABITE", 508 },
+    { "ENTEI", 288 },
+    { "FEAROW", 23 },
+    { "UNOWN_O", 232 },
+    { "NIDOKING", 38 },
+    { "GIBLE", 507 },
+    { "DRATINI", 164 },
+    { "ARTICUNO", 161 },
+    { "ELECTIVIRE", 530 },
+    { "PSYDUCK", 64 },
+    { "SPINDA_05", 376 },
+    { "BRELOOM", 330 },
+    { "TENTACOOL", 82 },
+    { "SPINDA_8", 378 },
+    { "GASTRODON_WEST_SEA", 486 },
+    { "VULPIX_ALOLA", 42 },
+    { "DUGTRIO", 58 },
+    { "JYNX", 141 },
+    { "NIDORINO", 37 },
+    { "LUXIO", 461 },
+    { "SEEL", 99 },
+    { "SHAYMIN_SKY", 563 },
+    { "SKIPLOOM", 205 },
+    { "UXIE", 549 },
+    { "FEEBAS", 400 },
+    { "PARASECT", 53 },
+    { "DIGLETT_ALOLA", 57 },
+    { "TROPIUS", 411 },
+    { "MUK", 103 },
+    { "FLAAFFY", 197 },
+    { "TANGROWTH", 529 },
+    { "ELEKID", 283 },
+    { "ALTARIA", 385 },
+    { "HORSEA", 133 },
+    { "RHYPERIOR", 528 },
+    { "CARVANHA", 362 },
+    { "VILEPLUME", 51 },
+    { "BAGON", 425 },
+    { "UNOWN_U", 238 },
+    { "GIRAFARIG", 247 },
+    { "GLACEON", 535 },
+    { "KIRLIA", 325 },
+    { "LUDICOLO", 316 },
+    { "CHATOT", 505 },
+    { "STEELIX", 252 },
+    { "IVYSAUR", 1 },
+    { "GLAMEOW", 495 },
+    { "SHEDINJA", 336 },
+    { "UNOWN_X", 241 },
+    { "JOLTEON", 152 },
+    { "MASQUERAIN", 328 },
+    { "HERACROSS", 258 },
+    { "GOREBYSS", 422 },
+    { "MONFERNO", 448 },
+    { "RAPIDASH", 91 },
+    { "CORSOLA", 266 },
+    { "SPINDA_00", 371 },
+    { "DROWZEE", 111 },
+    { "SUDOWOODO", 202 },
+    { "PIPLUP", 450 },
+    { "KOFFING", 126 },
+    { "MAREEP", 196 },
+    { "UNOWN_EXCLAMATION_POINT", 244 },
+    { "GIRATINA_ALTERED", 556 },
+    { "SPINDA_01", 372 },
+    { "SHIFTRY", 319 },
+    { "MISMAGIUS", 493 },
+    { "CRADILY", 397 },
+    { "HAPPINY", 504 },
+    { "LEDIAN", 183 },
+    { "HO_OH", 294 },
+    { "NATU", 194 },
+    { "SLAKOTH", 331 },
+    { "ILLUMISE", 358 },
+    { "SENTRET", 178 },
+    { "CHARMANDER", 3 },
+    { "GRIMER_NORMAL", 101 },
+    { "BRONZONG", 501 },
+    { "RALTS", 324 },
+    { "EXPLOUD", 339 },
+    { "SLUGMA", 262 },
+    { "ARMALDO", 399 },
+    { "LATIAS", 434 },
+    { "SCYTHER", 140 },
+    { "GOLDEEN", 135 },
+    { "DODRIO", 98 },
+    { "WEEZING", 127 },
+    { "DEOXYS", 440 },
+    { "SQUIRTLE", 6 },
+    { "LEAFEON", 534 },
+    { "SHARPEDO", 363 },
+    { "BUTTERFREE", 11 },
+    { "LOMBRE", 315 },
+    { "AZELF", 551 },
+    { "CAMERUPT", 367 },
+    { "CASCOON", 312 },
+    { "KRICKETOT", 458 },
+    { "SHAYMIN_LAND", 562 },
+    { "LUVDISC", 424 },
+    { "NINCADA", 334 },
+    { "CARNIVINE", 519 },
+    { "EEVEE", 150 },
+    { "CUBONE", 120 },
+    { "GOLEM_NORMAL", 88 },
+    { "EXEGGUTOR_ALOLA", 119 },
+    { "AMBIPOM", 488 },
+    { "RATICATE_NORMAL", 20 },
+    { "ARCEUS_ELECTRIC", 576 },
+    { "TAILLOW", 320 },
+    { "WYNAUT", 414 },
+    { "MAKUHITA", 340 },
+    { "WARTORTLE", 7 },
+    { "DRIFLOON", 489 },
+    { "SLOWPOKE", 92 },
+    { "ARCEUS_FIGHTING", 565 },
+    { "UNOWN", 218 },
+    { "MELTAN", 582 },
+    { "BANETTE", 408 },
+    { "TREECKO", 296 },
+    { "LARVITAR", 290 },
+    { "WEEPINBELL", 80 },
+    { "FROSLASS", 542 },
+    { "PONYTA", 90 },
+    { "SEALEO", 418 },
+    { "BURMY", 469 },
+    { "GROTLE", 445 },
+    { "VENONAT", 54 },
+    { "MAGMORTAR", 531 },
+    { "PHANPY", 275 },
+    { "UNOWN_J", 227 },
+    { "DUSKNOIR", 541 },
+    { "MAGMAR", 143 },
+    { "MAGNETON", 95 },
+    { "DARKRAI", 561 },
+    { "MANTYKE", 522 },
+    { "GROVYLE", 297 },
+    { "ALAKAZAM", 75 },
+    { "SKARMORY", 271 },
+    { "RAICHU", 27 },
+    { "BUDEW", 463 },
+    { "INFERNAPE", 449 },
+    { "TOGEKISS", 532 },
+    { "SHINX", 460 },
+    { "TOGEPI", 192 },
+    { "UNOWN_K", 228 },
+    { "OCTILLERY", 268 },
+    { "SKORUPI", 515 },
+    { "DIGLETT_NORMAL", 56 },
+    { "MAGBY", 284 },
+    { "GRUMPIG", 370 },
+    { "UNOWN_?", 245 },
+    { "ABOMASNOW", 524 },
+    { "WURMPLE", 309 },
+    { "ROTOM_WASH", 547 },
+    { "MELMETAL", 583 },
+    { "UNOWN_Z", 243 },
+    { "SKUNTANK", 499 },
+    { "SANDSLASH_NORMAL", 31 },
+    { "AZURILL", 342 },
+    { "HITMONLEE", 123 },
+    { "EKANS", 24 },
+    { "CLEFABLE", 40 },
+    { "SWAMPERT", 304 },
+    { "LUGIA", 293 },
+    { "SEEDOT", 317 },
+    { "HUNTAIL", 421 },
+    { "MILOTIC", 401 },
+    { "RATTATA", 18 },
+    { "NOCTOWL", 181 },
+    { "SNORUNT", 415 },
+    { "SEVIPER", 387 },
+    { "DONPHAN", 276 },
+    { "ARCEUS_NORMAL", 564 },
+    { "RHYHORN", 128 },
+    { "SHELLOS", 484 },
+    { "PROBOPASS", 540 },
+    { "DEOXYS_DEFENSE", 442 },
+    { "GALLADE", 539 },
+    { "CHERRIM_SUNNY", 483 },
+    { "SPINDA_2", 372 },
+    { "BELDUM", 428 },
+    { "LANTURN", 188 },
+    { "AERODACTYL", 159 },
+    { "MESPRIT", 550 },
+    { "SLOWKING", 216 },
+    { "POLIWHIRL", 71 },
+    { "QUAGSIRE", 212 },
+    { "ZANGOOSE", 386 },
+    { "CRANIDOS", 465 },
+    { "PIKACHU", 26 },
+    { "BULBASAUR", 0 },
+    { "ELECTRIKE", 353 },
+    { "SPINDA_5", 375 },
+    { "ARCEUS_DRAGON", 579 },
+    { "ARCANINE", 69 },
+    { "SPINDA_7", 377 },
+    { "MAGCARGO", 263 },
+    { "MEW", 168 },
+    { "RELICANTH", 423 },
+    { "REGIROCK", 431 },
+    { "RATTATA_NORMAL", 18 },
+    { "CROBAT", 186 },
+    { "CROAGUNK", 517 },
+    { "CACTURNE", 383 },
+    { "COMBUSKEN", 300 },
+    { "PILOSWINE", 265 },
+    { "CASTFORM_NORMAL", 402 },
+    { "REGICE", 432 },
+    { "SPINDA_1", 371 },
+    { "DELCATTY", 345 },
+    { "MAROWAK", 121 },
+    { "KABUTOPS", 158 },
+    { "AZUMARILL", 201 },
+    { "SPINDA_4", 374 },
+    { "MAWILE", 347 },
+    { "NIDORAN♂", 36 },
+    { "CYNDAQUIL", 172 },
+    { "STARYU", 137 },
+    { "SPHEAL", 417 },
+    { "WAILORD", 365 },
+    { "LICKILICKY", 527 },
+    { "DELIBIRD", 269 },
+    { "WHISCASH", 391 },
+    { "SPINDA_3", 373 },
+    { "CASTFORM_SUNNY", 403 },
+    { "GRAVELER", 86 },
+    { "GRAVELER_ALOLA", 87 },
+    { "REMORAID", 267 },
+    { "STUNKY", 498 },
+    { "RIOLU", 511 },
+    { "SPINDA_06", 377 },
+    { "SWALOT", 361 },
+    { "WIGGLYTUFF", 46 },
+    { "WINGULL", 322 },
+    { "KADABRA", 74 },
+    { "SOLROCK", 389 },
+    { "WORMADAM", 472 },
+    { "TRAPINCH", 379 },
+    { "TOTODILE", 175 },
+    { "MR._MIME", 139 },
+    { "PINECO", 248 },
+    { "UNOWN_!", 244 },
+    { "GRANBULL", 254 },
+    { "SUNFLORA", 209 },
+    { "SHELGON", 426 },
+    { "DUSTOX", 313 },
+    { "CATERPIE", 9 },
+    { "MEDICHAM", 352 },
+    { "SHUCKLE", 257 },
+    { "CHIMECHO", 412 },
+    { "VIBRAVA", 380 },
+    { "WALREIN", 419 },
+    { "CLAYDOL", 395 },
+    { "CHARMELEON", 4 },
+    { "ARON", 348 },
+    { "XATU", 195 },
+    { "BAYLEEF", 170 },
+    { "SHAYMIN", 562 },
+    { "GLALIE", 416 },
+    { "DUSKULL", 409 },
+    { "DRIFBLIM", 490 },
+    { "GRAVELER_NORMAL", 86 },
+    { "RATICATE", 20 },
+    { "DITTO", 149 },
+    { "STARAPTOR", 455 },
+    { "GULPIN", 360 },
+    { "MANTINE", 270 },
+    { "TYPHLOSION", 174 },
+    { "MISDREAVUS", 217 },
+    { "MUK_NORMAL", 103 },
+    { "DRAPION", 516 },
+    { "MAROWAK_NORMAL", 121 },
+    { "SNOVER", 523 },
+    { "NOSEPASS", 343 },
+    { "CRESSELIA", 558 },
+    { "LUMINEON", 521 },
+    { "AIPOM", 207 },
+    { "CHARIZARD", 5 },
+    { "GLISCOR", 536 },
+    { "MEWTWO", 167 },
+    { "ARCEUS_WATER", 574 },
+    { "MOTHIM", 475 },
+    { "HARIYAMA", 341 },
+    { "ROTOM_FAN", 545 },
+    { "RHYDON", 129 },
+    { "SHELLOS_WEST_SEA", 484 },
+    { "COMBEE", 476 },
+    { "KECLEON", 406 },
+    { "VULPIX_NORMAL", 41 },
+    { "BELLOSSOM", 199 },
+    { "FINNEON", 520 },
+    { "YANMEGA", 533 },
+    { "KINGDRA", 274 },
+    { "MACHAMP", 78 },
+    { "JUMPLUFF", 206 },
+    { "ABSOL", 413 },
+    { "PUPITAR", 291 },
+    { "EXEGGUTOR_NORMAL", 118 },
+    { "SHROOMISH", 329 },
+    { "OMASTAR", 156 },
+    { "DRAGONITE", 166 },
+    { "MAGNEZONE", 526 },
+    { "ROTOM", 543 },
+    { "MARILL", 200 },
+    { "MARSHTOMP", 303 },
+    { "FERALIGATR", 177 },
+    { "PHIONE", 559 },
+    { "MUDKIP", 302 },
+    { "MAGNEMITE", 94 },
+    { "RAICHU_NORMAL", 27 },
+    { "BUNEARY", 491 },
+    { "MUNCHLAX", 510 },
+    { "KABUTO", 157 },
+    { "SPINDA_04", 375 },
+    { "LEDYBA", 182 },
+    { "BURMY_SANDY", 470 },
+    { "WORMADAM_TRASH", 474 },
+    { "PURUGLY", 496 },
+    { "PERSIAN", 62 },
+    { "STARMIE", 138 },
+    { "SANDSLASH", 31 },
+    { "RAYQUAZA", 438 },
+    { "MURKROW", 215 },
+    { "ARCEUS_FIRE", 573 },
+    { "URSARING", 261 },
+    { "BURMY_PLANT", 469 },
+    { "ELECTRODE", 116 },
+    { "SMOOCHUM", 282 },
+    { "SLAKING", 333 },
+    { "CHANSEY", 130 },
+    { "ARCEUS_ICE", 578 },
+    { "SEADRA", 134 },
+    { "SWINUB", 264 },
+    { "DEWGONG", 100 },
+    { "BARBOACH", 390 },
+    { "BONSLY", 502 },
+    { "VENUSAUR", 2 },
+    { "GRIMER", 101 },
+    { "VOLTORB", 115 },
+    { "ARIADOS", 185 },
+    { "UNOWN_Y", 242 },
+    { "UNOWN_G", 224 },
+    { "KRICKETUNE", 459 },
+    { "ODDISH", 49 },
+    { "BLASTOISE", 8 },
+    { "ROSELIA", 359 },
+    { "GEODUDE_ALOLA", 85 },
+    { "ZUBAT", 47 },
+    { "SPIRITOMB", 506 },
+    { "TYRANITAR", 292 },
+    { "EMPOLEON", 452 },
+    { "RATICATE_ALOLA", 21 },
+    { "BIBAREL", 457 },
+    { "NIDORINA", 34 },
+    { "PRIMEAPE", 67 },
+    { "BASTIODON", 468 },
+    { "NUMEL", 366 },
+    { "KRABBY", 113 },
+    { "UNOWN_T", 237 },
+    { "MANECTRIC", 354 },
+    { "CHIKORITA", 169 },
+    { "MINUN", 356 },
+    { "UNOWN_E", 223 },
+    { "GYARADOS", 147 },
+    { "CLAMPERL", 420 },
+    { "LINOONE", 308 },
+    { "BLISSEY", 286 },
+    { "FARFETCH'D", 96 },
+    { "PORYGON_Z", 538 },
+    { "MACHOKE", 77 },
+    { "ZIGZAGOON", 307 },
+    { "FLOATZEL", 480 },
+    { "TENTACRUEL", 83 },
+    { "GARDEVOIR", 326 },
+    { "METAPOD", 10 },
+    { "MEOWTH_NORMAL", 60 },
+    { "LICKITUNG", 125 },
+    { "HOUNDOOM", 273 },
+    { "GLOOM", 50 },
+    { "ROSERADE", 464 },
+    { "SANDSHREW_ALOLA", 30 },
+    { "BURMY_TRASH", 471 },
+    { "MR_MIME", 139 },
+    { "SUNKERN", 208 },
+    { "ESPEON", 213 },
+    { "PARAS", 52 },
+    { "ARCEUS_POISON", 567 },
+    { "MACHOP", 76 },
+    { "NINJASK", 335 },
+    { "ARCEUS_GROUND", 568 },
+    { "CELEBI", 295 },
+    { "TURTWIG", 444 },
+    { "AMPHAROS", 198 },
+    { "BLAZIKEN", 301 },
+    { "MILTANK", 285 },
+    { "UNOWN_L", 229 },
+    { "MAGIKARP", 146 },
+    { "JIGGLYPUFF", 45 },
+    { "CASTFORM_SNOWY", 405 },
+    { "UNOWN_V", 239 },
+    { "UNOWN_R", 235 },
+    { "GLIGAR", 251 },
+    { "BEAUTIFLY", 311 },
+    { "SPINDA_07", 378 },
+    { "STANTLER", 278 },
+    { "KYOGRE", 436 },
+    { "MUK_ALOLA", 104 },
+    { "QWILFISH", 255 },
+    { "VAPOREON", 151 },
+    { "KANGASKHAN", 132 },
+    { "VESPIQUEN", 477 },
+    { "STARLY", 453 },
+    { "SWABLU", 384 },
+    { "QUILAVA", 173 },
+    { "ROTOM_NORMAL", 543 },
+    { "UNOWN_Q", 234 },
+    { "RAIKOU", 287 },
+    { "TANGELA", 131 },
+    { "FARFETCHD", 96 },
+    { "SANDSHREW", 29 },
+    { "UNOWN_I", 226 },
+    { "UNOWN_D", 222 },
+    { "POLITOED", 203 },
+    { "UNOWN_QUESTION_MARK", 245 },
+    { "UNOWN_B", 220 },
+    { "WEAVILE", 525 },
+    { "MEOWTH_ALOLA", 61 },
+    { "UNOWN_C", 221 },
+    { "VIGOROTH", 332 },
+    { "CHINCHOU", 187 },
+    { "LATIOS", 435 },
+    { "SHELLOS_EAST_SEA", 485 },
+    { "OMANYTE", 155 },
+    { "METAGROSS", 430 },
+    { "MEDITITE", 351 },
+    { "FORRETRESS", 249 },
+    { "CLOYSTER", 106 },
+    { "CHERRIM_OVERCAST", 482 },
+    { "DUNSPARCE", 250 },
+    { "SLOWBRO", 93 },
+    { "CLEFAIRY", 39 },
+    { "DIGLETT", 56 },
+    { "HOUNDOUR", 272 },
+    { "VOLBEAT", 357 },
+    { "BIDOOF", 456 },
+}};
+
+}
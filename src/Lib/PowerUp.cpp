@@ -0,0 +1,175 @@
+/**
+    @file PowerUp.cpp
+    @brief */
+#include "PowerUp.h"
+#include "PvpRank.h"
+#include "PoGoDb.h"
+
+#include <algorithm>
+#include <queue>
+
+namespace PoGoCmp
+{
+
+namespace
+{
+
+//! Prefix sums of the power-up costs: [i] is the cost from LevelIndex 0 to LevelIndex i.
+struct PowerUpCostTable
+{
+    PowerUpCostTable()
+    {
+        const auto& upgrades = PoGoCmp::PokemonUpgrades;
+        const auto numLevels = std::min(IvSpace::NumLevels(), upgrades.candyCost.size() * upgrades.upgradesPerLevel + 1);
+        candy.assign(numLevels, 0);
+        stardust.assign(numLevels, 0);
+        for (size_t i = 1; i < numLevels; ++i)
+        {
+            // One power-up is half a level, the costs are per level.
+            const auto level = (i - 1) / upgrades.upgradesPerLevel;
+            candy[i] = candy[i - 1] + upgrades.candyCost[level];
+            stardust[i] = stardust[i - 1] + upgrades.stardustCost[level];
+        }
+    }
+
+    std::vector<int> candy;
+    std::vector<int> stardust;
+};
+
+const PowerUpCostTable& CostTable()
+{
+    static const PowerUpCostTable table;
+    return table;
+}
+
+double Objective(UpgradeObjective objective, const PokemonSpecie& base, LevelIndex level, IvIndex iv)
+{
+    if (objective == UpgradeObjective::StatProduct)
+        return StatProduct(base, level, iv);
+    return ComputeCp(base, level, AtkIv(iv), DefIv(iv), StaIv(iv));
+}
+
+//! A segment of a Pokémon's convex hull: powering up from the previous hull vertex to the level.
+struct Segment
+{
+    size_t pokemon;
+    LevelIndex level;
+    PowerUpCost cost;
+    double gain;
+    double efficiency;
+};
+
+bool operator<(const Segment& a, const Segment& b) { return a.efficiency < b.efficiency; }
+
+} // ~unnamed namespace
+
+PowerUpCost PowerUpCostBetween(LevelIndex from, LevelIndex to)
+{
+    const auto& table = CostTable();
+    if ((size_t)to >= table.candy.size() || from > to) return { -1, -1 };
+    return {
+        table.candy[(size_t)to] - table.candy[(size_t)from],
+        table.stardust[(size_t)to] - table.stardust[(size_t)from]
+    };
+}
+
+UpgradePlan OptimizeUpgrades(
+    const std::vector<OwnedPokemon>& roster, PowerUpCost budget, UpgradeObjective objective, LevelIndex maxLevel)
+{
+    UpgradePlan plan{ {}, { 0, 0 }, 0 };
+    for (const auto& pkm : roster)
+        plan.levels.push_back(pkm.level);
+
+    maxLevel = std::min(maxLevel, LevelIndex(CostTable().candy.size() - 1));
+    // Both resources are weighted by the budget so that spending the whole budget of either costs the same.
+    const double candyWeight = budget.candy > 0 ? 1. / budget.candy : 1.;
+    const double stardustWeight = budget.stardust > 0 ? 1. / budget.stardust : 1.;
+    auto weightedCost = [&](const PowerUpCost& cost) { return cost.candy * candyWeight + cost.stardust * stardustWeight; };
+
+    // Upper convex hull of each Pokémon's (weighted cost, gain) options, as consecutive segments with decreasing
+    // efficiency. Only the next segment of each Pokémon is in the queue as the segments must be taken in order.
+    std::vector<std::vector<Segment>> hulls(roster.size());
+    std::vector<size_t> nextSegment(roster.size(), 0);
+    std::priority_queue<Segment> queue;
+    for (size_t i = 0; i < roster.size(); ++i)
+    {
+        const auto& pkm = roster[i];
+        if (pkm.specie >= NumSpecies() || pkm.level >= maxLevel) continue;
+        const auto& base = SpecieByIndex(pkm.specie);
+        const auto value = Objective(objective, base, pkm.level, pkm.iv);
+
+        struct Point { LevelIndex level; double cost; double gain; };
+        std::vector<Point> hull{ { pkm.level, 0., 0. } };
+        for (size_t level = (size_t)pkm.level + 1; level <= (size_t)maxLevel; ++level)
+        {
+            const Point p{
+                (LevelIndex)level,
+                weightedCost(PowerUpCostBetween(pkm.level, (LevelIndex)level)),
+                Objective(objective, base, (LevelIndex)level, pkm.iv) - value
+            };
+            auto cross = [](const Point& o, const Point& a, const Point& b)
+            {
+                return (a.cost - o.cost) * (b.gain - o.gain) - (a.gain - o.gain) * (b.cost - o.cost);
+            };
+            while (hull.size() >= 2 && cross(hull[hull.size() - 2], hull.back(), p) >= 0)
+                hull.pop_back();
+            hull.push_back(p);
+        }
+
+        for (size_t j = 1; j < hull.size(); ++j)
+        {
+            const auto cost = PowerUpCostBetween(hull[j - 1].level, hull[j].level);
+            const auto gain = hull[j].gain - hull[j - 1].gain;
+            hulls[i].push_back({ i, hull[j].level, cost, gain, gain / (hull[j].cost - hull[j - 1].cost) });
+        }
+        if (!hulls[i].empty())
+            queue.push(hulls[i].front());
+    }
+
+    auto fits = [&](const PowerUpCost& cost)
+    {
+        return plan.cost.candy + cost.candy <= budget.candy && plan.cost.stardust + cost.stardust <= budget.stardust;
+    };
+    auto take = [&](const Segment& segment)
+    {
+        plan.levels[segment.pokemon] = segment.level;
+        plan.cost.candy += segment.cost.candy;
+        plan.cost.stardust += segment.cost.stardust;
+        plan.gain += segment.gain;
+    };
+    while (!queue.empty())
+    {
+        const auto segment = queue.top();
+        queue.pop();
+        if (segment.gain <= 0) continue;
+        const auto from = plan.levels[segment.pokemon];
+        if (!fits(PowerUpCostBetween(from, segment.level)))
+        {
+            // The rest of the hull can be reached only through this segment, so instead power up to the level
+            // below the segment's end with the most gain that still fits, if any, and leave the Pokémon there.
+            const auto& pkm = roster[segment.pokemon];
+            const auto& base = SpecieByIndex(pkm.specie);
+            const auto value = Objective(objective, base, from, pkm.iv);
+            Segment best{ segment.pokemon, from, { 0, 0 }, 0., 0. };
+            for (size_t level = (size_t)from + 1; level < (size_t)segment.level; ++level)
+            {
+                const auto cost = PowerUpCostBetween(from, (LevelIndex)level);
+                // The cost grows with the level.
+                if (!fits(cost)) break;
+                const auto gain = Objective(objective, base, (LevelIndex)level, pkm.iv) - value;
+                if (gain > best.gain)
+                    best = { segment.pokemon, (LevelIndex)level, cost, gain, 0. };
+            }
+            if (best.gain > 0)
+                take(best);
+            continue;
+        }
+        take(segment);
+        if (++nextSegment[segment.pokemon] < hulls[segment.pokemon].size())
+            queue.push(hulls[segment.pokemon][nextSegment[segment.pokemon]]);
+    }
+
+    return plan;
+}
+
+} // ~namespace PoGoCmp
@@ -0,0 +1,62 @@
+/**
+    @file PowerUp.h
+    @brief Power-up costs and an optimizer for spending a stardust and candy budget on a roster of Pokémon. */
+#pragma once
+
+#include "IvSpace.h"
+
+#include <vector>
+
+namespace PoGoCmp
+{
+
+struct PowerUpCost
+{
+    int candy;
+    int stardust;
+};
+
+//! @return The cost of powering up from a level to another one in O(1), using prefix sums of
+//! PokemonUpgrades.candyCost and PokemonUpgrades.stardustCost. {-1, -1} for invalid levels or if from > to.
+PowerUpCost PowerUpCostBetween(LevelIndex from, LevelIndex to);
+
+//! A Pokémon of a player.
+struct OwnedPokemon
+{
+    SpecieIndex specie;
+    LevelIndex level;
+    IvIndex iv;
+};
+
+enum class UpgradeObjective : uint8_t
+{
+    //! Maximize the sum of CPs.
+    Cp,
+    //! Maximize the sum of stat products, see StatProduct().
+    StatProduct
+};
+
+struct UpgradePlan
+{
+    //! Target level for each Pokémon of the roster, the current level if not to be powered up.
+    std::vector<LevelIndex> levels;
+    //! Total cost of the plan.
+    PowerUpCost cost;
+    //! Total increase of the objective.
+    double gain;
+};
+
+//! Picks the power-ups that maximize the objective within the budget.
+//! The problem is a multiple-choice knapsack (one target level per Pokémon) with two constraints. It's solved greedily:
+//! for each Pokémon the upper convex hull of its (cost, gain) options is computed, with stardust and candy weighted by
+//! the budget, and the hull segments of all Pokémon are taken in the order of efficiency. When a segment doesn't fit,
+//! the Pokémon is powered up to the level below the segment's end with the most gain that fits, if any, instead.
+//! This is a heuristic without an approximation guarantee: it's optimal for a single Pokémon, but with a budget of
+//! only a few power-ups the indivisible segments can leave it well below the optimum. Takes O(N * L * log(N * L))
+//! time, where L is the number of levels.
+//! @param maxLevel Max. target level, e.g. trainer level + PokemonUpgrades.allowedLevelsAbovePlayer.
+UpgradePlan OptimizeUpgrades(
+    const std::vector<OwnedPokemon>& roster, PowerUpCost budget, UpgradeObjective objective,
+    LevelIndex maxLevel = LevelIndex(IvSpace::NumLevels() - 1));
+
+} // ~namespace PoGoCmp
@@ -0,0 +1,233 @@
+/**
+    @file PvpRank.cpp
+    @brief */
+#include "PvpRank.h"
+#include "BaseStatsCache.h"
+#include "PoGoDb.h"
+#include "Parallel.h"
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <numeric>
+
+namespace PoGoCmp
+{
+
+namespace
+{
+
+const League allLeagues[]{ League::Little, League::Great, League::Ultra, League::Master };
+const char* const leagueNames[]{ "little", "great", "ultra", "master" };
+
+const char fileMagic[4]{ 'P', 'G', 'P', 'R' };
+const uint32_t fileVersion = 2;
+const size_t fileHeaderSize = sizeof(fileMagic) + 4 * sizeof(uint32_t);
+const size_t fileTableSize = NumIvCombinations * (sizeof(uint16_t) + sizeof(LevelIndex));
+
+void AppendLittleEndian(std::vector<uint8_t>& buffer, uint32_t value, size_t numBytes)
+{
+    for (size_t i = 0; i < numBytes; ++i)
+        buffer.push_back(uint8_t(value >> (8 * i)));
+}
+
+uint32_t ReadLittleEndian(const uint8_t* data, size_t numBytes)
+{
+    uint32_t value{};
+    for (size_t i = 0; i < numBytes; ++i)
+        value |= uint32_t(data[i]) << (8 * i);
+    return value;
+}
+
+//! FNV-1a hash of the game data the ranks depend on: the base stats of every specie/form and the CP multipliers.
+uint32_t RankDataHash()
+{
+    uint32_t hash = 2166136261u;
+    auto add = [&hash](uint32_t value)
+    {
+        for (size_t i = 0; i < sizeof(value); ++i)
+            hash = (hash ^ uint8_t(value >> (8 * i))) * 16777619u;
+    };
+    for (size_t i = 0; i < NumSpecies(); ++i)
+    {
+        const auto& base = SpecieByIndex((SpecieIndex)i);
+        add(base.baseAtk);
+        add(base.baseDef);
+        add(base.baseSta);
+    }
+    for (auto cpm : PoGoCmp::HalfLevelCpMultiplier)
+    {
+        uint32_t bits;
+        static_assert(sizeof(bits) == sizeof(cpm), "float is not 32-bit");
+        std::memcpy(&bits, &cpm, sizeof(bits));
+        add(bits);
+    }
+    return hash;
+}
+
+//! The game never shows HP below 10.
+const int minHp = 10;
+
+} // ~unnamed namespace
+
+int LeagueCpCap(League league)
+{
+    switch (league)
+    {
+    case League::Little: return 500;
+    case League::Great: return 1500;
+    case League::Ultra: return 2500;
+    case League::Master:
+    default: return INT_MAX;
+    }
+}
+
+const char* LeagueName(League league)
+{
+    return league < League::NUM_LEAGUES ? leagueNames[(size_t)league] : "";
+}
+
+League LeagueByName(const std::string& name)
+{
+    for (auto league : allLeagues)
+        if (CompareI(name.c_str(), LeagueName(league)) == 0)
+            return league;
+    return League::NUM_LEAGUES;
+}
+
+double StatProduct(const PokemonSpecie& base, LevelIndex level, IvIndex iv)
+{
+    const auto cpm = GetCpm(level);
+    if (std::isnan(cpm)) return 0;
+    const double atk = float(base.baseAtk + AtkIv(iv)) * cpm;
+    const double def = float(base.baseDef + DefIv(iv)) * cpm;
+    const double hp = std::max(ComputeStat(base.baseSta, StaIv(iv), level), minHp);
+    return atk * def * hp;
+}
+
+PvpRankTable::PvpRankTable(SpecieIndex idx, const IvSpace& space, int cpCap)
+{
+    // CP never decreases when the level increases, so the last level not exceeding the cap is the best one.
+    levels.fill(LevelIndex::Invalid);
+    for (size_t level = 0; level < IvSpace::NumLevels(); ++level)
+    {
+        const auto* cp = space.CpTable((LevelIndex)level);
+        for (size_t iv = 0; iv < NumIvCombinations; ++iv)
+            if (cp[iv] <= cpCap)
+                levels[iv] = (LevelIndex)level;
+    }
+
+    const auto& base = SpecieByIndex(idx);
+    std::array<double, NumIvCombinations> statProducts;
+    for (size_t iv = 0; iv < NumIvCombinations; ++iv)
+        statProducts[iv] = StatProduct(base, levels[iv], (IvIndex)iv);
+    RankByStatProduct(statProducts);
+}
+
+PvpRankTable::PvpRankTable(const uint16_t* ranks_, const LevelIndex* levels_)
+{
+    std::copy(ranks_, ranks_ + NumIvCombinations, ranks.begin());
+    std::copy(levels_, levels_ + NumIvCombinations, levels.begin());
+    for (size_t iv = 0; iv < NumIvCombinations; ++iv)
+        byRank[ranks[iv] - 1] = (IvIndex)iv;
+}
+
+void PvpRankTable::RankByStatProduct(const std::array<double, NumIvCombinations>& statProducts)
+{
+    std::iota(byRank.begin(), byRank.end(), IvIndex{0});
+    std::stable_sort(byRank.begin(), byRank.end(),
+        [&statProducts](IvIndex a, IvIndex b) { return statProducts[a] > statProducts[b]; });
+    for (size_t i = 0; i < NumIvCombinations; ++i)
+        ranks[byRank[i]] = uint16_t(i + 1);
+}
+
+std::vector<PvpRankTable> ComputePvpRanks(SpecieIndex idx)
+{
+    const IvSpace space{ idx };
+    std::vector<PvpRankTable> tables;
+    for (auto league : allLeagues)
+        tables.emplace_back(idx, space, LeagueCpCap(league));
+    return tables;
+}
+
+bool WritePvpRankFile(const std::string& path, unsigned numThreads)
+{
+    std::map<BaseStats, size_t> uniqueIndices;
+    std::vector<SpecieIndex> uniqueSpecies;
+    std::vector<size_t> specieToUnique(NumSpecies());
+    for (size_t i = 0; i < NumSpecies(); ++i)
+    {
+        auto it = uniqueIndices.emplace(BaseStatsOf((SpecieIndex)i), uniqueSpecies.size());
+        if (it.second)
+            uniqueSpecies.push_back((SpecieIndex)i);
+        specieToUnique[i] = it.first->second;
+    }
+
+    std::vector<std::vector<PvpRankTable>> results(uniqueSpecies.size());
+    ParallelFor(uniqueSpecies.size(), numThreads,
+        [&](size_t i) { results[i] = ComputePvpRanks(uniqueSpecies[i]); });
+
+    std::ofstream file(path, std::ios::binary);
+    if (!file) return false;
+
+    std::vector<uint8_t> buffer(fileMagic, fileMagic + sizeof(fileMagic));
+    AppendLittleEndian(buffer, fileVersion, sizeof(uint32_t));
+    AppendLittleEndian(buffer, (uint32_t)NumSpecies(), sizeof(uint32_t));
+    AppendLittleEndian(buffer, (uint32_t)League::NUM_LEAGUES, sizeof(uint32_t));
+    AppendLittleEndian(buffer, RankDataHash(), sizeof(uint32_t));
+    file.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+
+    for (size_t i = 0; i < NumSpecies(); ++i)
+    {
+        for (const auto& table : results[specieToUnique[i]])
+        {
+            buffer.clear();
+            for (auto rank : table.Ranks())
+                AppendLittleEndian(buffer, rank, sizeof(uint16_t));
+            for (auto level : table.Levels())
+                buffer.push_back((uint8_t)level);
+            file.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+        }
+    }
+    return (bool)file;
+}
+
+bool PvpRankFile::Load(const std::string& path)
+{
+    data.clear();
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return false;
+    std::vector<uint8_t> contents{ std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+
+    const auto numTables = NumSpecies() * (size_t)League::NUM_LEAGUES;
+    if (contents.size() != fileHeaderSize + numTables * fileTableSize) return false;
+    if (!std::equal(fileMagic, fileMagic + sizeof(fileMagic), contents.begin())) return false;
+    const auto* header = contents.data() + sizeof(fileMagic);
+    if (ReadLittleEndian(header, sizeof(uint32_t)) != fileVersion) return false;
+    if (ReadLittleEndian(header + 4, sizeof(uint32_t)) != NumSpecies()) return false;
+    if (ReadLittleEndian(header + 8, sizeof(uint32_t)) != (uint32_t)League::NUM_LEAGUES) return false;
+    if (ReadLittleEndian(header + 12, sizeof(uint32_t)) != RankDataHash()) return false;
+
+    data = std::move(contents);
+    return true;
+}
+
+size_t PvpRankFile::TableOffset(SpecieIndex idx, League league) const
+{
+    return fileHeaderSize + ((size_t)idx * (size_t)League::NUM_LEAGUES + (size_t)league) * fileTableSize;
+}
+
+int PvpRankFile::Rank(SpecieIndex idx, League league, IvIndex iv) const
+{
+    return (int)ReadLittleEndian(&data[TableOffset(idx, league) + iv * sizeof(uint16_t)], sizeof(uint16_t));
+}
+
+LevelIndex PvpRankFile::Level(SpecieIndex idx, League league, IvIndex iv) const
+{
+    return (LevelIndex)data[TableOffset(idx, league) + NumIvCombinations * sizeof(uint16_t) + iv];
+}
+
+} // ~namespace PoGoCmp
@@ -0,0 +1,90 @@
+/**
+    @file PvpRank.h
+    @brief PvP league IV rankings: the best level for each IV combination under a CP cap, ranked by stat product. */
+#pragma once
+
+#include "IvSpace.h"
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace PoGoCmp
+{
+
+enum class League : uint8_t { Little, Great, Ultra, Master, NUM_LEAGUES };
+
+//! @return CP cap of the league, INT_MAX for Master League.
+int LeagueCpCap(League league);
+//! @return "little", "great", "ultra", or "master".
+const char* LeagueName(League league);
+//! @param name Case-insensitive LeagueName().
+//! @return League::NUM_LEAGUES if not a valid name.
+League LeagueByName(const std::string& name);
+
+//! Rankings of all IV combinations of a specie in a league.
+class PvpRankTable
+{
+public:
+    //! @param idx [0, NumSpecies()), undefined behavior otherwise.
+    //! @param space IvSpace of the specie.
+    //! @param cpCap Max. CP allowed.
+    //! The stat product uses the unrounded attack and defense and the HP as shown in the game.
+    //! Combinations with equal stat products are ranked by IvIndex, ascending.
+    PvpRankTable(SpecieIndex idx, const IvSpace& space, int cpCap);
+    //! Constructs a table from precomputed ranks and levels, e.g. the ones stored in a file.
+    PvpRankTable(const uint16_t* ranks, const LevelIndex* levels);
+
+    //! @return [1, NumIvCombinations].
+    int Rank(IvIndex iv) const { return ranks[iv]; }
+    //! @return The highest level not exceeding the CP cap, LevelIndex::Invalid if even the lowest level exceeds it.
+    LevelIndex Level(IvIndex iv) const { return levels[iv]; }
+    //! @param rank [1, NumIvCombinations], undefined behavior otherwise.
+    IvIndex IvByRank(int rank) const { return byRank[rank - 1]; }
+
+    const std::array<uint16_t, NumIvCombinations>& Ranks() const { return ranks; }
+    const std::array<LevelIndex, NumIvCombinations>& Levels() const { return levels; }
+
+private:
+    void RankByStatProduct(const std::array<double, NumIvCombinations>& statProducts);
+
+    std::array<uint16_t, NumIvCombinations> ranks;
+    std::array<LevelIndex, NumIvCombinations> levels;
+    std::array<IvIndex, NumIvCombinations> byRank;
+};
+
+//! @return The stat product of the IV combination at the level, 0 for an invalid level.
+double StatProduct(const PokemonSpecie& base, LevelIndex level, IvIndex iv);
+
+//! @return Rank tables of all leagues, indexed by League.
+std::vector<PvpRankTable> ComputePvpRanks(SpecieIndex idx);
+
+//! Computes the rank tables of all species and leagues in parallel and writes them to a file.
+//! Each unique set of base stats is computed only once. The IvSpaces are not cached.
+//! @param numThreads 0 for std::thread::hardware_concurrency().
+//! @return False if writing the file failed.
+bool WritePvpRankFile(const std::string& path, unsigned numThreads = 0);
+
+//! Rank tables of all species and leagues loaded from a file written by WritePvpRankFile().
+//! File layout, little-endian: the header (magic, version, number of species, number of leagues, hash of the base
+//! stats and the CP multipliers the ranks were computed from), followed by
+//! a table for each specie and league, specie-major: NumIvCombinations uint16 ranks and NumIvCombinations uint8 levels.
+class PvpRankFile
+{
+public:
+    //! @return False if the file couldn't be read or it doesn't match the current database.
+    bool Load(const std::string& path);
+
+    //! @param idx [0, NumSpecies()), undefined behavior otherwise, as well as if nothing is loaded.
+    int Rank(SpecieIndex idx, League league, IvIndex iv) const;
+    LevelIndex Level(SpecieIndex idx, League league, IvIndex iv) const;
+
+private:
+    size_t TableOffset(SpecieIndex idx, League league) const;
+
+    std::vector<uint8_t> data;
+};
+
+} // ~namespace PoGoCmp
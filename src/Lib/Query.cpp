@@ -0,0 +1,441 @@
+/**
+    @file Query.cpp
+    @brief */
+#include "Query.h"
+#include "MathUtils.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+
+namespace PoGoCmp
+{
+
+namespace
+{
+
+//! The columns available to SpeciesFilter, the argument of OpCode::Field.
+enum class FilterField : uint16_t
+{
+    Number, Atk, Def, Sta, Bulk, Total, Cp, MinCp, Gender, Buddy,
+    Type, Type2, Rarity
+};
+
+struct FilterFieldName
+{
+    std::string_view name;
+    FilterField field;
+};
+
+const FilterFieldName filterFieldNames[] =
+{
+    { "number", FilterField::Number },
+    { "atk", FilterField::Atk }, { "attack", FilterField::Atk },
+    { "def", FilterField::Def }, { "defense", FilterField::Def },
+    { "sta", FilterField::Sta }, { "hp", FilterField::Sta }, { "stamina", FilterField::Sta },
+    { "bulk", FilterField::Bulk },
+    { "total", FilterField::Total },
+    { "cp", FilterField::Cp },
+    { "mincp", FilterField::MinCp },
+    { "gender", FilterField::Gender },
+    { "buddy", FilterField::Buddy },
+    { "type", FilterField::Type },
+    { "type2", FilterField::Type2 },
+    { "rarity", FilterField::Rarity }
+};
+
+//! The pseudo-field for OpCode::Learns.
+constexpr std::string_view moveFieldName = "move";
+
+//! Limits the recursion of the parser, e.g. for "((((...".
+constexpr size_t MaxFilterNesting = 256;
+
+bool IsEnumField(FilterField field) { return field >= FilterField::Type; }
+
+float FieldValue(FilterField field, SpecieIndex idx)
+{
+    // The commonly used columns are read from PokemonColumns, the rest from the full PokemonSpecie.
+    const auto& columns = PokemonColumns;
+    switch (field)
+    {
+    case FilterField::Number: return columns.number[idx];
+    case FilterField::Atk: return columns.baseAtk[idx];
+    case FilterField::Def: return columns.baseDef[idx];
+    case FilterField::Sta: return columns.baseSta[idx];
+    case FilterField::Bulk: return float(SpecieByIndex(idx).bulk);
+    case FilterField::Total: return SpecieByIndex(idx).total;
+    case FilterField::Cp: return SpecieByIndex(idx).maxCp;
+    case FilterField::MinCp: return SpecieByIndex(idx).minCp;
+    case FilterField::Gender:
+    {
+        // Same as the "gender" sorting criteria of the CLI: genderless sorts last.
+        const auto& pkm = SpecieByIndex(idx);
+        return MathUtils::IsZero(pkm.malePercent) && MathUtils::IsZero(pkm.femalePercent) ? INFINITY : pkm.malePercent;
+    }
+    case FilterField::Buddy: return columns.buddyDistance[idx];
+    case FilterField::Type: return (float)columns.type[idx];
+    case FilterField::Type2: return (float)columns.type2[idx];
+    case FilterField::Rarity: return (float)columns.rarity[idx];
+    }
+    return NAN;
+}
+
+std::string ToLower(std::string_view str)
+{
+    std::string lower(str);
+    for (auto& c : lower)
+        c = (char)std::tolower((unsigned char)c);
+    return lower;
+}
+
+//! Recursive descent parser emitting the bytecode in postfix order.
+class FilterCompiler
+{
+public:
+    using OpCode = SpeciesFilter::OpCode;
+
+    FilterCompiler(std::string_view expression, std::vector<SpeciesFilter::Instruction>& output) :
+        expr(expression), code(output)
+    {
+    }
+
+    bool Compile(std::string& error)
+    {
+        Next();
+        if (token == Token::End) return Fail("Empty expression", error);
+        if (!ParseOr(error)) return false;
+        if (token != Token::End) return Fail("Unexpected '" + std::string(tokenText) + "'", error);
+        if (maxDepth > SpeciesFilter::MaxStackSize) return Fail("Expression too complex", error);
+        return true;
+    }
+
+private:
+    enum class Token { End, Name, Number, And, Or, Not, LeftParen, RightParen, Compare, Invalid };
+
+    void Next()
+    {
+        while (pos < expr.size() && std::isspace((unsigned char)expr[pos]))
+            ++pos;
+        tokenPos = pos;
+        if (pos == expr.size()) { token = Token::End; tokenText = {}; return; }
+
+        const auto isNameChar = [](char c) { return std::isalnum((unsigned char)c) || c == '_'; };
+        const auto rest = expr.substr(pos);
+        size_t len = 1;
+        if (std::isdigit((unsigned char)rest[0]) || rest[0] == '.')
+        {
+            while (len < rest.size() && (std::isdigit((unsigned char)rest[len]) || rest[len] == '.'))
+                ++len;
+            token = Token::Number;
+        }
+        else if (isNameChar(rest[0]))
+        {
+            while (len < rest.size() && isNameChar(rest[len]))
+                ++len;
+            token = Token::Name;
+        }
+        else if (rest.compare(0, 2, "&&") == 0) { token = Token::And; len = 2; }
+        else if (rest.compare(0, 2, "||") == 0) { token = Token::Or; len = 2; }
+        else if (rest.compare(0, 2, "!=") == 0) { token = Token::Compare; compareOp = CompareOp::NotEqual; len = 2; }
+        else if (rest.compare(0, 2, "<=") == 0) { token = Token::Compare; compareOp = CompareOp::LessEqual; len = 2; }
+        else if (rest.compare(0, 2, ">=") == 0) { token = Token::Compare; compareOp = CompareOp::GreaterEqual; len = 2; }
+        else if (rest.compare(0, 2, "==") == 0) { token = Token::Compare; compareOp = CompareOp::Equal; len = 2; }
+        else if (rest[0] == '=') { token = Token::Compare; compareOp = CompareOp::Equal; }
+        else if (rest[0] == '<') { token = Token::Compare; compareOp = CompareOp::Less; }
+        else if (rest[0] == '>') { token = Token::Compare; compareOp = CompareOp::Greater; }
+        else if (rest[0] == '!') { token = Token::Not; }
+        else if (rest[0] == '(') { token = Token::LeftParen; }
+        else if (rest[0] == ')') { token = Token::RightParen; }
+        else { token = Token::Invalid; }
+        tokenText = rest.substr(0, len);
+        pos += len;
+    }
+
+    bool Fail(const std::string& msg, std::string& error)
+    {
+        error = msg + " at position " + std::to_string(tokenPos + 1);
+        return false;
+    }
+
+    void Emit(OpCode op, uint16_t arg = 0, float value = 0)
+    {
+        code.push_back({ op, arg, value });
+        if (op == OpCode::Field || op == OpCode::Constant || op == OpCode::Learns)
+            maxDepth = std::max(maxDepth, ++depth);
+        else if (op != OpCode::Not)
+            --depth;
+    }
+
+    bool ParseOr(std::string& error)
+    {
+        if (!ParseAnd(error)) return false;
+        while (token == Token::Or)
+        {
+            Next();
+            if (!ParseAnd(error)) return false;
+            Emit(OpCode::Or);
+        }
+        return true;
+    }
+
+    bool ParseAnd(std::string& error)
+    {
+        if (!ParseUnary(error)) return false;
+        while (token == Token::And)
+        {
+            Next();
+            if (!ParseUnary(error)) return false;
+            Emit(OpCode::And);
+        }
+        return true;
+    }
+
+    bool ParseUnary(std::string& error)
+    {
+        if (++nesting > MaxFilterNesting) return Fail("Expression nested too deeply", error);
+        bool ok;
+        if (token == Token::Not)
+        {
+            Next();
+            ok = ParseUnary(error);
+            if (ok) Emit(OpCode::Not);
+        }
+        else if (token == Token::LeftParen)
+        {
+            Next();
+            ok = ParseOr(error);
+            if (ok && token != Token::RightParen) ok = Fail("Expected ')'", error);
+            if (ok) Next();
+        }
+        else
+        {
+            ok = ParseComparison(error);
+        }
+        --nesting;
+        return ok;
+    }
+
+    bool ParseComparison(std::string& error)
+    {
+        const auto name = ToLower(tokenText);
+        if (token == Token::Name && name == moveFieldName)
+        {
+            Next();
+            const auto op = compareOp;
+            if (token != Token::Compare || (op != CompareOp::Equal && op != CompareOp::NotEqual))
+                return Fail("Expected '=' or '!=' after 'move'", error);
+            Next();
+            const auto move = token == Token::Name ? MoveIdByName(tokenText) : MoveId::NONE;
+            if (move == MoveId::NONE) return Fail("Unknown move '" + std::string(tokenText) + "'", error);
+            Next();
+            Emit(OpCode::Learns, (uint16_t)move);
+            if (op == CompareOp::NotEqual) Emit(OpCode::Not);
+            return true;
+        }
+
+        const auto* field = FindField(name);
+        if (token == Token::Name && field && IsEnumField(field->field))
+        {
+            Next();
+            const auto op = compareOp;
+            if (token != Token::Compare || (op != CompareOp::Equal && op != CompareOp::NotEqual))
+                return Fail("Expected '=' or '!=' after '" + std::string(field->name) + "'", error);
+            Next();
+            const auto valueStr = std::string(tokenText);
+            float value = NAN;
+            if (token == Token::Name && field->field == FilterField::Rarity)
+            {
+                const auto rarity = StringToPokemonRarity(valueStr.c_str());
+                if (rarity != PokemonRarity::NONE) value = (float)rarity;
+            }
+            else if (token == Token::Name)
+            {
+                const auto type = StringToPokemonType(valueStr.c_str());
+                // Only the secondary type can be none.
+                if (type != PokemonType::NONE || (field->field == FilterField::Type2 && ToLower(valueStr) == "none"))
+                    value = (float)type;
+            }
+            if (std::isnan(value))
+                return Fail("Invalid value '" + valueStr + "' for '" + std::string(field->name) + "'", error);
+            Next();
+            Emit(OpCode::Field, (uint16_t)field->field);
+            Emit(OpCode::Constant, 0, value);
+            Emit(OpCode::Compare, (uint16_t)op);
+            return true;
+        }
+
+        if (!ParseNumeric(error)) return false;
+        if (token != Token::Compare) return Fail("Expected a comparison operator", error);
+        const auto op = compareOp;
+        Next();
+        if (!ParseNumeric(error)) return false;
+        Emit(OpCode::Compare, (uint16_t)op);
+        return true;
+    }
+
+    bool ParseNumeric(std::string& error)
+    {
+        if (token == Token::Number)
+        {
+            const std::string str(tokenText);
+            char* end = nullptr;
+            const auto value = std::strtof(str.c_str(), &end);
+            if (end != str.c_str() + str.size()) return Fail("Invalid number '" + str + "'", error);
+            Next();
+            Emit(OpCode::Constant, 0, value);
+            return true;
+        }
+        const auto* field = token == Token::Name ? FindField(ToLower(tokenText)) : nullptr;
+        if (!field || IsEnumField(field->field))
+        {
+            if (token == Token::End) return Fail("Unexpected end of expression", error);
+            return Fail("Expected a number or a numeric property instead of '" + std::string(tokenText) + "'", error);
+        }
+        Next();
+        Emit(OpCode::Field, (uint16_t)field->field);
+        return true;
+    }
+
+    static const FilterFieldName* FindField(const std::string& name)
+    {
+        for (const auto& field : filterFieldNames)
+            if (field.name == name) return &field;
+        return nullptr;
+    }
+
+    std::string_view expr;
+    std::vector<SpeciesFilter::Instruction>& code;
+    size_t pos{};
+    Token token{};
+    std::string_view tokenText;
+    size_t tokenPos{};
+    CompareOp compareOp{};
+    size_t depth{};
+    size_t maxDepth{};
+    size_t nesting{};
+};
+
+} // ~unnamed namespace
+
+bool Compare(float lhs, CompareOp op, float rhs)
+{
+    switch (op)
+    {
+    case CompareOp::Any: return true;
+    case CompareOp::Less: return lhs < rhs;
+    case CompareOp::LessEqual: return lhs <= rhs;
+    case CompareOp::Greater: return lhs > rhs;
+    case CompareOp::GreaterEqual: return lhs >= rhs;
+    case CompareOp::Equal: return MathUtils::Equals(lhs, rhs);
+    case CompareOp::NotEqual: return !MathUtils::Equals(lhs, rhs);
+    }
+    return false;
+}
+
+bool SpeciesFilter::Compile(std::string_view expression, std::string* error)
+{
+    code.clear();
+    std::string compileError;
+    if (FilterCompiler(expression, code).Compile(compileError)) return true;
+    code.clear();
+    if (error) *error = std::move(compileError);
+    return false;
+}
+
+bool SpeciesFilter::Matches(SpecieIndex idx) const
+{
+    if (code.empty()) return true;
+    // The compiler guarantees that the stack doesn't overflow and that each operator has its operands.
+    float stack[MaxStackSize];
+    size_t top = 0;
+    for (const auto& ins : code)
+    {
+        switch (ins.op)
+        {
+        case OpCode::Field: stack[top++] = FieldValue((FilterField)ins.arg, idx); break;
+        case OpCode::Constant: stack[top++] = ins.value; break;
+        case OpCode::Compare: --top; stack[top - 1] = Compare(stack[top - 1], (CompareOp)ins.arg, stack[top]); break;
+        case OpCode::Learns:
+        {
+            const auto learners = LearnersOf((MoveId)ins.arg);
+            stack[top++] = std::binary_search(learners.begin(), learners.end(), idx);
+            break;
+        }
+        case OpCode::And: --top; stack[top - 1] = stack[top - 1] != 0 && stack[top] != 0; break;
+        case OpCode::Or: --top; stack[top - 1] = stack[top - 1] != 0 || stack[top] != 0; break;
+        case OpCode::Not: stack[top - 1] = stack[top - 1] == 0; break;
+        }
+    }
+    return stack[0] != 0;
+}
+
+std::vector<SpecieIndex> RunQuery(const SpeciesQuery& query)
+{
+    const auto numSpecies = NumSpecies();
+    const auto& columns = PokemonColumns;
+
+    // Compile the ranges and the moves into a single membership bitmap and the span of species to scan.
+    size_t first = 0, last = numSpecies;
+    std::vector<bool> member;
+    if (!query.ranges.empty())
+    {
+        member.assign(numSpecies, false);
+        first = numSpecies;
+        last = 0;
+        for (const auto& range : query.ranges)
+        {
+            const auto rangeLast = std::min<size_t>(range.last, numSpecies);
+            if (range.first >= rangeLast) continue;
+            std::fill(member.begin() + range.first, member.begin() + rangeLast, true);
+            first = std::min<size_t>(first, range.first);
+            last = std::max(last, rangeLast);
+        }
+    }
+    if (!query.moves.empty())
+    {
+        std::vector<bool> learnsAnyMove(numSpecies);
+        for (auto move : query.moves)
+            for (auto idx : LearnersOf(move))
+                learnsAnyMove[idx] = true;
+        if (member.empty())
+            member = std::move(learnsAnyMove);
+        else
+            for (size_t i = first; i < last; ++i)
+                member[i] = member[i] && learnsAnyMove[i];
+    }
+
+    std::vector<bool> statGroupSeen(query.uniqueStats ? numSpecies : 0);
+    std::vector<SpecieIndex> result;
+    for (size_t i = first; i < last; ++i)
+    {
+        if (!member.empty() && !member[i]) continue;
+        if (query.rarities && !(query.rarities & (1u << (unsigned)columns.rarity[i]))) continue;
+        if (query.types)
+        {
+            const auto typeBits = (1u << (unsigned)columns.type[i]) |
+                (columns.type2[i] != PokemonType::NONE ? 1u << (unsigned)columns.type2[i] : 0u);
+            if (!(query.types & typeBits)) continue;
+        }
+        // The filters are the only criteria that need the full PokemonSpecie.
+        if (!query.filters.empty())
+        {
+            const auto& pkm = SpecieByIndex((SpecieIndex)i);
+            if (!std::all_of(query.filters.begin(), query.filters.end(),
+                [&pkm](const auto& filter) { return Compare(filter.property(pkm), filter.op, filter.value); }))
+                continue;
+        }
+        if (!query.expression.Matches((SpecieIndex)i)) continue;
+        // Last, so that a form left out by the other criteria doesn't hide the rest of its group.
+        if (query.uniqueStats)
+        {
+            const auto statGroup = columns.statGroup[i];
+            if (statGroupSeen[statGroup]) continue;
+            statGroupSeen[statGroup] = true;
+        }
+        result.push_back((SpecieIndex)i);
+    }
+    return result;
+}
+
+} // ~namespace PoGoCmp
@@ -0,0 +1,134 @@
+/**
+    @file Query.h
+    @brief Filtering of the species/forms by several criteria at once, in a single pass over PokemonColumns. */
+#pragma once
+
+#include "PoGoCmp.h"
+#include "PoGoDb.h"
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace PoGoCmp
+{
+
+//! @return A property of a specie/form, e.g. its attack.
+using SpecieProperty = float(*)(const PokemonSpecie&);
+
+enum class CompareOp : uint8_t
+{
+    //! Any value passes.
+    Any,
+    Less,
+    LessEqual,
+    Greater,
+    GreaterEqual,
+    //! Equal within 1e-5, see MathUtils::Equals().
+    Equal,
+    NotEqual
+};
+
+//! @return Whether "lhs op rhs" holds.
+bool Compare(float lhs, CompareOp op, float rhs);
+
+//! Passes if "property(pkm) op value" holds.
+struct PropertyFilter
+{
+    SpecieProperty property;
+    CompareOp op;
+    float value;
+};
+
+//! Filter expression compiled to bytecode that is evaluated against the columns of a specie/form, e.g.
+//! "atk>=200 && (type=fire || type2=fire) && rarity!=legendary && cp<2500".
+//! Grammar, operators in the order of precedence, case-insensitive names:
+//!     expr := and ('||' and)*
+//!     and := unary ('&&' unary)*
+//!     unary := '!' unary | '(' expr ')' | comparison
+//!     comparison := numeric op numeric | enum ('='|'!=') name
+//!     op := '<' | '<=' | '>' | '>=' | '=' | '==' | '!='
+//!     numeric := a decimal literal | number | atk | attack | def | defense | sta | hp | stamina | bulk | total | cp |
+//!         mincp | gender | buddy
+//!     enum := type | type2 (a type name, or none for type2) | rarity (normal/legendary/mythic) | move (a move ID,
+//!         matches if the specie/form learns the move)
+class SpeciesFilter
+{
+public:
+    //! Replaces the previously compiled expression.
+    //! @param error Optional, set to the description of the error if the compilation fails.
+    //! @return False if the expression is not valid, the filter is left empty then.
+    bool Compile(std::string_view expression, std::string* error = nullptr);
+    //! @return Whether nothing is compiled.
+    bool Empty() const { return code.empty(); }
+    //! @param idx [0, NumSpecies()), undefined behavior otherwise.
+    //! @return True if the specie/form passes the filter, always true for the empty filter.
+    bool Matches(SpecieIndex idx) const;
+
+    enum class OpCode : uint8_t
+    {
+        //! Pushes the value of the field arg.
+        Field,
+        //! Pushes value.
+        Constant,
+        //! Pops rhs and lhs and pushes Compare(lhs, CompareOp(arg), rhs).
+        Compare,
+        //! Pushes whether the specie/form learns the move arg.
+        Learns,
+        //! Pop two values, push one.
+        And,
+        Or,
+        //! Replaces the top value.
+        Not
+    };
+
+    struct Instruction
+    {
+        OpCode op;
+        uint16_t arg;
+        float value;
+    };
+
+    //! Maximum depth of the evaluation stack, i.e. roughly the nesting depth of the expression.
+    static constexpr size_t MaxStackSize = 32;
+
+private:
+    //! Postfix order.
+    std::vector<Instruction> code;
+};
+
+//! The criteria a specie/form must match. The empty query matches all species/forms.
+struct SpeciesQuery
+{
+    //! Matches the species/forms in any of the ranges, all if empty. The ranges may overlap.
+    std::vector<SpecieRange> ranges;
+    //! Bit 1 << PokemonRarity per accepted rarity, any rarity if 0.
+    uint32_t rarities{};
+    //! Bit 1 << PokemonType per accepted type, the primary or the secondary type must match. Any type if 0.
+    uint32_t types{};
+    //! Matches the species/forms learning any of the moves, see LearnersOf(). Invalid moves match nothing.
+    std::vector<MoveId> moves;
+    //! All of the filters must pass.
+    std::vector<PropertyFilter> filters;
+    //! Must pass unless empty.
+    SpeciesFilter expression;
+    //! Only the first match of each PokemonColumnTable::statGroup is included, i.e. the forms that differ
+    //! only by name and type are left out.
+    bool uniqueStats{};
+
+    //! Invalid rarities and types are ignored.
+    void AddRarity(PokemonRarity rarity) { if (rarity != PokemonRarity::NONE) rarities |= 1u << (unsigned)rarity; }
+    void AddType(PokemonType type)
+    {
+        if (type > PokemonType::NONE && type < PokemonType::NUM_TYPES) types |= 1u << (unsigned)type;
+    }
+};
+
+//! The ranges and the moves of the query are resolved to a membership bitmap, after which the species/forms
+//! are tested against all of the criteria in a single pass. Only the indices of the matches are stored.
+//! @return Indices of the matching species/forms in ascending order, without duplicates.
+std::vector<SpecieIndex> RunQuery(const SpeciesQuery& query);
+
+} // ~namespace PoGoCmp
@@ -0,0 +1,71 @@
+/**
+    @file RaidCp.cpp
+    @brief */
+#include "RaidCp.h"
+#include "PoGoDb.h"
+
+#include <vector>
+
+namespace PoGoCmp
+{
+
+namespace
+{
+
+//! Dense tables for all species, built in a single pass over the species on the first use.
+struct RaidCpTables
+{
+    RaidCpTables()
+    {
+        const auto numSpecies = NumSpecies();
+        const auto minIv = PoGoCmp::WeatherBonus.raidEncounterGuaranteedIndividualValues;
+        const auto level = LevelToIndex(RaidEncounterLevel);
+        const auto boostedLevel = LevelToIndex(RaidEncounterLevel + PoGoCmp::WeatherBonus.raidEncounterCpBaseLevelBonus);
+        bossCp.reserve(numSpecies * NumRaidTiers());
+        catchCp.reserve(numSpecies * 2);
+        for (size_t i = 0; i < numSpecies; ++i)
+        {
+            const auto& base = SpecieByIndex((SpecieIndex)i);
+            for (const auto& boss : PoGoCmp::RaidLevels)
+                bossCp.push_back(ComputeRaidBossCp(base, boss));
+            for (auto l : { level, boostedLevel })
+            {
+                catchCp.push_back({
+                    (uint16_t)ComputeCp(base, l, minIv, minIv, minIv),
+                    (uint16_t)ComputeCp(base, l, 15, 15, 15)
+                });
+            }
+        }
+    }
+
+    //! [specie][tier - 1], 32-bit as the CPs of the bosses with the most HP exceed 65535.
+    std::vector<int32_t> bossCp;
+    //! [specie][weatherBoosted]
+    std::vector<CpRange> catchCp;
+};
+
+const RaidCpTables& Tables()
+{
+    static const RaidCpTables tables;
+    return tables;
+}
+
+} // ~unnamed namespace
+
+size_t NumRaidTiers()
+{
+    return PoGoCmp::RaidLevels.size();
+}
+
+int RaidBossCp(SpecieIndex idx, size_t tier)
+{
+    if (tier < 1 || tier > NumRaidTiers()) return -1;
+    return Tables().bossCp[idx * NumRaidTiers() + tier - 1];
+}
+
+CpRange RaidCatchCp(SpecieIndex idx, bool weatherBoosted)
+{
+    return Tables().catchCp[idx * 2 + (weatherBoosted ? 1 : 0)];
+}
+
+} // ~namespace PoGoCmp
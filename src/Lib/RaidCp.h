@@ -0,0 +1,38 @@
+/**
+    @file RaidCp.h
+    @brief Precomputed raid boss CP and post-raid catch CP tables for all species and raid tiers. */
+#pragma once
+
+#include "PoGoCmp.h"
+
+#include <cstdint>
+#include <cstddef>
+
+namespace PoGoCmp
+{
+
+//! Inclusive CP range.
+struct CpRange
+{
+    uint16_t min;
+    uint16_t max;
+};
+
+//! Level of a Pokémon caught from a raid, not weather boosted. Not available in the game master.
+const float RaidEncounterLevel = 20;
+
+//! @return The number of raid tiers, i.e. RaidLevels.size().
+size_t NumRaidTiers();
+
+//! @param idx [0, NumSpecies()), undefined behavior otherwise.
+//! @param tier [1, NumRaidTiers()].
+//! @return The same as ComputeRaidBossCp(SpecieByIndex(idx), RaidLevels[tier - 1]), -1 for an invalid tier.
+int RaidBossCp(SpecieIndex idx, size_t tier);
+
+//! @param idx [0, NumSpecies()), undefined behavior otherwise.
+//! @param weatherBoosted Whether the encounter is boosted by WeatherBonus.raidEncounterCpBaseLevelBonus levels.
+//! @return CP range of the Pokémon when caught from a raid, IVs [WeatherBonus.raidEncounterGuaranteedIndividualValues, 15].
+//! @note The catch CP doesn't depend on the raid tier.
+CpRange RaidCatchCp(SpecieIndex idx, bool weatherBoosted);
+
+} // ~namespace PoGoCmp
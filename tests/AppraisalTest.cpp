@@ -0,0 +1,81 @@
+#include "../src/Lib/Appraisal.h"
+#include "../src/Lib/PoGoDb.h"
+#include "TestUtils.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+//! Brute-force reference for Appraise().
+std::vector<PoGoCmp::IvCandidate> ReferenceAppraise(PoGoCmp::SpecieIndex idx, int cp, int hp, int stardust)
+{
+    using namespace PoGoCmp;
+    const auto& pkm = SpecieByIndex(idx);
+    std::vector<IvCandidate> candidates;
+    for (size_t l = 0; l < IvSpace::NumLevels(); ++l)
+    {
+        const auto level = (LevelIndex)l;
+        if (stardust > 0 && PokemonUpgrades.stardustCost[l / 2] != stardust) continue;
+        for (size_t i = 0; i < NumIvCombinations; ++i)
+        {
+            const auto iv = (IvIndex)i;
+            if (std::max(ComputeCp(pkm, level, AtkIv(iv), DefIv(iv), StaIv(iv)), 10) != cp) continue;
+            if (hp > 0 && std::max(ComputeStat(pkm.baseSta, StaIv(iv), level), 10) != hp) continue;
+            candidates.push_back({ level, iv });
+        }
+    }
+    return candidates;
+}
+
+namespace PoGoCmp
+{
+bool operator==(const IvCandidate& a, const IvCandidate& b) { return a.level == b.level && a.iv == b.iv; }
+}
+
+int main()
+{
+    using namespace PoGoCmp;
+
+    const auto dust = LevelsByStardustCost(2500);
+    AssertTrue(dust.first == LevelToIndex(19) && dust.last == LevelToIndex(20.5f), "Unexpected levels for 2500 stardust.");
+    const auto noDust = LevelsByStardustCost(123);
+    AssertTrue(noDust.first > noDust.last, "Invalid stardust cost should yield an empty range.");
+
+    const auto dragonite = SpecieIndexOf(PokemonByIdName("DRAGONITE"));
+    AssertTrue(dragonite < NumSpecies(), "Dragonite not found.");
+    const auto& index = CpIndexFor(dragonite);
+    for (int cp = index.MinCp(); cp <= index.MaxCp(); ++cp)
+    {
+        AssertTrue(std::is_sorted(index.Begin(cp), index.End(cp), [](const auto& a, const auto& b)
+            { return a.level < b.level || (a.level == b.level && a.iv < b.iv); }),
+            "CpIndex entries not sorted by level and IV.");
+        for (auto it = index.Begin(cp); it != index.End(cp); ++it)
+            AssertTrue(IvSpaceFor(dragonite).Cp(it->level, it->iv) == cp, "CpIndex entry has wrong CP.");
+    }
+    AssertTrue(index.End(index.MaxCp()) - index.Begin(index.MinCp()) == (ptrdiff_t)(IvSpace::NumLevels() * NumIvCombinations),
+        "CpIndex should contain all combinations.");
+
+    const auto level = LevelToIndex(20);
+    const auto iv = ToIvIndex(14, 11, 13);
+    const auto cp = ComputeCp(SpecieByIndex(dragonite), level, 14, 11, 13);
+    const auto hp = ComputeStat(SpecieByIndex(dragonite).baseSta, 13, level);
+    for (int stardust : { 0, 2500 })
+    {
+        for (int h : { 0, hp })
+        {
+            const auto candidates = Appraise(dragonite, cp, h, stardust);
+            AssertTrue(candidates == ReferenceAppraise(dragonite, cp, h, stardust), "Appraise() differs from the reference.");
+            AssertTrue(std::find(candidates.begin(), candidates.end(), IvCandidate{ level, iv }) != candidates.end(),
+                "Appraise() didn't find the actual level and IVs.");
+        }
+    }
+    AssertTrue(Appraise(dragonite, cp, hp, 123).empty(), "Invalid stardust cost should yield no candidates.");
+
+    const auto magikarp = SpecieIndexOf(PokemonByIdName("MAGIKARP"));
+    AssertTrue(Appraise(magikarp, 10) == ReferenceAppraise(magikarp, 10, 0, 0), "Appraise() differs for CP 10.");
+    AssertTrue(Appraise(magikarp, 9).empty(), "CP below 10 should yield no candidates.");
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,71 @@
+#include "../src/Lib/PoGoCmp.h"
+#include "../src/Lib/PoGoDb.h"
+#include "TestUtils.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+int main()
+{
+    using namespace PoGoCmp;
+
+    const auto numLevels = (size_t)LevelToIndex((float)PlayerLevel.cpMultiplier.size()) + 1;
+    std::vector<SpecieIndex> species;
+    std::vector<LevelIndex> levels;
+    std::vector<uint8_t> atk, def, sta;
+    for (size_t s = 0; s < NumSpecies(); ++s)
+    {
+        for (size_t l = 0; l < numLevels; ++l)
+        {
+            for (uint8_t iv : { 0, 1, 7, 10, 15 })
+            {
+                species.push_back((SpecieIndex)s);
+                levels.push_back((LevelIndex)l);
+                atk.push_back(iv);
+                def.push_back(uint8_t(15 - iv));
+                sta.push_back(uint8_t(iv / 2));
+            }
+        }
+    }
+    // Invalid input, the count is also deliberately not a multiple of the SIMD width.
+    species.push_back((SpecieIndex)NumSpecies()); levels.push_back(LevelIndex{0}); atk.push_back(0); def.push_back(0); sta.push_back(0);
+    species.push_back(0); levels.push_back(LevelIndex::Invalid); atk.push_back(0); def.push_back(0); sta.push_back(0);
+    species.push_back(0); levels.push_back(LevelIndex{0}); atk.push_back(16); def.push_back(0); sta.push_back(0);
+    const auto count = species.size();
+    const auto numValid = count - 3;
+
+    const auto best = BatchInstructionSet();
+    for (auto set : { InstructionSet::Scalar, InstructionSet::Sse41, InstructionSet::Avx2 })
+    {
+        if (SetBatchInstructionSet(set) != set)
+        {
+            std::cout << "Instruction set " << (int)set << " not supported, skipping.\n";
+            continue;
+        }
+
+        const auto setName = "Instruction set " + std::to_string((int)set);
+        std::vector<int> cp(count), atkOut(count), defOut(count), staOut(count);
+        ComputeCp(species.data(), levels.data(), atk.data(), def.data(), sta.data(), count, cp.data());
+        ComputeStats(
+            species.data(), levels.data(), atk.data(), def.data(), sta.data(), count,
+            atkOut.data(), defOut.data(), staOut.data());
+        for (size_t i = 0; i < numValid; ++i)
+        {
+            const auto& pkm = SpecieByIndex(species[i]);
+            AssertTrue(cp[i] == ComputeCp(pkm, levels[i], atk[i], def[i], sta[i]), setName + ": " + std::string(pkm.id) + ": CP differs.");
+            AssertTrue(atkOut[i] == ComputeStat(pkm.baseAtk, atk[i], levels[i]), setName + ": " + std::string(pkm.id) + ": attack differs.");
+            AssertTrue(defOut[i] == ComputeStat(pkm.baseDef, def[i], levels[i]), setName + ": " + std::string(pkm.id) + ": defense differs.");
+            AssertTrue(staOut[i] == ComputeStat(pkm.baseSta, sta[i], levels[i]), setName + ": " + std::string(pkm.id) + ": stamina differs.");
+        }
+        for (size_t i = numValid; i < count; ++i)
+        {
+            AssertTrue(cp[i] == -1, setName + ": invalid input should yield -1 CP.");
+            AssertTrue(atkOut[i] == -1 && defOut[i] == -1 && staOut[i] == -1, setName + ": invalid input should yield -1 stats.");
+        }
+    }
+    SetBatchInstructionSet(best);
+
+    return EXIT_SUCCESS;
+}
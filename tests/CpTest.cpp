@@ -0,0 +1,80 @@
+#include "../src/Lib/PoGoCmp.h"
+#include "../src/Lib/PoGoDb.h"
+#include "TestUtils.h"
+
+#include <cstdlib>
+#include <cmath>
+#include <iostream>
+
+//! The original, pre-HalfLevelCpMultiplier, CPM implementation.
+float ReferenceCpm(float level)
+{
+    const auto numLevels = (float)PoGoCmp::PlayerLevel.cpMultiplier.size();
+    float levelIdx;
+    auto levelFact = std::modf(level, &levelIdx);
+    levelIdx -= 1;
+    auto nextLevelIdx = std::min(levelIdx + 1, numLevels - 1);
+    auto cpmBase = PoGoCmp::PlayerLevel.cpMultiplier[(size_t)levelIdx];
+    auto cpmNext = PoGoCmp::PlayerLevel.cpMultiplier[(size_t)nextLevelIdx];
+    auto cpmStep = (std::pow(cpmNext, 2) - std::pow(cpmBase, 2)) / 2.f;
+    auto cpm = levelFact != 0.f ? std::sqrt(std::pow(cpmBase, 2) + cpmStep) : cpmBase;
+    return cpm;
+}
+
+int ReferenceCp(const PoGoCmp::PokemonSpecie& base, float level, int atk, int def, int sta)
+{
+    float a = float(base.baseAtk + atk), d = float(base.baseDef + def), s = float(base.baseSta + sta);
+    return static_cast<int>(std::floor(a * std::pow(d, 0.5f) * std::pow(s, 0.5f) * std::pow(ReferenceCpm(level), 2) / 10.f));
+}
+
+int main()
+{
+    using namespace PoGoCmp;
+
+    const auto maxLevel = (float)PlayerLevel.cpMultiplier.size();
+    AssertTrue(HalfLevelCpMultiplier.size() == PlayerLevel.cpMultiplier.size() * 2 - 1, "Unexpected number of half levels.");
+    AssertTrue(LevelToIndex(0.5f) == LevelIndex::Invalid, "Level 0.5 should be invalid.");
+    AssertTrue(LevelToIndex(1.25f) == LevelIndex::Invalid, "Level 1.25 should be invalid.");
+    AssertTrue(LevelToIndex(maxLevel + 0.5f) == LevelIndex::Invalid, "Level above max. should be invalid.");
+    AssertTrue(LevelToIndex(NAN) == LevelIndex::Invalid, "NaN level should be invalid.");
+    AssertTrue(std::isnan(GetCpm(LevelIndex::Invalid)), "GetCpm(LevelIndex::Invalid) should be NaN.");
+    AssertTrue(ComputeCp(LevelIndex::Invalid, 100, 100, 100) < 0, "ComputeCp(LevelIndex::Invalid) should fail.");
+
+    for (float level = 1; level <= maxLevel; level += 0.5f)
+    {
+        const auto idx = LevelToIndex(level);
+        AssertTrue(idx != LevelIndex::Invalid, "Valid level " + std::to_string(level) + " yields an invalid index.");
+        AssertTrue(IndexToLevel(idx) == level, "IndexToLevel(LevelToIndex(" + std::to_string(level) + ")) round-trip failed.");
+        AssertTrue(GetCpm(idx) == ReferenceCpm(level), "CPM for level " + std::to_string(level) + " differs from the reference.");
+    }
+
+    for (const auto& kvp : PokemonByNumber)
+    {
+        const auto& pkm = kvp.second;
+        for (float level = 1; level <= maxLevel; level += 0.5f)
+        {
+            for (int iv : { 0, 7, 15 })
+            {
+                const auto cp = ComputeCp(pkm, LevelToIndex(level), iv, iv, iv);
+                AssertTrue(cp == ReferenceCp(pkm, level, iv, iv, iv), std::string(pkm.id) + ": CP differs from the reference.");
+                AssertTrue(cp == ComputeCp(pkm, level, (float)iv, (float)iv, (float)iv), std::string(pkm.id) + ": CP overloads differ.");
+            }
+        }
+    }
+
+    const auto maxLevelIdx = LevelToIndex(maxLevel);
+    for (const auto& kvp : PokemonByNumber)
+    {
+        const auto& pkm = kvp.second;
+        AssertTrue(pkm.minCp == ComputeCp(pkm, LevelIndex{0}, 0, 0, 0), std::string(pkm.id) + ": generated minCp differs.");
+        AssertTrue(pkm.maxCp == ComputeCp(pkm, maxLevelIdx, 15, 15, 15), std::string(pkm.id) + ": generated maxCp differs.");
+        AssertTrue(pkm.total == pkm.baseAtk + pkm.baseDef + pkm.baseSta, std::string(pkm.id) + ": generated total differs.");
+        AssertTrue(pkm.bulk == (uint32_t)pkm.baseDef * pkm.baseSta, std::string(pkm.id) + ": generated bulk differs.");
+    }
+
+    AssertTrue(MaxCp(PokemonByIdName("BULBASAUR")) == 1115, "Unexpected max. CP for Bulbasaur.");
+    AssertTrue(MaxCp(PokemonByIdName("MEWTWO")) == 4178, "Unexpected max. CP for Mewtwo.");
+    AssertTrue(MinCp(PokemonByIdName("MEWTWO")) == 52, "Unexpected min. CP for Mewtwo.");
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,130 @@
+#include "../src/Lib/Database.h"
+#include "../src/Lib/PoGoDb.h"
+#include "TestUtils.h"
+
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main()
+{
+    using namespace PoGoCmp;
+
+    const auto compiled = CurrentDatabase();
+    AssertTrue(compiled && compiled == Database::Compiled(), "The compiled-in database should be the default.");
+    AssertTrue(DatabaseGeneration() == 0, "Unexpected initial generation.");
+    AssertTrue(compiled->Species().size() == NumSpecies(), "Unexpected number of species.");
+    // "UNOWN" and "RATTATA" are base IDs of species with several forms.
+    for (auto name : { "BULBASAUR", "rattata alola", "Mr-Mime", "MEWTWO", "UNOWN", "rattata" })
+    {
+        const auto idx = compiled->SpecieIndexByName(name);
+        AssertTrue(idx < NumSpecies() && idx == SpecieIndexByName(name),
+            std::string(name) + ": SpecieIndexByName() differs.");
+    }
+    AssertTrue(compiled->SpecieIndexByName("MISSINGNO") == compiled->Species().size(), "Unknown name found.");
+    for (size_t i = 0; i < HalfLevelCpMultiplier.size(); ++i)
+    {
+        const auto level = 1.f + i / 2.f;
+        AssertTrue(compiled->CpMultiplier(level) == HalfLevelCpMultiplier[i],
+            "CpMultiplier(" + std::to_string(level) + ") differs.");
+    }
+    AssertTrue(std::isnan(compiled->CpMultiplier(0.5f)) && std::isnan(compiled->CpMultiplier(1.25f)) &&
+        std::isnan(compiled->CpMultiplier(100.f)), "CpMultiplier() of an invalid level should be NAN.");
+    for (size_t i = 0; i < NumSpecies(); ++i)
+    {
+        const auto idx = (SpecieIndex)i;
+        for (auto level : { 1.f, 15.5f, 40.f, 1.f + (HalfLevelCpMultiplier.size() - 1) / 2.f })
+            for (int iv : { 0, 7, 15 })
+            {
+                AssertTrue(compiled->ComputeCp(idx, level, iv, 15 - iv, iv) ==
+                    ComputeCp(SpecieByIndex(idx), level, iv, 15 - iv, iv),
+                    std::string(SpecieByIndex(idx).id) + ": ComputeCp() differs.");
+                AssertTrue(compiled->ComputeStat(SpecieByIndex(idx).baseAtk, iv, level) ==
+                    ComputeStat(SpecieByIndex(idx).baseAtk, iv, level),
+                    std::string(SpecieByIndex(idx).id) + ": ComputeStat() differs.");
+            }
+    }
+    AssertTrue(compiled->ComputeCp((SpecieIndex)NumSpecies(), 40.f, 15, 15, 15) == -1 &&
+        compiled->ComputeCp(0, 0.5f, 15, 15, 15) == -1 && compiled->ComputeCp(0, 40.f, 16, 15, 15) == -1,
+        "ComputeCp() with invalid arguments should fail.");
+    AssertTrue(compiled->ComputeStat(100, 15, 0.5f) == -1, "ComputeStat() with an invalid level should fail.");
+
+    DbSnapshotData inconsistent = CompiledDbSnapshotData();
+    inconsistent.pokemonMoves.back() = MoveId(inconsistent.moves.size());
+    AssertTrue(!Database::FromData(std::move(inconsistent)), "Inconsistent data should be rejected.");
+    DbSnapshotData invalidType = CompiledDbSnapshotData();
+    invalidType.species.front().type2 = PokemonType::NUM_TYPES;
+    AssertTrue(!Database::FromData(std::move(invalidType)), "An invalid type should be rejected.");
+    DbSnapshotData invalidMoveType = CompiledDbSnapshotData();
+    invalidMoveType.moves.front().type = PokemonType::NUM_TYPES;
+    AssertTrue(!Database::FromData(std::move(invalidMoveType)), "An invalid move type should be rejected.");
+
+    const std::string path{ "DatabaseTest.bin" };
+    AssertTrue(WriteDbSnapshot(path, CompiledDbSnapshotData()), "WriteDbSnapshot() failed.");
+    AssertTrue(!ReloadDatabaseAsync("nonexistent.bin").get(), "Reloading a nonexistent file should fail.");
+    AssertTrue(DatabaseGeneration() == 0 && CurrentDatabase() == compiled, "A failed reload shouldn't publish.");
+
+    // Readers keep querying while new databases are published.
+    std::atomic<bool> stop{ false };
+    std::atomic<size_t> numErrors{ 0 };
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 4; ++i)
+    {
+        readers.emplace_back([&]
+        {
+            while (!stop)
+            {
+                const auto db = CurrentDatabase();
+                const auto idx = db->SpecieIndexByName("BULBASAUR");
+                if (idx >= db->Species().size() || db->String(db->Species()[idx].id) != "BULBASAUR")
+                    ++numErrors;
+            }
+        });
+    }
+    // The readers must be joined before any return, a joinable std::thread calls std::terminate() when destroyed.
+    const uint64_t numReloads = 5;
+    bool allReloaded = true;
+    for (uint64_t i = 0; i < numReloads; ++i)
+        allReloaded = ReloadDatabaseAsync(path).get() && allReloaded;
+    stop = true;
+    for (auto& t : readers)
+        t.join();
+    AssertTrue(allReloaded, "ReloadDatabaseAsync() failed.");
+    AssertTrue(numErrors == 0, "Readers saw inconsistent data.");
+    AssertTrue(DatabaseGeneration() == numReloads, "Unexpected generation.");
+
+    const auto reloaded = CurrentDatabase();
+    AssertTrue(reloaded != compiled && reloaded->Species().size() == compiled->Species().size(),
+        "The reloaded database should be current.");
+    // The old snapshot stays usable for as long as it is held.
+    AssertTrue(compiled->String(compiled->Species()[0].id) == reloaded->String(reloaded->Species()[0].id),
+        "The snapshots should have the same data.");
+
+    // A thread that read the current database and then released it before going idle must not keep it alive
+    // after it's replaced.
+    PublishDatabase(Database::Load(path));
+    std::weak_ptr<const Database> replaced;
+    std::atomic<bool> hasRead{ false }, wakeUp{ false };
+    std::thread idle([&]
+    {
+        replaced = CurrentDatabase();
+        ReleaseCurrentDatabase();
+        hasRead = true;
+        while (!wakeUp)
+            std::this_thread::yield();
+    });
+    while (!hasRead)
+        std::this_thread::yield();
+    PublishDatabase(Database::Load(path));
+    const bool expired = replaced.expired();
+    wakeUp = true;
+    idle.join();
+    AssertTrue(expired, "A replaced database should be destroyed once released.");
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,138 @@
+#include "../src/Lib/DbSnapshot.h"
+#include "../src/Lib/PoGoDb.h"
+#include "TestUtils.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+//! Writes the file with a valid checksum so that only the validation of the contents can reject it.
+bool WriteWithChecksum(const std::string& path, std::vector<char> contents)
+{
+    using PoGoCmp::DbSnapshotHeader;
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = sizeof(DbSnapshotHeader); i < contents.size(); ++i)
+    {
+        crc ^= (uint8_t)contents[i];
+        for (int k = 0; k < 8; ++k)
+            crc = crc & 1 ? 0xEDB88320u ^ (crc >> 1) : crc >> 1;
+    }
+    crc ^= 0xFFFFFFFFu;
+    std::memcpy(contents.data() + offsetof(DbSnapshotHeader, checksum), &crc, sizeof(crc));
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(contents.data(), contents.size());
+    return (bool)file;
+}
+
+int main()
+{
+    using namespace PoGoCmp;
+
+    const std::string path{"DbSnapshotTest.bin"};
+    AssertTrue(WriteDbSnapshot(path, CompiledDbSnapshotData()), "WriteDbSnapshot() failed.");
+    DbSnapshot snapshot;
+    AssertTrue(snapshot.Load(path), "DbSnapshot::Load() failed.");
+
+    const auto species = snapshot.Species();
+    AssertTrue(species.size() == PokemonByNumber.size(), "Unexpected number of species.");
+    for (size_t i = 0; i < species.size(); ++i)
+    {
+        const auto& pkm = PokemonByNumber.begin()[i].second;
+        const auto& row = species[i];
+        const auto id = snapshot.String(row.id);
+        AssertTrue(id == pkm.id && id.data()[id.size()] == '\0', std::string(pkm.id) + ": ID differs.");
+        AssertTrue(row.number == pkm.number && row.baseAtk == pkm.baseAtk && row.baseDef == pkm.baseDef &&
+            row.baseSta == pkm.baseSta && row.type == pkm.type && row.type2 == pkm.type2 && row.maxCp == pkm.maxCp,
+            std::string(pkm.id) + ": stats differ.");
+        const auto pokemonMoves = snapshot.PokemonMoves();
+        AssertTrue(std::equal(
+                pokemonMoves.begin() + row.chargeMoves.offset,
+                pokemonMoves.begin() + row.chargeMoves.offset + row.chargeMoves.size,
+                begin(pkm.chargeMoves), end(pkm.chargeMoves)),
+            std::string(pkm.id) + ": charge moves differ.");
+    }
+
+    const auto moves = snapshot.Moves();
+    AssertTrue(moves.size() == Moves.size(), "Unexpected number of moves.");
+    for (size_t i = 0; i < moves.size(); ++i)
+    {
+        AssertTrue(snapshot.String(moves[i].id) == Moves[i].id, std::string(Moves[i].id) + ": ID differs.");
+        AssertTrue(moves[i].pvpEnergy == Moves[i].pvpEnergy && moves[i].IsFastMove() == Moves[i].IsFastMove(),
+            std::string(Moves[i].id) + ": data differs.");
+    }
+
+    const auto typeEffectiveness = snapshot.TypeEffectiveness();
+    AssertTrue(typeEffectiveness[(size_t)PokemonType::WATER * 18 + (size_t)PokemonType::FIRE] ==
+        TypeEffectiveness[(size_t)PokemonType::WATER][(size_t)PokemonType::FIRE], "Type effectiveness differs.");
+    const auto levels = snapshot.Levels();
+    AssertTrue(levels.size() == PlayerLevel.cpMultiplier.size(), "Unexpected number of levels.");
+    AssertTrue(levels[39].cpMultiplier == PlayerLevel.cpMultiplier[39] &&
+        levels[39].stardustCost == PokemonUpgrades.stardustCost[39], "Level data differs.");
+    AssertTrue(snapshot.Settings()->upgradesPerLevel == PokemonUpgrades.upgradesPerLevel, "Settings differ.");
+
+    std::vector<char> contents;
+    {
+        std::ifstream file(path, std::ios::binary);
+        contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    AssertTrue(WriteWithChecksum(path, contents) && snapshot.Load(path), "Rewriting the checksum broke the file.");
+
+    // Invalid contents with a valid checksum.
+    const auto sectionTable = sizeof(DbSnapshotHeader);
+    DbSnapshotHeader header;
+    std::memcpy(&header, contents.data(), sizeof(header));
+    std::vector<DbSnapshotSection> sections(header.numSections);
+    std::memcpy(sections.data(), contents.data() + sectionTable, sections.size() * sizeof(DbSnapshotSection));
+    {
+        auto modified = contents;
+        const auto settings = std::find_if(sections.begin(), sections.end(),
+            [](const auto& section) { return section.id == DbSnapshotSectionId::Settings; }) - sections.begin();
+        DbSnapshotSection empty = sections[settings];
+        empty.count = empty.size = 0;
+        std::memcpy(modified.data() + sectionTable + settings * sizeof(DbSnapshotSection), &empty, sizeof(empty));
+        AssertTrue(WriteWithChecksum(path, modified) && !snapshot.Load(path), "Loaded a snapshot without settings.");
+    }
+    {
+        // The same section twice: the section table grows and the sections move by one table entry.
+        auto modified = contents;
+        auto moved = sections;
+        for (auto& section : moved)
+            section.offset += sizeof(DbSnapshotSection);
+        moved.push_back(moved.front());
+        auto movedHeader = header;
+        movedHeader.numSections = (uint32_t)moved.size();
+        movedHeader.fileSize += sizeof(DbSnapshotSection);
+        modified.insert(modified.begin() + sectionTable, sizeof(DbSnapshotSection), '\0');
+        std::memcpy(modified.data(), &movedHeader, sizeof(movedHeader));
+        std::memcpy(modified.data() + sectionTable, moved.data(), moved.size() * sizeof(DbSnapshotSection));
+        AssertTrue(WriteWithChecksum(path, modified) && !snapshot.Load(path), "Loaded a snapshot with a duplicate section.");
+        moved.back().id = (DbSnapshotSectionId)1000;
+        std::memcpy(modified.data() + sectionTable, moved.data(), moved.size() * sizeof(DbSnapshotSection));
+        AssertTrue(WriteWithChecksum(path, modified) && snapshot.Load(path), "An unknown section should be ignored.");
+    }
+    {
+        auto data = CompiledDbSnapshotData();
+        data.species.back().rarity = PokemonRarity::NONE;
+        AssertTrue(WriteDbSnapshot(path, data) && !snapshot.Load(path), "Loaded a snapshot with an invalid rarity.");
+    }
+
+    // A flipped byte anywhere in the file must be caught by the checksum.
+    contents[contents.size() / 2] ^= 1;
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(contents.data(), contents.size());
+    }
+    AssertTrue(!snapshot.Load(path), "Loading a corrupted snapshot should fail.");
+    AssertTrue(!snapshot.IsLoaded() && snapshot.Species().empty(), "A failed load should leave nothing loaded.");
+    std::remove(path.c_str());
+    AssertTrue(!snapshot.Load("nonexistent.bin"), "Loading a nonexistent file should fail.");
+
+    return EXIT_SUCCESS;
+}
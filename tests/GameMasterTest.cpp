@@ -0,0 +1,97 @@
+#include "../src/Lib/GameMaster.h"
+#include "../src/Lib/PoGoDb.h"
+#include "TestUtils.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+namespace
+{
+
+// Abridged GAME_MASTER with the first and the last level only.
+const std::string gameMaster{ R"({
+    "itemTemplates": [
+        { "templateId": "PLAYER_LEVEL_SETTINGS", "playerLevel": {
+            "requiredExperience": [0, 20000000], "cpMultiplier": [0.094, 0.7903],
+            "maxEggPlayerLevel": 20, "maxEncounterPlayerLevel": 30 } },
+        { "templateId": "POKEMON_UPGRADE_SETTINGS", "pokemonUpgrades": {
+            "upgradesPerLevel": 2, "allowedLevelsAbovePlayer": 2, "candyCost": [1, 15], "stardustCost": [200, 10000] } },
+        { "templateId": "POKEMON_TYPE_GRASS", "typeEffective": {
+            "attackScalar": [1, 1, 0.625, 0.625, 1.6, 1.6, 0.625, 1, 0.625, 0.625, 1.6, 0.625, 1, 1, 1, 0.625, 1, 1] } },
+        { "templateId": "COMBAT_V0214_MOVE_VINE_WHIP_FAST", "combatMove": {
+            "uniqueId": "VINE_WHIP_FAST", "type": "POKEMON_TYPE_GRASS", "power": 5, "energyDelta": 8 } },
+        { "templateId": "COMBAT_V0118_MOVE_POWER_WHIP", "combatMove": {
+            "uniqueId": "POWER_WHIP", "type": "POKEMON_TYPE_GRASS", "power": 90, "energyDelta": -50 } },
+        { "templateId": "V0214_MOVE_VINE_WHIP_FAST", "moveSettings": {
+            "movementId": "VINE_WHIP_FAST", "power": 7, "energyDelta": 6,
+            "durationMs": 600, "damageWindowStartMs": 350, "damageWindowEndMs": 600 } },
+        { "templateId": "V0118_MOVE_POWER_WHIP", "moveSettings": {
+            "movementId": "POWER_WHIP", "power": 90, "energyDelta": -50,
+            "durationMs": 2600, "damageWindowStartMs": 1250, "damageWindowEndMs": 1700 } },
+        { "templateId": "FORMS_V0001_POKEMON_BULBASAUR", "formSettings": { "pokemon": "BULBASAUR" } },
+        { "templateId": "SPAWN_V0001_POKEMON_BULBASAUR", "genderSettings": {
+            "pokemon": "BULBASAUR", "gender": { "malePercent": 0.875, "femalePercent": 0.125 } } },
+        { "templateId": "V0001_POKEMON_BULBASAUR", "pokemonSettings": {
+            "pokemonId": "BULBASAUR", "type": "POKEMON_TYPE_GRASS", "type2": "POKEMON_TYPE_POISON",
+            "stats": { "baseStamina": 128, "baseAttack": 118, "baseDefense": 111 },
+            "quickMoves": ["VINE_WHIP_FAST"], "cinematicMoves": ["POWER_WHIP"], "kmBuddyDistance": 3.0 } },
+        { "templateId": "SOME_FUTURE_SETTINGS", "futureSettings": { "nested": [[1, 2], { "a": null }] } }
+    ],
+    "timestampMs": "1549590777000"
+})" };
+
+} // ~unnamed namespace
+
+int main()
+{
+    using namespace PoGoCmp;
+
+    std::istringstream input{ gameMaster };
+    DbSnapshotData data;
+    GameMasterStats stats{};
+    AssertTrue(ReadGameMaster(input, data, &stats), "ReadGameMaster() failed.");
+    AssertTrue(stats.numTemplates == 11, "Unexpected number of templates.");
+    AssertTrue(stats.bytes == gameMaster.size(), "Unexpected number of bytes.");
+
+    AssertTrue(data.species.size() == 1, "Unexpected number of species.");
+    const auto& bulbasaur = data.species.front();
+    const auto& compiled = PokemonByIdName("BULBASAUR");
+    AssertTrue(data.strings.c_str() + bulbasaur.id.offset == std::string("BULBASAUR"), "Unexpected ID.");
+    AssertTrue(bulbasaur.number == 1 && bulbasaur.baseAtk == 118 && bulbasaur.baseDef == 111 && bulbasaur.baseSta == 128,
+        "Unexpected base stats.");
+    AssertTrue(bulbasaur.type == PokemonType::GRASS && bulbasaur.type2 == PokemonType::POISON, "Unexpected types.");
+    AssertTrue(bulbasaur.rarity == PokemonRarity::NORMAL && bulbasaur.buddyDistance == 3, "Unexpected rarity/buddy.");
+    AssertTrue(bulbasaur.malePercent == compiled.malePercent && bulbasaur.femalePercent == compiled.femalePercent,
+        "Unexpected gender ratio.");
+    AssertTrue(bulbasaur.minCp == compiled.minCp && bulbasaur.maxCp == compiled.maxCp, "Unexpected min./max. CP.");
+
+    AssertTrue(data.moves.size() == 2, "Unexpected number of moves.");
+    // Sorted by ID, the fast postfix removed.
+    AssertTrue(data.strings.c_str() + data.moves[0].id.offset == std::string("POWER_WHIP"), "Unexpected move ID.");
+    AssertTrue(data.strings.c_str() + data.moves[1].id.offset == std::string("VINE_WHIP"), "Unexpected move ID.");
+    AssertTrue(data.moves[1].IsFastMove() && data.moves[1].pvpPower == 5 && data.moves[1].combatPower == 7,
+        "Unexpected move data.");
+    AssertTrue(bulbasaur.fastMoves.size == 1 && data.pokemonMoves[bulbasaur.fastMoves.offset] == MoveId(1),
+        "Unexpected fast moves.");
+    AssertTrue(bulbasaur.chargeMoves.size == 1 && data.pokemonMoves[bulbasaur.chargeMoves.offset] == MoveId(0),
+        "Unexpected charge moves.");
+
+    const auto grassVsWater = (size_t)PokemonType::GRASS * (size_t)PokemonType::NUM_TYPES + (size_t)PokemonType::WATER;
+    AssertTrue(data.typeEffectiveness[grassVsWater] == 1.6f, "Unexpected type effectiveness.");
+    AssertTrue(data.levels.size() == 2 && data.levels[1].cpMultiplier == 0.7903f && data.levels[1].stardustCost == 10000,
+        "Unexpected levels.");
+    AssertTrue(data.settings.maxEncounterPlayerLevel == 30 && data.settings.upgradesPerLevel == 2,
+        "Unexpected settings.");
+
+    std::istringstream truncated{ gameMaster.substr(0, gameMaster.size() / 2) };
+    AssertTrue(!ReadGameMaster(truncated, data), "Reading truncated JSON should fail.");
+    std::string unknownMove{ gameMaster };
+    unknownMove.replace(unknownMove.find("[\"POWER_WHIP\"]"), 14, "[\"SOLAR_BEAM\"]");
+    std::istringstream unknownMoveInput{ unknownMove };
+    AssertTrue(!ReadGameMaster(unknownMoveInput, data), "Reading a moveset with an unknown move should fail.");
+    AssertTrue(!ReadGameMaster("nonexistent.json", data), "Reading a nonexistent file should fail.");
+
+    return EXIT_SUCCESS;
+}
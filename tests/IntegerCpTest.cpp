@@ -0,0 +1,65 @@
+#include "../src/Lib/PoGoCmp.h"
+#include "../src/Lib/PoGoDb.h"
+#include "TestUtils.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+//! Differential test of ComputeCpInteger() against the floating-point ComputeCp(). By default every distinct total
+//! stat triple (base + IV) of every specie is tested at the max. level, and a different 1/64 of them at each of
+//! the other levels. With --exhaustive all of them are tested at every level, ~116M cases.
+int main(int argc, char* argv[])
+{
+    const bool exhaustive = argc > 1 && std::strcmp(argv[1], "--exhaustive") == 0;
+    const size_t sampleStride = 64;
+
+    using namespace PoGoCmp;
+
+    for (size_t i = 0; i < HalfLevelCpMultiplier.size(); ++i)
+        AssertTrue(std::ldexp((double)HalfLevelCpMultiplierQ27[i], -27) == HalfLevelCpMultiplier[i], "Q27 CPM differs.");
+    AssertTrue(ComputeCpInteger(LevelIndex::Invalid, 100, 100, 100) < 0, "Invalid level should fail.");
+    AssertTrue(ComputeCpInteger(LevelIndex{0}, 100, 0, 100) == 0, "Zero stat should yield 0 CP.");
+    for (size_t i = 0; i < HalfLevelCpMultiplier.size(); ++i)
+        AssertTrue(ComputeCpInteger(HalfLevelCpMultiplier[i], 300, 250, 220) ==
+            ComputeCpInteger((LevelIndex)i, 300, 250, 220), "CP with an explicit CPM differs.");
+    AssertTrue(ComputeCpInteger(0.f, 100, 100, 100) < 0 && ComputeCpInteger(NAN, 100, 100, 100) < 0 &&
+        ComputeCpInteger(1.5f, 100, 100, 100) < 0, "Invalid CPM should fail.");
+
+    // Many species share the base stats and the IV ranges overlap, so the triples are deduplicated first.
+    const size_t dim = 1024;
+    std::vector<bool> seen(dim * dim * dim);
+    std::vector<uint32_t> triples;
+    for (const auto& kvp : PokemonByNumber)
+    {
+        const auto& pkm = kvp.second;
+        for (size_t a = pkm.baseAtk; a <= pkm.baseAtk + 15u; ++a)
+            for (size_t d = pkm.baseDef; d <= pkm.baseDef + 15u; ++d)
+                for (size_t s = pkm.baseSta; s <= pkm.baseSta + 15u; ++s)
+                    if (!seen[(a * dim + d) * dim + s])
+                    {
+                        seen[(a * dim + d) * dim + s] = true;
+                        triples.push_back(uint32_t((a * dim + d) * dim + s));
+                    }
+    }
+
+    const auto numLevels = HalfLevelCpMultiplier.size();
+    for (size_t l = 0; l < numLevels; ++l)
+    {
+        const auto level = (LevelIndex)l;
+        const size_t stride = exhaustive || l == numLevels - 1 ? 1 : sampleStride;
+        for (size_t i = exhaustive ? 0 : l % stride; i < triples.size(); i += stride)
+        {
+            const auto t = triples[i];
+            const int a = int(t / dim / dim), d = int(t / dim % dim), s = int(t % dim);
+            AssertTrue(ComputeCpInteger(level, a, d, s) == ComputeCp(level, (float)a, (float)d, (float)s),
+                "CP differs for " + std::to_string(a) + "/" + std::to_string(d) + "/" + std::to_string(s) +
+                " @ L" + std::to_string(IndexToLevel(level)));
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
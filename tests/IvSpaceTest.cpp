@@ -0,0 +1,57 @@
+#include "../src/Lib/IvSpace.h"
+#include "../src/Lib/PoGoDb.h"
+#include "TestUtils.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+int main()
+{
+    using namespace PoGoCmp;
+
+    AssertTrue(ToIvIndex(15, 15, 15) == NumIvCombinations - 1, "Unexpected IvIndex for 15/15/15.");
+    AssertTrue(AtkIv(ToIvIndex(1, 2, 3)) == 1 && DefIv(ToIvIndex(1, 2, 3)) == 2 && StaIv(ToIvIndex(1, 2, 3)) == 3,
+        "IvIndex round-trip failed.");
+
+    std::vector<SpecieIndex> species(NumSpecies());
+    std::iota(species.begin(), species.end(), SpecieIndex{0});
+    // Every 32nd specie is verified exhaustively, the rest only via the cache.
+    std::vector<SpecieIndex> sample;
+    for (size_t i = 0; i < species.size(); i += 32)
+        sample.push_back(species[i]);
+    PrecomputeIvSpaces(sample.data(), sample.size(), 4);
+
+    for (auto idx : sample)
+    {
+        const auto& pkm = SpecieByIndex(idx);
+        const auto& space = IvSpaceFor(idx);
+        AssertTrue(&space == &IvSpaceFor(idx), std::string(pkm.id) + ": IvSpace not cached.");
+        for (size_t l = 0; l < IvSpace::NumLevels(); ++l)
+        {
+            const auto level = (LevelIndex)l;
+            for (int iv = 0; iv < (int)NumIvValues; ++iv)
+            {
+                AssertTrue(space.Atk(level, iv) == ComputeStat(pkm.baseAtk, iv, level), std::string(pkm.id) + ": attack differs.");
+                AssertTrue(space.Def(level, iv) == ComputeStat(pkm.baseDef, iv, level), std::string(pkm.id) + ": defense differs.");
+                AssertTrue(space.Sta(level, iv) == ComputeStat(pkm.baseSta, iv, level), std::string(pkm.id) + ": stamina differs.");
+            }
+            for (size_t i = 0; i < NumIvCombinations; ++i)
+            {
+                const auto iv = (IvIndex)i;
+                AssertTrue(space.Cp(level, iv) == ComputeCp(pkm, level, AtkIv(iv), DefIv(iv), StaIv(iv)),
+                    std::string(pkm.id) + ": CP differs.");
+                AssertTrue(space.CpTable(level)[iv] == space.Cp(level, iv), std::string(pkm.id) + ": CpTable() differs.");
+            }
+        }
+    }
+
+    const auto maxLevel = LevelIndex(IvSpace::NumLevels() - 1);
+    const auto mewtwo = SpecieIndexOf(PokemonByIdName("MEWTWO"));
+    AssertTrue(mewtwo < NumSpecies(), "Mewtwo not found.");
+    AssertTrue(IvSpaceFor(mewtwo).Cp(maxLevel, ToIvIndex(15, 15, 15)) == 4178, "Unexpected max. CP for Mewtwo.");
+
+    return EXIT_SUCCESS;
+}
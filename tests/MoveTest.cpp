@@ -0,0 +1,91 @@
+#include "../src/Lib/PoGoCmp.h"
+#include "../src/Lib/PoGoDb.h"
+#include "TestUtils.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+int main()
+{
+    using namespace PoGoCmp;
+
+    for (size_t i = 0; i < Moves.size(); ++i)
+    {
+        AssertTrue(MoveIdByName(Moves[i].id) == (MoveId)i, std::string(Moves[i].id) + ": MoveIdByName() mismatch.");
+        AssertTrue(i == 0 || Moves[i - 1].id < Moves[i].id, "Moves not sorted by ID.");
+    }
+    AssertTrue(MoveIdByName("NOT_A_MOVE") == MoveId::NONE, "Unknown move should yield MoveId::NONE.");
+    AssertTrue(MoveIdByName("") == MoveId::NONE, "Empty move ID should yield MoveId::NONE.");
+    AssertTrue(MoveIdByName("vine whip") == MoveId::VINE_WHIP, "MoveIdByName() should be case-insensitive.");
+
+    AssertTrue(FastMoves().size() + ChargeMoves().size() == Moves.size(), "Fast and charge moves don't cover all moves.");
+    for (auto move : FastMoves())
+        AssertTrue(MoveById(move).IsFastMove(), std::string(MoveById(move).id) + ": not a fast move.");
+    for (auto move : ChargeMoves())
+        AssertTrue(MoveById(move).IsChargeMove(), std::string(MoveById(move).id) + ": not a charge move.");
+    size_t numMovesOfTypes = 0;
+    for (int t = 0; t < (int)PokemonType::NUM_TYPES; ++t)
+    {
+        const auto type = (PokemonType)t;
+        const auto moves = MovesOfType(type);
+        AssertTrue(moves.size() == FastMovesOfType(type).size() + ChargeMovesOfType(type).size(),
+            std::string(PokemonTypeToString(type)) + ": fast and charge moves don't cover all moves of the type.");
+        for (auto move : FastMovesOfType(type))
+        {
+            AssertTrue(MoveById(move).type == type && MoveById(move).IsFastMove(),
+                std::string(MoveById(move).id) + ": not a fast " + PokemonTypeToString(type) + " move.");
+        }
+        for (auto move : ChargeMovesOfType(type))
+        {
+            AssertTrue(MoveById(move).type == type && MoveById(move).IsChargeMove(),
+                std::string(MoveById(move).id) + ": not a charge " + PokemonTypeToString(type) + " move.");
+        }
+        numMovesOfTypes += moves.size();
+    }
+    AssertTrue(numMovesOfTypes == Moves.size(), "Moves by type don't cover all moves.");
+    AssertTrue(MovesOfType(PokemonType::NONE).empty(), "MovesOfType(NONE) should be empty.");
+    AssertTrue(*FastMovesOfType(PokemonType::GRASS).begin() == MoveId::BULLET_SEED, "Unexpected first fast grass move.");
+    AssertTrue(MoveById(MoveId::VINE_WHIP).id == "VINE_WHIP", "Unexpected move for MoveId::VINE_WHIP.");
+
+    for (const auto& kvp : PokemonByNumber)
+    {
+        const auto& pkm = kvp.second;
+        AssertTrue(pkm.fastMoves.offset + pkm.fastMoves.size <= PokemonMoves.size() &&
+            pkm.chargeMoves.offset + pkm.chargeMoves.size <= PokemonMoves.size(), std::string(pkm.id) + ": moveset out of bounds.");
+        // Fast moves generate energy and charge moves consume it, e.g. Transform does neither.
+        for (auto move : pkm.fastMoves)
+            AssertTrue(MoveById(move).combatEnergy >= 0, std::string(pkm.id) + ": " + std::string(MoveById(move).id) + " is not a fast move.");
+        for (auto move : pkm.chargeMoves)
+            AssertTrue(MoveById(move).combatEnergy <= 0, std::string(pkm.id) + ": " + std::string(MoveById(move).id) + " is not a charge move.");
+    }
+
+    // The learners index agrees with the movesets.
+    for (size_t i = 0; i < Moves.size(); ++i)
+    {
+        const auto move = (MoveId)i;
+        const auto learners = LearnersOf(move);
+        size_t numLearners = 0;
+        for (size_t idx = 0; idx < PokemonByNumber.size(); ++idx)
+        {
+            const auto& pkm = PokemonByNumber.begin()[idx].second;
+            const bool learns = std::find(begin(pkm.fastMoves), end(pkm.fastMoves), move) != end(pkm.fastMoves) ||
+                std::find(begin(pkm.chargeMoves), end(pkm.chargeMoves), move) != end(pkm.chargeMoves);
+            if (!learns) continue;
+            AssertTrue(numLearners < learners.size() && learners.begin()[numLearners] == idx,
+                std::string(Moves[i].id) + ": " + std::string(pkm.id) + " missing from the learners.");
+            ++numLearners;
+        }
+        AssertTrue(numLearners == learners.size(), std::string(Moves[i].id) + ": unexpected learners.");
+    }
+    AssertTrue(LearnersOf(MoveId::NONE).empty(), "LearnersOf(NONE) should be empty.");
+
+    const auto& bulbasaur = PokemonByIdName("BULBASAUR");
+    AssertTrue(bulbasaur.fastMoves.size == 2 && *begin(bulbasaur.fastMoves) == MoveId::VINE_WHIP,
+        "Unexpected fast moves for Bulbasaur.");
+    AssertTrue(bulbasaur.chargeMoves.size == 3 && *begin(bulbasaur.chargeMoves) == MoveId::SLUDGE_BOMB,
+        "Unexpected charge moves for Bulbasaur.");
+
+    return EXIT_SUCCESS;
+}
@@ -4,6 +4,7 @@
 #include <cstdlib>
 #include <iostream>
 #include <locale>
+#include <string>
 
 //! @todo Unicode output
 #define AssertNameToId(a, b) \
@@ -14,6 +15,10 @@ if (PokemonNameToId((a)) != (b)) \
 if (PokemonIdToName((a)) != (b)) \
 { std::cerr << "ID '" << a << "' did not map into name '" << b << "'\n"; return EXIT_FAILURE; }
 
+#define AssertNameToIndex(a, b) \
+if (PokemonIndexByName((a)) != (b)) \
+{ std::cerr << "Name '" << a << "' did not map into index " << b << "\n"; return EXIT_FAILURE; }
+
 int main(/*int argc, char **argv*/)
 {
     using namespace PoGoCmp;
@@ -59,6 +64,37 @@ int main(/*int argc, char **argv*/)
     AssertIdToName("MIME_JR", "Mime Jr.");
     AssertIdToName("PORYGON_Z", "Porygon Z");
 
+    // The perfect hash finds every ID and name and all of the names accepted by PokemonNameToId().
+    for (size_t i = 0; i < PokemonByNumber.size(); ++i)
+    {
+        const std::string id{ PokemonByNumber.begin()[i].second.id };
+        AssertNameToIndex(id, i);
+        AssertNameToIndex(PokemonIdToName(id), i);
+        AssertNameToIndex(PokemonNameToId(PokemonIdToName(id)), i);
+    }
+    for (const auto& base : FormNames)
+    {
+        const auto first = PokemonIndexByName(base.first);
+        if (first >= PokemonByNumber.size() || FormIdToBaseId(std::string(PokemonByNumber.begin()[first].second.id)) != base.first)
+        {
+            std::cerr << "Base ID '" << base.first << "' did not map into its first form\n";
+            return EXIT_FAILURE;
+        }
+    }
+    for (const auto* name : { "Nidoran Female", "nidoran male", "mr mime", "ho oh", "mime jr", "porygonz", "rattata alola" })
+    {
+        const auto index = PokemonIndexByName(PokemonNameToId(name));
+        if (index >= PokemonByNumber.size())
+        {
+            std::cerr << "Alias '" << name << "' not found\n";
+            return EXIT_FAILURE;
+        }
+        AssertNameToIndex(name, index);
+    }
+    AssertNameToIndex("", PokemonByNumber.size());
+    AssertNameToIndex("IVYSAURR", PokemonByNumber.size());
+    AssertNameToIndex("MR.MIME", PokemonByNumber.size());
+
     if (PoGoCmp::PokemonByIdName("SPINDA_08").number != 0)
     {
         std::cerr << "SPINDA_08 exists but has no name-ID mapping\n";
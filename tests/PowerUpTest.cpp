@@ -0,0 +1,138 @@
+#include "../src/Lib/PowerUp.h"
+#include "../src/Lib/PoGoDb.h"
+#include "../src/Lib/PvpRank.h"
+#include "TestUtils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+double ReferenceObjective(PoGoCmp::UpgradeObjective objective, const PoGoCmp::OwnedPokemon& pkm, PoGoCmp::LevelIndex level)
+{
+    using namespace PoGoCmp;
+    const auto& base = SpecieByIndex(pkm.specie);
+    if (objective == UpgradeObjective::StatProduct)
+        return StatProduct(base, level, pkm.iv);
+    return ComputeCp(base, level, AtkIv(pkm.iv), DefIv(pkm.iv), StaIv(pkm.iv));
+}
+
+//! Exact reference for OptimizeUpgrades(): dynamic programming over the roster with the best gain for each
+//! (candy, stardust) total within the budget.
+double ReferenceMaxGain(
+    const std::vector<PoGoCmp::OwnedPokemon>& roster, PoGoCmp::PowerUpCost budget, PoGoCmp::UpgradeObjective objective,
+    PoGoCmp::LevelIndex maxLevel)
+{
+    using namespace PoGoCmp;
+    std::map<std::pair<int, int>, double> gainByCost{ { { 0, 0 }, 0. } };
+    for (const auto& pkm : roster)
+    {
+        std::map<std::pair<int, int>, double> next;
+        const auto value = ReferenceObjective(objective, pkm, pkm.level);
+        for (const auto& [cost, gain] : gainByCost)
+        {
+            // Starts from the current level, i.e. not powered up.
+            for (size_t level = (size_t)pkm.level; level <= std::max((size_t)pkm.level, (size_t)maxLevel); ++level)
+            {
+                const auto c = PowerUpCostBetween(pkm.level, (LevelIndex)level);
+                const std::pair<int, int> total{ cost.first + c.candy, cost.second + c.stardust };
+                if (total.first > budget.candy || total.second > budget.stardust) break;
+                auto& best = next.emplace(total, -1.).first->second;
+                best = std::max(best, gain + ReferenceObjective(objective, pkm, (LevelIndex)level) - value);
+            }
+        }
+        gainByCost.swap(next);
+    }
+    double maxGain = 0;
+    for (const auto& kvp : gainByCost)
+        maxGain = std::max(maxGain, kvp.second);
+    return maxGain;
+}
+
+int main()
+{
+    using namespace PoGoCmp;
+
+    const auto numLevels = IvSpace::NumLevels();
+    for (size_t from = 0; from < numLevels; ++from)
+    {
+        for (size_t to = from; to < numLevels; ++to)
+        {
+            // The loop of the original powerup command.
+            int candy{}, stardust{};
+            for (float i = IndexToLevel((LevelIndex)from) - 1; i < IndexToLevel((LevelIndex)to) - 1; i += 0.5f)
+            {
+                candy += PokemonUpgrades.candyCost[(size_t)std::floor(i)];
+                stardust += PokemonUpgrades.stardustCost[(size_t)std::floor(i)];
+            }
+            const auto cost = PowerUpCostBetween((LevelIndex)from, (LevelIndex)to);
+            AssertTrue(cost.candy == candy && cost.stardust == stardust,
+                "Cost from " + std::to_string(from) + " to " + std::to_string(to) + " differs.");
+        }
+    }
+    AssertTrue(PowerUpCostBetween(LevelIndex{2}, LevelIndex{1}).candy < 0, "from > to should fail.");
+    AssertTrue(PowerUpCostBetween(LevelIndex{0}, LevelIndex::Invalid).candy < 0, "Invalid level should fail.");
+
+    std::vector<OwnedPokemon> roster;
+    for (size_t i = 0; i < NumSpecies(); i += 7)
+        roster.push_back({ (SpecieIndex)i, LevelIndex(i % 40), ToIvIndex(int(i % 16), 15 - int(i % 16), 10) });
+
+    const auto none = OptimizeUpgrades(roster, { 0, 0 }, UpgradeObjective::Cp);
+    AssertTrue(none.gain == 0 && none.cost.candy == 0 && none.cost.stardust == 0, "Zero budget should yield no upgrades.");
+
+    const auto maxLevel = LevelIndex(numLevels - 1);
+    const auto all = OptimizeUpgrades(roster, { 1 << 30, 1 << 30 }, UpgradeObjective::Cp);
+    for (auto level : all.levels)
+        AssertTrue(level == maxLevel, "Unlimited budget should upgrade everything to max. level.");
+
+    for (auto objective : { UpgradeObjective::Cp, UpgradeObjective::StatProduct })
+    {
+        const PowerUpCost budget{ 2000, 500000 };
+        const auto plan = OptimizeUpgrades(roster, budget, objective, LevelToIndex(35));
+        AssertTrue(plan.cost.candy <= budget.candy && plan.cost.stardust <= budget.stardust, "Plan exceeds the budget.");
+        AssertTrue(plan.gain > 0, "Plan should improve something.");
+        PowerUpCost cost{ 0, 0 };
+        for (size_t i = 0; i < roster.size(); ++i)
+        {
+            AssertTrue(plan.levels[i] >= roster[i].level, "Plan lowers a level.");
+            AssertTrue(plan.levels[i] == roster[i].level || plan.levels[i] <= LevelToIndex(35), "Plan exceeds max. level.");
+            const auto c = PowerUpCostBetween(roster[i].level, plan.levels[i]);
+            cost.candy += c.candy;
+            cost.stardust += c.stardust;
+        }
+        AssertTrue(cost.candy == plan.cost.candy && cost.stardust == plan.cost.stardust, "Plan cost differs.");
+    }
+
+    // Small rosters against the exact optimum. The plan of a single Pokémon is optimal: when the next hull segment
+    // doesn't fit, the highest affordable level is taken instead. For more Pokémon with a budget of a few power-ups
+    // the plan can be well below the optimum, about 2/3 of it at worst on these rosters.
+    uint32_t seed = 12345;
+    auto random = [&seed](uint32_t n) { seed = seed * 1664525u + 1013904223u; return (seed >> 8) % n; };
+    for (int i = 0; i < 2000; ++i)
+    {
+        std::vector<OwnedPokemon> small;
+        const auto size = i % 2 == 0 ? 1 : 4;
+        for (int j = 0; j < size; ++j)
+        {
+            small.push_back({ (SpecieIndex)random((uint32_t)NumSpecies()), LevelIndex(random(40) + 20),
+                ToIvIndex((int)random(16), (int)random(16), (int)random(16)) });
+        }
+        const PowerUpCost budget{ (int)random(60) + 1, (int)random(40000) + 1000 };
+        for (auto objective : { UpgradeObjective::Cp, UpgradeObjective::StatProduct })
+        {
+            const auto plan = OptimizeUpgrades(small, budget, objective, LevelToIndex(40));
+            const auto maxGain = ReferenceMaxGain(small, budget, objective, LevelToIndex(40));
+            AssertTrue(plan.cost.candy <= budget.candy && plan.cost.stardust <= budget.stardust, "Plan exceeds the budget.");
+            AssertTrue(plan.gain <= maxGain * (1 + 1e-9), "Plan exceeds the optimum.");
+            const auto minRatio = size == 1 ? 1 - 1e-9 : 0.6;
+            AssertTrue(plan.gain >= minRatio * maxGain, "Plan too far from the optimum.");
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
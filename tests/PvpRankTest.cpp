@@ -0,0 +1,79 @@
+#include "../src/Lib/PvpRank.h"
+#include "../src/Lib/PoGoDb.h"
+#include "TestUtils.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+int main()
+{
+    using namespace PoGoCmp;
+
+    AssertTrue(LeagueByName("Great") == League::Great, "LeagueByName() failed.");
+    AssertTrue(LeagueByName("foo") == League::NUM_LEAGUES, "LeagueByName() should fail for an invalid name.");
+
+    const auto azumarill = SpecieIndexOf(PokemonByIdName("AZUMARILL"));
+    AssertTrue(azumarill < NumSpecies(), "Azumarill not found.");
+    const auto& base = SpecieByIndex(azumarill);
+    const auto tables = ComputePvpRanks(azumarill);
+    AssertTrue(tables.size() == (size_t)League::NUM_LEAGUES, "Unexpected number of tables.");
+
+    for (auto league : { League::Little, League::Great, League::Ultra, League::Master })
+    {
+        const auto& table = tables[(size_t)league];
+        const auto cap = LeagueCpCap(league);
+        double prevProduct = INFINITY;
+        for (int rank = 1; rank <= (int)NumIvCombinations; ++rank)
+        {
+            const auto iv = table.IvByRank(rank);
+            AssertTrue(table.Rank(iv) == rank, "Rank/IvByRank round-trip failed.");
+            const auto level = table.Level(iv);
+            const auto product = StatProduct(base, level, iv);
+            AssertTrue(product <= prevProduct, "Ranks not ordered by stat product.");
+            prevProduct = product;
+            if (level == LevelIndex::Invalid) continue;
+            AssertTrue(ComputeCp(base, level, AtkIv(iv), DefIv(iv), StaIv(iv)) <= cap, "Best level exceeds the CP cap.");
+            const auto next = LevelIndex((size_t)level + 1);
+            AssertTrue(std::isnan(GetCpm(next)) || ComputeCp(base, next, AtkIv(iv), DefIv(iv), StaIv(iv)) > cap,
+                "Best level is not the highest level within the CP cap.");
+        }
+    }
+    AssertTrue(tables[(size_t)League::Master].IvByRank(1) == ToIvIndex(15, 15, 15), "15/15/15 should rank #1 in Master League.");
+
+    const std::string path{"PvpRankTest.bin"};
+    AssertTrue(WritePvpRankFile(path, 2), "WritePvpRankFile() failed.");
+    PvpRankFile file;
+    AssertTrue(file.Load(path), "PvpRankFile::Load() failed.");
+    {
+        // A file computed from different base stats or CP multipliers is rejected by the hash in the header.
+        PvpRankFile other;
+        std::vector<char> contents;
+        {
+            std::ifstream in(path, std::ios::binary);
+            contents.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        }
+        contents[16] ^= 1;
+        std::ofstream(path, std::ios::binary | std::ios::trunc).write(contents.data(), contents.size());
+        AssertTrue(!other.Load(path), "Loaded a rank file of different game data.");
+    }
+    std::remove(path.c_str());
+    for (auto league : { League::Little, League::Great, League::Ultra, League::Master })
+    {
+        const auto& table = tables[(size_t)league];
+        for (size_t i = 0; i < NumIvCombinations; ++i)
+        {
+            const auto iv = (IvIndex)i;
+            AssertTrue(file.Rank(azumarill, league, iv) == table.Rank(iv), "Rank from the file differs.");
+            AssertTrue(file.Level(azumarill, league, iv) == table.Level(iv), "Level from the file differs.");
+        }
+    }
+    AssertTrue(!file.Load("nonexistent.bin"), "Loading a nonexistent file should fail.");
+
+    return EXIT_SUCCESS;
+}
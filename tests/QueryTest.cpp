@@ -0,0 +1,157 @@
+#include "../src/Lib/Query.h"
+#include "TestUtils.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+int main()
+{
+    using namespace PoGoCmp;
+
+    const auto& columns = PokemonColumns;
+    const auto attack = [](const PokemonSpecie& pkm) -> float { return pkm.baseAtk; };
+
+    AssertTrue(RunQuery({}).size() == NumSpecies(), "The empty query must match all species.");
+
+    AssertTrue(Compare(1, CompareOp::Any, 2) && Compare(1, CompareOp::Less, 2) && !Compare(2, CompareOp::Less, 2) &&
+        Compare(2, CompareOp::LessEqual, 2) && Compare(3, CompareOp::Greater, 2) && Compare(2, CompareOp::GreaterEqual, 2) &&
+        Compare(2, CompareOp::Equal, 2.000001f) && !Compare(2, CompareOp::Equal, 2.1f), "Unexpected comparison.");
+
+    {
+        // Overlapping and empty ranges.
+        SpeciesQuery query;
+        query.ranges = { SpeciesByNumber(1, 151), SpeciesByNumber(100, 200), SpeciesByNumber(0) };
+        const auto result = RunQuery(query);
+        const auto expected = FilterSpecies(SpeciesByNumber(1, 200), [](SpecieIndex) { return true; });
+        AssertTrue(result == expected, "Unexpected result for overlapping ranges.");
+
+        query.ranges = { SpeciesByNumber(0) };
+        AssertTrue(RunQuery(query).empty(), "An empty range must match nothing.");
+    }
+
+    {
+        // All of the criteria at once, compared to filtering in separate passes.
+        SpeciesQuery query;
+        query.ranges = { SpeciesByNumber(1, 386), SpeciesByNumber(479) };
+        query.AddRarity(PokemonRarity::NORMAL);
+        query.AddRarity(PokemonRarity::LEGENDARY);
+        query.AddType(PokemonType::WATER);
+        query.AddType(PokemonType::ELECTRIC);
+        query.AddType(PokemonType::NONE);
+        const auto thunderbolt = MoveIdByName("THUNDERBOLT");
+        const auto hydroPump = MoveIdByName("HYDRO_PUMP");
+        query.moves = { thunderbolt, hydroPump };
+        query.filters = { { attack, CompareOp::GreaterEqual, 150 } };
+
+        auto expected = FilterSpecies(SpeciesByNumber(1, 386), [](SpecieIndex) { return true; });
+        const auto rotoms = SpeciesByNumber(479);
+        for (auto idx = rotoms.first; idx < rotoms.last; ++idx)
+            expected.push_back(idx);
+        FilterSpecies(expected, [&columns](SpecieIndex i)
+        {
+            return columns.rarity[i] == PokemonRarity::NORMAL || columns.rarity[i] == PokemonRarity::LEGENDARY;
+        });
+        FilterSpecies(expected, [&columns](SpecieIndex i)
+        {
+            for (auto type : { PokemonType::WATER, PokemonType::ELECTRIC })
+                if (columns.type[i] == type || columns.type2[i] == type) return true;
+            return false;
+        });
+        FilterSpecies(expected, [&](SpecieIndex i)
+        {
+            const auto learners = LearnersOf(thunderbolt), learners2 = LearnersOf(hydroPump);
+            return std::find(learners.begin(), learners.end(), i) != learners.end() ||
+                std::find(learners2.begin(), learners2.end(), i) != learners2.end();
+        });
+        FilterSpecies(expected, [](SpecieIndex i) { return SpecieByIndex(i).baseAtk >= 150; });
+
+        const auto result = RunQuery(query);
+        AssertTrue(!result.empty() && result == expected, "Unexpected result for the combined query.");
+    }
+
+    {
+        // Invalid moves match nothing.
+        SpeciesQuery query;
+        query.moves = { MoveId::NONE };
+        AssertTrue(RunQuery(query).empty(), "An invalid move must match nothing.");
+    }
+
+    {
+        // Only the first matching form of a stat group is kept, after the other criteria.
+        SpeciesQuery query;
+        query.ranges = { SpeciesByNumber(479) };
+        query.uniqueStats = true;
+        const auto rotoms = RunQuery(query);
+        AssertTrue(rotoms.size() == 2, "Expected Rotom and one of the alternate forms.");
+
+        query.AddType(PokemonType::WATER);
+        const auto washRotoms = RunQuery(query);
+        AssertTrue(washRotoms.size() == 1 && SpecieByIndex(washRotoms.front()).id == "ROTOM_WASH",
+            "The type must be tested before the stat group.");
+
+        query = {};
+        query.uniqueStats = true;
+        const auto unique = RunQuery(query);
+        std::vector<uint16_t> statGroups;
+        for (auto idx : unique)
+            statGroups.push_back(columns.statGroup[idx]);
+        std::sort(statGroups.begin(), statGroups.end());
+        AssertTrue(std::adjacent_find(statGroups.begin(), statGroups.end()) == statGroups.end(),
+            "Duplicate stat group in the results.");
+        AssertTrue(std::is_sorted(unique.begin(), unique.end()), "The results must be in ascending order.");
+    }
+
+    {
+        // Filter expressions, compared to the same criteria in C++.
+        SpeciesFilter filter;
+        AssertTrue(filter.Empty() && filter.Matches(0), "The empty filter must match everything.");
+        AssertTrue(filter.Compile("atk>=200 && (type=fire || TYPE2 = Fire) && rarity!=legendary && cp<2500"),
+            "Failed to compile a valid filter.");
+        const auto thunderbolt = MoveIdByName("THUNDERBOLT");
+        for (size_t i = 0; i < NumSpecies(); ++i)
+        {
+            const auto& pkm = SpecieByIndex((SpecieIndex)i);
+            const bool expected = pkm.baseAtk >= 200 &&
+                (pkm.type == PokemonType::FIRE || pkm.type2 == PokemonType::FIRE) &&
+                pkm.rarity != PokemonRarity::LEGENDARY && pkm.maxCp < 2500;
+            AssertTrue(filter.Matches((SpecieIndex)i) == expected, std::string(pkm.id) + ": unexpected filter result.");
+        }
+
+        AssertTrue(filter.Compile("!(move=thunderbolt) || def > atk && type2 = none"), "Failed to compile a valid filter.");
+        for (size_t i = 0; i < NumSpecies(); ++i)
+        {
+            const auto idx = (SpecieIndex)i;
+            const auto& pkm = SpecieByIndex(idx);
+            const auto learners = LearnersOf(thunderbolt);
+            const bool expected = std::find(learners.begin(), learners.end(), idx) == learners.end() ||
+                (pkm.baseDef > pkm.baseAtk && pkm.type2 == PokemonType::NONE);
+            AssertTrue(filter.Matches(idx) == expected, std::string(pkm.id) + ": unexpected filter result.");
+        }
+
+        SpeciesQuery query;
+        query.expression = filter;
+        query.AddType(PokemonType::ELECTRIC);
+        auto expected = FilterSpecies(AllSpecies(), [&](SpecieIndex i) { return filter.Matches(i); });
+        FilterSpecies(expected, [&columns](SpecieIndex i)
+        {
+            return columns.type[i] == PokemonType::ELECTRIC || columns.type2[i] == PokemonType::ELECTRIC;
+        });
+        AssertTrue(RunQuery(query) == expected, "Unexpected result for a query with a filter expression.");
+
+        std::string error;
+        for (const auto* invalid : { "", "atk", "atk>=", "atk>=200 &&", "(atk>1", "atk>1)", "type<fire", "type=water2",
+            "type=none", "rarity=fire", "move=splash2", "foo=1", "atk>=200 & def>1", "1.2.3>atk", "atk=#" })
+        {
+            error.clear();
+            AssertTrue(!filter.Compile(invalid, &error) && filter.Empty() && !error.empty(),
+                std::string("Compiled an invalid filter: ") + invalid);
+        }
+        AssertTrue(!filter.Compile(std::string(1000, '(') + "atk>1" + std::string(1000, ')')),
+            "Compiled a too deeply nested filter.");
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,38 @@
+#include "../src/Lib/RaidCp.h"
+#include "../src/Lib/PoGoDb.h"
+#include "TestUtils.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+int main()
+{
+    using namespace PoGoCmp;
+
+    AssertTrue(NumRaidTiers() == RaidLevels.size(), "Unexpected number of raid tiers.");
+    AssertTrue(RaidBossCp(0, 0) < 0 && RaidBossCp(0, NumRaidTiers() + 1) < 0, "Invalid tier should yield -1.");
+
+    const auto minIv = WeatherBonus.raidEncounterGuaranteedIndividualValues;
+    const auto boostedLevel = RaidEncounterLevel + WeatherBonus.raidEncounterCpBaseLevelBonus;
+    for (size_t i = 0; i < NumSpecies(); ++i)
+    {
+        const auto idx = (SpecieIndex)i;
+        const auto& pkm = SpecieByIndex(idx);
+        for (size_t tier = 1; tier <= NumRaidTiers(); ++tier)
+            AssertTrue(RaidBossCp(idx, tier) == ComputeRaidBossCp(pkm, RaidLevels[tier - 1]), std::string(pkm.id) + ": boss CP differs.");
+
+        const auto normal = RaidCatchCp(idx, false);
+        AssertTrue(normal.min == ComputeCp(pkm, RaidEncounterLevel, minIv, minIv, minIv), std::string(pkm.id) + ": min. catch CP differs.");
+        AssertTrue(normal.max == ComputeCp(pkm, RaidEncounterLevel, 15, 15, 15), std::string(pkm.id) + ": max. catch CP differs.");
+        const auto boosted = RaidCatchCp(idx, true);
+        AssertTrue(boosted.min == ComputeCp(pkm, boostedLevel, minIv, minIv, minIv), std::string(pkm.id) + ": min. boosted CP differs.");
+        AssertTrue(boosted.max == ComputeCp(pkm, boostedLevel, 15, 15, 15), std::string(pkm.id) + ": max. boosted CP differs.");
+    }
+
+    const auto mewtwo = SpecieIndexOf(PokemonByIdName("MEWTWO"));
+    AssertTrue(RaidCatchCp(mewtwo, false).max == 2387, "Unexpected max. catch CP for Mewtwo.");
+    AssertTrue(RaidCatchCp(mewtwo, true).max == 2984, "Unexpected max. boosted catch CP for Mewtwo.");
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,78 @@
+#include "../src/Lib/PoGoCmp.h"
+#include "../src/Lib/PoGoDb.h"
+#include "TestUtils.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+int main()
+{
+    using namespace PoGoCmp;
+
+    const auto& columns = PokemonColumns;
+    AssertTrue(columns.number.size() == NumSpecies(), "Unexpected number of rows.");
+    AssertTrue(AllSpecies().first == 0 && AllSpecies().Size() == NumSpecies(), "Unexpected range for all species.");
+
+    for (size_t i = 0; i < NumSpecies(); ++i)
+    {
+        const auto idx = (SpecieIndex)i;
+        const auto& pkm = SpecieByIndex(idx);
+        AssertTrue(columns.number[i] == pkm.number && columns.baseAtk[i] == pkm.baseAtk &&
+            columns.baseDef[i] == pkm.baseDef && columns.baseSta[i] == pkm.baseSta &&
+            columns.type[i] == pkm.type && columns.type2[i] == pkm.type2 && columns.rarity[i] == pkm.rarity &&
+            columns.buddyDistance[i] == pkm.buddyDistance, std::string(pkm.id) + ": columns differ.");
+
+        const auto forms = SpeciesByNumber(pkm.number);
+        AssertTrue(forms.first <= idx && idx < forms.last, std::string(pkm.id) + ": not within the forms of its number.");
+        AssertTrue(forms.Size() == PokemonByNumber.count(pkm.number), std::string(pkm.id) + ": unexpected number of forms.");
+        AssertTrue(SpecieIndexOf(pkm) == idx, std::string(pkm.id) + ": SpecieIndexOf() mismatch.");
+
+        // The stat group is the first form with the same stats.
+        const auto statGroup = columns.statGroup[i];
+        AssertTrue(forms.first <= statGroup && statGroup <= idx, std::string(pkm.id) + ": stat group out of the forms.");
+        for (auto form = forms.first; form < forms.last; ++form)
+        {
+            const bool sameStats = columns.baseAtk[form] == pkm.baseAtk && columns.baseDef[form] == pkm.baseDef &&
+                columns.baseSta[form] == pkm.baseSta;
+            AssertTrue(sameStats == (columns.statGroup[form] == statGroup), std::string(pkm.id) + ": unexpected stat group.");
+            AssertTrue(!sameStats || form >= statGroup, std::string(pkm.id) + ": stat group not the first form.");
+        }
+        const bool allFormsSameStats = forms.Size() > 1 && std::all_of(
+            columns.statGroup.begin() + forms.first, columns.statGroup.begin() + forms.last,
+            [statGroup](auto group) { return group == statGroup; });
+        const auto baseId = columns.baseId[i];
+        AssertTrue(allFormsSameStats == (baseId != NoBaseId), std::string(pkm.id) + ": unexpected base ID.");
+        AssertTrue(baseId == NoBaseId || FormIdToBaseId(std::string(pkm.id)) == PokemonBaseIds[baseId],
+            std::string(pkm.id) + ": base ID differs from FormIdToBaseId().");
+    }
+    AssertTrue(PokemonBaseIds[columns.baseId[SpecieIndexByName("UNOWN_A")]] == "UNOWN", "Unexpected base ID for Unown.");
+    AssertTrue(columns.baseId[SpecieIndexByName("ROTOM_WASH")] == NoBaseId, "Rotom forms have different stats.");
+    AssertTrue(columns.statGroup[SpecieIndexByName("ROTOM_WASH")] == columns.statGroup[SpecieIndexByName("ROTOM_FAN")],
+        "Rotom Wash and Rotom Fan have the same stats.");
+
+    AssertTrue(SpeciesByNumber(0).Empty(), "There is no Pokédex number 0.");
+    AssertTrue(SpeciesByNumber(UINT16_MAX).Empty(), "Out-of-range number should yield an empty range.");
+    AssertTrue(SpeciesByNumber(2, 1).Empty(), "Reversed range should be empty.");
+    const auto gen1 = SpeciesByNumber(1, 151);
+    AssertTrue(gen1.first == 0 && gen1.last == SpeciesByNumber(152).first, "Unexpected range for gen 1.");
+
+    const auto dragons = FilterSpecies(AllSpecies(), [&columns](SpecieIndex i)
+    {
+        return columns.type[i] == PokemonType::DRAGON || columns.type2[i] == PokemonType::DRAGON;
+    });
+    auto numDragons = 0u;
+    for (const auto& kvp : PokemonByNumber)
+        if (kvp.second.type == PokemonType::DRAGON || kvp.second.type2 == PokemonType::DRAGON)
+            ++numDragons;
+    AssertTrue(dragons.size() == numDragons, "Unexpected number of dragons.");
+
+    auto legendaryDragons = dragons;
+    FilterSpecies(legendaryDragons, [&columns](SpecieIndex i) { return columns.rarity[i] == PokemonRarity::LEGENDARY; });
+    AssertTrue(!legendaryDragons.empty() && legendaryDragons.size() < dragons.size(), "Unexpected in-place filtering.");
+    AssertTrue(std::is_sorted(legendaryDragons.begin(), legendaryDragons.end()), "Filtering didn't preserve the order.");
+
+    return EXIT_SUCCESS;
+}
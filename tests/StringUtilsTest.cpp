@@ -1,14 +1,9 @@
 #include "../src/Lib/StringUtils.h"
 #include "../src/Lib/MathUtils.h"
+#include "TestUtils.h"
 
 #include <iostream>
 
-#define AssertTrue(exp, msg) \
-if (!(exp)) { std::cerr << (msg) << '\n'; return EXIT_FAILURE; }
-
-#define AssertFalse(exp, msg) \
-if ((exp)) { std::cerr << (msg) << '\n'; return EXIT_FAILURE; }
-
 int main()
 {
     using namespace StringUtils;
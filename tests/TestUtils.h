@@ -0,0 +1,14 @@
+/**
+    @file TestUtils.h
+    @brief Assertions shared by the tests. A failed assertion prints the message and returns EXIT_FAILURE from
+    the enclosing function, so use them only in main() or in functions returning int. */
+#pragma once
+
+#include <cstdlib>
+#include <iostream>
+
+#define AssertTrue(exp, msg) \
+if (!(exp)) { std::cerr << (msg) << '\n'; return EXIT_FAILURE; }
+
+#define AssertFalse(exp, msg) \
+if ((exp)) { std::cerr << (msg) << '\n'; return EXIT_FAILURE; }